@@ -51,6 +51,47 @@ static double measure_throughput(const char *label,
   return mib_per_sec;
 }
 
+static void bench_hex_byte_loop(const uint8_t *data, size_t len,
+                                size_t iters) {
+  std::vector<char> out(2 * len + 1);
+  for (size_t i = 0; i < iters; ++i) {
+    for (size_t b = 0; b < len; ++b)
+      std::snprintf(&out[2 * b], 3, "%02x", data[b]);
+  }
+}
+
+static void bench_hex_encode(const uint8_t *data, size_t len, size_t iters) {
+  std::vector<char> out(2 * len + 1);
+  for (size_t i = 0; i < iters; ++i)
+    tinyblake_hex_encode(out.data(), out.size(), data, len, 0);
+}
+
+static void bench_hex_encode_ct(const uint8_t *data, size_t len,
+                                size_t iters) {
+  std::vector<char> out(2 * len + 1);
+  for (size_t i = 0; i < iters; ++i)
+    tinyblake_hex_encode(out.data(), out.size(), data, len,
+                         TINYBLAKE_ENCODE_CONSTANT_TIME);
+}
+
+static void bench_base64url_encode(const uint8_t *data, size_t len,
+                                   size_t iters) {
+  std::vector<char> out(tinyblake_base64url_encoded_len(len) + 1);
+  for (size_t i = 0; i < iters; ++i)
+    tinyblake_base64url_encode(out.data(), out.size(), data, len, 0);
+}
+
+static void bench_base64url_decode(const uint8_t *data, size_t len,
+                                   size_t iters) {
+  std::vector<char> text(tinyblake_base64url_encoded_len(len) + 1);
+  tinyblake_base64url_encode(text.data(), text.size(), data, len, 0);
+  std::vector<uint8_t> out(len);
+  size_t n = 0;
+  for (size_t i = 0; i < iters; ++i)
+    tinyblake_base64url_decode(out.data(), out.size(), &n, text.data(),
+                               text.size() - 1, TINYBLAKE_ENCODE_CONSTANT_TIME);
+}
+
 static void bench_blake2b_512(const uint8_t *data, size_t len, size_t iters) {
   uint8_t out[64];
   for (size_t i = 0; i < iters; ++i) {
@@ -74,6 +115,31 @@ static void bench_blake2b_keyed(const uint8_t *data, size_t len, size_t iters) {
   }
 }
 
+static void bench_blake2s_256(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[32];
+  for (size_t i = 0; i < iters; ++i) {
+    tinyblake_blake2s(out, 32, data, len, nullptr, 0);
+  }
+}
+
+static void bench_blake3(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[32];
+  for (size_t i = 0; i < iters; ++i) {
+    tinyblake_blake3(out, 32, data, len, nullptr);
+  }
+}
+
+static void bench_blake3_parallel(const uint8_t *data, size_t len,
+                                  size_t iters) {
+  uint8_t out[32];
+  for (size_t i = 0; i < iters; ++i) {
+    tinyblake_blake3_state S;
+    tinyblake_blake3_init(&S);
+    tinyblake_blake3_update_parallel(&S, data, len, 0);
+    tinyblake_blake3_final(&S, out, 32);
+  }
+}
+
 static void bench_hmac(const uint8_t *data, size_t len, size_t iters) {
   uint8_t key[32];
   std::memset(key, 0x42, 32);
@@ -83,6 +149,13 @@ static void bench_hmac(const uint8_t *data, size_t len, size_t iters) {
   }
 }
 
+static void bench_blake2xb_2k(const uint8_t *data, size_t len, size_t iters) {
+  static uint8_t out[2048];
+  for (size_t i = 0; i < iters; ++i) {
+    tinyblake_blake2xb(out, sizeof(out), data, len, nullptr, 0);
+  }
+}
+
 static void measure_pbkdf2(const char *label, uint32_t rounds,
                            size_t iterations) {
   uint8_t out[64];
@@ -100,6 +173,275 @@ static void measure_pbkdf2(const char *label, uint32_t rounds,
               iterations, rounds, calls_per_sec, secs);
 }
 
+static void measure_balloon(const char *label, uint64_t s_cost,
+                            uint64_t t_cost, uint32_t p_cost,
+                            size_t iterations) {
+  uint8_t out[64];
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    if (p_cost == 0)
+      tinyblake_balloon(out, "password", 8, "salt", 4, s_cost, t_cost);
+    else
+      tinyblake_balloon_m(out, "password", 8, "salt", 4, s_cost, t_cost,
+                          p_cost, 0);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double mib = static_cast<double>(s_cost) * 64.0 / (1024.0 * 1024.0);
+
+  std::printf("%-30s %6.1f MiB  t=%-3llu  %10.2f ms/call\n", label, mib,
+              static_cast<unsigned long long>(t_cost),
+              secs * 1000.0 / static_cast<double>(iterations));
+}
+
+static void measure_lthash(const char *label, size_t elem_len, size_t batch,
+                           size_t iterations) {
+  std::vector<std::vector<uint8_t>> elems(batch,
+                                          std::vector<uint8_t>(elem_len, 0xCD));
+  std::vector<const void *> ptrs(batch);
+  std::vector<size_t> lens(batch, elem_len);
+  for (size_t i = 0; i < batch; ++i) {
+    elems[i][0] = static_cast<uint8_t>(i);
+    ptrs[i] = elems[i].data();
+  }
+
+  tinyblake_lthash16 h;
+  tinyblake_lthash16_init(&h);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    if (batch == 1)
+      tinyblake_lthash16_add(&h, ptrs[0], elem_len);
+    else
+      tinyblake_lthash16_add_many(&h, ptrs.data(), lens.data(), batch);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double updates_per_sec = static_cast<double>(iterations * batch) / secs;
+
+  std::printf("%-30s %6zu updates  %10.1f updates/s  (%.4f s)\n", label,
+              iterations * batch, updates_per_sec, secs);
+}
+
+static void measure_blake2s_many(const char *label, size_t msg_len,
+                                 bool batched, size_t n, size_t iterations) {
+  std::vector<uint8_t> data(n * msg_len, 0x5A);
+  std::vector<const void *> ptrs(n);
+  std::vector<size_t> lens(n, msg_len);
+  for (size_t i = 0; i < n; ++i)
+    ptrs[i] = data.data() + i * msg_len;
+  std::vector<uint8_t> out(n * 32);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t it = 0; it < iterations; ++it) {
+    if (batched) {
+      tinyblake_blake2s_hash_many(out.data(), 32, ptrs.data(), lens.data(), n,
+                                  nullptr, 0);
+    } else {
+      for (size_t i = 0; i < n; ++i)
+        tinyblake_blake2s(out.data() + i * 32, 32, ptrs[i], msg_len, nullptr,
+                          0);
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double total_bytes = static_cast<double>(iterations * n * msg_len);
+  double mib_per_sec = (total_bytes / (1024.0 * 1024.0)) / secs;
+
+  std::printf("%-30s %6zu msgs  %8.2f MiB/s  (%.4f s)\n", label,
+              iterations * n, mib_per_sec, secs);
+}
+
+static void measure_tuples(const char *label, size_t field_len, bool batched,
+                           size_t nrecords, size_t iterations) {
+  const size_t nfields = 3;
+  std::vector<uint8_t> blob(field_len, 0xEF);
+  std::vector<uint8_t> ids(nrecords * 8, 0);
+  std::vector<tinyblake_blake2b_tuple_field> fields(nrecords * nfields);
+  for (size_t r = 0; r < nrecords; ++r) {
+    ids[r * 8] = static_cast<uint8_t>(r);
+    fields[r * nfields + 0] = {&ids[r * 8], 8, TINYBLAKE_TUPLE_U64};
+    fields[r * nfields + 1] = {blob.data(), blob.size(), TINYBLAKE_TUPLE_BYTES};
+    fields[r * nfields + 2] = {"name", 4, TINYBLAKE_TUPLE_STRING};
+  }
+  std::vector<uint8_t> out(nrecords * 32);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    if (batched) {
+      tinyblake_blake2b_tuple_hash_many(out.data(), 32, fields.data(), nfields,
+                                        nrecords, nullptr, 0);
+    } else {
+      for (size_t r = 0; r < nrecords; ++r) {
+        tinyblake_blake2b_state S;
+        tinyblake_blake2b_tuple_init(&S, 32, nullptr, 0);
+        for (size_t f = 0; f < nfields; ++f) {
+          const tinyblake_blake2b_tuple_field &fd = fields[r * nfields + f];
+          tinyblake_blake2b_tuple_add(&S, fd.tag, fd.data, fd.len);
+        }
+        tinyblake_blake2b_final(&S, out.data() + r * 32, 32);
+      }
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double records_per_sec = static_cast<double>(iterations * nrecords) / secs;
+
+  std::printf("%-30s %6zu records  %10.1f records/s  (%.4f s)\n", label,
+              iterations * nrecords, records_per_sec, secs);
+}
+
+/* Verify one HMAC tag against nkeys candidate keys (key rotation); the tag
+ * matches the last key, so the per-key loop cannot stop early either */
+static void measure_hmac_multi(const char *label, size_t msg_len, size_t nkeys,
+                               bool fused, size_t iterations) {
+  std::vector<uint8_t> msg(msg_len, 0x5A);
+  std::vector<std::vector<uint8_t>> keys(nkeys);
+  std::vector<tinyblake_hmac_key_ctx> ctxs(nkeys);
+  for (size_t k = 0; k < nkeys; ++k) {
+    keys[k].assign(32, static_cast<uint8_t>(k + 1));
+    tinyblake_hmac_key_ctx_init(&ctxs[k], keys[k].data(), 32);
+  }
+  uint8_t tag[64], mac[64];
+  tinyblake_hmac(tag, 64, keys[nkeys - 1].data(), 32, msg.data(), msg_len);
+
+  size_t hits = 0;
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    if (fused) {
+      size_t matched;
+      hits += tinyblake_hmac_multi_verify(msg.data(), msg_len, ctxs.data(),
+                                          nkeys, tag, 64, &matched) == 0;
+    } else {
+      for (size_t k = 0; k < nkeys; ++k) {
+        tinyblake_hmac(mac, 64, keys[k].data(), 32, msg.data(), msg_len);
+        hits += static_cast<size_t>(tinyblake_constant_time_eq(mac, tag, 64));
+      }
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double per_sec = static_cast<double>(iterations) / secs;
+
+  std::printf("%-30s %6zu verifies  %10.1f verifies/s  (%.4f s)%s\n", label,
+              iterations, per_sec, secs, hits == iterations ? "" : " MISMATCH");
+}
+
+static void measure_chain(const char *label, bool fused, size_t outlen,
+                          uint64_t steps) {
+  uint8_t d[64] = {};
+
+  auto start = std::chrono::high_resolution_clock::now();
+  if (fused) {
+    tinyblake_blake2b_iterate(d, outlen, d, outlen, steps);
+  } else {
+    for (uint64_t i = 0; i < steps; ++i) {
+      tinyblake_blake2b(d, outlen, d, outlen, nullptr, 0);
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double steps_per_sec = static_cast<double>(steps) / secs;
+
+  std::printf("%-30s %8llu steps  %10.1f steps/s  (%.4f s)\n", label,
+              static_cast<unsigned long long>(steps), steps_per_sec, secs);
+}
+
+static void measure_chain_verify(uint64_t segments, uint64_t interval) {
+  const size_t outlen = 32;
+  std::vector<uint8_t> cps(segments * outlen);
+  uint8_t tip[32];
+
+  auto start = std::chrono::high_resolution_clock::now();
+  tinyblake_blake2b_iterate_checkpoints(tip, outlen, "seed", 4,
+                                        segments * interval, interval,
+                                        cps.data(), cps.size());
+  auto mid = std::chrono::high_resolution_clock::now();
+  size_t first_bad = 0;
+  tinyblake_blake2b_chain_verify("seed", 4, cps.data(), segments, outlen,
+                                 interval, 0, &first_bad);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double gen = std::chrono::duration<double>(mid - start).count();
+  double ver = std::chrono::duration<double>(end - mid).count();
+  char label[64];
+  std::snprintf(label, sizeof(label), "Chain verify %llu x %llu",
+                static_cast<unsigned long long>(segments),
+                static_cast<unsigned long long>(interval));
+  std::printf("%-30s generate %.4f s  verify %.4f s  (%.1fx)\n", label, gen,
+              ver, gen / ver);
+}
+
+static void measure_pow(const char *label, size_t headerlen, bool midstate,
+                        uint64_t tries) {
+  std::vector<uint8_t> msg(headerlen + 8, 0xA5);
+  uint8_t target[32] = {}; /* unreachable: every try runs to completion */
+  uint8_t d[32];
+  uint64_t nonce = 0;
+
+  auto start = std::chrono::high_resolution_clock::now();
+  if (midstate) {
+    tinyblake_pow_search(msg.data(), headerlen, 32, target, 0, tries, 0,
+                         &nonce, nullptr);
+  } else {
+    for (uint64_t n = 0; n < tries; ++n) {
+      std::memcpy(msg.data() + headerlen, &n, 8);
+      tinyblake_blake2b(d, 32, msg.data(), msg.size(), nullptr, 0);
+      if (std::memcmp(d, target, 32) <= 0)
+        break;
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double tries_per_sec = static_cast<double>(tries) / secs;
+
+  std::printf("%-30s %8llu tries  %10.1f tries/s  (%.4f s)\n", label,
+              static_cast<unsigned long long>(tries), tries_per_sec, secs);
+}
+
+static void measure_wots(const char *label, bool engine, size_t keys) {
+  const size_t n = 67; /* WOTS+ chains for n = 32, w = 16 */
+  std::vector<uint8_t> values(n * 32, 0x42), addrs(n * 16, 0);
+  std::vector<uint32_t> steps(n, 15);
+  uint8_t seed[16] = {};
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t k = 0; k < keys; ++k) {
+    if (engine) {
+      tinyblake_wots_chains(values.data(), values.data(), addrs.data(),
+                            nullptr, steps.data(), n, seed);
+      continue;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      for (uint32_t j = 0; j < 15; ++j) {
+        uint8_t param[64] = {32, 0, 1, 1};
+        std::memcpy(param + 32, &addrs[i * 16], 12);
+        std::memcpy(param + 44, &j, 4);
+        std::memcpy(param + 48, seed, 16);
+        tinyblake_blake2b_state S;
+        tinyblake_blake2b_init_param(&S, param);
+        tinyblake_blake2b_update(&S, &values[i * 32], 32);
+        tinyblake_blake2b_final(&S, &values[i * 32], 32);
+      }
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double keys_per_sec = static_cast<double>(keys) / secs;
+
+  std::printf("%-30s %6zu keys  %10.1f keys/s  (%.4f s)\n", label, keys,
+              keys_per_sec, secs);
+}
+
 int main() {
   std::printf("=== TinyBLAKE Benchmarks ===\n\n");
 
@@ -120,15 +462,84 @@ int main() {
   measure_throughput("BLAKE2b-keyed  1KiB", bench_blake2b_keyed, 1024, 50000);
   measure_throughput("BLAKE2b-keyed  64KiB", bench_blake2b_keyed, 65536, 2000);
 
+  std::printf("\n--- BLAKE2s-256 ---\n");
+  measure_throughput("BLAKE2s-256  64B", bench_blake2s_256, 64, 100000);
+  measure_throughput("BLAKE2s-256  1KiB", bench_blake2s_256, 1024, 50000);
+  measure_throughput("BLAKE2s-256  64KiB", bench_blake2s_256, 65536, 2000);
+  measure_blake2s_many("BLAKE2s loop      1KiB x64", 1024, false, 64, 500);
+  measure_blake2s_many("BLAKE2s hash_many 1KiB x64", 1024, true, 64, 500);
+
+  std::printf("\n--- BLAKE3 ---\n");
+  measure_throughput("BLAKE3  64B", bench_blake3, 64, 100000);
+  measure_throughput("BLAKE3  1KiB", bench_blake3, 1024, 50000);
+  measure_throughput("BLAKE3  64KiB", bench_blake3, 65536, 5000);
+  measure_throughput("BLAKE3  1MiB", bench_blake3, 1048576, 300);
+  measure_throughput("BLAKE3 parallel  16MiB", bench_blake3_parallel,
+                     16777216, 20);
+
   std::printf("\n--- HMAC-BLAKE2b-512 ---\n");
   measure_throughput("HMAC  64B", bench_hmac, 64, 50000);
   measure_throughput("HMAC  1KiB", bench_hmac, 1024, 20000);
   measure_throughput("HMAC  64KiB", bench_hmac, 65536, 1000);
 
+  std::printf("\n--- Multi-key verification (HMAC, 4 candidate keys) ---\n");
+  measure_hmac_multi("HMAC per-key loop  64B", 64, 4, false, 50000);
+  measure_hmac_multi("HMAC multi_verify  64B", 64, 4, true, 50000);
+  measure_hmac_multi("HMAC per-key loop  1KiB", 1024, 4, false, 10000);
+  measure_hmac_multi("HMAC multi_verify  1KiB", 1024, 4, true, 10000);
+
   std::printf("\n--- PBKDF2-HMAC-BLAKE2b-512 ---\n");
   measure_pbkdf2("PBKDF2 c=1", 1, 50000);
   measure_pbkdf2("PBKDF2 c=1000", 1000, 50);
 
+  std::printf("\n--- Balloon-BLAKE2b ---\n");
+  measure_balloon("Balloon  s=16K", 16384, 3, 0, 5);
+  measure_balloon("Balloon  s=256K", 262144, 1, 0, 1);
+  measure_balloon("Balloon-M p=4  s=16K", 16384, 3, 4, 2);
+
+  std::printf("\n--- BLAKE2Xb (2 KiB output) ---\n");
+  measure_throughput("BLAKE2Xb-2K  64B", bench_blake2xb_2k, 64, 20000);
+
+  std::printf("\n--- Hash chains (H^n) ---\n");
+  measure_chain("Chain API loop  32B", false, 32, 500000);
+  measure_chain("Chain iterate   32B", true, 32, 500000);
+  measure_chain("Chain API loop  64B", false, 64, 500000);
+  measure_chain("Chain iterate   64B", true, 64, 500000);
+  measure_chain_verify(64, 20000);
+
+  std::printf("\n--- WOTS+ key generation (67 chains x 15 steps) ---\n");
+  measure_wots("WOTS keygen per-step API", false, 2000);
+  measure_wots("WOTS keygen chain engine", true, 2000);
+
+  std::printf("\n--- Proof-of-work nonce search ---\n");
+  measure_pow("PoW rehash     80B header", 80, false, 1000000);
+  measure_pow("PoW midstate   80B header", 80, true, 1000000);
+  measure_pow("PoW rehash     1KiB header", 1024, false, 200000);
+  measure_pow("PoW midstate   1KiB header", 1024, true, 200000);
+
+  std::printf("\n--- Tuple hashing (3 fields, 32-byte digest) ---\n");
+  measure_tuples("Tuple single   64B", 64, false, 64, 2000);
+  measure_tuples("Tuple batched  64B", 64, true, 64, 2000);
+  measure_tuples("Tuple single  512B", 512, false, 64, 500);
+  measure_tuples("Tuple batched 512B", 512, true, 64, 500);
+
+  std::printf("\n--- LtHash16 (BLAKE2Xb expansion) ---\n");
+  measure_lthash("LtHash16 add  64B", 64, 1, 20000);
+  measure_lthash("LtHash16 add_many 64B x64", 64, 64, 500);
+  measure_lthash("LtHash16 add_many 1KiB x64", 1024, 64, 200);
+
+  std::printf("\n--- Digest encoding ---\n");
+  measure_throughput("hex snprintf loop  64B", bench_hex_byte_loop, 64, 100000);
+  measure_throughput("hex encode  64B", bench_hex_encode, 64, 1000000);
+  measure_throughput("hex encode CT  64B", bench_hex_encode_ct, 64, 1000000);
+  measure_throughput("hex encode  4KiB", bench_hex_encode, 4096, 50000);
+  measure_throughput("base64url encode  64B", bench_base64url_encode, 64,
+                     1000000);
+  measure_throughput("base64url encode  4KiB", bench_base64url_encode, 4096,
+                     50000);
+  measure_throughput("base64url decode CT  4KiB", bench_base64url_decode, 4096,
+                     50000);
+
   std::printf("\nDone.\n");
   return 0;
 }
\ No newline at end of file
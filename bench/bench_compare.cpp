@@ -0,0 +1,457 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * TinyBLAKE against OpenSSL's BLAKE2b-512 and libsodium's generichash.
+ *
+ * Each library found at configure time runs the same size sweep, keyed
+ * hashes, HMAC-BLAKE2b-512 and PBKDF2-HMAC-BLAKE2b-512, reported in the
+ * main benchmark's format. Every implementation is checked against
+ * TinyBLAKE's output before it is timed. All digests are 64 bytes, the only
+ * length EVP_blake2b512 produces.
+ *
+ * OpenSSL runs through pre-fetched EVP objects, so lookups are not timed.
+ * Keyed BLAKE2b uses the BLAKE2BMAC EVP_MAC, which needs OpenSSL 3.0.
+ * libsodium has no HMAC or PBKDF2 over BLAKE2b, so they are built here on
+ * crypto_generichash, with the padded-key states computed once per key the
+ * way TinyBLAKE's are.
+ */
+
+#include <tinyblake.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(TINYBLAKE_BENCH_OPENSSL)
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/opensslv.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#define TINYBLAKE_BENCH_OPENSSL_MAC 1
+#endif
+#endif
+
+#if defined(TINYBLAKE_BENCH_SODIUM)
+#include <sodium.h>
+#endif
+
+namespace {
+
+constexpr size_t DIGEST = 64;
+
+/* One library's entry points. keyed may be null when unsupported. */
+struct impl {
+  const char *name;
+  bool (*hash)(uint8_t out[DIGEST], const uint8_t *in, size_t inlen);
+  bool (*keyed)(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+                const uint8_t *in, size_t inlen);
+  bool (*hmac)(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+               const uint8_t *in, size_t inlen);
+  bool (*pbkdf2)(uint8_t out[DIGEST], const char *pass, size_t passlen,
+                 const uint8_t *salt, size_t saltlen, uint32_t rounds);
+};
+
+const impl *g_impl = nullptr;
+
+/* ─── TinyBLAKE ─── */
+
+bool tb_hash(uint8_t out[DIGEST], const uint8_t *in, size_t inlen) {
+  return tinyblake_blake2b(out, DIGEST, in, inlen, nullptr, 0) == 0;
+}
+
+bool tb_keyed(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+              const uint8_t *in, size_t inlen) {
+  return tinyblake_blake2b(out, DIGEST, in, inlen, key, keylen) == 0;
+}
+
+bool tb_hmac(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+             const uint8_t *in, size_t inlen) {
+  return tinyblake_hmac(out, DIGEST, key, keylen, in, inlen) == 0;
+}
+
+bool tb_pbkdf2(uint8_t out[DIGEST], const char *pass, size_t passlen,
+               const uint8_t *salt, size_t saltlen, uint32_t rounds) {
+  return tinyblake_pbkdf2(out, DIGEST, pass, passlen, salt, saltlen,
+                          rounds) == 0;
+}
+
+const impl TINYBLAKE_IMPL = {"tinyblake", tb_hash, tb_keyed, tb_hmac,
+                             tb_pbkdf2};
+
+/* ─── OpenSSL ─── */
+
+#if defined(TINYBLAKE_BENCH_OPENSSL)
+
+struct openssl_objects {
+  const EVP_MD *md = nullptr;
+  EVP_MD_CTX *md_ctx = nullptr;
+#if defined(TINYBLAKE_BENCH_OPENSSL_MAC)
+  EVP_MAC_CTX *keyed_ctx = nullptr;
+  EVP_MAC_CTX *hmac_ctx = nullptr;
+#endif
+};
+
+openssl_objects g_ossl;
+
+bool openssl_setup() {
+#if defined(TINYBLAKE_BENCH_OPENSSL_MAC)
+  g_ossl.md = EVP_MD_fetch(nullptr, "BLAKE2B-512", nullptr);
+  EVP_MAC *blake2bmac = EVP_MAC_fetch(nullptr, "BLAKE2BMAC", nullptr);
+  EVP_MAC *hmac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
+  if (blake2bmac)
+    g_ossl.keyed_ctx = EVP_MAC_CTX_new(blake2bmac);
+  if (hmac) {
+    g_ossl.hmac_ctx = EVP_MAC_CTX_new(hmac);
+    char digest[] = "BLAKE2B-512";
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+        OSSL_PARAM_construct_end()};
+    if (g_ossl.hmac_ctx && !EVP_MAC_CTX_set_params(g_ossl.hmac_ctx, params)) {
+      EVP_MAC_CTX_free(g_ossl.hmac_ctx);
+      g_ossl.hmac_ctx = nullptr;
+    }
+  }
+  EVP_MAC_free(blake2bmac);
+  EVP_MAC_free(hmac);
+#else
+  g_ossl.md = EVP_blake2b512();
+#endif
+  g_ossl.md_ctx = EVP_MD_CTX_new();
+  return g_ossl.md && g_ossl.md_ctx;
+}
+
+bool ossl_hash(uint8_t out[DIGEST], const uint8_t *in, size_t inlen) {
+  unsigned int n = 0;
+  return EVP_DigestInit_ex(g_ossl.md_ctx, g_ossl.md, nullptr) == 1 &&
+         EVP_DigestUpdate(g_ossl.md_ctx, in, inlen) == 1 &&
+         EVP_DigestFinal_ex(g_ossl.md_ctx, out, &n) == 1 && n == DIGEST;
+}
+
+#if defined(TINYBLAKE_BENCH_OPENSSL_MAC)
+bool ossl_mac(EVP_MAC_CTX *ctx, uint8_t out[DIGEST], const uint8_t *key,
+              size_t keylen, const uint8_t *in, size_t inlen) {
+  size_t n = 0;
+  return ctx && EVP_MAC_init(ctx, key, keylen, nullptr) == 1 &&
+         EVP_MAC_update(ctx, in, inlen) == 1 &&
+         EVP_MAC_final(ctx, out, &n, DIGEST) == 1 && n == DIGEST;
+}
+
+bool ossl_keyed(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+                const uint8_t *in, size_t inlen) {
+  return ossl_mac(g_ossl.keyed_ctx, out, key, keylen, in, inlen);
+}
+
+bool ossl_hmac(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+               const uint8_t *in, size_t inlen) {
+  return ossl_mac(g_ossl.hmac_ctx, out, key, keylen, in, inlen);
+}
+#else
+bool ossl_hmac(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+               const uint8_t *in, size_t inlen) {
+  unsigned int n = 0;
+  return HMAC(g_ossl.md, key, static_cast<int>(keylen), in, inlen, out,
+              &n) != nullptr &&
+         n == DIGEST;
+}
+#endif
+
+bool ossl_pbkdf2(uint8_t out[DIGEST], const char *pass, size_t passlen,
+                 const uint8_t *salt, size_t saltlen, uint32_t rounds) {
+  return PKCS5_PBKDF2_HMAC(pass, static_cast<int>(passlen), salt,
+                           static_cast<int>(saltlen),
+                           static_cast<int>(rounds), g_ossl.md,
+                           static_cast<int>(DIGEST), out) == 1;
+}
+
+const impl OPENSSL_IMPL = {
+    "openssl", ossl_hash,
+#if defined(TINYBLAKE_BENCH_OPENSSL_MAC)
+    ossl_keyed,
+#else
+    nullptr,
+#endif
+    ossl_hmac, ossl_pbkdf2};
+
+#endif /* TINYBLAKE_BENCH_OPENSSL */
+
+/* ─── libsodium ─── */
+
+#if defined(TINYBLAKE_BENCH_SODIUM)
+
+bool sodium_hash(uint8_t out[DIGEST], const uint8_t *in, size_t inlen) {
+  return crypto_generichash(out, DIGEST, in, inlen, nullptr, 0) == 0;
+}
+
+bool sodium_keyed(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+                  const uint8_t *in, size_t inlen) {
+  return crypto_generichash(out, DIGEST, in, inlen, key, keylen) == 0;
+}
+
+/* HMAC (RFC 2104, 128-byte block) on crypto_generichash, with the inner
+ * and outer states absorbed once per key and copied per message */
+struct sodium_hmac_key {
+  crypto_generichash_state inner;
+  crypto_generichash_state outer;
+};
+
+void sodium_hmac_setup(sodium_hmac_key &k, const uint8_t *key,
+                       size_t keylen) {
+  uint8_t block[128] = {};
+  if (keylen > sizeof(block))
+    crypto_generichash(block, DIGEST, key, keylen, nullptr, 0);
+  else
+    std::memcpy(block, key, keylen);
+
+  uint8_t pad[128];
+  for (size_t i = 0; i < sizeof(pad); ++i)
+    pad[i] = static_cast<uint8_t>(block[i] ^ 0x36);
+  crypto_generichash_init(&k.inner, nullptr, 0, DIGEST);
+  crypto_generichash_update(&k.inner, pad, sizeof(pad));
+  for (size_t i = 0; i < sizeof(pad); ++i)
+    pad[i] = static_cast<uint8_t>(block[i] ^ 0x5c);
+  crypto_generichash_init(&k.outer, nullptr, 0, DIGEST);
+  crypto_generichash_update(&k.outer, pad, sizeof(pad));
+  sodium_memzero(block, sizeof(block));
+  sodium_memzero(pad, sizeof(pad));
+}
+
+void sodium_hmac_with(const sodium_hmac_key &k, uint8_t out[DIGEST],
+                      const uint8_t *in, size_t inlen) {
+  crypto_generichash_state st = k.inner;
+  uint8_t inner[DIGEST];
+  crypto_generichash_update(&st, in, inlen);
+  crypto_generichash_final(&st, inner, DIGEST);
+  st = k.outer;
+  crypto_generichash_update(&st, inner, DIGEST);
+  crypto_generichash_final(&st, out, DIGEST);
+}
+
+bool sodium_hmac(uint8_t out[DIGEST], const uint8_t *key, size_t keylen,
+                 const uint8_t *in, size_t inlen) {
+  sodium_hmac_key k;
+  sodium_hmac_setup(k, key, keylen);
+  sodium_hmac_with(k, out, in, inlen);
+  return true;
+}
+
+/* PBKDF2 with a single 64-byte output block */
+bool sodium_pbkdf2(uint8_t out[DIGEST], const char *pass, size_t passlen,
+                   const uint8_t *salt, size_t saltlen, uint32_t rounds) {
+  sodium_hmac_key k;
+  sodium_hmac_setup(k, reinterpret_cast<const uint8_t *>(pass), passlen);
+
+  std::vector<uint8_t> first(salt, salt + saltlen);
+  const uint8_t index[4] = {0, 0, 0, 1};
+  first.insert(first.end(), index, index + 4);
+
+  uint8_t u[DIGEST];
+  sodium_hmac_with(k, u, first.data(), first.size());
+  std::memcpy(out, u, DIGEST);
+  for (uint32_t r = 1; r < rounds; ++r) {
+    sodium_hmac_with(k, u, u, DIGEST);
+    for (size_t i = 0; i < DIGEST; ++i)
+      out[i] ^= u[i];
+  }
+  sodium_memzero(u, sizeof(u));
+  return true;
+}
+
+const impl SODIUM_IMPL = {"libsodium", sodium_hash, sodium_keyed, sodium_hmac,
+                          sodium_pbkdf2};
+
+#endif /* TINYBLAKE_BENCH_SODIUM */
+
+/* ─── Harness ─── */
+
+const uint8_t KEY[32] = {0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+                         0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+                         0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+                         0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42};
+const uint8_t SALT[4] = {'s', 'a', 'l', 't'};
+
+/* Compare an implementation's output with TinyBLAKE's on one message per
+ * workload; a library that disagrees is not timed */
+bool agrees(const impl &x) {
+  std::vector<uint8_t> msg(1000);
+  for (size_t i = 0; i < msg.size(); ++i)
+    msg[i] = static_cast<uint8_t>(i);
+
+  uint8_t a[DIGEST], b[DIGEST];
+  bool ok = x.hash(a, msg.data(), msg.size()) &&
+            tb_hash(b, msg.data(), msg.size()) && !std::memcmp(a, b, DIGEST);
+  if (ok && x.keyed)
+    ok = x.keyed(a, KEY, sizeof(KEY), msg.data(), msg.size()) &&
+         tb_keyed(b, KEY, sizeof(KEY), msg.data(), msg.size()) &&
+         !std::memcmp(a, b, DIGEST);
+  if (ok) /* a key longer than a block is hashed first */
+    ok = x.hmac(a, msg.data(), 200, msg.data(), msg.size()) &&
+         tb_hmac(b, msg.data(), 200, msg.data(), msg.size()) &&
+         !std::memcmp(a, b, DIGEST);
+  if (ok)
+    ok = x.pbkdf2(a, "password", 8, SALT, sizeof(SALT), 3) &&
+         tb_pbkdf2(b, "password", 8, SALT, sizeof(SALT), 3) &&
+         !std::memcmp(a, b, DIGEST);
+  return ok;
+}
+
+double measure_throughput(const char *label,
+                          void (*fn)(const uint8_t *, size_t, size_t),
+                          size_t block_size, size_t iterations) {
+  std::vector<uint8_t> data(block_size, 0xAB);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  fn(data.data(), data.size(), iterations);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double total_bytes = static_cast<double>(block_size) * iterations;
+  double mib_per_sec = (total_bytes / (1024.0 * 1024.0)) / secs;
+
+  std::printf("%-30s %8zu bytes x %6zu iters = %8.2f MiB/s  (%.4f s)\n", label,
+              block_size, iterations, mib_per_sec, secs);
+  return mib_per_sec;
+}
+
+void measure_pbkdf2(const char *label, uint32_t rounds, size_t iterations) {
+  uint8_t out[DIGEST];
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    g_impl->pbkdf2(out, "password", 8, SALT, sizeof(SALT), rounds);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double calls_per_sec = iterations / secs;
+
+  std::printf("%-30s %6zu calls  c=%-6u  %10.1f calls/s  (%.4f s)\n", label,
+              iterations, rounds, calls_per_sec, secs);
+}
+
+void bench_hash(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[DIGEST];
+  for (size_t i = 0; i < iters; ++i)
+    g_impl->hash(out, data, len);
+}
+
+void bench_keyed(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[DIGEST];
+  for (size_t i = 0; i < iters; ++i)
+    g_impl->keyed(out, KEY, sizeof(KEY), data, len);
+}
+
+void bench_hmac(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[DIGEST];
+  for (size_t i = 0; i < iters; ++i)
+    g_impl->hmac(out, KEY, sizeof(KEY), data, len);
+}
+
+struct sweep_point {
+  const char *name;
+  size_t size;
+  size_t iters;
+};
+
+const sweep_point HASH_SWEEP[] = {
+    {"64B", 64, 100000},     {"256B", 256, 100000},  {"1KiB", 1024, 50000},
+    {"4KiB", 4096, 20000},   {"64KiB", 65536, 2000}, {"1MiB", 1048576, 100},
+};
+
+const sweep_point MAC_SWEEP[] = {
+    {"64B", 64, 50000}, {"1KiB", 1024, 20000}, {"64KiB", 65536, 1000}};
+
+template <size_t N>
+void run_sweep(const std::vector<const impl *> &impls,
+               const sweep_point (&sweep)[N],
+               void (*fn)(const uint8_t *, size_t, size_t),
+               bool needs_keyed = false) {
+  char label[64];
+  for (const sweep_point &p : sweep) {
+    for (const impl *x : impls) {
+      g_impl = x;
+      std::snprintf(label, sizeof(label), "%-10s %s", x->name, p.name);
+      if (needs_keyed && !x->keyed)
+        std::printf("%-30s (not supported)\n", label);
+      else
+        measure_throughput(label, fn, p.size, p.iters);
+    }
+  }
+}
+
+} /* namespace */
+
+int main() {
+  std::printf("=== TinyBLAKE vs. OpenSSL / libsodium ===\n\n");
+
+  std::vector<const impl *> impls = {&TINYBLAKE_IMPL};
+#if defined(TINYBLAKE_BENCH_OPENSSL)
+  std::printf("OpenSSL:   %s\n", OPENSSL_VERSION_TEXT);
+  if (openssl_setup() && agrees(OPENSSL_IMPL))
+    impls.push_back(&OPENSSL_IMPL);
+  else
+    std::printf("           BLAKE2b unavailable or output mismatch; skipped\n");
+#else
+  std::printf("OpenSSL:   not found at configure time\n");
+#endif
+#if defined(TINYBLAKE_BENCH_SODIUM)
+  std::printf("libsodium: %s\n", sodium_version_string());
+  if (sodium_init() >= 0 && agrees(SODIUM_IMPL))
+    impls.push_back(&SODIUM_IMPL);
+  else
+    std::printf("           initialization failed or output mismatch; "
+                "skipped\n");
+#else
+  std::printf("libsodium: not found at configure time\n");
+#endif
+
+  std::printf("\n--- BLAKE2b-512 (unkeyed) ---\n");
+  run_sweep(impls, HASH_SWEEP, bench_hash);
+
+  std::printf("\n--- BLAKE2b-512 (keyed, 32B key) ---\n");
+  run_sweep(impls, MAC_SWEEP, bench_keyed, true);
+
+  std::printf("\n--- HMAC-BLAKE2b-512 ---\n");
+  run_sweep(impls, MAC_SWEEP, bench_hmac);
+
+  std::printf("\n--- PBKDF2-HMAC-BLAKE2b-512 ---\n");
+  char label[64];
+  for (uint32_t rounds : {1u, 1000u}) {
+    for (const impl *x : impls) {
+      g_impl = x;
+      std::snprintf(label, sizeof(label), "%-10s c=%u", x->name, rounds);
+      measure_pbkdf2(label, rounds, rounds == 1 ? 50000 : 50);
+    }
+  }
+
+  std::printf("\nDone.\n");
+  return 0;
+}
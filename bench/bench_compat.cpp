@@ -0,0 +1,238 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * tinyblake_compat against the libraries it stands in for. libsodium and
+ * libb2 export the same symbols as the compatibility library, so the
+ * originals are loaded at run time (RTLD_LOCAL, and RTLD_DEEPBIND where
+ * available so their internal calls stay inside them) instead of linked.
+ * The paths come from CMake's find_library(); a library that was not found
+ * is reported and skipped. Function types are taken from the compat
+ * headers, which match the originals' signatures.
+ */
+
+#include <blake2.h>
+#include <sodium/crypto_generichash.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
+namespace {
+
+struct generichash_api {
+  const char *name;
+  decltype(&crypto_generichash) hash;
+  decltype(&crypto_generichash_init) init;
+  decltype(&crypto_generichash_update) update;
+  decltype(&crypto_generichash_final) final_;
+};
+
+struct b2_api {
+  const char *name;
+  decltype(&blake2b) hash;
+  decltype(&blake2bp) hash_parallel;
+};
+
+const generichash_api *g_gh = nullptr;
+const b2_api *g_b2 = nullptr;
+
+void *open_library(const char *path) {
+#if defined(_WIN32)
+  (void)path;
+  return nullptr;
+#else
+  int flags = RTLD_NOW | RTLD_LOCAL;
+#if defined(RTLD_DEEPBIND)
+  flags |= RTLD_DEEPBIND;
+#endif
+  return path ? dlopen(path, flags) : nullptr;
+#endif
+}
+
+template <typename Fn> bool bind(void *lib, const char *symbol, Fn &fn) {
+#if defined(_WIN32)
+  (void)lib;
+  (void)symbol;
+  return false;
+#else
+  fn = reinterpret_cast<Fn>(dlsym(lib, symbol));
+  return fn != nullptr;
+#endif
+}
+
+bool load_sodium(const char *path, generichash_api &api) {
+  void *lib = open_library(path);
+  if (!lib)
+    return false;
+  int (*sodium_init)(void) = nullptr;
+  if (!bind(lib, "sodium_init", sodium_init) || sodium_init() < 0)
+    return false;
+  api.name = "libsodium";
+  return bind(lib, "crypto_generichash", api.hash) &&
+         bind(lib, "crypto_generichash_init", api.init) &&
+         bind(lib, "crypto_generichash_update", api.update) &&
+         bind(lib, "crypto_generichash_final", api.final_);
+}
+
+bool load_b2(const char *path, b2_api &api) {
+  void *lib = open_library(path);
+  if (!lib)
+    return false;
+  api.name = "libb2";
+  return bind(lib, "blake2b", api.hash) &&
+         bind(lib, "blake2bp", api.hash_parallel);
+}
+
+double measure_throughput(const char *label,
+                          void (*fn)(const uint8_t *, size_t, size_t),
+                          size_t block_size, size_t iterations) {
+  std::vector<uint8_t> data(block_size, 0xAB);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  fn(data.data(), data.size(), iterations);
+  auto end = std::chrono::high_resolution_clock::now();
+
+  double secs = std::chrono::duration<double>(end - start).count();
+  double total_bytes = static_cast<double>(block_size) * iterations;
+  double mib_per_sec = (total_bytes / (1024.0 * 1024.0)) / secs;
+
+  std::printf("%-30s %8zu bytes x %6zu iters = %8.2f MiB/s  (%.4f s)\n", label,
+              block_size, iterations, mib_per_sec, secs);
+  return mib_per_sec;
+}
+
+void bench_generichash(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[32];
+  for (size_t i = 0; i < iters; ++i)
+    g_gh->hash(out, sizeof(out), data, len, nullptr, 0);
+}
+
+void bench_generichash_keyed(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t key[32];
+  std::memset(key, 0x42, sizeof(key));
+  uint8_t out[32];
+  for (size_t i = 0; i < iters; ++i)
+    g_gh->hash(out, sizeof(out), data, len, key, sizeof(key));
+}
+
+/* 64-byte updates, as a record-at-a-time caller would make */
+void bench_generichash_stream(const uint8_t *data, size_t len, size_t iters) {
+  crypto_generichash_state st;
+  uint8_t out[32];
+  for (size_t i = 0; i < iters; ++i) {
+    g_gh->init(&st, nullptr, 0, sizeof(out));
+    for (size_t off = 0; off < len; off += 64)
+      g_gh->update(&st, data + off, len - off < 64 ? len - off : 64);
+    g_gh->final_(&st, out, sizeof(out));
+  }
+}
+
+void bench_blake2b(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[64];
+  for (size_t i = 0; i < iters; ++i)
+    g_b2->hash(out, data, nullptr, sizeof(out), len, 0);
+}
+
+void bench_blake2bp(const uint8_t *data, size_t len, size_t iters) {
+  uint8_t out[64];
+  for (size_t i = 0; i < iters; ++i)
+    g_b2->hash_parallel(out, data, nullptr, sizeof(out), len, 0);
+}
+
+void run_generichash(const generichash_api &api) {
+  g_gh = &api;
+  char label[64];
+  std::printf("\n--- crypto_generichash (%s) ---\n", api.name);
+  std::snprintf(label, sizeof(label), "%s  64B", api.name);
+  measure_throughput(label, bench_generichash, 64, 200000);
+  std::snprintf(label, sizeof(label), "%s  1KiB", api.name);
+  measure_throughput(label, bench_generichash, 1024, 50000);
+  std::snprintf(label, sizeof(label), "%s  64KiB", api.name);
+  measure_throughput(label, bench_generichash, 65536, 2000);
+  std::snprintf(label, sizeof(label), "%s keyed  1KiB", api.name);
+  measure_throughput(label, bench_generichash_keyed, 1024, 50000);
+  std::snprintf(label, sizeof(label), "%s stream64  64KiB", api.name);
+  measure_throughput(label, bench_generichash_stream, 65536, 1000);
+}
+
+void run_b2(const b2_api &api) {
+  g_b2 = &api;
+  char label[64];
+  std::printf("\n--- blake2b / blake2bp (%s) ---\n", api.name);
+  std::snprintf(label, sizeof(label), "%s blake2b  64B", api.name);
+  measure_throughput(label, bench_blake2b, 64, 200000);
+  std::snprintf(label, sizeof(label), "%s blake2b  64KiB", api.name);
+  measure_throughput(label, bench_blake2b, 65536, 2000);
+  std::snprintf(label, sizeof(label), "%s blake2bp  64KiB", api.name);
+  measure_throughput(label, bench_blake2bp, 65536, 2000);
+  std::snprintf(label, sizeof(label), "%s blake2bp  1MiB", api.name);
+  measure_throughput(label, bench_blake2bp, 1048576, 100);
+}
+
+} /* namespace */
+
+int main() {
+  std::printf("=== tinyblake_compat vs. originals ===\n");
+
+#if defined(TINYBLAKE_BENCH_SODIUM_PATH)
+  const char *sodium_path = TINYBLAKE_BENCH_SODIUM_PATH;
+#else
+  const char *sodium_path = nullptr;
+#endif
+#if defined(TINYBLAKE_BENCH_B2_PATH)
+  const char *b2_path = TINYBLAKE_BENCH_B2_PATH;
+#else
+  const char *b2_path = nullptr;
+#endif
+
+  const generichash_api compat_gh = {
+      "compat", crypto_generichash, crypto_generichash_init,
+      crypto_generichash_update, crypto_generichash_final};
+  run_generichash(compat_gh);
+  generichash_api sodium_gh = {};
+  if (load_sodium(sodium_path, sodium_gh))
+    run_generichash(sodium_gh);
+  else
+    std::printf("\n(libsodium not found; skipped)\n");
+
+  const b2_api compat_b2 = {"compat", blake2b, blake2bp};
+  run_b2(compat_b2);
+  b2_api libb2 = {};
+  if (load_b2(b2_path, libb2))
+    run_b2(libb2);
+  else
+    std::printf("\n(libb2 not found; skipped)\n");
+
+  return 0;
+}
@@ -0,0 +1,438 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * Energy benchmark: samples the Linux powercap RAPL counters around each
+ * measurement and reports energy per byte and per call for every BLAKE2b
+ * backend this CPU supports, next to the throughput.
+ *
+ *   tinyblake_energy_bench [--seconds S] [--backends a,b,...]
+ *
+ *   --seconds S     minimum run time per measurement (default 1.0); RAPL
+ *                   counters tick about once a millisecond, so short runs
+ *                   are mostly quantization noise
+ *   --backends LIST engines to run, as for tinyblake_engine_get() (default:
+ *                   every backend this CPU supports)
+ *
+ * Package domains ("intel-rapl:N", named package-N) are summed into the
+ * package figure; DRAM subdomains are reported separately where the
+ * platform has them. The MMIO copy of the package counter
+ * ("intel-rapl-mmio") measures the same energy and is skipped. Since
+ * Linux 5.10 energy_uj is readable by root only; without access, or
+ * outside Linux, or in a container without /sys/class/powercap, the
+ * benchmark says so and reports throughput alone.
+ *
+ * Package energy includes every core and the uncore, busy or not. An idle
+ * baseline is measured first and "dyn nJ/B" subtracts it, which is the
+ * marginal cost of the hashing on an otherwise quiet machine; the total
+ * figures are what a dedicated host pays. Each "op" is one API call, or
+ * one batch of eight for the hash_many rows and their single-message
+ * loops, so the two compare directly.
+ */
+
+#include <tinyblake.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+/* ─── RAPL counters ─── */
+
+struct rapl_domain {
+  std::string label;  /* e.g. "intel-rapl:0 package-0" */
+  std::string path;   /* energy_uj file */
+  uint64_t max_range; /* microjoules at which the counter wraps */
+  bool dram;
+};
+
+std::vector<rapl_domain> g_domains;
+
+bool read_u64(const std::string &path, uint64_t *v) {
+  std::FILE *f = std::fopen(path.c_str(), "r");
+  if (!f)
+    return false;
+  unsigned long long x = 0;
+  const bool ok = std::fscanf(f, "%llu", &x) == 1;
+  std::fclose(f);
+  *v = x;
+  return ok;
+}
+
+std::string read_line(const std::string &path) {
+  char buf[128] = {};
+  std::FILE *f = std::fopen(path.c_str(), "r");
+  if (!f)
+    return std::string();
+  if (!std::fgets(buf, sizeof(buf), f))
+    buf[0] = '\0';
+  std::fclose(f);
+  std::string s = buf;
+  while (!s.empty() && (s.back() == '\n' || s.back() == '\r'))
+    s.pop_back();
+  return s;
+}
+
+/* Finds the readable package and DRAM domains. Returns a reason string
+ * when there are none. */
+const char *rapl_discover() {
+#ifdef __linux__
+  const std::string root = "/sys/class/powercap/";
+  DIR *dir = opendir(root.c_str());
+  if (!dir)
+    return "/sys/class/powercap is not present";
+
+  bool found = false;
+  while (const dirent *e = readdir(dir)) {
+    const std::string zone = e->d_name;
+    /* "intel-rapl:N" packages and "intel-rapl:N:M" subdomains only */
+    if (zone.compare(0, 11, "intel-rapl:") != 0)
+      continue;
+    const std::string base = root + zone + "/";
+    const std::string name = read_line(base + "name");
+    const bool sub = zone.find(':', 11) != std::string::npos;
+    const bool dram = sub && name == "dram";
+    if (!(sub ? dram : name.compare(0, 7, "package") == 0))
+      continue;
+    found = true;
+
+    rapl_domain d;
+    d.label = zone + " " + name;
+    d.path = base + "energy_uj";
+    d.dram = dram;
+    uint64_t v;
+    if (!read_u64(d.path, &v))
+      continue;
+    if (!read_u64(base + "max_energy_range_uj", &d.max_range))
+      d.max_range = 0;
+    g_domains.push_back(d);
+  }
+  closedir(dir);
+
+  if (!g_domains.empty())
+    return nullptr;
+  return found ? "energy_uj is not readable (root only since Linux 5.10)"
+               : "no intel-rapl package domains";
+#else
+  return "RAPL sampling needs Linux powercap";
+#endif
+}
+
+struct energy_sample {
+  std::vector<uint64_t> uj;
+};
+
+energy_sample rapl_sample() {
+  energy_sample s;
+  s.uj.resize(g_domains.size());
+  for (size_t i = 0; i < g_domains.size(); ++i)
+    if (!read_u64(g_domains[i].path, &s.uj[i]))
+      s.uj[i] = 0;
+  return s;
+}
+
+/* Joules between two samples, package and DRAM separately. A counter that
+ * went backwards wrapped once; runs are far shorter than a wrap period. */
+void rapl_delta(const energy_sample &a, const energy_sample &b, double *pkg,
+                double *dram) {
+  *pkg = 0.0;
+  *dram = 0.0;
+  for (size_t i = 0; i < g_domains.size(); ++i) {
+    uint64_t d = b.uj[i] - a.uj[i];
+    if (b.uj[i] < a.uj[i])
+      d = g_domains[i].max_range > a.uj[i]
+              ? g_domains[i].max_range - a.uj[i] + b.uj[i]
+              : 0;
+    const double j = static_cast<double>(d) * 1e-6;
+    if (g_domains[i].dram)
+      *dram += j;
+    else
+      *pkg += j;
+  }
+}
+
+bool have_dram() {
+  for (const rapl_domain &d : g_domains)
+    if (d.dram)
+      return true;
+  return false;
+}
+
+/* ─── Workloads ─── */
+
+const size_t MANY = 8;
+
+struct buffers {
+  std::vector<uint8_t> data;
+  const void *in[MANY];
+  size_t inlen[MANY];
+  uint8_t key[32];
+  uint8_t out[MANY * 64];
+};
+
+buffers g_buf;
+
+/* One op per call; each runs `ops` ops over `len` input bytes */
+using op_fn = void (*)(const tinyblake_engine *engine, size_t len,
+                       size_t ops);
+
+void op_blake2b(const tinyblake_engine *e, size_t len, size_t ops) {
+  for (size_t i = 0; i < ops; ++i)
+    tinyblake_blake2b_ex(e, g_buf.out, 64, g_buf.data.data(), len, nullptr,
+                         0);
+}
+
+/* Eight messages of `len` bytes through the multi-lane kernels... */
+void op_blake2b_many(const tinyblake_engine *, size_t len, size_t ops) {
+  for (size_t k = 0; k < MANY; ++k)
+    g_buf.inlen[k] = len;
+  for (size_t i = 0; i < ops; ++i)
+    tinyblake_blake2b_hash_many(g_buf.out, 64, g_buf.in, g_buf.inlen, MANY,
+                                nullptr, 0);
+}
+
+/* ...and the same eight one at a time */
+void op_blake2b_loop(const tinyblake_engine *e, size_t len, size_t ops) {
+  for (size_t i = 0; i < ops; ++i)
+    for (size_t k = 0; k < MANY; ++k)
+      tinyblake_blake2b_ex(e, g_buf.out + 64 * k, 64, g_buf.in[k], len,
+                           nullptr, 0);
+}
+
+void op_hmac(const tinyblake_engine *, size_t len, size_t ops) {
+  for (size_t i = 0; i < ops; ++i)
+    tinyblake_hmac(g_buf.out, 64, g_buf.key, 32, g_buf.data.data(), len);
+}
+
+void op_blake2s(const tinyblake_engine *, size_t len, size_t ops) {
+  for (size_t i = 0; i < ops; ++i)
+    tinyblake_blake2s(g_buf.out, 32, g_buf.data.data(), len, nullptr, 0);
+}
+
+void op_blake2s_many(const tinyblake_engine *, size_t len, size_t ops) {
+  for (size_t k = 0; k < MANY; ++k)
+    g_buf.inlen[k] = len;
+  for (size_t i = 0; i < ops; ++i)
+    tinyblake_blake2s_hash_many(g_buf.out, 32, g_buf.in, g_buf.inlen, MANY,
+                                nullptr, 0);
+}
+
+void op_blake3(const tinyblake_engine *, size_t len, size_t ops) {
+  for (size_t i = 0; i < ops; ++i)
+    tinyblake_blake3(g_buf.out, 32, g_buf.data.data(), len, nullptr);
+}
+
+void op_blake3_parallel(const tinyblake_engine *, size_t len, size_t ops) {
+  for (size_t i = 0; i < ops; ++i) {
+    tinyblake_blake3_state S;
+    tinyblake_blake3_init(&S);
+    tinyblake_blake3_update_parallel(&S, g_buf.data.data(), len, 0);
+    tinyblake_blake3_final(&S, g_buf.out, 32);
+  }
+}
+
+struct workload {
+  const char *name;
+  op_fn fn;
+  size_t len;     /* bytes per message */
+  size_t per_op;  /* messages per op */
+};
+
+/* BLAKE2b-based rows follow the backend under test */
+const workload BLAKE2B_WORKLOADS[] = {
+    {"BLAKE2b-512  64B", op_blake2b, 64, 1},
+    {"BLAKE2b-512  1KiB", op_blake2b, 1024, 1},
+    {"BLAKE2b-512  64KiB", op_blake2b, 65536, 1},
+    {"BLAKE2b loop      1KiB x8", op_blake2b_loop, 1024, MANY},
+    {"BLAKE2b hash_many 1KiB x8", op_blake2b_many, 1024, MANY},
+    {"HMAC-BLAKE2b  1KiB", op_hmac, 1024, 1},
+};
+
+/* Hashes with their own dispatch, run once */
+const workload OTHER_WORKLOADS[] = {
+    {"BLAKE2s-256  1KiB", op_blake2s, 1024, 1},
+    {"BLAKE2s hash_many 1KiB x8", op_blake2s_many, 1024, MANY},
+    {"BLAKE3  64KiB", op_blake3, 65536, 1},
+    {"BLAKE3 parallel  16MiB", op_blake3_parallel, 16u << 20, 1},
+};
+
+const size_t INPUT_BYTES = 16u << 20;
+
+/* ─── Measurement ─── */
+
+double g_seconds = 1.0;
+double g_idle_watts = 0.0;
+
+/* Runs `w` for at least g_seconds, doubling the batch size until a batch
+ * is long enough that the clock and counter reads do not matter */
+void measure(const workload &w, const tinyblake_engine *engine) {
+  w.fn(engine, w.len, 1); /* warm up */
+
+  size_t ops = 1, total_ops = 0;
+  double secs = 0.0;
+  const energy_sample e0 = rapl_sample();
+  const auto start = clock_type::now();
+  while (secs < g_seconds) {
+    w.fn(engine, w.len, ops);
+    total_ops += ops;
+    secs = std::chrono::duration<double>(clock_type::now() - start).count();
+    if (secs < g_seconds / 16)
+      ops *= 2;
+  }
+  const energy_sample e1 = rapl_sample();
+
+  const double bytes =
+      static_cast<double>(total_ops * w.per_op) * static_cast<double>(w.len);
+  const double mibs = bytes / (1024.0 * 1024.0) / secs;
+  std::printf("%-28s %10.1f", w.name, mibs);
+  if (g_domains.empty()) {
+    std::printf("\n");
+    return;
+  }
+
+  double pkg, dram;
+  rapl_delta(e0, e1, &pkg, &dram);
+  const double dyn = pkg - g_idle_watts * secs;
+  std::printf(" %8.2f %10.3f %10.3f %12.1f", pkg / secs, pkg * 1e9 / bytes,
+              dyn * 1e9 / bytes,
+              pkg * 1e9 / static_cast<double>(total_ops));
+  if (have_dram())
+    std::printf(" %10.3f", dram * 1e9 / bytes);
+  std::printf("\n");
+}
+
+void print_header() {
+  std::printf("%-28s %10s", "workload", "MiB/s");
+  if (!g_domains.empty()) {
+    std::printf(" %8s %10s %10s %12s", "pkg W", "nJ/B", "dyn nJ/B", "nJ/op");
+    if (have_dram())
+      std::printf(" %10s", "DRAM nJ/B");
+  }
+  std::printf("\n");
+}
+
+int usage() {
+  std::fprintf(stderr, "usage: tinyblake_energy_bench [--seconds S] "
+                       "[--backends a,b,...]\n");
+  return 2;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv) {
+  std::vector<std::string> backends = {"portable", "x64",       "avx2",
+                                       "avx512",   "neon",      "neon_sha3",
+                                       "rvv"};
+  bool explicit_backends = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc)
+      return usage();
+    const std::string val = argv[++i];
+    if (arg == "--seconds") {
+      g_seconds = std::strtod(val.c_str(), nullptr);
+    } else if (arg == "--backends") {
+      backends.clear();
+      explicit_backends = true;
+      for (size_t p = 0; p <= val.size();) {
+        size_t q = val.find(',', p);
+        if (q == std::string::npos)
+          q = val.size();
+        if (q > p)
+          backends.push_back(val.substr(p, q - p));
+        p = q + 1;
+      }
+    } else {
+      return usage();
+    }
+  }
+  if (!(g_seconds > 0.0) || backends.empty())
+    return usage();
+
+  g_buf.data.assign(INPUT_BYTES, 0xA5);
+  for (size_t k = 0; k < MANY; ++k)
+    g_buf.in[k] = g_buf.data.data() + k * 65536;
+  std::memset(g_buf.key, 0x42, sizeof(g_buf.key));
+
+  std::printf("=== TinyBLAKE energy ===\n");
+  if (const char *why = rapl_discover()) {
+    std::printf("RAPL unavailable: %s; reporting throughput only\n", why);
+  } else {
+    for (const rapl_domain &d : g_domains)
+      std::printf("RAPL domain %s\n", d.label.c_str());
+    /* Idle baseline over the same interval as one measurement */
+    const energy_sample e0 = rapl_sample();
+    const auto start = clock_type::now();
+    std::this_thread::sleep_for(std::chrono::duration<double>(g_seconds));
+    const energy_sample e1 = rapl_sample();
+    const double secs =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    double pkg, dram;
+    rapl_delta(e0, e1, &pkg, &dram);
+    g_idle_watts = pkg / secs;
+    std::printf("Idle package power %.2f W\n", g_idle_watts);
+  }
+
+  for (const std::string &name : backends) {
+    const tinyblake_engine *engine = tinyblake_engine_get(name.c_str());
+    if (!engine) {
+      if (explicit_backends)
+        std::printf("\n--- %s: not available on this CPU ---\n",
+                    name.c_str());
+      continue;
+    }
+    /* The thread default routes HMAC and hash_many through the engine */
+    tinyblake_engine_set_thread_default(engine);
+    std::printf("\n--- BLAKE2b backend: %s ---\n",
+                tinyblake_engine_name(engine));
+    print_header();
+    for (const workload &w : BLAKE2B_WORKLOADS)
+      measure(w, engine);
+  }
+  tinyblake_engine_set_thread_default(nullptr);
+
+  std::printf("\n--- BLAKE2s / BLAKE3 (default dispatch) ---\n");
+  print_header();
+  for (const workload &w : OTHER_WORKLOADS)
+    measure(w, nullptr);
+
+  std::printf("\nDone.\n");
+  return 0;
+}
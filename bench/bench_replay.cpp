@@ -0,0 +1,673 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * Trace-replay benchmark: hashes a recorded or sampled mix of requests
+ * instead of fixed-size loops, and reports throughput and per-request
+ * latency percentiles.
+ *
+ *   tinyblake_replay_bench [source] [options]
+ *
+ * Sources (default --synthetic):
+ *   --trace FILE       CSV lines "op,keylen,msglen,outlen", or the binary
+ *                      format written by --dump (detected by its magic)
+ *   --histogram FILE   CSV lines "weight,op,keylen,min_len,max_len,outlen";
+ *                      --records requests are sampled from it, lengths
+ *                      uniform within each row
+ *   --synthetic        built-in histogram: 70% under 64 B, a tail to
+ *                      16 MiB, 30% keyed
+ *
+ * Options:
+ *   --api oneshot|incremental|batch|async   (default oneshot)
+ *   --chunk N     update() size for incremental (default 4096)
+ *   --batch N     max requests per *_hash_many call for batch (default 8)
+ *   --threads N   workers for async (default: hardware threads)
+ *   --rate R      async submissions per second, 0 = all at once (default 0)
+ *   --records N   requests to sample from a histogram (default 100000)
+ *   --seed N      sampling and data seed (default 1)
+ *   --repeat N    replay the trace N times (default 1)
+ *   --dump FILE   write the trace in binary form and exit
+ *
+ * Operations: blake2b (keyed when keylen > 0), hmac (HMAC-BLAKE2b),
+ * blake2s and blake3 (keylen 0 or 32). Lines starting with '#' and a
+ * header line starting with "op" or "weight" are skipped. Message bytes
+ * are generated, not recorded; each request hashes a slice of one
+ * pseudo-random buffer at a varying offset.
+ *
+ * Latency is the time from submission to digest: the call itself for
+ * oneshot and incremental, the whole *_hash_many call for every request
+ * in a batch, and queueing plus hashing for async.
+ */
+
+#include <tinyblake.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+enum op_kind : uint8_t { OP_BLAKE2B, OP_HMAC, OP_BLAKE2S, OP_BLAKE3 };
+
+const char *const OP_NAMES[] = {"blake2b", "hmac", "blake2s", "blake3"};
+
+struct request {
+  uint8_t op;
+  uint8_t keylen;
+  uint8_t outlen;
+  uint64_t msglen;
+};
+
+/* ─── Trace sources ─── */
+
+/* Binary trace: magic, then 16-byte little-endian records
+ * {op u8, keylen u8, outlen u8, 0 u8, 0 u32, msglen u64} */
+const char TRACE_MAGIC[8] = {'T', 'B', 'T', 'R', 'A', 'C', 'E', '1'};
+
+bool parse_op(const char *name, uint8_t &op) {
+  for (uint8_t i = 0; i < sizeof(OP_NAMES) / sizeof(OP_NAMES[0]); ++i) {
+    if (std::strcmp(name, OP_NAMES[i]) == 0) {
+      op = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Reject requests the library would refuse, so replay never fails mid-run */
+bool valid_request(const request &r) {
+  switch (r.op) {
+  case OP_BLAKE2B:
+    return r.outlen >= 1 && r.outlen <= 64 && r.keylen <= 64;
+  case OP_HMAC:
+    return r.outlen >= 1 && r.outlen <= 64 && r.keylen >= 1;
+  case OP_BLAKE2S:
+    return r.outlen >= 1 && r.outlen <= 32 && r.keylen <= 32;
+  case OP_BLAKE3:
+    return r.outlen >= 1 && (r.keylen == 0 || r.keylen == 32);
+  default:
+    return false;
+  }
+}
+
+bool skip_line(const char *line) {
+  while (*line == ' ' || *line == '\t')
+    ++line;
+  return *line == '\0' || *line == '\n' || *line == '\r' || *line == '#' ||
+         std::strncmp(line, "op", 2) == 0 ||
+         std::strncmp(line, "weight", 6) == 0;
+}
+
+bool load_binary(std::FILE *f, std::vector<request> &out) {
+  uint8_t rec[16];
+  while (std::fread(rec, 1, sizeof(rec), f) == sizeof(rec)) {
+    request r;
+    r.op = rec[0];
+    r.keylen = rec[1];
+    r.outlen = rec[2];
+    r.msglen = 0;
+    for (int i = 7; i >= 0; --i)
+      r.msglen = (r.msglen << 8) | rec[8 + i];
+    if (!valid_request(r))
+      return false;
+    out.push_back(r);
+  }
+  return true;
+}
+
+bool load_csv(std::FILE *f, std::vector<request> &out) {
+  char line[256];
+  size_t lineno = 0;
+  while (std::fgets(line, sizeof(line), f)) {
+    ++lineno;
+    if (skip_line(line))
+      continue;
+    char name[16];
+    unsigned keylen = 0, outlen = 0;
+    unsigned long long msglen = 0;
+    request r;
+    if (std::sscanf(line, " %15[a-z0-9] , %u , %llu , %u", name, &keylen,
+                    &msglen, &outlen) != 4 ||
+        !parse_op(name, r.op) || keylen > 255 || outlen > 255) {
+      std::fprintf(stderr, "trace line %zu: expected op,keylen,msglen,outlen\n",
+                   lineno);
+      return false;
+    }
+    r.keylen = static_cast<uint8_t>(keylen);
+    r.outlen = static_cast<uint8_t>(outlen);
+    r.msglen = msglen;
+    if (!valid_request(r)) {
+      std::fprintf(stderr, "trace line %zu: unsupported request\n", lineno);
+      return false;
+    }
+    out.push_back(r);
+  }
+  return true;
+}
+
+bool load_trace(const char *path, std::vector<request> &out) {
+  std::FILE *f = std::fopen(path, "rb");
+  if (!f) {
+    std::fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+  char magic[sizeof(TRACE_MAGIC)];
+  bool ok;
+  if (std::fread(magic, 1, sizeof(magic), f) == sizeof(magic) &&
+      std::memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0) {
+    ok = load_binary(f, out);
+  } else {
+    std::rewind(f);
+    ok = load_csv(f, out);
+  }
+  std::fclose(f);
+  return ok;
+}
+
+bool dump_trace(const char *path, const std::vector<request> &trace) {
+  std::FILE *f = std::fopen(path, "wb");
+  if (!f)
+    return false;
+  bool ok = std::fwrite(TRACE_MAGIC, 1, sizeof(TRACE_MAGIC), f) ==
+            sizeof(TRACE_MAGIC);
+  for (const request &r : trace) {
+    uint8_t rec[16] = {r.op, r.keylen, r.outlen};
+    for (int i = 0; i < 8; ++i)
+      rec[8 + i] = static_cast<uint8_t>(r.msglen >> (8 * i));
+    ok = ok && std::fwrite(rec, 1, sizeof(rec), f) == sizeof(rec);
+  }
+  return std::fclose(f) == 0 && ok;
+}
+
+struct histogram_row {
+  double weight;
+  request shape; /* msglen unused */
+  uint64_t min_len;
+  uint64_t max_len;
+};
+
+/* The default mix: 70% of requests under 64 bytes, 30% keyed (BLAKE2b
+ * keys and HMAC), and a thin tail out to 16 MiB */
+const histogram_row SYNTHETIC[] = {
+    {30.0, {OP_BLAKE2B, 0, 32, 0}, 1, 31},
+    {19.0, {OP_BLAKE2B, 0, 32, 0}, 32, 63},
+    {12.0, {OP_BLAKE2B, 0, 64, 0}, 64, 1023},
+    {6.0, {OP_BLAKE2B, 0, 64, 0}, 1024, 65535},
+    {2.9, {OP_BLAKE2B, 0, 64, 0}, 65536, 1048575},
+    {0.1, {OP_BLAKE2B, 0, 64, 0}, 1048576, 16777216},
+    {14.0, {OP_BLAKE2B, 32, 32, 0}, 1, 63},
+    {7.0, {OP_HMAC, 32, 64, 0}, 1, 63},
+    {6.0, {OP_BLAKE2B, 32, 32, 0}, 64, 4095},
+    {3.0, {OP_HMAC, 32, 64, 0}, 64, 65535},
+};
+
+bool load_histogram(const char *path, std::vector<histogram_row> &rows) {
+  std::FILE *f = std::fopen(path, "r");
+  if (!f) {
+    std::fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+  char line[256];
+  size_t lineno = 0;
+  bool ok = true;
+  while (ok && std::fgets(line, sizeof(line), f)) {
+    ++lineno;
+    if (skip_line(line))
+      continue;
+    histogram_row row;
+    char name[16];
+    unsigned keylen = 0, outlen = 0;
+    unsigned long long lo = 0, hi = 0;
+    ok = std::sscanf(line, " %lf , %15[a-z0-9] , %u , %llu , %llu , %u",
+                     &row.weight, name, &keylen, &lo, &hi, &outlen) == 6 &&
+         parse_op(name, row.shape.op) && keylen <= 255 && outlen <= 255 &&
+         row.weight >= 0 && lo <= hi;
+    if (ok) {
+      row.shape.keylen = static_cast<uint8_t>(keylen);
+      row.shape.outlen = static_cast<uint8_t>(outlen);
+      row.shape.msglen = 0;
+      row.min_len = lo;
+      row.max_len = hi;
+      ok = valid_request(row.shape);
+    }
+    if (ok)
+      rows.push_back(row);
+    else
+      std::fprintf(stderr, "histogram line %zu: expected "
+                           "weight,op,keylen,min_len,max_len,outlen\n",
+                   lineno);
+  }
+  std::fclose(f);
+  return ok && !rows.empty();
+}
+
+uint64_t splitmix64(uint64_t &s) {
+  uint64_t z = (s += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+std::vector<request> sample(const std::vector<histogram_row> &rows,
+                            size_t count, uint64_t seed) {
+  double total = 0;
+  for (const histogram_row &r : rows)
+    total += r.weight;
+
+  std::vector<request> out;
+  out.reserve(count);
+  uint64_t s = seed;
+  for (size_t i = 0; i < count; ++i) {
+    double pick = static_cast<double>(splitmix64(s) >> 11) * 0x1.0p-53 * total;
+    size_t k = 0;
+    while (k + 1 < rows.size() && pick >= rows[k].weight) {
+      pick -= rows[k].weight;
+      ++k;
+    }
+    request r = rows[k].shape;
+    const uint64_t span = rows[k].max_len - rows[k].min_len + 1;
+    r.msglen = rows[k].min_len + (span ? splitmix64(s) % span : 0);
+    out.push_back(r);
+  }
+  return out;
+}
+
+/* ─── Replay ─── */
+
+struct replay_config {
+  std::string api = "oneshot";
+  size_t chunk = 4096;
+  size_t batch = 8;
+  size_t threads = 0;
+  double rate = 0;
+};
+
+struct workload {
+  std::vector<uint8_t> data; /* max msglen + 64 pseudo-random bytes */
+  uint8_t key[64];
+};
+
+const uint8_t *message(const workload &w, size_t index) {
+  return w.data.data() + index % 64;
+}
+
+void hash_oneshot(const workload &w, const request &r, const uint8_t *msg,
+                  uint8_t *out) {
+  const size_t len = static_cast<size_t>(r.msglen);
+  switch (r.op) {
+  case OP_BLAKE2B:
+    tinyblake_blake2b(out, r.outlen, msg, len, w.key, r.keylen);
+    break;
+  case OP_HMAC:
+    tinyblake_hmac(out, r.outlen, w.key, r.keylen, msg, len);
+    break;
+  case OP_BLAKE2S:
+    tinyblake_blake2s(out, r.outlen, msg, len, w.key, r.keylen);
+    break;
+  case OP_BLAKE3:
+    tinyblake_blake3(out, r.outlen, msg, len, r.keylen ? w.key : nullptr);
+    break;
+  }
+}
+
+void hash_incremental(const workload &w, const request &r, const uint8_t *msg,
+                      uint8_t *out, size_t chunk) {
+  size_t len = static_cast<size_t>(r.msglen);
+  switch (r.op) {
+  case OP_BLAKE2B: {
+    tinyblake_blake2b_state S;
+    if (r.keylen)
+      tinyblake_blake2b_init_key(&S, r.outlen, w.key, r.keylen);
+    else
+      tinyblake_blake2b_init(&S, r.outlen);
+    for (size_t off = 0; off < len; off += chunk)
+      tinyblake_blake2b_update(&S, msg + off, std::min(chunk, len - off));
+    tinyblake_blake2b_final(&S, out, r.outlen);
+    break;
+  }
+  case OP_HMAC: {
+    tinyblake_hmac_state S;
+    tinyblake_hmac_init(&S, w.key, r.keylen);
+    for (size_t off = 0; off < len; off += chunk)
+      tinyblake_hmac_update(&S, msg + off, std::min(chunk, len - off));
+    tinyblake_hmac_final(&S, out, r.outlen);
+    break;
+  }
+  case OP_BLAKE2S: {
+    tinyblake_blake2s_state S;
+    if (r.keylen)
+      tinyblake_blake2s_init_key(&S, r.outlen, w.key, r.keylen);
+    else
+      tinyblake_blake2s_init(&S, r.outlen);
+    for (size_t off = 0; off < len; off += chunk)
+      tinyblake_blake2s_update(&S, msg + off, std::min(chunk, len - off));
+    tinyblake_blake2s_final(&S, out, r.outlen);
+    break;
+  }
+  case OP_BLAKE3: {
+    tinyblake_blake3_state S;
+    if (r.keylen)
+      tinyblake_blake3_init_keyed(&S, w.key);
+    else
+      tinyblake_blake3_init(&S);
+    for (size_t off = 0; off < len; off += chunk)
+      tinyblake_blake3_update(&S, msg + off, std::min(chunk, len - off));
+    tinyblake_blake3_final(&S, out, r.outlen);
+    break;
+  }
+  }
+}
+
+uint64_t elapsed_ns(clock_type::time_point a, clock_type::time_point b) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count());
+}
+
+/* Runs of the same (op, keylen, outlen) go to one *_hash_many call; HMAC
+ * and BLAKE3 have no batch API and run one at a time */
+void replay_batch(const workload &w, const std::vector<request> &trace,
+                  size_t batch, std::vector<uint64_t> &lat) {
+  std::vector<const void *> ptrs(batch);
+  std::vector<size_t> lens(batch);
+  std::vector<uint8_t> out(batch * 64);
+  for (size_t i = 0; i < trace.size();) {
+    const request &r = trace[i];
+    size_t n = 1;
+    if (r.op == OP_BLAKE2B || r.op == OP_BLAKE2S) {
+      while (n < batch && i + n < trace.size() && trace[i + n].op == r.op &&
+             trace[i + n].keylen == r.keylen &&
+             trace[i + n].outlen == r.outlen)
+        ++n;
+    }
+    for (size_t k = 0; k < n; ++k) {
+      ptrs[k] = message(w, i + k);
+      lens[k] = static_cast<size_t>(trace[i + k].msglen);
+    }
+
+    auto start = clock_type::now();
+    if (r.op == OP_BLAKE2B)
+      tinyblake_blake2b_hash_many(out.data(), r.outlen, ptrs.data(),
+                                  lens.data(), n, w.key, r.keylen);
+    else if (r.op == OP_BLAKE2S)
+      tinyblake_blake2s_hash_many(out.data(), r.outlen, ptrs.data(),
+                                  lens.data(), n, w.key, r.keylen);
+    else
+      hash_oneshot(w, r, message(w, i), out.data());
+    auto end = clock_type::now();
+
+    for (size_t k = 0; k < n; ++k)
+      lat[i + k] = elapsed_ns(start, end);
+    i += n;
+  }
+}
+
+/* A submitting thread feeds a queue that worker threads drain with the
+ * one-shot API, optionally paced to a target request rate */
+void replay_async(const workload &w, const std::vector<request> &trace,
+                  size_t threads, double rate, std::vector<uint64_t> &lat) {
+  struct item {
+    size_t index;
+    clock_type::time_point submitted;
+  };
+  std::deque<item> queue;
+  std::mutex mutex;
+  std::condition_variable ready;
+  bool done = false;
+
+  auto worker = [&]() {
+    uint8_t out[64];
+    for (;;) {
+      item it;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [&] { return done || !queue.empty(); });
+        if (queue.empty())
+          return;
+        it = queue.front();
+        queue.pop_front();
+      }
+      hash_oneshot(w, trace[it.index], message(w, it.index), out);
+      lat[it.index] = elapsed_ns(it.submitted, clock_type::now());
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (size_t t = 0; t < threads; ++t)
+    pool.emplace_back(worker);
+
+  const auto begin = clock_type::now();
+  for (size_t i = 0; i < trace.size(); ++i) {
+    if (rate > 0) {
+      const auto due = begin + std::chrono::duration_cast<clock_type::duration>(
+                                   std::chrono::duration<double>(
+                                       static_cast<double>(i) / rate));
+      std::this_thread::sleep_until(due);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back({i, clock_type::now()});
+    }
+    ready.notify_one();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = true;
+  }
+  ready.notify_all();
+  for (std::thread &t : pool)
+    t.join();
+}
+
+double replay(const workload &w, const std::vector<request> &trace,
+              const replay_config &cfg, std::vector<uint64_t> &lat) {
+  lat.assign(trace.size(), 0);
+  uint8_t out[64];
+  auto start = clock_type::now();
+  if (cfg.api == "batch") {
+    replay_batch(w, trace, cfg.batch, lat);
+  } else if (cfg.api == "async") {
+    replay_async(w, trace, cfg.threads, cfg.rate, lat);
+  } else {
+    const bool incremental = cfg.api == "incremental";
+    for (size_t i = 0; i < trace.size(); ++i) {
+      auto t0 = clock_type::now();
+      if (incremental)
+        hash_incremental(w, trace[i], message(w, i), out, cfg.chunk);
+      else
+        hash_oneshot(w, trace[i], message(w, i), out);
+      lat[i] = elapsed_ns(t0, clock_type::now());
+    }
+  }
+  return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+/* Nearest-rank percentile of sorted latencies */
+double percentile_us(const std::vector<uint64_t> &sorted, double p) {
+  size_t rank = static_cast<size_t>(p / 100.0 * sorted.size() + 0.5);
+  rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+  return static_cast<double>(sorted[rank - 1]) / 1000.0;
+}
+
+void report(const char *source, const replay_config &cfg,
+            const std::vector<request> &trace, double secs,
+            std::vector<uint64_t> &lat, size_t pass) {
+  uint64_t bytes = 0;
+  size_t keyed = 0, small = 0;
+  size_t per_op[4] = {};
+  for (const request &r : trace) {
+    bytes += r.msglen;
+    keyed += r.keylen > 0;
+    small += r.msglen < 64;
+    ++per_op[r.op];
+  }
+  const double n = static_cast<double>(trace.size());
+
+  std::printf("\n--- Replay pass %zu: %s, api=%s ---\n", pass, source,
+              cfg.api.c_str());
+  std::printf("requests %zu  (blake2b %zu, hmac %zu, blake2s %zu, blake3 %zu)"
+              "  keyed %.1f%%  <64B %.1f%%\n",
+              trace.size(), per_op[OP_BLAKE2B], per_op[OP_HMAC],
+              per_op[OP_BLAKE2S], per_op[OP_BLAKE3], 100.0 * keyed / n,
+              100.0 * small / n);
+  std::printf("%-30s %12llu bytes in %.4f s = %8.2f MiB/s  %10.1f req/s\n",
+              "throughput", static_cast<unsigned long long>(bytes), secs,
+              static_cast<double>(bytes) / (1024.0 * 1024.0) / secs, n / secs);
+
+  std::sort(lat.begin(), lat.end());
+  std::printf("%-30s p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+              "latency (us)", percentile_us(lat, 50), percentile_us(lat, 90),
+              percentile_us(lat, 99), percentile_us(lat, 99.9),
+              static_cast<double>(lat.back()) / 1000.0);
+}
+
+int usage() {
+  std::fprintf(stderr,
+               "usage: tinyblake_replay_bench [--trace FILE | --histogram FILE"
+               " | --synthetic]\n"
+               "         [--api oneshot|incremental|batch|async] [--chunk N]"
+               " [--batch N]\n"
+               "         [--threads N] [--rate R] [--records N] [--seed N]"
+               " [--repeat N]\n"
+               "         [--dump FILE]\n");
+  return 2;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv) {
+  const char *trace_path = nullptr;
+  const char *histogram_path = nullptr;
+  const char *dump_path = nullptr;
+  size_t records = 100000, repeat = 1;
+  uint64_t seed = 1;
+  replay_config cfg;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const char *val = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (arg == "--synthetic") {
+      trace_path = histogram_path = nullptr;
+      continue;
+    }
+    if (!val)
+      return usage();
+    ++i;
+    if (arg == "--trace")
+      trace_path = val;
+    else if (arg == "--histogram")
+      histogram_path = val;
+    else if (arg == "--dump")
+      dump_path = val;
+    else if (arg == "--api")
+      cfg.api = val;
+    else if (arg == "--chunk")
+      cfg.chunk = std::strtoull(val, nullptr, 10);
+    else if (arg == "--batch")
+      cfg.batch = std::strtoull(val, nullptr, 10);
+    else if (arg == "--threads")
+      cfg.threads = std::strtoull(val, nullptr, 10);
+    else if (arg == "--rate")
+      cfg.rate = std::strtod(val, nullptr);
+    else if (arg == "--records")
+      records = std::strtoull(val, nullptr, 10);
+    else if (arg == "--seed")
+      seed = std::strtoull(val, nullptr, 10);
+    else if (arg == "--repeat")
+      repeat = std::strtoull(val, nullptr, 10);
+    else
+      return usage();
+  }
+  if (cfg.api != "oneshot" && cfg.api != "incremental" &&
+      cfg.api != "batch" && cfg.api != "async")
+    return usage();
+  if (cfg.chunk == 0 || cfg.batch == 0 || repeat == 0)
+    return usage();
+  if (cfg.threads == 0)
+    cfg.threads = std::max(1u, std::thread::hardware_concurrency());
+
+  std::vector<request> trace;
+  const char *source = "synthetic";
+  if (trace_path) {
+    source = trace_path;
+    if (!load_trace(trace_path, trace))
+      return 1;
+  } else {
+    std::vector<histogram_row> rows;
+    if (histogram_path) {
+      source = histogram_path;
+      if (!load_histogram(histogram_path, rows))
+        return 1;
+    } else {
+      rows.assign(std::begin(SYNTHETIC), std::end(SYNTHETIC));
+    }
+    trace = sample(rows, records, seed);
+  }
+  if (trace.empty()) {
+    std::fprintf(stderr, "empty trace\n");
+    return 1;
+  }
+
+  if (dump_path) {
+    if (!dump_trace(dump_path, trace)) {
+      std::fprintf(stderr, "cannot write %s\n", dump_path);
+      return 1;
+    }
+    std::printf("wrote %zu requests to %s\n", trace.size(), dump_path);
+    return 0;
+  }
+
+  workload w;
+  uint64_t max_len = 0;
+  for (const request &r : trace)
+    max_len = std::max(max_len, r.msglen);
+  w.data.resize(static_cast<size_t>(max_len) + 64);
+  uint64_t s = seed ^ 0x5EED;
+  for (uint8_t &b : w.data)
+    b = static_cast<uint8_t>(splitmix64(s));
+  for (uint8_t &b : w.key)
+    b = static_cast<uint8_t>(splitmix64(s));
+
+  std::printf("=== TinyBLAKE trace replay ===\n");
+  std::vector<uint64_t> lat;
+  for (size_t pass = 1; pass <= repeat; ++pass) {
+    const double secs = replay(w, trace, cfg, lat);
+    report(source, cfg, trace, secs, lat, pass);
+  }
+  return 0;
+}
@@ -0,0 +1,287 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * Roofline benchmark: measures streaming-read and memcpy bandwidth, then
+ * reports each bulk hashing mode's throughput as a fraction of that
+ * bandwidth at the same thread count and working-set size.
+ *
+ *   tinyblake_roofline_bench [--threads N] [--bytes N] [--sizes a,b,...]
+ *
+ *   --threads N   largest thread count (default: hardware threads); the
+ *                 sweep runs 1, 2, 4, ... and N
+ *   --bytes N     bytes each thread processes per measurement
+ *                 (default 256 MiB)
+ *   --sizes LIST  per-thread working sets in KiB (default 16,256,4096,65536,
+ *                 roughly L1, L2, L3 and DRAM)
+ *
+ * One thread gives the per-core roofline; all hardware threads give the
+ * whole-machine figure, which is the per-socket figure on single-socket
+ * hosts. Every thread owns its buffer and loops over it, so a working set
+ * that fits in cache measures cache bandwidth rather than DRAM.
+ *
+ * Hashing reads its input once, so the roofline is the read bandwidth:
+ * the faster of the read loop and memcpy, since memcpy reads as fast as it
+ * copies and libc's copy may use wider vectors than this file is built
+ * for. "%roof" near 100 means the mode is bandwidth-bound at that size and
+ * thread count; lower values are compute headroom.
+ */
+
+#include <tinyblake.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+/* Keeps the read loop's result alive */
+std::atomic<uint64_t> g_sink{0};
+
+/* Per-thread kernel: processes `buf` until `bytes` have gone through it.
+ * `threads` is the total thread count, for modes that share one buffer. */
+using kernel_fn = void (*)(uint8_t *buf, size_t len, size_t bytes,
+                           size_t threads);
+
+void kernel_read(uint8_t *buf, size_t len, size_t bytes, size_t) {
+  /* Eight independent sums over 64-byte lines; wide enough for the
+   * compiler to keep every load port busy, vectorized or not */
+  uint64_t acc[8] = {};
+  for (size_t done = 0; done < bytes; done += len) {
+    for (size_t i = 0; i + 64 <= len; i += 64) {
+      for (int k = 0; k < 8; ++k) {
+        uint64_t w;
+        std::memcpy(&w, buf + i + 8 * k, sizeof(w));
+        acc[k] += w;
+      }
+    }
+  }
+  uint64_t sum = 0;
+  for (int k = 0; k < 8; ++k)
+    sum += acc[k];
+  g_sink.fetch_add(sum, std::memory_order_relaxed);
+}
+
+/* Copies the first half of the buffer onto the second; `bytes` counts the
+ * bytes copied */
+void kernel_copy(uint8_t *buf, size_t len, size_t bytes, size_t) {
+  const size_t half = len / 2;
+  for (size_t done = 0; done < bytes; done += half)
+    std::memcpy(buf + half, buf, half);
+  g_sink.fetch_add(buf[len - 1], std::memory_order_relaxed);
+}
+
+void kernel_blake2b(uint8_t *buf, size_t len, size_t bytes, size_t) {
+  uint8_t out[64];
+  for (size_t done = 0; done < bytes; done += len)
+    tinyblake_blake2b(out, 64, buf, len, nullptr, 0);
+}
+
+/* The buffer as eight equal messages through the multi-lane kernels */
+void kernel_blake2b_many(uint8_t *buf, size_t len, size_t bytes, size_t) {
+  const size_t n = 8, msg = len / n;
+  const void *in[n];
+  size_t inlen[n];
+  for (size_t k = 0; k < n; ++k) {
+    in[k] = buf + k * msg;
+    inlen[k] = msg;
+  }
+  uint8_t out[n * 64];
+  for (size_t done = 0; done < bytes; done += msg * n)
+    tinyblake_blake2b_hash_many(out, 64, in, inlen, n, nullptr, 0);
+}
+
+void kernel_blake3(uint8_t *buf, size_t len, size_t bytes, size_t) {
+  uint8_t out[32];
+  for (size_t done = 0; done < bytes; done += len)
+    tinyblake_blake3(out, 32, buf, len, nullptr);
+}
+
+/* One tree hash over all threads' input at once: a single caller with a
+ * buffer of size * threads bytes, split across `threads` pool workers */
+void kernel_blake3_parallel(uint8_t *buf, size_t len, size_t bytes,
+                            size_t threads) {
+  uint8_t out[32];
+  for (size_t done = 0; done < bytes; done += len) {
+    tinyblake_blake3_state S;
+    tinyblake_blake3_init(&S);
+    tinyblake_blake3_update_parallel(&S, buf, len, threads);
+    tinyblake_blake3_final(&S, out, 32);
+  }
+}
+
+struct mode {
+  const char *name;
+  kernel_fn fn;
+  bool shared; /* one caller over a shared buffer instead of one per thread */
+};
+
+/* Runs `fn` on `threads` threads, each over its own `size`-byte buffer (or
+ * once over a shared size * threads buffer) and returns MiB/s in total */
+double run(const mode &m, size_t size, size_t threads, size_t bytes) {
+  const size_t callers = m.shared ? 1 : threads;
+  const size_t len = m.shared ? size * threads : size;
+  std::vector<std::vector<uint8_t>> bufs(callers);
+  for (size_t t = 0; t < callers; ++t)
+    bufs[t].assign(len, static_cast<uint8_t>(0xA5 ^ t));
+
+  /* Threads fault in their buffers and warm up, then start together */
+  std::atomic<size_t> ready{0};
+  std::atomic<bool> go{false};
+  std::vector<std::thread> pool;
+  for (size_t t = 0; t < callers; ++t) {
+    pool.emplace_back([&, t]() {
+      m.fn(bufs[t].data(), len, len, threads);
+      ready.fetch_add(1);
+      while (!go.load(std::memory_order_acquire))
+        std::this_thread::yield();
+      m.fn(bufs[t].data(), len, m.shared ? bytes * threads : bytes, threads);
+    });
+  }
+  while (ready.load() != callers)
+    std::this_thread::yield();
+  const auto start = clock_type::now();
+  go.store(true, std::memory_order_release);
+  for (std::thread &t : pool)
+    t.join();
+  const double secs =
+      std::chrono::duration<double>(clock_type::now() - start).count();
+
+  const double total =
+      static_cast<double>(bytes) * static_cast<double>(threads);
+  return total / (1024.0 * 1024.0) / secs;
+}
+
+std::string size_label(size_t size) {
+  char buf[32];
+  if (size >= 1024 * 1024 && size % (1024 * 1024) == 0)
+    std::snprintf(buf, sizeof(buf), "%zuMiB", size / (1024 * 1024));
+  else
+    std::snprintf(buf, sizeof(buf), "%zuKiB", size / 1024);
+  return buf;
+}
+
+int usage() {
+  std::fprintf(stderr, "usage: tinyblake_roofline_bench [--threads N] "
+                       "[--bytes N] [--sizes KiB,KiB,...]\n");
+  return 2;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv) {
+  size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+  size_t bytes = 256u << 20;
+  std::vector<size_t> sizes = {16u << 10, 256u << 10, 4u << 20, 64u << 20};
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc)
+      return usage();
+    const char *val = argv[++i];
+    if (arg == "--threads") {
+      max_threads = std::strtoull(val, nullptr, 10);
+    } else if (arg == "--bytes") {
+      bytes = std::strtoull(val, nullptr, 10);
+    } else if (arg == "--sizes") {
+      sizes.clear();
+      for (char *p = const_cast<char *>(val); *p;) {
+        sizes.push_back(std::strtoull(p, &p, 10) << 10);
+        if (*p == ',')
+          ++p;
+        else if (*p)
+          return usage();
+      }
+    } else {
+      return usage();
+    }
+  }
+  /* The multi-lane mode splits each buffer eight ways, one block minimum */
+  for (size_t s : sizes)
+    if (s < 8 * 128)
+      return usage();
+  if (max_threads == 0 || bytes == 0 || sizes.empty())
+    return usage();
+
+  std::vector<size_t> thread_counts;
+  for (size_t t = 1; t < max_threads; t *= 2)
+    thread_counts.push_back(t);
+  thread_counts.push_back(max_threads);
+
+  const mode read_mode = {"read", kernel_read, false};
+  const mode copy_mode = {"copy", kernel_copy, false};
+  const mode hash_modes[] = {
+      {"BLAKE2b-512", kernel_blake2b, false},
+      {"BLAKE2b-512 hash_many x8", kernel_blake2b_many, false},
+      {"BLAKE3", kernel_blake3, false},
+      {"BLAKE3 update_parallel", kernel_blake3_parallel, true},
+  };
+
+  std::printf("=== TinyBLAKE roofline ===\n");
+  std::printf("%zu bytes per thread per measurement\n", bytes);
+
+  /* roof[s][t]: read bandwidth in MiB/s for sizes[s] at thread_counts[t] */
+  std::vector<std::vector<double>> roof(sizes.size());
+
+  std::printf("\n--- Memory bandwidth ---\n");
+  std::printf("%-10s %7s %12s %12s\n", "size", "threads", "read MiB/s",
+              "copy MiB/s");
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    for (size_t t : thread_counts) {
+      const double rd = run(read_mode, sizes[s], t, bytes);
+      const double cp = run(copy_mode, sizes[s], t, bytes);
+      roof[s].push_back(std::max(rd, cp));
+      std::printf("%-10s %7zu %12.1f %12.1f\n", size_label(sizes[s]).c_str(),
+                  t, rd, cp);
+    }
+  }
+
+  for (const mode &m : hash_modes) {
+    std::printf("\n--- %s ---\n", m.name);
+    std::printf("%-10s %7s %12s %7s\n", "size", "threads", "MiB/s", "%roof");
+    for (size_t s = 0; s < sizes.size(); ++s) {
+      for (size_t k = 0; k < thread_counts.size(); ++k) {
+        const double mibs = run(m, sizes[s], thread_counts[k], bytes);
+        std::printf("%-10s %7zu %12.1f %6.1f%%\n",
+                    size_label(sizes[s]).c_str(), thread_counts[k], mibs,
+                    100.0 * mibs / roof[s][k]);
+      }
+    }
+  }
+
+  std::printf("\nDone.\n");
+  return 0;
+}
@@ -0,0 +1,41 @@
+# Find libsodium (it ships no CMake package of its own).
+#
+# Defines Sodium_FOUND, Sodium_INCLUDE_DIRS, Sodium_LIBRARIES,
+# Sodium_VERSION (from sodium/version.h) and the imported target
+# Sodium::Sodium. pkg-config hints are used when available.
+
+find_package(PkgConfig QUIET)
+if(PKG_CONFIG_FOUND)
+    pkg_check_modules(PC_SODIUM QUIET libsodium)
+endif()
+
+find_path(Sodium_INCLUDE_DIR sodium.h
+    HINTS ${PC_SODIUM_INCLUDEDIR} ${PC_SODIUM_INCLUDE_DIRS})
+find_library(Sodium_LIBRARY NAMES sodium libsodium
+    HINTS ${PC_SODIUM_LIBDIR} ${PC_SODIUM_LIBRARY_DIRS})
+
+if(Sodium_INCLUDE_DIR AND EXISTS "${Sodium_INCLUDE_DIR}/sodium/version.h")
+    file(STRINGS "${Sodium_INCLUDE_DIR}/sodium/version.h" _sodium_version
+        REGEX "#define SODIUM_VERSION_STRING ")
+    string(REGEX REPLACE ".*\"([^\"]*)\".*" "\\1" Sodium_VERSION
+        "${_sodium_version}")
+    unset(_sodium_version)
+endif()
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Sodium
+    REQUIRED_VARS Sodium_LIBRARY Sodium_INCLUDE_DIR
+    VERSION_VAR Sodium_VERSION)
+
+if(Sodium_FOUND)
+    set(Sodium_INCLUDE_DIRS ${Sodium_INCLUDE_DIR})
+    set(Sodium_LIBRARIES ${Sodium_LIBRARY})
+    if(NOT TARGET Sodium::Sodium)
+        add_library(Sodium::Sodium UNKNOWN IMPORTED)
+        set_target_properties(Sodium::Sodium PROPERTIES
+            IMPORTED_LOCATION "${Sodium_LIBRARY}"
+            INTERFACE_INCLUDE_DIRECTORIES "${Sodium_INCLUDE_DIR}")
+    endif()
+endif()
+
+mark_as_advanced(Sodium_INCLUDE_DIR Sodium_LIBRARY)
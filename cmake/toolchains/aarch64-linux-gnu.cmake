@@ -0,0 +1,28 @@
+# Cross-compile for AArch64 Linux with the Debian/Ubuntu GNU toolchain
+# (g++-aarch64-linux-gnu) and run the result under qemu-aarch64 user mode:
+#
+#   cmake -S . -B build-arm64 \
+#       -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/aarch64-linux-gnu.cmake \
+#       -DBUILD_TESTS=ON
+#   cmake --build build-arm64 -j
+#   qemu-aarch64 -cpu max -L /usr/aarch64-linux-gnu build-arm64/tinyblake_tests
+#
+# "-cpu max" exposes the SHA3 extension; "-cpu cortex-a72" does not, which
+# exercises the plain NEON dispatch path.
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CMAKE_C_COMPILER aarch64-linux-gnu-gcc)
+set(CMAKE_CXX_COMPILER aarch64-linux-gnu-g++)
+
+set(CMAKE_FIND_ROOT_PATH /usr/aarch64-linux-gnu)
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+if(NOT DEFINED TINYBLAKE_QEMU_CPU)
+    set(TINYBLAKE_QEMU_CPU max)
+endif()
+set(CMAKE_CROSSCOMPILING_EMULATOR
+    qemu-aarch64 -cpu ${TINYBLAKE_QEMU_CPU} -L /usr/aarch64-linux-gnu)
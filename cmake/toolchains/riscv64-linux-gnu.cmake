@@ -0,0 +1,34 @@
+# Cross-compile for 64-bit RISC-V Linux with the Debian/Ubuntu GNU toolchain
+# (g++-riscv64-linux-gnu, GCC 14 or newer for the RVV 1.0 intrinsics) and
+# run the result under qemu-riscv64 user mode:
+#
+#   cmake -S . -B build-rv64 \
+#       -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/riscv64-linux-gnu.cmake \
+#       -DBUILD_TESTS=ON
+#   cmake --build build-rv64 -j
+#   qemu-riscv64 -cpu rv64,v=true,vlen=256 -L /usr/riscv64-linux-gnu \
+#       build-rv64/tinyblake_tests
+#
+# The multi-lane kernel's lane count is VLEN / 64, so change vlen= (128,
+# 256, 512) to exercise 2, 4 and 8 lanes.
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR riscv64)
+
+if(NOT CMAKE_C_COMPILER)
+    set(CMAKE_C_COMPILER riscv64-linux-gnu-gcc)
+endif()
+if(NOT CMAKE_CXX_COMPILER)
+    set(CMAKE_CXX_COMPILER riscv64-linux-gnu-g++)
+endif()
+
+set(CMAKE_FIND_ROOT_PATH /usr/riscv64-linux-gnu)
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+if(NOT DEFINED TINYBLAKE_QEMU_CPU)
+    set(TINYBLAKE_QEMU_CPU "rv64,v=true,vlen=256")
+endif()
+set(CMAKE_CROSSCOMPILING_EMULATOR
+    qemu-riscv64 -cpu ${TINYBLAKE_QEMU_CPU} -L /usr/riscv64-linux-gnu)
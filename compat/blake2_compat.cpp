@@ -0,0 +1,421 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * libb2 API on TinyBLAKE.
+ *
+ * libb2's blake2b_state is public and larger than tinyblake_blake2b_state,
+ * so each call that compresses loads the caller's state into a TinyBLAKE
+ * state, runs the TinyBLAKE function and stores the result back. Updates
+ * that only fill the buffer skip the round trip. TinyBLAKE buffers at
+ * most one block, so only the first half of blake2b_state::buf is used.
+ *
+ * BLAKE2bp's four leaves take equal-length block streams, so whole stripes
+ * go through TinyBLAKE's multi-lane kernel with the leaves in lockstep.
+ * Finalization stays on the single-stream path: it is one block per leaf,
+ * and the last leaf needs the last-node flag, which the lane kernels do
+ * not take.
+ */
+
+#include "blake2.h"
+#include "internal/blake2b_dispatch.h"
+#include "tinyblake/blake2b.h"
+
+#include <cstddef>
+#include <cstring>
+
+static_assert(sizeof(blake2b_param) == 64,
+              "blake2b_param must be the 64-byte parameter block");
+static_assert(sizeof(blake2b_state) == 384 && alignof(blake2b_state) == 64,
+              "blake2b_state must keep libb2's size and alignment");
+
+namespace {
+
+constexpr size_t PARALLELISM = 4;
+
+void load(const blake2b_state *S, tinyblake_blake2b_state *T) {
+  std::memcpy(T->h, S->h, sizeof(T->h));
+  T->t[0] = S->t[0];
+  T->t[1] = S->t[1];
+  std::memcpy(T->buf, S->buf, S->buflen);
+  T->buflen = S->buflen;
+  T->outlen = S->outlen;
+  T->last_node = S->last_node;
+}
+
+void store(const tinyblake_blake2b_state *T, blake2b_state *S) {
+  std::memcpy(S->h, T->h, sizeof(S->h));
+  S->t[0] = T->t[0];
+  S->t[1] = T->t[1];
+  std::memcpy(S->buf, T->buf, T->buflen);
+  S->buflen = static_cast<uint32_t>(T->buflen);
+}
+
+/* Reset S to a freshly initialized TinyBLAKE state T, then wipe T */
+int adopt(blake2b_state *S, tinyblake_blake2b_state *T, int rc) {
+  if (rc == 0) {
+    std::memset(S, 0, sizeof(*S));
+    store(T, S);
+    S->outlen = T->outlen;
+  }
+  tinyblake_secure_zero(T, sizeof(*T));
+  return rc;
+}
+
+/*
+ * blake2bp_state sits inside libb2's pack(1) block, so its leaf and root
+ * states can be at any address even though blake2b_state asks for 64-byte
+ * alignment. They are only addressed as bytes and worked on through an
+ * aligned copy, written back when the copy goes out of scope.
+ */
+class node_copy {
+public:
+  /* Node i < PARALLELISM is leaf i; PARALLELISM is the root */
+  node_copy(blake2bp_state *S, size_t i) {
+    unsigned char *base = reinterpret_cast<unsigned char *>(S);
+    bytes_ = i < PARALLELISM ? base + offsetof(blake2bp_state, S) +
+                                   i * sizeof(blake2b_state)
+                             : base + offsetof(blake2bp_state, R);
+    std::memcpy(&state, bytes_, sizeof(state));
+  }
+  ~node_copy() {
+    std::memcpy(bytes_, &state, sizeof(state));
+    tinyblake_secure_zero(&state, sizeof(state));
+  }
+
+  node_copy(const node_copy &) = delete;
+  node_copy &operator=(const node_copy &) = delete;
+
+  blake2b_state state;
+
+private:
+  unsigned char *bytes_;
+};
+
+/*
+ * Absorb `nstripes` whole stripes into the leaves, block i of each stripe
+ * going to leaf i. Like blake2b_update(), a leaf keeps its newest block
+ * buffered since it may turn out to be the last; each step compresses the
+ * previously buffered block of every leaf in one multi-lane call (two on
+ * 2-lane backends, single-block compresses where there is none).
+ */
+void leaves_absorb(blake2b_state *const leaf[PARALLELISM], const uint8_t *in,
+                   size_t nstripes) {
+  using tinyblake::detail::BLAKE2B_MAX_LANES;
+  if (nstripes == 0)
+    return;
+
+  const tinyblake::detail::blake2b_lanes_kernel &kernel =
+      tinyblake::detail::blake2b_get_lanes();
+  const tinyblake::blake2b_compress_fn single =
+      tinyblake::detail::blake2b_get_compress();
+  const size_t lanes = kernel.lanes;
+  const size_t stripe = PARALLELISM * BLAKE2B_BLOCKBYTES;
+
+  alignas(64) static const uint8_t zero_block[BLAKE2B_BLOCKBYTES] = {};
+  uint64_t idle_h[8] = {};
+  const uint8_t *pending[PARALLELISM];
+  for (size_t i = 0; i < PARALLELISM; ++i)
+    pending[i] = leaf[i]->buflen == BLAKE2B_BLOCKBYTES ? leaf[i]->buf
+                                                       : nullptr;
+
+  for (size_t k = 0; k < nstripes; ++k, in += stripe) {
+    for (size_t i = 0; i < PARALLELISM; ++i) {
+      if (pending[i] && (leaf[i]->t[0] += BLAKE2B_BLOCKBYTES) <
+                            BLAKE2B_BLOCKBYTES)
+        ++leaf[i]->t[1];
+    }
+
+    if (lanes < 2) {
+      for (size_t i = 0; i < PARALLELISM; ++i) {
+        if (pending[i])
+          single(leaf[i]->h, pending[i], leaf[i]->t[0], leaf[i]->t[1],
+                 false);
+      }
+    } else {
+      for (size_t base = 0; base < PARALLELISM; base += lanes) {
+        uint64_t *state[BLAKE2B_MAX_LANES];
+        const uint8_t *block[BLAKE2B_MAX_LANES];
+        uint64_t t0[BLAKE2B_MAX_LANES];
+        uint64_t t1[BLAKE2B_MAX_LANES];
+        uint64_t f0[BLAKE2B_MAX_LANES];
+        for (size_t l = 0; l < lanes; ++l) {
+          const size_t i = base + l;
+          const bool active = i < PARALLELISM && pending[i];
+          state[l] = active ? leaf[i]->h : idle_h;
+          block[l] = active ? pending[i] : zero_block;
+          t0[l] = active ? leaf[i]->t[0] : 0;
+          t1[l] = active ? leaf[i]->t[1] : 0;
+          f0[l] = 0;
+        }
+        kernel.fn(state, block, t0, t1, f0);
+      }
+    }
+
+    for (size_t i = 0; i < PARALLELISM; ++i)
+      pending[i] = in + i * BLAKE2B_BLOCKBYTES;
+  }
+
+  for (size_t i = 0; i < PARALLELISM; ++i) {
+    std::memcpy(leaf[i]->buf, pending[i], BLAKE2B_BLOCKBYTES);
+    leaf[i]->buflen = BLAKE2B_BLOCKBYTES;
+  }
+  tinyblake_secure_zero(idle_h, sizeof(idle_h));
+}
+
+/* Leaves emit the full 64-byte chaining value (inner_length) whatever the
+ * final digest length; the root emits outlen bytes */
+int init_node(blake2b_state *S, size_t outlen, size_t keylen, uint64_t offset,
+              uint8_t depth) {
+  blake2b_param P;
+  std::memset(&P, 0, sizeof(P));
+  P.digest_length = static_cast<uint8_t>(outlen);
+  P.key_length = static_cast<uint8_t>(keylen);
+  P.fanout = PARALLELISM;
+  P.depth = 2;
+  P.node_offset = offset;
+  P.node_depth = depth;
+  P.inner_length = BLAKE2B_OUTBYTES;
+  if (blake2b_init_param(S, &P) != 0)
+    return -1;
+  if (depth == 0)
+    S->outlen = BLAKE2B_OUTBYTES;
+  return 0;
+}
+
+int blake2bp_init_tree(blake2bp_state *S, size_t outlen, const void *key,
+                       size_t keylen) {
+  std::memset(S->buf, 0, sizeof(S->buf));
+  S->buflen = 0;
+  S->outlen = static_cast<uint8_t>(outlen);
+
+  {
+    node_copy root(S, PARALLELISM);
+    if (init_node(&root.state, outlen, keylen, 0, 1) != 0)
+      return -1;
+    root.state.last_node = 1;
+  }
+
+  uint8_t block[BLAKE2B_BLOCKBYTES];
+  std::memset(block, 0, sizeof(block));
+  if (keylen > 0)
+    std::memcpy(block, key, keylen);
+  int rc = 0;
+  for (size_t i = 0; i < PARALLELISM && rc == 0; ++i) {
+    node_copy leaf(S, i);
+    rc = init_node(&leaf.state, outlen, keylen, i, 0);
+    leaf.state.last_node = i == PARALLELISM - 1;
+    if (rc == 0 && keylen > 0)
+      rc = blake2b_update(&leaf.state, block, BLAKE2B_BLOCKBYTES);
+  }
+  tinyblake_secure_zero(block, sizeof(block));
+  return rc;
+}
+
+} /* namespace */
+
+extern "C" {
+
+/* ─── BLAKE2b ─── */
+
+int blake2b_init(blake2b_state *S, size_t outlen) {
+  if (!S)
+    return -1;
+  tinyblake_blake2b_state T;
+  return adopt(S, &T, tinyblake_blake2b_init(&T, outlen));
+}
+
+int blake2b_init_key(blake2b_state *S, size_t outlen, const void *key,
+                     size_t keylen) {
+  if (!S)
+    return -1;
+  tinyblake_blake2b_state T;
+  return adopt(S, &T, tinyblake_blake2b_init_key(&T, outlen, key, keylen));
+}
+
+int blake2b_init_param(blake2b_state *S, const blake2b_param *P) {
+  if (!S || !P)
+    return -1;
+  tinyblake_blake2b_state T;
+  return adopt(S, &T,
+               tinyblake_blake2b_init_param(
+                   &T, reinterpret_cast<const uint8_t *>(P)));
+}
+
+int blake2b_update(blake2b_state *S, const uint8_t *in, size_t inlen) {
+  if (!S || S->buflen > BLAKE2B_BLOCKBYTES)
+    return -1;
+  if (inlen == 0)
+    return 0;
+  if (!in)
+    return -1;
+
+  /* Still fits the buffer: nothing to compress */
+  if (inlen <= BLAKE2B_BLOCKBYTES - S->buflen) {
+    std::memcpy(S->buf + S->buflen, in, inlen);
+    S->buflen += static_cast<uint32_t>(inlen);
+    return 0;
+  }
+
+  tinyblake_blake2b_state T;
+  load(S, &T);
+  const int rc = tinyblake_blake2b_update(&T, in, inlen);
+  if (rc == 0)
+    store(&T, S);
+  tinyblake_secure_zero(&T, sizeof(T));
+  return rc;
+}
+
+int blake2b_final(blake2b_state *S, uint8_t *out, size_t outlen) {
+  if (!S || !out || S->f[0] != 0 || S->buflen > BLAKE2B_BLOCKBYTES)
+    return -1;
+  if (outlen < S->outlen)
+    return -1;
+
+  tinyblake_blake2b_state T;
+  load(S, &T);
+  const int rc = tinyblake_blake2b_final(&T, out, outlen);
+  tinyblake_secure_zero(&T, sizeof(T));
+
+  /* Leave the state finalized, as libb2 does, with nothing secret in it */
+  const uint8_t last_node = S->last_node;
+  tinyblake_secure_zero(S, sizeof(*S));
+  S->f[0] = ~uint64_t{0};
+  S->f[1] = last_node ? ~uint64_t{0} : 0;
+  S->last_node = last_node;
+  return rc;
+}
+
+int blake2b(uint8_t *out, const void *in, const void *key, size_t outlen,
+            size_t inlen, size_t keylen) {
+  if (!out || (!in && inlen > 0) || (!key && keylen > 0))
+    return -1;
+  return tinyblake_blake2b(out, outlen, in, inlen, key, keylen);
+}
+
+/* ─── BLAKE2bp ─── */
+
+int blake2bp_init(blake2bp_state *S, size_t outlen) {
+  if (!S || outlen == 0 || outlen > BLAKE2B_OUTBYTES)
+    return -1;
+  return blake2bp_init_tree(S, outlen, nullptr, 0);
+}
+
+int blake2bp_init_key(blake2bp_state *S, size_t outlen, const void *key,
+                      size_t keylen) {
+  if (!S || outlen == 0 || outlen > BLAKE2B_OUTBYTES)
+    return -1;
+  if (!key || keylen == 0 || keylen > BLAKE2B_KEYBYTES)
+    return -1;
+  return blake2bp_init_tree(S, outlen, key, keylen);
+}
+
+int blake2bp_update(blake2bp_state *S, const uint8_t *in, size_t inlen) {
+  const size_t stripe = PARALLELISM * BLAKE2B_BLOCKBYTES;
+  if (!S || S->buflen > stripe)
+    return -1;
+  if (inlen == 0)
+    return 0;
+  if (!in)
+    return -1;
+
+  size_t left = S->buflen;
+  if (inlen >= stripe - left) {
+    node_copy l0(S, 0), l1(S, 1), l2(S, 2), l3(S, 3);
+    blake2b_state *const leaf[PARALLELISM] = {&l0.state, &l1.state,
+                                              &l2.state, &l3.state};
+
+    /* Complete a buffered stripe first */
+    if (left > 0) {
+      const size_t fill = stripe - left;
+      std::memcpy(S->buf + left, in, fill);
+      leaves_absorb(leaf, S->buf, 1);
+      in += fill;
+      inlen -= fill;
+      left = 0;
+    }
+
+    /* Whole stripes straight from the input */
+    leaves_absorb(leaf, in, inlen / stripe);
+    in += inlen - inlen % stripe;
+    inlen %= stripe;
+  }
+
+  if (inlen > 0)
+    std::memcpy(S->buf + left, in, inlen);
+  S->buflen = static_cast<uint32_t>(left + inlen);
+  return 0;
+}
+
+int blake2bp_final(blake2bp_state *S, uint8_t *out, size_t outlen) {
+  if (!S || !out || outlen < S->outlen ||
+      S->buflen > PARALLELISM * BLAKE2B_BLOCKBYTES)
+    return -1;
+
+  uint8_t hash[PARALLELISM][BLAKE2B_OUTBYTES];
+  int rc = 0;
+  for (size_t i = 0; i < PARALLELISM && rc == 0; ++i) {
+    node_copy leaf(S, i);
+    if (S->buflen > i * BLAKE2B_BLOCKBYTES) {
+      size_t left = S->buflen - i * BLAKE2B_BLOCKBYTES;
+      if (left > BLAKE2B_BLOCKBYTES)
+        left = BLAKE2B_BLOCKBYTES;
+      rc = blake2b_update(&leaf.state, S->buf + i * BLAKE2B_BLOCKBYTES, left);
+    }
+    if (rc == 0)
+      rc = blake2b_final(&leaf.state, hash[i], BLAKE2B_OUTBYTES);
+  }
+  if (rc == 0) {
+    node_copy root(S, PARALLELISM);
+    rc = blake2b_update(&root.state, &hash[0][0], sizeof(hash));
+    if (rc == 0)
+      rc = blake2b_final(&root.state, out, outlen);
+  }
+
+  tinyblake_secure_zero(hash, sizeof(hash));
+  tinyblake_secure_zero(S->buf, sizeof(S->buf));
+  return rc;
+}
+
+int blake2bp(uint8_t *out, const void *in, const void *key, size_t outlen,
+             size_t inlen, size_t keylen) {
+  if (!out || (!in && inlen > 0) || (!key && keylen > 0))
+    return -1;
+
+  blake2bp_state S;
+  int rc = keylen > 0 ? blake2bp_init_key(&S, outlen, key, keylen)
+                      : blake2bp_init(&S, outlen);
+  if (rc == 0)
+    rc = blake2bp_update(&S, static_cast<const uint8_t *>(in), inlen);
+  if (rc == 0)
+    rc = blake2bp_final(&S, out, outlen);
+  tinyblake_secure_zero(&S, sizeof(S));
+  return rc;
+}
+
+} /* extern "C" */
@@ -0,0 +1,295 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * libsodium crypto_generichash API on TinyBLAKE.
+ *
+ * libsodium's state is opaque, so a tinyblake_blake2b_state lives directly
+ * in its storage and every call forwards without copying.
+ */
+
+#include "sodium/crypto_generichash.h"
+#include "tinyblake/blake2b.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace {
+
+struct generichash_state {
+  tinyblake_blake2b_state S;
+  uint8_t finalized;
+};
+
+static_assert(sizeof(crypto_generichash_blake2b_state) == 384 &&
+                  alignof(crypto_generichash_blake2b_state) == 64,
+              "state must keep libsodium's size and alignment");
+static_assert(sizeof(generichash_state) <=
+                  sizeof(crypto_generichash_blake2b_state),
+              "generichash_state must fit libsodium's opaque state");
+
+generichash_state *state_of(crypto_generichash_blake2b_state *state) {
+  return std::launder(reinterpret_cast<generichash_state *>(state->opaque));
+}
+
+bool valid_lengths(size_t outlen, size_t keylen) {
+  return outlen > 0 && outlen <= crypto_generichash_blake2b_BYTES_MAX &&
+         keylen <= crypto_generichash_blake2b_KEYBYTES_MAX;
+}
+
+/* Parameter block with the given lengths and optional salt/personal, plus
+ * the padded key block when keyed */
+int init_state(tinyblake_blake2b_state *S, const unsigned char *key,
+               size_t keylen, size_t outlen, const unsigned char *salt,
+               const unsigned char *personal) {
+  if (!key)
+    keylen = 0;
+
+  uint8_t param[64];
+  std::memset(param, 0, sizeof(param));
+  param[0] = static_cast<uint8_t>(outlen);
+  param[1] = static_cast<uint8_t>(keylen);
+  param[2] = 1; /* fanout */
+  param[3] = 1; /* depth */
+  if (salt)
+    std::memcpy(param + 32, salt, crypto_generichash_blake2b_SALTBYTES);
+  if (personal)
+    std::memcpy(param + 48, personal, crypto_generichash_blake2b_PERSONALBYTES);
+
+  int rc = tinyblake_blake2b_init_param(S, param);
+  if (rc == 0 && keylen > 0) {
+    uint8_t block[TINYBLAKE_BLAKE2B_BLOCKBYTES];
+    std::memset(block, 0, sizeof(block));
+    std::memcpy(block, key, keylen);
+    rc = tinyblake_blake2b_update(S, block, sizeof(block));
+    tinyblake_secure_zero(block, sizeof(block));
+  }
+  return rc;
+}
+
+/* Absorb a 64-bit length in size_t pieces (only splits on 32-bit hosts) */
+int update_state(tinyblake_blake2b_state *S, const unsigned char *in,
+                 unsigned long long inlen) {
+  while (inlen > 0) {
+    size_t chunk = static_cast<size_t>(inlen);
+    if (static_cast<unsigned long long>(chunk) != inlen)
+      chunk = SIZE_MAX;
+    if (tinyblake_blake2b_update(S, in, chunk) != 0)
+      return -1;
+    in += chunk;
+    inlen -= chunk;
+  }
+  return 0;
+}
+
+} /* namespace */
+
+extern "C" {
+
+/* ─── crypto_generichash_blake2b ─── */
+
+size_t crypto_generichash_blake2b_bytes_min(void) {
+  return crypto_generichash_blake2b_BYTES_MIN;
+}
+
+size_t crypto_generichash_blake2b_bytes_max(void) {
+  return crypto_generichash_blake2b_BYTES_MAX;
+}
+
+size_t crypto_generichash_blake2b_bytes(void) {
+  return crypto_generichash_blake2b_BYTES;
+}
+
+size_t crypto_generichash_blake2b_keybytes_min(void) {
+  return crypto_generichash_blake2b_KEYBYTES_MIN;
+}
+
+size_t crypto_generichash_blake2b_keybytes_max(void) {
+  return crypto_generichash_blake2b_KEYBYTES_MAX;
+}
+
+size_t crypto_generichash_blake2b_keybytes(void) {
+  return crypto_generichash_blake2b_KEYBYTES;
+}
+
+size_t crypto_generichash_blake2b_saltbytes(void) {
+  return crypto_generichash_blake2b_SALTBYTES;
+}
+
+size_t crypto_generichash_blake2b_personalbytes(void) {
+  return crypto_generichash_blake2b_PERSONALBYTES;
+}
+
+size_t crypto_generichash_blake2b_statebytes(void) {
+  return sizeof(crypto_generichash_blake2b_state);
+}
+
+int crypto_generichash_blake2b(unsigned char *out, size_t outlen,
+                               const unsigned char *in,
+                               unsigned long long inlen,
+                               const unsigned char *key, size_t keylen) {
+  if (!out || !valid_lengths(outlen, keylen))
+    return -1;
+  if ((!in && inlen > 0) || (!key && keylen > 0))
+    return -1;
+
+  /* Whole message addressable: one call, one kernel choice */
+  if (static_cast<unsigned long long>(static_cast<size_t>(inlen)) == inlen)
+    return tinyblake_blake2b(out, outlen, in, static_cast<size_t>(inlen), key,
+                             keylen);
+  return crypto_generichash_blake2b_salt_personal(out, outlen, in, inlen, key,
+                                                  keylen, nullptr, nullptr);
+}
+
+int crypto_generichash_blake2b_salt_personal(
+    unsigned char *out, size_t outlen, const unsigned char *in,
+    unsigned long long inlen, const unsigned char *key, size_t keylen,
+    const unsigned char *salt, const unsigned char *personal) {
+  if (!out || !valid_lengths(outlen, keylen))
+    return -1;
+  if ((!in && inlen > 0) || (!key && keylen > 0))
+    return -1;
+
+  tinyblake_blake2b_state S;
+  int rc = init_state(&S, key, keylen, outlen, salt, personal);
+  if (rc == 0)
+    rc = update_state(&S, in, inlen);
+  if (rc == 0)
+    rc = tinyblake_blake2b_final(&S, out, outlen);
+  tinyblake_secure_zero(&S, sizeof(S));
+  return rc;
+}
+
+int crypto_generichash_blake2b_init(crypto_generichash_blake2b_state *state,
+                                    const unsigned char *key,
+                                    const size_t keylen, const size_t outlen) {
+  return crypto_generichash_blake2b_init_salt_personal(
+      state, key, keylen, outlen, nullptr, nullptr);
+}
+
+int crypto_generichash_blake2b_init_salt_personal(
+    crypto_generichash_blake2b_state *state, const unsigned char *key,
+    const size_t keylen, const size_t outlen, const unsigned char *salt,
+    const unsigned char *personal) {
+  if (!state || !valid_lengths(outlen, keylen))
+    return -1;
+
+  std::memset(state, 0, sizeof(*state));
+  generichash_state *st = new (state->opaque) generichash_state();
+  if (init_state(&st->S, key, keylen, outlen, salt, personal) != 0) {
+    tinyblake_secure_zero(state, sizeof(*state));
+    return -1;
+  }
+  return 0;
+}
+
+int crypto_generichash_blake2b_update(crypto_generichash_blake2b_state *state,
+                                      const unsigned char *in,
+                                      unsigned long long inlen) {
+  if (!state)
+    return -1;
+  generichash_state *st = state_of(state);
+  if (st->finalized)
+    return -1;
+  return update_state(&st->S, in, inlen);
+}
+
+int crypto_generichash_blake2b_final(crypto_generichash_blake2b_state *state,
+                                     unsigned char *out, const size_t outlen) {
+  if (!state || !out || outlen == 0 ||
+      outlen > crypto_generichash_blake2b_BYTES_MAX)
+    return -1;
+  generichash_state *st = state_of(state);
+  if (st->finalized)
+    return -1;
+
+  /* libsodium emits outlen bytes whatever length init was given; the
+   * chaining value does not depend on this field once initialized */
+  st->S.outlen = static_cast<uint8_t>(outlen);
+  const int rc = tinyblake_blake2b_final(&st->S, out, outlen);
+  st->finalized = 1;
+  return rc;
+}
+
+/* ─── crypto_generichash ─── */
+
+size_t crypto_generichash_bytes_min(void) {
+  return crypto_generichash_BYTES_MIN;
+}
+
+size_t crypto_generichash_bytes_max(void) {
+  return crypto_generichash_BYTES_MAX;
+}
+
+size_t crypto_generichash_bytes(void) { return crypto_generichash_BYTES; }
+
+size_t crypto_generichash_keybytes_min(void) {
+  return crypto_generichash_KEYBYTES_MIN;
+}
+
+size_t crypto_generichash_keybytes_max(void) {
+  return crypto_generichash_KEYBYTES_MAX;
+}
+
+size_t crypto_generichash_keybytes(void) {
+  return crypto_generichash_KEYBYTES;
+}
+
+const char *crypto_generichash_primitive(void) {
+  return crypto_generichash_PRIMITIVE;
+}
+
+size_t crypto_generichash_statebytes(void) {
+  return sizeof(crypto_generichash_state);
+}
+
+int crypto_generichash(unsigned char *out, size_t outlen,
+                       const unsigned char *in, unsigned long long inlen,
+                       const unsigned char *key, size_t keylen) {
+  return crypto_generichash_blake2b(out, outlen, in, inlen, key, keylen);
+}
+
+int crypto_generichash_init(crypto_generichash_state *state,
+                            const unsigned char *key, const size_t keylen,
+                            const size_t outlen) {
+  return crypto_generichash_blake2b_init(state, key, keylen, outlen);
+}
+
+int crypto_generichash_update(crypto_generichash_state *state,
+                              const unsigned char *in,
+                              unsigned long long inlen) {
+  return crypto_generichash_blake2b_update(state, in, inlen);
+}
+
+int crypto_generichash_final(crypto_generichash_state *state,
+                             unsigned char *out, const size_t outlen) {
+  return crypto_generichash_blake2b_final(state, out, outlen);
+}
+
+} /* extern "C" */
@@ -0,0 +1,134 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_COMPAT_BLAKE2_H
+#define TINYBLAKE_COMPAT_BLAKE2_H
+
+/*
+ * libb2-compatible BLAKE2b / BLAKE2bp API implemented on TinyBLAKE.
+ *
+ * Types, constants, struct layouts and function signatures follow libb2's
+ * <blake2.h>, so code written against libb2 builds and links against
+ * tinyblake_compat unchanged and may keep blake2b_state objects in its own
+ * structs. Every function returns 0 on success and -1 on bad arguments,
+ * as libb2 does. BLAKE2s and BLAKE2sp are not provided.
+ */
+
+#include "tinyblake_compat_export.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum blake2b_constant {
+  BLAKE2B_BLOCKBYTES = 128,
+  BLAKE2B_OUTBYTES = 64,
+  BLAKE2B_KEYBYTES = 64,
+  BLAKE2B_SALTBYTES = 16,
+  BLAKE2B_PERSONALBYTES = 16
+};
+
+#pragma pack(push, 1)
+
+/* The 64-byte BLAKE2b parameter block, byte for byte */
+typedef struct __blake2b_param {
+  uint8_t digest_length;
+  uint8_t key_length;
+  uint8_t fanout;
+  uint8_t depth;
+  uint32_t leaf_length;
+  uint64_t node_offset;
+  uint8_t node_depth;
+  uint8_t inner_length;
+  uint8_t reserved[14];
+  uint8_t salt[BLAKE2B_SALTBYTES];
+  uint8_t personal[BLAKE2B_PERSONALBYTES];
+} blake2b_param;
+
+/*
+ * Streaming state. Set last_node to 1 before blake2b_final() on the last
+ * node of a tree level; f[0] is nonzero once the state is finalized.
+ */
+typedef struct TINYBLAKE_COMPAT_ALIGN(64) __blake2b_state {
+  uint64_t h[8];
+  uint64_t t[2];
+  uint64_t f[2];
+  uint8_t buf[2 * BLAKE2B_BLOCKBYTES];
+  uint32_t buflen;
+  uint8_t outlen;
+  uint8_t last_node;
+} blake2b_state;
+
+/* BLAKE2bp: four interleaved leaves under one root */
+typedef struct __blake2bp_state {
+  blake2b_state S[4][1];
+  blake2b_state R[1];
+  uint8_t buf[4 * BLAKE2B_BLOCKBYTES];
+  uint32_t buflen;
+  uint8_t outlen;
+} blake2bp_state;
+
+#pragma pack(pop)
+
+/* Streaming API */
+TINYBLAKE_COMPAT_API int blake2b_init(blake2b_state *S, size_t outlen);
+TINYBLAKE_COMPAT_API int blake2b_init_key(blake2b_state *S, size_t outlen,
+                                          const void *key, size_t keylen);
+TINYBLAKE_COMPAT_API int blake2b_init_param(blake2b_state *S,
+                                            const blake2b_param *P);
+TINYBLAKE_COMPAT_API int blake2b_update(blake2b_state *S, const uint8_t *in,
+                                        size_t inlen);
+/* Writes the digest length the state was initialized with; outlen is the
+ * buffer size and must be at least that */
+TINYBLAKE_COMPAT_API int blake2b_final(blake2b_state *S, uint8_t *out,
+                                       size_t outlen);
+
+TINYBLAKE_COMPAT_API int blake2bp_init(blake2bp_state *S, size_t outlen);
+TINYBLAKE_COMPAT_API int blake2bp_init_key(blake2bp_state *S, size_t outlen,
+                                           const void *key, size_t keylen);
+TINYBLAKE_COMPAT_API int blake2bp_update(blake2bp_state *S, const uint8_t *in,
+                                         size_t inlen);
+/* As blake2b_final() */
+TINYBLAKE_COMPAT_API int blake2bp_final(blake2bp_state *S, uint8_t *out,
+                                        size_t outlen);
+
+/* Simple API (note libb2's argument order) */
+TINYBLAKE_COMPAT_API int blake2b(uint8_t *out, const void *in, const void *key,
+                                 size_t outlen, size_t inlen, size_t keylen);
+TINYBLAKE_COMPAT_API int blake2bp(uint8_t *out, const void *in,
+                                  const void *key, size_t outlen, size_t inlen,
+                                  size_t keylen);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TINYBLAKE_COMPAT_BLAKE2_H */
@@ -0,0 +1,85 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_COMPAT_CRYPTO_GENERICHASH_H
+#define TINYBLAKE_COMPAT_CRYPTO_GENERICHASH_H
+
+/*
+ * libsodium-compatible crypto_generichash_* API: BLAKE2b under its generic
+ * name, with the semantics documented in crypto_generichash_blake2b.h.
+ */
+
+#include "crypto_generichash_blake2b.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define crypto_generichash_BYTES_MIN crypto_generichash_blake2b_BYTES_MIN
+#define crypto_generichash_BYTES_MAX crypto_generichash_blake2b_BYTES_MAX
+#define crypto_generichash_BYTES crypto_generichash_blake2b_BYTES
+#define crypto_generichash_KEYBYTES_MIN crypto_generichash_blake2b_KEYBYTES_MIN
+#define crypto_generichash_KEYBYTES_MAX crypto_generichash_blake2b_KEYBYTES_MAX
+#define crypto_generichash_KEYBYTES crypto_generichash_blake2b_KEYBYTES
+#define crypto_generichash_PRIMITIVE "blake2b"
+
+typedef crypto_generichash_blake2b_state crypto_generichash_state;
+
+TINYBLAKE_COMPAT_API size_t crypto_generichash_bytes_min(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_bytes_max(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_bytes(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_keybytes_min(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_keybytes_max(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_keybytes(void);
+TINYBLAKE_COMPAT_API const char *crypto_generichash_primitive(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_statebytes(void);
+
+TINYBLAKE_COMPAT_API int crypto_generichash(unsigned char *out, size_t outlen,
+                                            const unsigned char *in,
+                                            unsigned long long inlen,
+                                            const unsigned char *key,
+                                            size_t keylen);
+
+TINYBLAKE_COMPAT_API int
+crypto_generichash_init(crypto_generichash_state *state,
+                        const unsigned char *key, const size_t keylen,
+                        const size_t outlen);
+
+TINYBLAKE_COMPAT_API int
+crypto_generichash_update(crypto_generichash_state *state,
+                          const unsigned char *in, unsigned long long inlen);
+
+TINYBLAKE_COMPAT_API int
+crypto_generichash_final(crypto_generichash_state *state, unsigned char *out,
+                         const size_t outlen);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TINYBLAKE_COMPAT_CRYPTO_GENERICHASH_H */
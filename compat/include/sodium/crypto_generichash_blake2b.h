@@ -0,0 +1,115 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_COMPAT_CRYPTO_GENERICHASH_BLAKE2B_H
+#define TINYBLAKE_COMPAT_CRYPTO_GENERICHASH_BLAKE2B_H
+
+/*
+ * libsodium-compatible crypto_generichash_blake2b_* API implemented on
+ * TinyBLAKE, matching libsodium 1.0.18's constants, state size and
+ * signatures. Where libsodium aborts on misuse (a NULL output, or a NULL
+ * key with a nonzero length in the one-shot functions) these return -1.
+ * crypto_generichash_blake2b_keygen() is not provided; no randomness
+ * source is part of this library.
+ */
+
+#include "../tinyblake_compat_export.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define crypto_generichash_blake2b_BYTES_MIN 16U
+#define crypto_generichash_blake2b_BYTES_MAX 64U
+#define crypto_generichash_blake2b_BYTES 32U
+#define crypto_generichash_blake2b_KEYBYTES_MIN 16U
+#define crypto_generichash_blake2b_KEYBYTES_MAX 64U
+#define crypto_generichash_blake2b_KEYBYTES 32U
+#define crypto_generichash_blake2b_SALTBYTES 16U
+#define crypto_generichash_blake2b_PERSONALBYTES 16U
+
+/* Opaque; 384 bytes on a 64-byte boundary, as in libsodium */
+typedef struct TINYBLAKE_COMPAT_ALIGN(64) crypto_generichash_blake2b_state {
+  unsigned char opaque[384];
+} crypto_generichash_blake2b_state;
+
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_bytes_min(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_bytes_max(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_bytes(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_keybytes_min(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_keybytes_max(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_keybytes(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_saltbytes(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_personalbytes(void);
+TINYBLAKE_COMPAT_API size_t crypto_generichash_blake2b_statebytes(void);
+
+/*
+ * One-shot hash. outlen is 1..64 and keylen 0..64 (the _MIN constants are
+ * recommendations, not enforced); a NULL or empty key means unkeyed.
+ */
+TINYBLAKE_COMPAT_API int
+crypto_generichash_blake2b(unsigned char *out, size_t outlen,
+                           const unsigned char *in, unsigned long long inlen,
+                           const unsigned char *key, size_t keylen);
+
+/* As above with a 16-byte salt and personalization; NULL means zeros */
+TINYBLAKE_COMPAT_API int crypto_generichash_blake2b_salt_personal(
+    unsigned char *out, size_t outlen, const unsigned char *in,
+    unsigned long long inlen, const unsigned char *key, size_t keylen,
+    const unsigned char *salt, const unsigned char *personal);
+
+TINYBLAKE_COMPAT_API int
+crypto_generichash_blake2b_init(crypto_generichash_blake2b_state *state,
+                                const unsigned char *key, const size_t keylen,
+                                const size_t outlen);
+
+TINYBLAKE_COMPAT_API int crypto_generichash_blake2b_init_salt_personal(
+    crypto_generichash_blake2b_state *state, const unsigned char *key,
+    const size_t keylen, const size_t outlen, const unsigned char *salt,
+    const unsigned char *personal);
+
+TINYBLAKE_COMPAT_API int
+crypto_generichash_blake2b_update(crypto_generichash_blake2b_state *state,
+                                  const unsigned char *in,
+                                  unsigned long long inlen);
+
+/*
+ * Writes outlen (1..64) bytes of the final chaining value, which need not
+ * match the length given to init. Returns -1 if already finalized.
+ */
+TINYBLAKE_COMPAT_API int
+crypto_generichash_blake2b_final(crypto_generichash_blake2b_state *state,
+                                 unsigned char *out, const size_t outlen);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TINYBLAKE_COMPAT_CRYPTO_GENERICHASH_BLAKE2B_H */
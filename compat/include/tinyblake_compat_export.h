@@ -0,0 +1,58 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_COMPAT_EXPORT_H
+#define TINYBLAKE_COMPAT_EXPORT_H
+
+/*
+ * Symbol visibility for the compatibility library, mirroring TINYBLAKE_API.
+ * The libb2 and libsodium headers declare their functions with it.
+ */
+#if defined(TINYBLAKE_COMPAT_SHARED)
+#if defined(_WIN32) || defined(__CYGWIN__)
+#if defined(TINYBLAKE_COMPAT_BUILDING)
+#define TINYBLAKE_COMPAT_API __declspec(dllexport)
+#else
+#define TINYBLAKE_COMPAT_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__) || defined(__clang__)
+#define TINYBLAKE_COMPAT_API __attribute__((visibility("default")))
+#else
+#define TINYBLAKE_COMPAT_API
+#endif
+#else
+#define TINYBLAKE_COMPAT_API
+#endif
+
+#if defined(_MSC_VER)
+#define TINYBLAKE_COMPAT_ALIGN(n) __declspec(align(n))
+#else
+#define TINYBLAKE_COMPAT_ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+#endif /* TINYBLAKE_COMPAT_EXPORT_H */
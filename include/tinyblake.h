@@ -29,10 +29,23 @@
 #ifndef TINYBLAKE_H
 #define TINYBLAKE_H
 
+#include "tinyblake/balloon.h"
 #include "tinyblake/blake2b.h"
+#include "tinyblake/blake2b_tuple.h"
+#include "tinyblake/blake2s.h"
+#include "tinyblake/blake2xb.h"
+#include "tinyblake/blake3.h"
+#include "tinyblake/chain.h"
 #include "tinyblake/common.h"
+#include "tinyblake/encoding.h"
 #include "tinyblake/hmac.h"
+#include "tinyblake/hmac_blake2s.h"
+#include "tinyblake/keyed_multi.h"
+#include "tinyblake/lthash.h"
 #include "tinyblake/pbkdf2.h"
+#include "tinyblake/pow.h"
+#include "tinyblake/stats.h"
 #include "tinyblake/version.h"
+#include "tinyblake/wots.h"
 
 #endif /* TINYBLAKE_H */
\ No newline at end of file
@@ -0,0 +1,119 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BALLOON_H
+#define TINYBLAKE_BALLOON_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  TINYBLAKE_BALLOON_OUTBYTES = 64,   /* one BLAKE2b-512 block */
+  TINYBLAKE_BALLOON_DELTA = 3,       /* dependencies mixed per block */
+  TINYBLAKE_BALLOON_M_MAXSALT = 1024 /* longest salt for Balloon-M */
+};
+
+/*
+ * Balloon hashing (Boneh, Corrigan-Gibbs, Schechter 2016) instantiated
+ * with BLAKE2b-512. Integers are encoded as LE64 and H(a, b, ...) is
+ * BLAKE2b-512 of the concatenation:
+ *
+ *   buf[0] = H(cnt++, passwd, salt)
+ *   buf[m] = H(cnt++, buf[m - 1])                        m = 1..s_cost-1
+ *   for t in 0..t_cost-1, m in 0..s_cost-1:
+ *     buf[m] = H(cnt++, buf[m - 1 mod s_cost], buf[m])
+ *     for i in 0..2:
+ *       other  = LE512(H(cnt++, salt, t, m, i)) mod s_cost
+ *       buf[m] = H(cnt++, buf[m], buf[other])
+ *   output = buf[s_cost - 1]
+ *
+ * The index hashes depend only on the salt and counters, so they are
+ * precomputed in batches on the multi-lane kernels. Blocks live in a
+ * page-backed arena (huge pages where the OS grants them).
+ */
+
+/**
+ * Sequential Balloon. s_cost is the number of 64-byte blocks
+ * (1..2^32), t_cost the number of mixing rounds (>= 1). Writes 64 bytes to
+ * `out`. Returns 0 on success, -1 on invalid arguments or allocation
+ * failure.
+ */
+TINYBLAKE_API int tinyblake_balloon(void *out, const void *passwd,
+                                    size_t passwdlen, const void *salt,
+                                    size_t saltlen, uint64_t s_cost,
+                                    uint64_t t_cost);
+
+/**
+ * Balloon-M: p_cost independent instances with salts salt || LE64(p + 1),
+ * p = 0..p_cost-1, XORed together, then
+ * out = H(passwd, salt, xor_of_instances). Instances run on up to
+ * `threads` threads (0 = all hardware threads); each allocates its own
+ * s_cost-block arena. saltlen is limited to TINYBLAKE_BALLOON_M_MAXSALT so
+ * the per-instance salt fits a fixed buffer.
+ */
+TINYBLAKE_API int tinyblake_balloon_m(void *out, const void *passwd,
+                                      size_t passwdlen, const void *salt,
+                                      size_t saltlen, uint64_t s_cost,
+                                      uint64_t t_cost, uint32_t p_cost,
+                                      size_t threads);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <vector>
+
+namespace tinyblake::balloon {
+
+inline constexpr size_t OUT_BYTES = 64;
+
+/** Sequential Balloon; see tinyblake_balloon(). */
+TINYBLAKE_API std::vector<uint8_t> hash(const void *passwd, size_t passwdlen,
+                                        const void *salt, size_t saltlen,
+                                        uint64_t s_cost, uint64_t t_cost);
+
+/** Balloon-M; see tinyblake_balloon_m(). */
+TINYBLAKE_API std::vector<uint8_t>
+hash_m(const void *passwd, size_t passwdlen, const void *salt, size_t saltlen,
+       uint64_t s_cost, uint64_t t_cost, uint32_t p_cost, size_t threads = 0);
+
+} /* namespace tinyblake::balloon */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_BALLOON_H */
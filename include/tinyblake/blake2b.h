@@ -53,6 +53,8 @@ typedef struct tinyblake_blake2b_state {
   uint8_t buf[128];
   size_t buflen;
   uint8_t outlen;
+  uint8_t last_node; /* tree hashing: set to 1 before final() on the last
+                        node of a level; init() clears it */
 } tinyblake_blake2b_state;
 
 TINYBLAKE_API int tinyblake_blake2b_init(tinyblake_blake2b_state *state,
@@ -78,6 +80,177 @@ TINYBLAKE_API int tinyblake_blake2b(void *out, size_t outlen, const void *in,
                                     size_t inlen, const void *key,
                                     size_t keylen);
 
+/**
+ * Hash n independent messages in[i][0..inlen[i]) with the same outlen and
+ * optional key; digest i goes to out + i * outlen. Messages run through the
+ * multi-lane kernels (4 with AVX2, 8 with AVX-512) when available.
+ */
+TINYBLAKE_API int tinyblake_blake2b_hash_many(void *out, size_t outlen,
+                                              const void *const in[],
+                                              const size_t inlen[], size_t n,
+                                              const void *key, size_t keylen);
+
+/* ─── Cache-line-aligned state (layout version 2) ─── */
+
+/**
+ * BLAKE2b state laid out on 64-byte cache lines: the counters and buffer
+ * fill that every update touches share line 0, the chaining value owns line
+ * 1 (so SIMD backends load and store it aligned), and the block buffer fills
+ * lines 2-3. sizeof is a multiple of 64, so adjacent elements of an array
+ * never share a line.
+ *
+ * Used through the *_v2 functions below, which behave exactly like their
+ * tinyblake_blake2b_state counterparts. Stack and static objects get the
+ * alignment automatically; heap arrays should come from
+ * tinyblake_blake2b_state_array_alloc().
+ */
+typedef struct tinyblake_blake2b_state_v2 {
+  uint64_t t[2];
+  size_t buflen;
+  uint8_t outlen;
+  uint8_t version; /* TINYBLAKE_BLAKE2B_STATE_V2 once initialized */
+  alignas(64) uint64_t h[8];
+  alignas(64) uint8_t buf[128];
+} tinyblake_blake2b_state_v2;
+
+enum { TINYBLAKE_BLAKE2B_STATE_V2 = 2 };
+
+TINYBLAKE_API int tinyblake_blake2b_init_v2(tinyblake_blake2b_state_v2 *state,
+                                            size_t outlen);
+
+TINYBLAKE_API int
+tinyblake_blake2b_init_key_v2(tinyblake_blake2b_state_v2 *state, size_t outlen,
+                              const void *key, size_t keylen);
+
+TINYBLAKE_API int
+tinyblake_blake2b_init_param_v2(tinyblake_blake2b_state_v2 *state,
+                                const uint8_t param[64]);
+
+TINYBLAKE_API int
+tinyblake_blake2b_update_v2(tinyblake_blake2b_state_v2 *state, const void *in,
+                            size_t inlen);
+
+TINYBLAKE_API int tinyblake_blake2b_final_v2(tinyblake_blake2b_state_v2 *state,
+                                             void *out, size_t outlen);
+
+/**
+ * Allocate `count` zeroed, 64-byte-aligned v2 states, one or more whole
+ * cache lines each, for per-thread hashing without false sharing.
+ * Returns NULL on count == 0 or allocation failure.
+ */
+TINYBLAKE_API tinyblake_blake2b_state_v2 *
+tinyblake_blake2b_state_array_alloc(size_t count);
+
+/**
+ * Wipe and free an array from tinyblake_blake2b_state_array_alloc().
+ * NULL is ignored.
+ */
+TINYBLAKE_API void
+tinyblake_blake2b_state_array_free(tinyblake_blake2b_state_v2 *states,
+                                   size_t count);
+
+/* ─── Size-class dispatch ─── */
+
+/**
+ * Size classes for kernel selection. A call that compresses at most
+ * single_max bytes uses the SINGLE kernel, at most small_max bytes the
+ * SMALL kernel, and anything larger the BULK kernel. The one-shot
+ * tinyblake_blake2b() classifies the whole message; update() and final()
+ * classify each call.
+ */
+enum {
+  TINYBLAKE_BLAKE2B_SIZE_SINGLE = 0,
+  TINYBLAKE_BLAKE2B_SIZE_SMALL = 1,
+  TINYBLAKE_BLAKE2B_SIZE_BULK = 2
+};
+
+/**
+ * Pin a size class to a kernel by name: "portable", "x64", "avx2",
+ * "avx512", "neon", "neon_sha3" or "rvv", or "auto" to restore the default.
+ * Returns -1 for an unknown class, or a kernel that is not compiled in or
+ * not supported by this CPU.
+ *
+ * The same choices can be made before first use with the environment
+ * variables TINYBLAKE_BLAKE2B_KERNEL_SINGLE, _SMALL and _BULK.
+ */
+TINYBLAKE_API int tinyblake_blake2b_set_kernel(int size_class,
+                                               const char *name);
+
+/**
+ * Name of the kernel a size class currently uses, or NULL for an unknown
+ * class.
+ */
+TINYBLAKE_API const char *tinyblake_blake2b_get_kernel(int size_class);
+
+/**
+ * Set the class boundaries in bytes (defaults 128 and 512, i.e. one and
+ * four blocks; environment TINYBLAKE_BLAKE2B_SINGLE_MAX / _SMALL_MAX).
+ * Returns -1 if single_max > small_max.
+ */
+TINYBLAKE_API int tinyblake_blake2b_set_thresholds(size_t single_max,
+                                                   size_t small_max);
+
+TINYBLAKE_API void tinyblake_blake2b_get_thresholds(size_t *single_max,
+                                                    size_t *small_max);
+
+/**
+ * Time every supported kernel at each class's representative size and
+ * assign the fastest to each class. Takes a few milliseconds; setting
+ * TINYBLAKE_BLAKE2B_AUTOTUNE=1 runs it on first use. Returns 0.
+ */
+TINYBLAKE_API int tinyblake_blake2b_autotune(void);
+
+/* ─── Engines ─── */
+
+/**
+ * One backend's BLAKE2b kernels bundled together: the block compress
+ * (also used for final blocks), the aligned compress for v2 states, the
+ * iterated-hash kernel and the multi-lane batch kernels. Engines are
+ * immutable and live for the whole process; they are never freed.
+ */
+typedef struct tinyblake_engine tinyblake_engine;
+
+/**
+ * Engine for a backend by name, as for tinyblake_blake2b_set_kernel(), or
+ * "auto" for the best backend this CPU supports. Returns NULL if the
+ * backend is not compiled in or not supported by this CPU.
+ */
+TINYBLAKE_API const tinyblake_engine *tinyblake_engine_get(const char *name);
+
+/** Backend name of an engine ("avx2", "neon", ...). */
+TINYBLAKE_API const char *tinyblake_engine_name(const tinyblake_engine *engine);
+
+/**
+ * Make `engine` the calling thread's default for every BLAKE2b-based
+ * function (HMAC, PBKDF2, chains, Balloon, ...). Functions that spread work
+ * over the internal thread pool (chain verification, proof-of-work search,
+ * Balloon-M) resolve the kernels on the calling thread, so the engine holds
+ * for their workers too. NULL returns the thread to the process-wide
+ * dispatch and its size classes. Other threads are unaffected.
+ */
+TINYBLAKE_API void
+tinyblake_engine_set_thread_default(const tinyblake_engine *engine);
+
+/** The calling thread's default engine, or NULL if none is set. */
+TINYBLAKE_API const tinyblake_engine *tinyblake_engine_thread_default(void);
+
+/**
+ * tinyblake_blake2b(), _update() and _final() on an explicit engine. A
+ * NULL engine means the thread default, then the process-wide dispatch.
+ */
+TINYBLAKE_API int tinyblake_blake2b_ex(const tinyblake_engine *engine,
+                                       void *out, size_t outlen,
+                                       const void *in, size_t inlen,
+                                       const void *key, size_t keylen);
+
+TINYBLAKE_API int tinyblake_blake2b_update_ex(const tinyblake_engine *engine,
+                                              tinyblake_blake2b_state *state,
+                                              const void *in, size_t inlen);
+
+TINYBLAKE_API int tinyblake_blake2b_final_ex(const tinyblake_engine *engine,
+                                             tinyblake_blake2b_state *state,
+                                             void *out, size_t outlen);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -97,6 +270,41 @@ inline constexpr size_t MAX_KEY_BYTES = 64;
 inline constexpr size_t SALT_BYTES = 16;
 inline constexpr size_t PERSONAL_BYTES = 16;
 
+/**
+ * A backend's kernel bundle (see tinyblake_engine_get()). Cheap to copy;
+ * the underlying engine lives for the whole process.
+ */
+class TINYBLAKE_API engine {
+public:
+  /**
+   * @param name  Backend name, or "auto" for the best this CPU supports.
+   * @throws std::invalid_argument if the backend is unavailable
+   */
+  explicit engine(const char *name = "auto");
+
+  const char *name() const { return tinyblake_engine_name(engine_); }
+  const tinyblake_engine *get() const { return engine_; }
+
+  /**
+   * Makes an engine the calling thread's default for as long as the scope
+   * lives, then restores the previous default.
+   */
+  class TINYBLAKE_API thread_scope {
+  public:
+    explicit thread_scope(const engine &e);
+    ~thread_scope();
+
+    thread_scope(const thread_scope &) = delete;
+    thread_scope &operator=(const thread_scope &) = delete;
+
+  private:
+    const tinyblake_engine *previous_;
+  };
+
+private:
+  const tinyblake_engine *engine_;
+};
+
 class TINYBLAKE_API hasher {
 public:
   /**
@@ -139,11 +347,42 @@ public:
   /** Reset to initial state (same parameters). */
   void reset();
 
+  /** Run later update/final calls on `e` instead of the thread default. */
+  void set_engine(const engine &e) { engine_ = e.get(); }
+
 private:
   tinyblake_blake2b_state state_;
   uint8_t param_[64];
   bool keyed_;
   uint8_t key_block_[128]; /* padded key for reset */
+  const tinyblake_engine *engine_ = nullptr;
+};
+
+/**
+ * Owning array of cache-line-aligned v2 states, one per worker, so threads
+ * hashing side by side never write to the same cache line.
+ */
+class TINYBLAKE_API state_array {
+public:
+  /** @throws std::invalid_argument on count == 0, std::bad_alloc */
+  explicit state_array(size_t count);
+  ~state_array();
+
+  state_array(const state_array &) = delete;
+  state_array &operator=(const state_array &) = delete;
+  state_array(state_array &&) noexcept;
+  state_array &operator=(state_array &&) noexcept;
+
+  tinyblake_blake2b_state_v2 &operator[](size_t i) { return states_[i]; }
+  const tinyblake_blake2b_state_v2 &operator[](size_t i) const {
+    return states_[i];
+  }
+  tinyblake_blake2b_state_v2 *data() { return states_; }
+  size_t size() const { return count_; }
+
+private:
+  tinyblake_blake2b_state_v2 *states_;
+  size_t count_;
 };
 
 /* ─── One-shot free functions ─── */
@@ -153,12 +392,26 @@ TINYBLAKE_API std::vector<uint8_t> hash(const void *data, size_t len,
 TINYBLAKE_API std::vector<uint8_t> hash(const std::vector<uint8_t> &data,
                                         size_t outlen = 64);
 
+/** One-shot hash on an explicit engine. */
+TINYBLAKE_API std::vector<uint8_t> hash(const engine &e, const void *data,
+                                        size_t len, size_t outlen = 64);
+
 TINYBLAKE_API std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
                                               const void *data, size_t datalen,
                                               size_t outlen = 64);
 
+/** Digests of every message, concatenated; see tinyblake_blake2b_hash_many(). */
+TINYBLAKE_API std::vector<uint8_t>
+hash_many(const std::vector<std::vector<uint8_t>> &messages,
+          size_t outlen = 64);
+
 } /* namespace tinyblake::blake2b */
 
 #endif /* __cplusplus */
 
+/* Header-only mode: inline one-shot and single-block compress */
+#if defined(__cplusplus) && defined(TINYBLAKE_HEADER_ONLY)
+#include "blake2b_inline.h"
+#endif
+
 #endif /* TINYBLAKE_BLAKE2B_H */
\ No newline at end of file
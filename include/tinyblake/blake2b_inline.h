@@ -0,0 +1,433 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#ifndef TINYBLAKE_BLAKE2B_INLINE_H
+#define TINYBLAKE_BLAKE2B_INLINE_H
+
+/*
+ * Header-only BLAKE2b: one-shot hash and single-block compress, defined
+ * inline so small messages skip the library call, the PIC prologue and the
+ * function-pointer dispatch. Needs nothing from the compiled library.
+ *
+ * The kernel is chosen from the compiler's target macros, not at runtime:
+ * AVX2 when __AVX2__ is set (with VPRORQ rotations under __AVX512VL__),
+ * NEON on AArch64, portable C++ otherwise or under TINYBLAKE_FORCE_PORTABLE.
+ * Everything has internal linkage, so translation units built with
+ * different -m flags each keep their own kernel instead of the linker
+ * picking one copy for all of them.
+ *
+ * Included by tinyblake/blake2b.h when TINYBLAKE_HEADER_ONLY is defined
+ * (the tinyblake_header_only CMake target defines it), or directly.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(TINYBLAKE_FORCE_PORTABLE) && defined(__AVX2__) &&                 \
+    (defined(__x86_64__) || defined(_M_X64))
+#define TINYBLAKE_INLINE_AVX2 1
+#include <immintrin.h>
+#elif !defined(TINYBLAKE_FORCE_PORTABLE) &&                                    \
+    (defined(__aarch64__) || defined(_M_ARM64))
+#define TINYBLAKE_INLINE_NEON 1
+#include <arm_neon.h>
+#else
+#define TINYBLAKE_INLINE_PORTABLE 1
+#endif
+
+namespace tinyblake {
+namespace blake2b_inline {
+
+static constexpr uint64_t IV[8] = {
+    0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL, 0x3C6EF372FE94F82BULL,
+    0xA54FF53A5F1D36F1ULL, 0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+    0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL};
+
+static constexpr uint8_t SIGMA[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+};
+
+static inline uint64_t load64(const uint8_t *p) {
+  uint64_t v;
+  std::memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+
+static inline void store64(uint8_t *p, uint64_t v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  std::memcpy(p, &v, 8);
+}
+
+/* Zeroization the optimizer cannot drop; memset plus a compiler barrier
+ * where available, a volatile byte loop elsewhere */
+static inline void wipe(void *p, size_t n) {
+#if defined(__GNUC__) || defined(__clang__)
+  std::memset(p, 0, n);
+  __asm__ __volatile__("" : : "r"(p) : "memory");
+#else
+  volatile uint8_t *v = static_cast<volatile uint8_t *>(p);
+  while (n--)
+    *v++ = 0;
+#endif
+}
+
+#if defined(TINYBLAKE_INLINE_AVX2)
+
+static inline __m256i rotr32(__m256i x) {
+  return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+#if defined(__AVX512VL__)
+static inline __m256i rotr24(__m256i x) { return _mm256_ror_epi64(x, 24); }
+static inline __m256i rotr16(__m256i x) { return _mm256_ror_epi64(x, 16); }
+static inline __m256i rotr63(__m256i x) { return _mm256_ror_epi64(x, 63); }
+#else
+static inline __m256i rotr24(__m256i x) {
+  return _mm256_or_si256(_mm256_srli_epi64(x, 24), _mm256_slli_epi64(x, 40));
+}
+static inline __m256i rotr16(__m256i x) {
+  const __m256i mask = _mm256_setr_epi8(
+      2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7,
+      0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+  return _mm256_shuffle_epi8(x, mask);
+}
+static inline __m256i rotr63(__m256i x) {
+  return _mm256_or_si256(_mm256_srli_epi64(x, 63), _mm256_slli_epi64(x, 1));
+}
+#endif
+
+static inline void g4(__m256i &a, __m256i &b, __m256i &c, __m256i &d,
+                      __m256i mx, __m256i my) {
+  a = _mm256_add_epi64(_mm256_add_epi64(a, b), mx);
+  d = rotr32(_mm256_xor_si256(d, a));
+  c = _mm256_add_epi64(c, d);
+  b = rotr24(_mm256_xor_si256(b, c));
+  a = _mm256_add_epi64(_mm256_add_epi64(a, b), my);
+  d = rotr16(_mm256_xor_si256(d, a));
+  c = _mm256_add_epi64(c, d);
+  b = rotr63(_mm256_xor_si256(b, c));
+}
+
+static inline __m256i words4(const uint64_t m[16], const uint8_t *s, int i0) {
+  return _mm256_set_epi64x(static_cast<int64_t>(m[s[i0 + 6]]),
+                           static_cast<int64_t>(m[s[i0 + 4]]),
+                           static_cast<int64_t>(m[s[i0 + 2]]),
+                           static_cast<int64_t>(m[s[i0]]));
+}
+
+static inline void compress(uint64_t h[8], const uint8_t block[128],
+                            uint64_t t0, uint64_t t1, bool last) {
+  uint64_t m[16];
+  for (int i = 0; i < 16; ++i)
+    m[i] = load64(block + i * 8);
+
+  const __m256i orig1 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(h));
+  const __m256i orig2 =
+      _mm256_loadu_si256(reinterpret_cast<__m256i *>(h + 4));
+  __m256i row1 = orig1;
+  __m256i row2 = orig2;
+  __m256i row3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(IV));
+  __m256i row4 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[7]),
+      static_cast<int64_t>(last ? ~IV[6] : IV[6]),
+      static_cast<int64_t>(IV[5] ^ t1), static_cast<int64_t>(IV[4] ^ t0));
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    g4(row1, row2, row3, row4, words4(m, s, 0), words4(m, s, 1));
+    row2 = _mm256_permute4x64_epi64(row2, _MM_SHUFFLE(0, 3, 2, 1));
+    row3 = _mm256_permute4x64_epi64(row3, _MM_SHUFFLE(1, 0, 3, 2));
+    row4 = _mm256_permute4x64_epi64(row4, _MM_SHUFFLE(2, 1, 0, 3));
+    g4(row1, row2, row3, row4, words4(m, s, 8), words4(m, s, 9));
+    row2 = _mm256_permute4x64_epi64(row2, _MM_SHUFFLE(2, 1, 0, 3));
+    row3 = _mm256_permute4x64_epi64(row3, _MM_SHUFFLE(1, 0, 3, 2));
+    row4 = _mm256_permute4x64_epi64(row4, _MM_SHUFFLE(0, 3, 2, 1));
+  }
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(h),
+                      _mm256_xor_si256(orig1, _mm256_xor_si256(row1, row3)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(h + 4),
+                      _mm256_xor_si256(orig2, _mm256_xor_si256(row2, row4)));
+  wipe(m, sizeof(m));
+}
+
+#elif defined(TINYBLAKE_INLINE_NEON)
+
+static inline uint64x2_t rotr32(uint64x2_t x) {
+  return vreinterpretq_u64_u32(vrev64q_u32(vreinterpretq_u32_u64(x)));
+}
+
+static inline uint64x2_t rotr_tbl(uint64x2_t x, uint8x16_t tbl) {
+  return vreinterpretq_u64_u8(vqtbl1q_u8(vreinterpretq_u8_u64(x), tbl));
+}
+
+static inline uint64x2_t rotr63(uint64x2_t x) {
+  return vsliq_n_u64(vshrq_n_u64(x, 63), x, 1);
+}
+
+static inline uint64x2_t pair(uint64_t lo, uint64_t hi) {
+  return vcombine_u64(vcreate_u64(lo), vcreate_u64(hi));
+}
+
+/* G on two columns at once: rows a, b, c, d each hold two words */
+static inline void g2(uint64x2_t &a, uint64x2_t &b, uint64x2_t &c,
+                      uint64x2_t &d, uint64x2_t mx, uint64x2_t my,
+                      uint8x16_t rot24, uint8x16_t rot16) {
+  a = vaddq_u64(vaddq_u64(a, b), mx);
+  d = rotr32(veorq_u64(d, a));
+  c = vaddq_u64(c, d);
+  b = rotr_tbl(veorq_u64(b, c), rot24);
+  a = vaddq_u64(vaddq_u64(a, b), my);
+  d = rotr_tbl(veorq_u64(d, a), rot16);
+  c = vaddq_u64(c, d);
+  b = rotr63(veorq_u64(b, c));
+}
+
+static inline void compress(uint64_t h[8], const uint8_t block[128],
+                            uint64_t t0, uint64_t t1, bool last) {
+  static const uint8_t rot16_bytes[16] = {2,  3,  4,  5,  6,  7,  0, 1,
+                                          10, 11, 12, 13, 14, 15, 8, 9};
+  static const uint8_t rot24_bytes[16] = {3,  4,  5,  6,  7,  0, 1, 2,
+                                          11, 12, 13, 14, 15, 8, 9, 10};
+  const uint8x16_t rot16 = vld1q_u8(rot16_bytes);
+  const uint8x16_t rot24 = vld1q_u8(rot24_bytes);
+
+  uint64_t m[16];
+  for (int i = 0; i < 16; ++i)
+    m[i] = load64(block + i * 8);
+
+  const uint64x2_t orig1a = vld1q_u64(h), orig1b = vld1q_u64(h + 2);
+  const uint64x2_t orig2a = vld1q_u64(h + 4), orig2b = vld1q_u64(h + 6);
+  uint64x2_t row1a = orig1a, row1b = orig1b;
+  uint64x2_t row2a = orig2a, row2b = orig2b;
+  uint64x2_t row3a = vld1q_u64(IV), row3b = vld1q_u64(IV + 2);
+  uint64x2_t row4a = pair(IV[4] ^ t0, IV[5] ^ t1);
+  uint64x2_t row4b = pair(last ? ~IV[6] : IV[6], IV[7]);
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    g2(row1a, row2a, row3a, row4a, pair(m[s[0]], m[s[2]]),
+       pair(m[s[1]], m[s[3]]), rot24, rot16);
+    g2(row1b, row2b, row3b, row4b, pair(m[s[4]], m[s[6]]),
+       pair(m[s[5]], m[s[7]]), rot24, rot16);
+
+    /* Diagonalize */
+    uint64x2_t t0a = vextq_u64(row2a, row2b, 1);
+    uint64x2_t t0b = vextq_u64(row2b, row2a, 1);
+    row2a = t0a;
+    row2b = t0b;
+    t0a = row3a;
+    row3a = row3b;
+    row3b = t0a;
+    t0a = vextq_u64(row4b, row4a, 1);
+    t0b = vextq_u64(row4a, row4b, 1);
+    row4a = t0a;
+    row4b = t0b;
+
+    g2(row1a, row2a, row3a, row4a, pair(m[s[8]], m[s[10]]),
+       pair(m[s[9]], m[s[11]]), rot24, rot16);
+    g2(row1b, row2b, row3b, row4b, pair(m[s[12]], m[s[14]]),
+       pair(m[s[13]], m[s[15]]), rot24, rot16);
+
+    /* Undiagonalize */
+    t0a = vextq_u64(row2b, row2a, 1);
+    t0b = vextq_u64(row2a, row2b, 1);
+    row2a = t0a;
+    row2b = t0b;
+    t0a = row3a;
+    row3a = row3b;
+    row3b = t0a;
+    t0a = vextq_u64(row4a, row4b, 1);
+    t0b = vextq_u64(row4b, row4a, 1);
+    row4a = t0a;
+    row4b = t0b;
+  }
+
+  vst1q_u64(h, veorq_u64(orig1a, veorq_u64(row1a, row3a)));
+  vst1q_u64(h + 2, veorq_u64(orig1b, veorq_u64(row1b, row3b)));
+  vst1q_u64(h + 4, veorq_u64(orig2a, veorq_u64(row2a, row4a)));
+  vst1q_u64(h + 6, veorq_u64(orig2b, veorq_u64(row2b, row4b)));
+  wipe(m, sizeof(m));
+}
+
+#else /* portable */
+
+static inline uint64_t rotr64(uint64_t x, int n) {
+  return (x >> n) | (x << (64 - n));
+}
+
+static inline void g(uint64_t v[16], int a, int b, int c, int d, uint64_t x,
+                     uint64_t y) {
+  v[a] = v[a] + v[b] + x;
+  v[d] = rotr64(v[d] ^ v[a], 32);
+  v[c] = v[c] + v[d];
+  v[b] = rotr64(v[b] ^ v[c], 24);
+  v[a] = v[a] + v[b] + y;
+  v[d] = rotr64(v[d] ^ v[a], 16);
+  v[c] = v[c] + v[d];
+  v[b] = rotr64(v[b] ^ v[c], 63);
+}
+
+static inline void compress(uint64_t h[8], const uint8_t block[128],
+                            uint64_t t0, uint64_t t1, bool last) {
+  uint64_t m[16];
+  uint64_t v[16];
+  for (int i = 0; i < 16; ++i)
+    m[i] = load64(block + i * 8);
+  for (int i = 0; i < 8; ++i) {
+    v[i] = h[i];
+    v[i + 8] = IV[i];
+  }
+  v[12] ^= t0;
+  v[13] ^= t1;
+  if (last)
+    v[14] = ~v[14];
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+    g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+    g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+    g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+    g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+    g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+    g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+    g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+  }
+
+  for (int i = 0; i < 8; ++i)
+    h[i] ^= v[i] ^ v[i + 8];
+  wipe(m, sizeof(m));
+  wipe(v, sizeof(v));
+}
+
+#endif
+
+} /* namespace blake2b_inline */
+} /* namespace tinyblake */
+
+/**
+ * Single-block fast path: one BLAKE2b compression of `block` into the
+ * chaining value h (same contract as the library's backend compress
+ * functions; last != 0 marks the final block).
+ */
+static inline void tinyblake_blake2b_compress_inline(uint64_t h[8],
+                                                     const uint8_t block[128],
+                                                     uint64_t t0, uint64_t t1,
+                                                     int last) {
+  tinyblake::blake2b_inline::compress(h, block, t0, t1, last != 0);
+}
+
+/**
+ * Inline one-shot BLAKE2b, byte-for-byte identical to tinyblake_blake2b().
+ * Messages up to 128 bytes (128 - 0 bytes after a key block) take a single
+ * compression with no state struct.
+ *
+ * @return 0 on success, -1 on invalid arguments
+ */
+static inline int tinyblake_blake2b_inline(void *out, size_t outlen,
+                                           const void *in, size_t inlen,
+                                           const void *key, size_t keylen) {
+  namespace bi = tinyblake::blake2b_inline;
+
+  if (!out || outlen == 0 || outlen > 64 || keylen > 64)
+    return -1;
+  if ((keylen > 0 && !key) || (inlen > 0 && !in))
+    return -1;
+
+  uint64_t h[8];
+  for (int i = 0; i < 8; ++i)
+    h[i] = bi::IV[i];
+  h[0] ^= 0x01010000ULL ^ (static_cast<uint64_t>(keylen) << 8) ^ outlen;
+
+  const uint8_t *p = static_cast<const uint8_t *>(in);
+  uint8_t block[128];
+  uint64_t t = 0;
+
+  if (keylen > 0) {
+    std::memset(block, 0, 128);
+    std::memcpy(block, key, keylen);
+    t = 128;
+    bi::compress(h, block, t, 0, inlen == 0);
+  }
+
+  if (inlen > 0 || keylen == 0) {
+    while (inlen > 128) {
+      t += 128;
+      bi::compress(h, p, t, 0, false);
+      p += 128;
+      inlen -= 128;
+    }
+    if (inlen > 0)
+      std::memcpy(block, p, inlen);
+    std::memset(block + inlen, 0, 128 - inlen);
+    t += inlen;
+    bi::compress(h, block, t, 0, true);
+  }
+
+  uint8_t digest[64];
+  for (int i = 0; i < 8; ++i)
+    bi::store64(digest + i * 8, h[i]);
+  std::memcpy(out, digest, outlen);
+
+  bi::wipe(block, sizeof(block));
+  bi::wipe(digest, sizeof(digest));
+  bi::wipe(h, sizeof(h));
+  return 0;
+}
+
+/** Name of the kernel the inline path was compiled with */
+static inline const char *tinyblake_blake2b_inline_backend() {
+#if defined(TINYBLAKE_INLINE_AVX2) && defined(__AVX512VL__)
+  return "avx2+avx512vl";
+#elif defined(TINYBLAKE_INLINE_AVX2)
+  return "avx2";
+#elif defined(TINYBLAKE_INLINE_NEON)
+  return "neon";
+#else
+  return "portable";
+#endif
+}
+
+#endif /* TINYBLAKE_BLAKE2B_INLINE_H */
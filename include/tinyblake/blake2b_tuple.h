@@ -0,0 +1,167 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BLAKE2B_TUPLE_H
+#define TINYBLAKE_BLAKE2B_TUPLE_H
+
+#include "blake2b.h"
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Field type tags. Every field is absorbed as
+ *
+ *   tag (1 byte) || length (8 bytes, little-endian) || data
+ *
+ * so a sequence of fields decodes uniquely and no two different tuples
+ * share an encoding. Integer fields are 8-byte little-endian values. Other
+ * tag values are allowed for caller-defined types.
+ */
+enum {
+  TINYBLAKE_TUPLE_BYTES = 0x01,
+  TINYBLAKE_TUPLE_STRING = 0x02,
+  TINYBLAKE_TUPLE_U64 = 0x03,
+  TINYBLAKE_TUPLE_I64 = 0x04
+};
+
+typedef struct tinyblake_blake2b_tuple_field {
+  const void *data;
+  size_t len;
+  uint8_t tag;
+} tinyblake_blake2b_tuple_field;
+
+/**
+ * Initialize a tuple hash. personal (0..16 bytes, zero-padded) goes into
+ * the parameter block personalization field. Finish with
+ * tinyblake_blake2b_final().
+ */
+TINYBLAKE_API int tinyblake_blake2b_tuple_init(tinyblake_blake2b_state *state,
+                                               size_t outlen,
+                                               const void *personal,
+                                               size_t personal_len);
+
+TINYBLAKE_API int tinyblake_blake2b_tuple_add(tinyblake_blake2b_state *state,
+                                              uint8_t tag, const void *data,
+                                              size_t len);
+
+TINYBLAKE_API int
+tinyblake_blake2b_tuple_add_u64(tinyblake_blake2b_state *state, uint64_t v);
+
+TINYBLAKE_API int
+tinyblake_blake2b_tuple_add_i64(tinyblake_blake2b_state *state, int64_t v);
+
+/**
+ * Hash `nrecords` records of `nfields` fields each through the multi-lane
+ * kernels. Record r is fields[r * nfields .. (r + 1) * nfields) and its
+ * digest is written to out + r * outlen. Integer-tagged fields must point
+ * to 8 little-endian bytes. Never allocates; wide records are absorbed
+ * in chunks of 16 fields.
+ */
+TINYBLAKE_API int tinyblake_blake2b_tuple_hash_many(
+    void *out, size_t outlen, const tinyblake_blake2b_tuple_field *fields,
+    size_t nfields, size_t nrecords, const void *personal,
+    size_t personal_len);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <string>
+#include <vector>
+
+namespace tinyblake::blake2b {
+
+using tuple_field = tinyblake_blake2b_tuple_field;
+
+class TINYBLAKE_API tuple_hasher {
+public:
+  /**
+   * Construct a tuple hasher.
+   * @param outlen        Digest length in bytes (1..64).
+   * @param personal      Personalization (may be null when personal_len is 0).
+   * @param personal_len  Personalization length in bytes (0..16).
+   */
+  explicit tuple_hasher(size_t outlen = 64, const void *personal = nullptr,
+                        size_t personal_len = 0);
+
+  ~tuple_hasher();
+
+  tuple_hasher(const tuple_hasher &) = delete;
+  tuple_hasher &operator=(const tuple_hasher &) = delete;
+  tuple_hasher(tuple_hasher &&) noexcept;
+  tuple_hasher &operator=(tuple_hasher &&) noexcept;
+
+  /** Append a raw byte field. */
+  void add_field(const void *data, size_t len);
+  void add_field(const std::vector<uint8_t> &data);
+
+  /** Append a string field (tagged distinctly from raw bytes). */
+  void add_string(const std::string &s);
+
+  /** Append an integer field. */
+  void add_u64(uint64_t v);
+  void add_i64(int64_t v);
+
+  /** Finalize and return digest. */
+  std::vector<uint8_t> final_();
+
+  /** Finalize into caller-provided buffer. */
+  void final_(void *out, size_t outlen);
+
+  /** Reset to initial state (same parameters). */
+  void reset();
+
+private:
+  tinyblake_blake2b_state state_;
+  uint8_t param_[64];
+};
+
+/**
+ * Batched tuple hashing; returns nrecords digests of outlen bytes each,
+ * concatenated. See tinyblake_blake2b_tuple_hash_many().
+ */
+TINYBLAKE_API std::vector<uint8_t>
+hash_tuples(const tuple_field *fields, size_t nfields, size_t nrecords,
+            size_t outlen = 64, const void *personal = nullptr,
+            size_t personal_len = 0);
+
+} /* namespace tinyblake::blake2b */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_BLAKE2B_TUPLE_H */
@@ -0,0 +1,184 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BLAKE2S_H
+#define TINYBLAKE_BLAKE2S_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * BLAKE2s (RFC 7693): the 32-bit member of the family, for small inputs,
+ * 32-bit targets and protocols that specify it. The API mirrors
+ * tinyblake_blake2b_*; the parameter block is 32 bytes.
+ */
+
+enum {
+  TINYBLAKE_BLAKE2S_BLOCKBYTES = 64,
+  TINYBLAKE_BLAKE2S_OUTBYTES = 32,
+  TINYBLAKE_BLAKE2S_KEYBYTES = 32,
+  TINYBLAKE_BLAKE2S_SALTBYTES = 8,
+  TINYBLAKE_BLAKE2S_PERSONALBYTES = 8
+};
+
+typedef struct tinyblake_blake2s_state {
+  uint32_t h[8];
+  uint32_t t[2];
+  uint8_t buf[64];
+  size_t buflen;
+  uint8_t outlen;
+} tinyblake_blake2s_state;
+
+TINYBLAKE_API int tinyblake_blake2s_init(tinyblake_blake2s_state *state,
+                                         size_t outlen);
+
+TINYBLAKE_API int tinyblake_blake2s_init_key(tinyblake_blake2s_state *state,
+                                             size_t outlen, const void *key,
+                                             size_t keylen);
+
+TINYBLAKE_API int tinyblake_blake2s_init_param(tinyblake_blake2s_state *state,
+                                               const uint8_t param[32]);
+
+TINYBLAKE_API int tinyblake_blake2s_update(tinyblake_blake2s_state *state,
+                                           const void *in, size_t inlen);
+
+TINYBLAKE_API int tinyblake_blake2s_final(tinyblake_blake2s_state *state,
+                                          void *out, size_t outlen);
+
+/**
+ * One-shot hashing convenience.
+ */
+TINYBLAKE_API int tinyblake_blake2s(void *out, size_t outlen, const void *in,
+                                    size_t inlen, const void *key,
+                                    size_t keylen);
+
+/**
+ * Hash n independent messages in[i][0..inlen[i]) with the same outlen and
+ * optional key; digest i goes to out + i * outlen. Messages run eight at a
+ * time on the AVX2 multi-lane kernel when available.
+ */
+TINYBLAKE_API int tinyblake_blake2s_hash_many(void *out, size_t outlen,
+                                              const void *const in[],
+                                              const size_t inlen[], size_t n,
+                                              const void *key, size_t keylen);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <string>
+#include <vector>
+
+namespace tinyblake::blake2s {
+
+inline constexpr size_t BLOCK_BYTES = 64;
+inline constexpr size_t MAX_OUT_BYTES = 32;
+inline constexpr size_t MAX_KEY_BYTES = 32;
+inline constexpr size_t SALT_BYTES = 8;
+inline constexpr size_t PERSONAL_BYTES = 8;
+
+class TINYBLAKE_API hasher {
+public:
+  /**
+   * Construct an unkeyed BLAKE2s hasher.
+   * @param outlen  Digest length in bytes (1..32).
+   */
+  explicit hasher(size_t outlen = 32);
+
+  /**
+   * Construct a keyed BLAKE2s hasher.
+   * @param key     Key data.
+   * @param keylen  Key length in bytes (1..32).
+   * @param outlen  Digest length in bytes (1..32).
+   */
+  hasher(const void *key, size_t keylen, size_t outlen = 32);
+
+  /**
+   * Construct with a full 32-byte parameter block.
+   */
+  explicit hasher(const uint8_t param[32]);
+
+  ~hasher();
+
+  hasher(const hasher &) = delete;
+  hasher &operator=(const hasher &) = delete;
+  hasher(hasher &&) noexcept;
+  hasher &operator=(hasher &&) noexcept;
+
+  /** Feed data. */
+  void update(const void *data, size_t len);
+  void update(const std::vector<uint8_t> &data);
+  void update(const std::string &data);
+
+  /** Finalize and return digest. */
+  std::vector<uint8_t> final_();
+
+  /** Finalize into caller-provided buffer. */
+  void final_(void *out, size_t outlen);
+
+  /** Reset to initial state (same parameters). */
+  void reset();
+
+private:
+  tinyblake_blake2s_state state_;
+  uint8_t param_[32];
+  bool keyed_;
+  uint8_t key_block_[64]; /* padded key for reset */
+};
+
+/* ─── One-shot free functions ─── */
+
+TINYBLAKE_API std::vector<uint8_t> hash(const void *data, size_t len,
+                                        size_t outlen = 32);
+TINYBLAKE_API std::vector<uint8_t> hash(const std::vector<uint8_t> &data,
+                                        size_t outlen = 32);
+
+TINYBLAKE_API std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
+                                              const void *data, size_t datalen,
+                                              size_t outlen = 32);
+
+/** Digests of every message, concatenated; see tinyblake_blake2s_hash_many(). */
+TINYBLAKE_API std::vector<uint8_t>
+hash_many(const std::vector<std::vector<uint8_t>> &messages,
+          size_t outlen = 32);
+
+} /* namespace tinyblake::blake2s */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_BLAKE2S_H */
@@ -0,0 +1,145 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BLAKE2XB_H
+#define TINYBLAKE_BLAKE2XB_H
+
+#include "blake2b.h"
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  TINYBLAKE_BLAKE2XB_MAXOUTBYTES = 0xFFFFFFFE /* 2^32 - 2 */
+};
+
+/**
+ * BLAKE2Xb extendable-output state.
+ *
+ * The root is an ordinary BLAKE2b-512 over the input with the requested
+ * output length folded into the parameter block; the output is then expanded
+ * from the root digest in independent 64-byte blocks.
+ */
+typedef struct tinyblake_blake2xb_state {
+  tinyblake_blake2b_state root;
+  uint8_t param[64];
+} tinyblake_blake2xb_state;
+
+TINYBLAKE_API int tinyblake_blake2xb_init(tinyblake_blake2xb_state *state,
+                                          size_t outlen);
+
+TINYBLAKE_API int tinyblake_blake2xb_init_key(tinyblake_blake2xb_state *state,
+                                              size_t outlen, const void *key,
+                                              size_t keylen);
+
+TINYBLAKE_API int tinyblake_blake2xb_update(tinyblake_blake2xb_state *state,
+                                            const void *in, size_t inlen);
+
+TINYBLAKE_API int tinyblake_blake2xb_final(tinyblake_blake2xb_state *state,
+                                           void *out, size_t outlen);
+
+/**
+ * One-shot BLAKE2Xb. outlen is 1..TINYBLAKE_BLAKE2XB_MAXOUTBYTES.
+ */
+TINYBLAKE_API int tinyblake_blake2xb(void *out, size_t outlen, const void *in,
+                                     size_t inlen, const void *key,
+                                     size_t keylen);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <string>
+#include <vector>
+
+namespace tinyblake::blake2xb {
+
+inline constexpr size_t MAX_OUT_BYTES = 0xFFFFFFFE;
+
+class TINYBLAKE_API hasher {
+public:
+  /**
+   * Construct an unkeyed BLAKE2Xb hasher.
+   * @param outlen  Output length in bytes (1..2^32-2).
+   */
+  explicit hasher(size_t outlen);
+
+  /**
+   * Construct a keyed BLAKE2Xb hasher.
+   * @param key     Key data.
+   * @param keylen  Key length in bytes (1..64).
+   * @param outlen  Output length in bytes (1..2^32-2).
+   */
+  hasher(const void *key, size_t keylen, size_t outlen);
+
+  ~hasher();
+
+  hasher(const hasher &) = delete;
+  hasher &operator=(const hasher &) = delete;
+  hasher(hasher &&) noexcept;
+  hasher &operator=(hasher &&) noexcept;
+
+  /** Feed data. */
+  void update(const void *data, size_t len);
+  void update(const std::vector<uint8_t> &data);
+  void update(const std::string &data);
+
+  /** Finalize and return output. */
+  std::vector<uint8_t> final_();
+
+  /** Finalize into caller-provided buffer. */
+  void final_(void *out, size_t outlen);
+
+private:
+  tinyblake_blake2xb_state state_;
+  size_t outlen_;
+};
+
+/* ─── One-shot free functions ─── */
+
+TINYBLAKE_API std::vector<uint8_t> hash(const void *data, size_t len,
+                                        size_t outlen);
+
+TINYBLAKE_API std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
+                                              const void *data, size_t datalen,
+                                              size_t outlen);
+
+} /* namespace tinyblake::blake2xb */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_BLAKE2XB_H */
@@ -0,0 +1,218 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BLAKE3_H
+#define TINYBLAKE_BLAKE3_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * BLAKE3: a Merkle tree of 1 KiB chunks compressed with a 7-round
+ * BLAKE2s-style function. Chunks are independent, so bulk input is hashed
+ * many chunks at a time on the SIMD kernels (4 with SSE4.1, 8 with AVX2,
+ * 16 with AVX-512) and, through update_parallel, across threads.
+ *
+ * Three modes: plain hashing, keyed hashing with a 32-byte key, and key
+ * derivation from a context string. Output is extendable: final() and
+ * final_seek() produce any number of bytes from any offset.
+ */
+
+enum {
+  TINYBLAKE_BLAKE3_BLOCKBYTES = 64,
+  TINYBLAKE_BLAKE3_CHUNKBYTES = 1024,
+  TINYBLAKE_BLAKE3_OUTBYTES = 32,
+  TINYBLAKE_BLAKE3_KEYBYTES = 32,
+  TINYBLAKE_BLAKE3_MAX_DEPTH = 54 /* 2^54 chunks = 2^64 bytes */
+};
+
+typedef struct tinyblake_blake3_state {
+  uint32_t key[8];
+  uint32_t cv[8]; /* chaining value of the current chunk */
+  uint64_t chunk_counter;
+  uint8_t buf[64];
+  uint8_t buflen;
+  uint8_t blocks_compressed;
+  uint8_t flags;
+  uint8_t cv_stack_len;
+  uint8_t cv_stack[(TINYBLAKE_BLAKE3_MAX_DEPTH + 1) * 32];
+} tinyblake_blake3_state;
+
+TINYBLAKE_API int tinyblake_blake3_init(tinyblake_blake3_state *state);
+
+TINYBLAKE_API int tinyblake_blake3_init_keyed(tinyblake_blake3_state *state,
+                                              const uint8_t key[32]);
+
+/**
+ * Key derivation mode: the context string should be hardcoded, globally
+ * unique and application-specific; key material goes through update().
+ */
+TINYBLAKE_API int
+tinyblake_blake3_init_derive_key(tinyblake_blake3_state *state,
+                                 const void *context, size_t contextlen);
+
+TINYBLAKE_API int tinyblake_blake3_update(tinyblake_blake3_state *state,
+                                          const void *in, size_t inlen);
+
+/**
+ * As tinyblake_blake3_update(), but large inputs are split into subtrees
+ * hashed on up to `threads` threads (0 = all hardware threads). The result
+ * is identical to update(). Must not be called from inside another
+ * TinyBLAKE parallel operation.
+ */
+TINYBLAKE_API int
+tinyblake_blake3_update_parallel(tinyblake_blake3_state *state,
+                                 const void *in, size_t inlen,
+                                 size_t threads);
+
+/**
+ * Write outlen bytes of output. The state is not modified, so more input
+ * may follow and final() may be called again.
+ */
+TINYBLAKE_API int tinyblake_blake3_final(const tinyblake_blake3_state *state,
+                                         void *out, size_t outlen);
+
+/**
+ * Write outlen bytes of output starting at byte offset `seek` of the
+ * extendable output stream.
+ */
+TINYBLAKE_API int
+tinyblake_blake3_final_seek(const tinyblake_blake3_state *state,
+                            uint64_t seek, void *out, size_t outlen);
+
+/**
+ * One-shot hashing; key is NULL for plain hashing or 32 bytes for keyed.
+ */
+TINYBLAKE_API int tinyblake_blake3(void *out, size_t outlen, const void *in,
+                                   size_t inlen, const uint8_t *key);
+
+/**
+ * One-shot key derivation: outlen bytes from context and key material.
+ */
+TINYBLAKE_API int tinyblake_blake3_derive_key(void *out, size_t outlen,
+                                              const void *context,
+                                              size_t contextlen,
+                                              const void *material,
+                                              size_t materiallen);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <string>
+#include <vector>
+
+namespace tinyblake::blake3 {
+
+inline constexpr size_t BLOCK_BYTES = 64;
+inline constexpr size_t CHUNK_BYTES = 1024;
+inline constexpr size_t OUT_BYTES = 32;
+inline constexpr size_t KEY_BYTES = 32;
+
+class TINYBLAKE_API hasher {
+public:
+  /** Construct a plain BLAKE3 hasher. */
+  hasher();
+
+  /**
+   * Construct a keyed BLAKE3 hasher.
+   * @param key  32-byte key.
+   */
+  explicit hasher(const uint8_t key[32]);
+
+  /**
+   * Construct a hasher in key derivation mode for the given context.
+   */
+  static hasher derive_key(const std::string &context);
+
+  ~hasher();
+
+  hasher(const hasher &) = delete;
+  hasher &operator=(const hasher &) = delete;
+  hasher(hasher &&) noexcept;
+  hasher &operator=(hasher &&) noexcept;
+
+  /** Feed data. */
+  void update(const void *data, size_t len);
+  void update(const std::vector<uint8_t> &data);
+  void update(const std::string &data);
+
+  /** Feed data, hashing large inputs on up to `threads` threads. */
+  void update_parallel(const void *data, size_t len, size_t threads = 0);
+
+  /** Return outlen bytes of output; the hasher may keep absorbing. */
+  std::vector<uint8_t> final_(size_t outlen = 32) const;
+
+  /** Write outlen bytes of output into a caller-provided buffer. */
+  void final_(void *out, size_t outlen) const;
+
+  /** Write outlen bytes of output starting at offset `seek`. */
+  void final_seek(uint64_t seek, void *out, size_t outlen) const;
+
+  /** Reset to the initial state (same mode and key). */
+  void reset();
+
+private:
+  tinyblake_blake3_state state_;
+};
+
+/* ─── One-shot free functions ─── */
+
+TINYBLAKE_API std::vector<uint8_t> hash(const void *data, size_t len,
+                                        size_t outlen = 32);
+TINYBLAKE_API std::vector<uint8_t> hash(const std::vector<uint8_t> &data,
+                                        size_t outlen = 32);
+
+TINYBLAKE_API std::vector<uint8_t> keyed_hash(const uint8_t key[32],
+                                              const void *data, size_t len,
+                                              size_t outlen = 32);
+
+TINYBLAKE_API std::vector<uint8_t> derive_key(const std::string &context,
+                                              const void *material,
+                                              size_t len, size_t outlen = 32);
+
+/** One-shot hash of a large input on up to `threads` threads (0 = all). */
+TINYBLAKE_API std::vector<uint8_t> hash_parallel(const void *data, size_t len,
+                                                 size_t outlen = 32,
+                                                 size_t threads = 0);
+
+} /* namespace tinyblake::blake3 */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_BLAKE3_H */
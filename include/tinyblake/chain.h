@@ -0,0 +1,118 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_CHAIN_H
+#define TINYBLAKE_CHAIN_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Iterated hash: out = H^n(in), where H is unkeyed BLAKE2b with an
+ * outlen-byte digest (1..64). The first step hashes `in`; every later step
+ * hashes the previous digest. n must be at least 1.
+ */
+TINYBLAKE_API int tinyblake_blake2b_iterate(void *out, size_t outlen,
+                                            const void *in, size_t inlen,
+                                            uint64_t n);
+
+/**
+ * As tinyblake_blake2b_iterate(), additionally writing every interval-th
+ * digest (H^interval, H^(2 * interval), ...) to `checkpoints`. The buffer
+ * must hold (n / interval) * outlen bytes.
+ */
+TINYBLAKE_API int tinyblake_blake2b_iterate_checkpoints(
+    void *out, size_t outlen, const void *in, size_t inlen, uint64_t n,
+    uint64_t interval, void *checkpoints, size_t checkpoints_len);
+
+/**
+ * Verify a chain produced by tinyblake_blake2b_iterate_checkpoints():
+ * checkpoint 0 must equal H^interval(seed) and checkpoint i must equal
+ * H^interval(checkpoint i - 1). Segments are independent, so they are
+ * spread over up to `threads` threads (0 = all hardware threads) with each
+ * thread stepping a group of segments in lockstep on the multi-lane kernel.
+ *
+ * Returns 0 if every checkpoint matches, 1 if one does not (the index of
+ * the first failing segment is stored in *first_bad), -1 on invalid
+ * arguments.
+ */
+TINYBLAKE_API int tinyblake_blake2b_chain_verify(
+    const void *seed, size_t seedlen, const void *checkpoints,
+    size_t ncheckpoints, size_t outlen, uint64_t interval, size_t threads,
+    size_t *first_bad);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <vector>
+
+namespace tinyblake::chain {
+
+/** H^n(data); see tinyblake_blake2b_iterate(). */
+TINYBLAKE_API std::vector<uint8_t> iterate(const void *data, size_t len,
+                                           uint64_t n, size_t outlen = 64);
+
+/**
+ * Every interval-th digest of the chain H^1(data) .. H^n(data), in order.
+ */
+TINYBLAKE_API std::vector<std::vector<uint8_t>>
+checkpoints(const void *data, size_t len, uint64_t n, uint64_t interval,
+            size_t outlen = 64);
+
+struct verify_result {
+  bool valid;
+  size_t first_bad; /* index of the first failing checkpoint when !valid */
+};
+
+/**
+ * Verify checkpoints (as returned by checkpoints()) against the seed in
+ * parallel. See tinyblake_blake2b_chain_verify().
+ * @param steps_between  chain steps between consecutive checkpoints
+ * @param threads        thread cap (0 = all hardware threads)
+ */
+TINYBLAKE_API verify_result
+verify(const void *seed, size_t seedlen,
+       const std::vector<std::vector<uint8_t>> &checkpoints,
+       uint64_t steps_between, size_t threads = 0);
+
+} /* namespace tinyblake::chain */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_CHAIN_H */
@@ -0,0 +1,153 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_ENCODING_H
+#define TINYBLAKE_ENCODING_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Encoding flags. TINYBLAKE_ENCODE_CONSTANT_TIME selects branch-free,
+ * table-free character handling for keys, MAC tags and other secrets: the
+ * time taken depends only on the lengths, not on the bytes. The SIMD
+ * kernels used for the bulk of long inputs qualify in either mode.
+ */
+enum { TINYBLAKE_ENCODE_CONSTANT_TIME = 1 };
+
+/** Encoded length of `inlen` bytes in lowercase hex, excluding the NUL. */
+TINYBLAKE_API size_t tinyblake_hex_encoded_len(size_t inlen);
+
+/**
+ * Encoded length of `inlen` bytes in unpadded base64url (RFC 4648 section
+ * 5), excluding the NUL.
+ */
+TINYBLAKE_API size_t tinyblake_base64url_encoded_len(size_t inlen);
+
+/**
+ * Encode `inlen` bytes as NUL-terminated lowercase hex. `outcap` must be at
+ * least tinyblake_hex_encoded_len(inlen) + 1. Returns 0 or -1.
+ */
+TINYBLAKE_API int tinyblake_hex_encode(char *out, size_t outcap,
+                                       const void *in, size_t inlen,
+                                       int flags);
+
+/**
+ * Decode `inlen` hex characters (either case) into `out`, storing the byte
+ * count in *outlen. Returns -1, with `out` wiped, on an odd length, a
+ * non-hex character or outcap < inlen / 2.
+ */
+TINYBLAKE_API int tinyblake_hex_decode(void *out, size_t outcap,
+                                       size_t *outlen, const char *in,
+                                       size_t inlen, int flags);
+
+/** As tinyblake_hex_encode(), in unpadded base64url. */
+TINYBLAKE_API int tinyblake_base64url_encode(char *out, size_t outcap,
+                                             const void *in, size_t inlen,
+                                             int flags);
+
+/**
+ * Decode unpadded base64url. Rejects, with `out` wiped, padding, characters
+ * outside the URL alphabet, a length of 1 mod 4 and non-zero trailing
+ * bits, so every byte string has exactly one accepted encoding.
+ */
+TINYBLAKE_API int tinyblake_base64url_decode(void *out, size_t outcap,
+                                             size_t *outlen, const char *in,
+                                             size_t inlen, int flags);
+
+/**
+ * Encode `count` items of `itemlen` bytes each, stored back to back (a
+ * hash_many output column), as `count` NUL-terminated strings of
+ * tinyblake_hex_encoded_len(itemlen) + 1 bytes each, also back to back.
+ * `outcap` must cover all of them.
+ */
+TINYBLAKE_API int tinyblake_hex_encode_many(char *out, size_t outcap,
+                                            const void *in, size_t itemlen,
+                                            size_t count, int flags);
+
+/** As tinyblake_hex_encode_many(), in unpadded base64url. */
+TINYBLAKE_API int tinyblake_base64url_encode_many(char *out, size_t outcap,
+                                                  const void *in,
+                                                  size_t itemlen, size_t count,
+                                                  int flags);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <string>
+#include <vector>
+
+namespace tinyblake::hex {
+
+TINYBLAKE_API std::string encode(const void *data, size_t len,
+                                 bool constant_time = false);
+TINYBLAKE_API std::string encode(const std::vector<uint8_t> &data,
+                                 bool constant_time = false);
+
+/** @throws std::invalid_argument on malformed input */
+TINYBLAKE_API std::vector<uint8_t> decode(const std::string &text,
+                                          bool constant_time = false);
+
+/** One string per `itemlen`-byte item of `data` (count items). */
+TINYBLAKE_API std::vector<std::string>
+encode_many(const void *data, size_t itemlen, size_t count,
+            bool constant_time = false);
+
+} /* namespace tinyblake::hex */
+
+namespace tinyblake::base64url {
+
+TINYBLAKE_API std::string encode(const void *data, size_t len,
+                                 bool constant_time = false);
+TINYBLAKE_API std::string encode(const std::vector<uint8_t> &data,
+                                 bool constant_time = false);
+
+/** @throws std::invalid_argument on malformed input */
+TINYBLAKE_API std::vector<uint8_t> decode(const std::string &text,
+                                          bool constant_time = false);
+
+TINYBLAKE_API std::vector<std::string>
+encode_many(const void *data, size_t itemlen, size_t count,
+            bool constant_time = false);
+
+} /* namespace tinyblake::base64url */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_ENCODING_H */
@@ -0,0 +1,165 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#ifndef TINYBLAKE_KEYED_MULTI_H
+#define TINYBLAKE_KEYED_MULTI_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Precomputed keyed-BLAKE2b context: the chaining value after the padded
+ * key block, so per-message work starts at the first message block. Holds
+ * key material; wipe with tinyblake_secure_zero() when retired.
+ */
+typedef struct tinyblake_blake2b_key_ctx {
+  uint64_t h[8];          /* after the key block, not finalized */
+  uint64_t h0[8];         /* IV ^ parameter block, for empty messages */
+  uint8_t key_block[128]; /* zero-padded key, for empty messages */
+  uint8_t outlen;
+} tinyblake_blake2b_key_ctx;
+
+/**
+ * Precomputed HMAC-BLAKE2b-512 context: inner and outer chaining values
+ * after the ipad / opad blocks. Holds key material.
+ */
+typedef struct tinyblake_hmac_key_ctx {
+  uint64_t inner[8];  /* after ipad, not finalized */
+  uint64_t outer[8];  /* after opad */
+  uint8_t ipad[128];  /* for empty messages, where ipad is the last block */
+} tinyblake_hmac_key_ctx;
+
+TINYBLAKE_API int tinyblake_blake2b_key_ctx_init(tinyblake_blake2b_key_ctx *ctx,
+                                                 size_t outlen,
+                                                 const void *key,
+                                                 size_t keylen);
+
+TINYBLAKE_API int tinyblake_hmac_key_ctx_init(tinyblake_hmac_key_ctx *ctx,
+                                              const void *key, size_t keylen);
+
+/**
+ * Keyed BLAKE2b of one message under `nkeys` keys in a single pass. The
+ * message words are broadcast to every SIMD lane; only the chaining values
+ * differ per lane. Digest i (key_ctxs[i].outlen bytes) is written right
+ * after digest i - 1 in `outs`.
+ */
+TINYBLAKE_API int
+tinyblake_blake2b_keyed_multi(const void *msg, size_t len,
+                              const tinyblake_blake2b_key_ctx key_ctxs[],
+                              size_t nkeys, void *outs);
+
+/**
+ * Check `tag` against the keyed BLAKE2b of msg under each key, comparing in
+ * constant time as each lane group finishes and never stopping early.
+ * Every key_ctxs[i].outlen must equal taglen.
+ *
+ * @param matched  set to the index of the matching key (the lowest one if
+ *                 several match); may be NULL
+ * @return 0 if some key matches, -1 if none does or on invalid arguments
+ */
+TINYBLAKE_API int tinyblake_blake2b_keyed_multi_verify(
+    const void *msg, size_t len, const tinyblake_blake2b_key_ctx key_ctxs[],
+    size_t nkeys, const void *tag, size_t taglen, size_t *matched);
+
+/**
+ * HMAC-BLAKE2b-512 of one message under `nkeys` keys. The inner hashes share
+ * the message schedule across lanes; the outer hashes run through the
+ * multi-lane kernel. Writes nkeys * 64 bytes to `outs`.
+ */
+TINYBLAKE_API int tinyblake_hmac_multi(const void *msg, size_t len,
+                                       const tinyblake_hmac_key_ctx key_ctxs[],
+                                       size_t nkeys, void *outs);
+
+/**
+ * Check a (possibly truncated, 1..64 byte) HMAC tag against every key in
+ * one pass with a constant-time compare; see
+ * tinyblake_blake2b_keyed_multi_verify().
+ */
+TINYBLAKE_API int
+tinyblake_hmac_multi_verify(const void *msg, size_t len,
+                            const tinyblake_hmac_key_ctx key_ctxs[],
+                            size_t nkeys, const void *tag, size_t taglen,
+                            size_t *matched);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <optional>
+#include <vector>
+
+namespace tinyblake::blake2b {
+
+using key_ctx = tinyblake_blake2b_key_ctx;
+
+/** @throws std::invalid_argument on bad outlen / key */
+TINYBLAKE_API key_ctx make_key_ctx(const void *key, size_t keylen,
+                                   size_t outlen = 64);
+
+/** Digests under every key, concatenated. */
+TINYBLAKE_API std::vector<uint8_t>
+keyed_multi(const void *msg, size_t len, const std::vector<key_ctx> &keys);
+
+/** Index of the key that produced `tag`, or nullopt. */
+TINYBLAKE_API std::optional<size_t>
+keyed_multi_verify(const void *msg, size_t len,
+                   const std::vector<key_ctx> &keys, const void *tag,
+                   size_t taglen);
+
+} /* namespace tinyblake::blake2b */
+
+namespace tinyblake::hmac {
+
+using key_ctx = tinyblake_hmac_key_ctx;
+
+/** @throws std::invalid_argument on a null or empty key */
+TINYBLAKE_API key_ctx make_key_ctx(const void *key, size_t keylen);
+
+/** 64-byte MACs under every key, concatenated. */
+TINYBLAKE_API std::vector<uint8_t>
+mac_multi(const void *msg, size_t len, const std::vector<key_ctx> &keys);
+
+/** Index of the key that produced `tag`, or nullopt. */
+TINYBLAKE_API std::optional<size_t>
+verify_multi(const void *msg, size_t len, const std::vector<key_ctx> &keys,
+             const void *tag, size_t taglen);
+
+} /* namespace tinyblake::hmac */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_KEYED_MULTI_H */
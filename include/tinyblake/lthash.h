@@ -0,0 +1,155 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_LTHASH_H
+#define TINYBLAKE_LTHASH_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  TINYBLAKE_LTHASH16_BYTES = 2048, /* checksum size */
+  TINYBLAKE_LTHASH16_LANES = 1024  /* uint16 lanes */
+};
+
+/**
+ * LtHash16 homomorphic multiset hash (Bellare–Micciancio lattice hash, as
+ * deployed by Facebook's folly::LtHash).
+ *
+ * Each element is expanded with BLAKE2Xb into 1024 little-endian uint16
+ * lanes; the checksum of a multiset is the lane-wise sum (mod 2^16) of its
+ * elements' expansions. Adding or removing an element is O(1) in the size
+ * of the set, and checksums of disjoint multisets can be combined.
+ */
+typedef struct tinyblake_lthash16 {
+  alignas(64) uint8_t sum[2048];
+} tinyblake_lthash16;
+
+/** Reset to the checksum of the empty multiset. */
+TINYBLAKE_API int tinyblake_lthash16_init(tinyblake_lthash16 *state);
+
+TINYBLAKE_API int tinyblake_lthash16_add(tinyblake_lthash16 *state,
+                                         const void *elem, size_t len);
+
+TINYBLAKE_API int tinyblake_lthash16_remove(tinyblake_lthash16 *state,
+                                            const void *elem, size_t len);
+
+/**
+ * Batched add/remove. Element expansions are computed several at a time
+ * on the multi-lane BLAKE2b kernels.
+ */
+TINYBLAKE_API int tinyblake_lthash16_add_many(tinyblake_lthash16 *state,
+                                              const void *const elems[],
+                                              const size_t lens[], size_t n);
+
+TINYBLAKE_API int tinyblake_lthash16_remove_many(tinyblake_lthash16 *state,
+                                                 const void *const elems[],
+                                                 const size_t lens[],
+                                                 size_t n);
+
+/** Multiset union / difference of two checksums. */
+TINYBLAKE_API int tinyblake_lthash16_combine(tinyblake_lthash16 *state,
+                                             const tinyblake_lthash16 *other);
+
+TINYBLAKE_API int tinyblake_lthash16_subtract(tinyblake_lthash16 *state,
+                                              const tinyblake_lthash16 *other);
+
+/**
+ * Compact digest of the checksum: BLAKE2b over the 2048 checksum bytes.
+ * outlen is 1..64.
+ */
+TINYBLAKE_API int tinyblake_lthash16_digest(const tinyblake_lthash16 *state,
+                                            void *out, size_t outlen);
+
+/**
+ * Constant-time checksum comparison. Returns 1 if equal, 0 if not.
+ */
+TINYBLAKE_API int tinyblake_lthash16_eq(const tinyblake_lthash16 *a,
+                                        const tinyblake_lthash16 *b);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <string>
+#include <vector>
+
+namespace tinyblake::lthash {
+
+inline constexpr size_t CHECKSUM_BYTES = 2048;
+
+class TINYBLAKE_API lthash16 {
+public:
+  /** Checksum of the empty multiset. */
+  lthash16();
+
+  /** Add / remove one element. */
+  void add(const void *elem, size_t len);
+  void add(const std::vector<uint8_t> &elem);
+  void add(const std::string &elem);
+  void remove(const void *elem, size_t len);
+  void remove(const std::vector<uint8_t> &elem);
+  void remove(const std::string &elem);
+
+  /** Batched add / remove. */
+  void add_many(const void *const elems[], const size_t lens[], size_t n);
+  void remove_many(const void *const elems[], const size_t lens[], size_t n);
+
+  /** Multiset union / difference. */
+  lthash16 &operator+=(const lthash16 &other);
+  lthash16 &operator-=(const lthash16 &other);
+
+  /** Constant-time comparison. */
+  bool operator==(const lthash16 &other) const;
+  bool operator!=(const lthash16 &other) const;
+
+  /** Compact BLAKE2b digest of the checksum (1..64 bytes). */
+  std::vector<uint8_t> digest(size_t outlen = 32) const;
+
+  /** Raw 2048-byte checksum. */
+  const uint8_t *data() const { return state_.sum; }
+
+private:
+  tinyblake_lthash16 state_;
+};
+
+} /* namespace tinyblake::lthash */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_LTHASH_H */
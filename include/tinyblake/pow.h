@@ -0,0 +1,121 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_POW_H
+#define TINYBLAKE_POW_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Proof of work over BLAKE2b: a nonce is valid when
+ *
+ *   BLAKE2b-<outlen>(header || LE64(nonce)) <= target
+ *
+ * with both sides compared as big-endian numbers (i.e. byte-wise, first
+ * byte most significant). A leading-zero-bits difficulty is a target of
+ * that many zero bits followed by ones; see tinyblake_pow_target_bits().
+ */
+
+/**
+ * Fill an outlen-byte target requiring `bits` leading zero bits
+ * (bits <= 8 * outlen).
+ */
+TINYBLAKE_API int tinyblake_pow_target_bits(uint8_t *target, size_t outlen,
+                                            unsigned bits);
+
+/**
+ * Search nonces start_nonce, start_nonce + 1, ... (at most max_tries of
+ * them) for one meeting `target`. The header's full blocks are compressed
+ * once; each candidate only re-hashes the final block(s) holding the nonce,
+ * several nonces per call on the multi-lane kernels, spread over up to
+ * `threads` threads (0 = all hardware threads).
+ *
+ * The smallest qualifying nonce in the range is returned regardless of
+ * thread count. On success *nonce_out is set and, if digest_out is not
+ * NULL, the outlen-byte digest is written there.
+ *
+ * Returns 0 if a nonce was found, 1 if the range was exhausted, -1 on
+ * invalid arguments.
+ */
+TINYBLAKE_API int tinyblake_pow_search(const void *header, size_t headerlen,
+                                       size_t outlen, const uint8_t *target,
+                                       uint64_t start_nonce,
+                                       uint64_t max_tries, size_t threads,
+                                       uint64_t *nonce_out, void *digest_out);
+
+/**
+ * Check a single nonce. Returns 1 if it meets `target`, 0 if not, -1 on
+ * invalid arguments.
+ */
+TINYBLAKE_API int tinyblake_pow_verify(const void *header, size_t headerlen,
+                                       uint64_t nonce, size_t outlen,
+                                       const uint8_t *target);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <vector>
+
+namespace tinyblake::pow {
+
+struct solution {
+  bool found;
+  uint64_t nonce;
+  std::vector<uint8_t> digest; /* empty when !found */
+};
+
+/**
+ * Find the smallest nonce >= start whose digest has `difficulty_bits`
+ * leading zero bits. See tinyblake_pow_search().
+ */
+TINYBLAKE_API solution search(const void *header, size_t len,
+                              unsigned difficulty_bits, uint64_t start = 0,
+                              uint64_t max_tries = UINT64_MAX,
+                              size_t outlen = 64, size_t threads = 0);
+
+/** True if `nonce` meets `difficulty_bits` for this header. */
+TINYBLAKE_API bool verify(const void *header, size_t len, uint64_t nonce,
+                          unsigned difficulty_bits, size_t outlen = 64);
+
+} /* namespace tinyblake::pow */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_POW_H */
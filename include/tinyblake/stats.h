@@ -0,0 +1,162 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_STATS_H
+#define TINYBLAKE_STATS_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Latency histograms for the public entry points.
+ *
+ * Built only with -DENABLE_STATS=ON; otherwise every call below except
+ * tinyblake_stats_enabled() and tinyblake_stats_op_name() returns -1 and
+ * the entry points carry no instrumentation.
+ *
+ * One call in every `rate` (per thread) is timed with the monotonic clock
+ * and added to that thread's histogram with relaxed atomics; there are no
+ * locks or shared cache lines on the recording path. Calls the library
+ * makes to an instrumented function internally (e.g. hashing a long HMAC
+ * key with tinyblake_blake2b()) neither count toward the sampling period
+ * nor record, whether or not the outer call was sampled. Histograms are
+ * log-linear: exact below 64 ns, then 32 buckets per power of two (at most
+ * 1/32 relative error) up to 2^40 ns, with longer calls in the last bucket.
+ *
+ * Snapshots merge every live thread's histogram with those of threads that
+ * have exited.
+ */
+
+/*
+ * Instrumented operations: the one-shot and batch entry points. The
+ * streaming init/update/final calls are left out, since each one covers
+ * only part of a message.
+ */
+#define TINYBLAKE_STATS_BLAKE2B 0            /* tinyblake_blake2b(_ex) */
+#define TINYBLAKE_STATS_BLAKE2B_HASH_MANY 1  /* tinyblake_blake2b_hash_many */
+#define TINYBLAKE_STATS_BLAKE2S_HASH_MANY 2  /* tinyblake_blake2s_hash_many */
+#define TINYBLAKE_STATS_HMAC 3               /* tinyblake_hmac */
+#define TINYBLAKE_STATS_HMAC_VERIFY 4        /* tinyblake_hmac_multi_verify */
+#define TINYBLAKE_STATS_PBKDF2 5             /* tinyblake_pbkdf2 */
+#define TINYBLAKE_STATS_HMAC_BLAKE2S 6       /* tinyblake_hmac_blake2s */
+#define TINYBLAKE_STATS_HMAC_MULTI 7         /* tinyblake_hmac_multi */
+#define TINYBLAKE_STATS_KEYED_MULTI 8        /* tinyblake_blake2b_keyed_multi */
+#define TINYBLAKE_STATS_KEYED_MULTI_VERIFY 9 /* ..._keyed_multi_verify */
+#define TINYBLAKE_STATS_TUPLE_HASH_MANY 10   /* ..._tuple_hash_many */
+#define TINYBLAKE_STATS_OPS 11
+
+#define TINYBLAKE_STATS_BUCKETS 1152
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct tinyblake_stats_summary {
+  uint64_t count; /* sampled calls */
+  uint64_t min_ns;
+  uint64_t max_ns;
+  uint64_t mean_ns;
+  uint64_t p50_ns; /* percentiles: upper bound of the bucket holding the */
+  uint64_t p90_ns; /* nearest-rank sample, clamped to [min_ns, max_ns] */
+  uint64_t p99_ns;
+  uint64_t p999_ns;
+} tinyblake_stats_summary;
+
+/** 1 if the library was built with ENABLE_STATS, else 0. */
+TINYBLAKE_API int tinyblake_stats_enabled(void);
+
+/**
+ * Time one call in every `rate` on each thread; 0 stops sampling (the
+ * default), 1 times every call.
+ */
+TINYBLAKE_API int tinyblake_stats_set_sample_rate(uint32_t rate);
+
+TINYBLAKE_API uint32_t tinyblake_stats_sample_rate(void);
+
+/**
+ * Clear every histogram. Samples recorded concurrently may land on either
+ * side of the reset.
+ */
+TINYBLAKE_API int tinyblake_stats_reset(void);
+
+/** Merged summary for one TINYBLAKE_STATS_* operation. */
+TINYBLAKE_API int tinyblake_stats_snapshot(int op,
+                                           tinyblake_stats_summary *out);
+
+/**
+ * Merged bucket counts for one operation, for export to an external
+ * metrics system. Bucket bounds come from tinyblake_stats_bucket_range().
+ */
+TINYBLAKE_API int
+tinyblake_stats_histogram(int op, uint64_t counts[TINYBLAKE_STATS_BUCKETS]);
+
+/** Inclusive latency range [lo_ns, hi_ns] of one histogram bucket. */
+TINYBLAKE_API int tinyblake_stats_bucket_range(size_t index, uint64_t *lo_ns,
+                                               uint64_t *hi_ns);
+
+/** Metric name of an operation ("blake2b", "hmac", ...), or NULL. */
+TINYBLAKE_API const char *tinyblake_stats_op_name(int op);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <vector>
+
+namespace tinyblake::stats {
+
+using summary = tinyblake_stats_summary;
+
+inline bool enabled() { return tinyblake_stats_enabled() == 1; }
+
+/** @throws std::runtime_error if built without ENABLE_STATS */
+TINYBLAKE_API void set_sample_rate(uint32_t rate);
+
+/** @throws std::runtime_error if built without ENABLE_STATS */
+TINYBLAKE_API void reset();
+
+/**
+ * @throws std::invalid_argument on an unknown op
+ * @throws std::runtime_error if built without ENABLE_STATS
+ */
+TINYBLAKE_API summary snapshot(int op);
+
+/** Bucket counts; @throws as snapshot() */
+TINYBLAKE_API std::vector<uint64_t> histogram(int op);
+
+} /* namespace tinyblake::stats */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_STATS_H */
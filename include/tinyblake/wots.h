@@ -0,0 +1,111 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_WOTS_H
+#define TINYBLAKE_WOTS_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/* ──────────────────────────── C API ──────────────────────────── */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  TINYBLAKE_WOTS_N = 32,         /* chain value size */
+  TINYBLAKE_WOTS_ADDR_BYTES = 16, /* per-chain address (salt field) */
+  TINYBLAKE_WOTS_SEED_BYTES = 16  /* public seed (personal field) */
+};
+
+/*
+ * Chain function for Winternitz-style one-time signatures (WOTS+ with the
+ * bitmask replaced by a tweak). One step at chain position j is
+ *
+ *   F(x) = BLAKE2b-256(x)  with  salt     = addr[0..12) || LE32(j)
+ *                                personal = seed
+ *
+ * so every step of every chain is domain-separated without extra
+ * compressions. Bytes 12..15 of each address are overwritten with the step
+ * index.
+ */
+
+/**
+ * Advance `nchains` independent chains. Chain i starts from the 32-byte
+ * value in[32 i], at position start[i] (NULL = all 0), and takes steps[i]
+ * steps; the result goes to out[32 i]. `out` may be the same buffer as
+ * `in`. Chains run in lockstep, one per lane of the multi-lane kernel, and
+ * a lane that finishes is refilled with the next pending chain.
+ *
+ * Returns 0 on success, -1 on invalid arguments (including
+ * start[i] + steps[i] > 2^32 - 1).
+ */
+TINYBLAKE_API int tinyblake_wots_chains(uint8_t *out, const uint8_t *in,
+                                        const uint8_t *addrs,
+                                        const uint32_t *start,
+                                        const uint32_t *steps, size_t nchains,
+                                        const uint8_t *seed);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/* ──────────────────────────── C++ API ──────────────────────────── */
+#ifdef __cplusplus
+
+#include <vector>
+
+namespace tinyblake::wots {
+
+inline constexpr size_t N = 32;
+inline constexpr size_t ADDR_BYTES = 16;
+inline constexpr size_t SEED_BYTES = 16;
+
+/**
+ * Advance chains; `values` holds 32 * n bytes and `addrs` 16 * n bytes.
+ * `start` may be empty (all chains start at 0); otherwise it and `steps`
+ * have one entry per chain. See tinyblake_wots_chains().
+ */
+TINYBLAKE_API std::vector<uint8_t>
+chains(const std::vector<uint8_t> &values, const std::vector<uint8_t> &addrs,
+       const std::vector<uint32_t> &start, const std::vector<uint32_t> &steps,
+       const uint8_t seed[SEED_BYTES]);
+
+/** A single chain; convenience over chains(). */
+TINYBLAKE_API std::vector<uint8_t> chain(const uint8_t value[N],
+                                         const uint8_t addr[ADDR_BYTES],
+                                         uint32_t start, uint32_t steps,
+                                         const uint8_t seed[SEED_BYTES]);
+
+} /* namespace tinyblake::wots */
+
+#endif /* __cplusplus */
+
+#endif /* TINYBLAKE_WOTS_H */
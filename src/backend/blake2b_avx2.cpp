@@ -124,21 +124,10 @@ static inline void g_column(__m256i &a, __m256i &b, __m256i &c, __m256i &d,
   b = rotr64_63(_mm256_xor_si256(b, c));
 }
 
-void blake2b_compress_avx2(uint64_t state[8], const uint8_t block[128],
-                           uint64_t t0, uint64_t t1, bool last) {
-  uint64_t m[16];
-  for (int i = 0; i < 16; ++i) {
-    m[i] = detail::load_le64(block + i * 8);
-  }
-
-  __m256i row1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state));
-  __m256i row2 =
-      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + 4));
+/* Twelve rounds plus feed-forward on register-resident rows */
+static inline void compress_rows(__m256i &row1, __m256i &row2, __m256i row4,
+                                 const uint64_t m[16]) {
   __m256i row3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(IV));
-  __m256i row4 = _mm256_set_epi64x(
-      static_cast<int64_t>(IV[7]),
-      static_cast<int64_t>(last ? (IV[6] ^ 0xFFFFFFFFFFFFFFFFULL) : IV[6]),
-      static_cast<int64_t>(IV[5] ^ t1), static_cast<int64_t>(IV[4] ^ t0));
 
   __m256i orig1 = row1;
   __m256i orig2 = row2;
@@ -169,11 +158,379 @@ void blake2b_compress_avx2(uint64_t state[8], const uint8_t block[128],
 
   row1 = _mm256_xor_si256(_mm256_xor_si256(row1, row3), orig1);
   row2 = _mm256_xor_si256(_mm256_xor_si256(row2, row4), orig2);
+}
+
+/* Aligned selects VMOVDQA for the chaining value (state 32-byte aligned) */
+template <bool Aligned>
+static inline void compress_state(uint64_t state[8], const uint8_t block[128],
+                                  uint64_t t0, uint64_t t1, bool last) {
+  uint64_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le64(block + i * 8);
+  }
+
+  const __m256i *src = reinterpret_cast<const __m256i *>(state);
+  __m256i row1, row2;
+  if constexpr (Aligned) {
+    row1 = _mm256_load_si256(src);
+    row2 = _mm256_load_si256(src + 1);
+  } else {
+    row1 = _mm256_loadu_si256(src);
+    row2 = _mm256_loadu_si256(src + 1);
+  }
+  __m256i row4 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[7]),
+      static_cast<int64_t>(last ? (IV[6] ^ 0xFFFFFFFFFFFFFFFFULL) : IV[6]),
+      static_cast<int64_t>(IV[5] ^ t1), static_cast<int64_t>(IV[4] ^ t0));
 
-  _mm256_storeu_si256(reinterpret_cast<__m256i *>(state), row1);
-  _mm256_storeu_si256(reinterpret_cast<__m256i *>(state + 4), row2);
+  compress_rows(row1, row2, row4, m);
+
+  __m256i *dst = reinterpret_cast<__m256i *>(state);
+  if constexpr (Aligned) {
+    _mm256_store_si256(dst, row1);
+    _mm256_store_si256(dst + 1, row2);
+  } else {
+    _mm256_storeu_si256(dst, row1);
+    _mm256_storeu_si256(dst + 1, row2);
+  }
 }
 
+void blake2b_compress_avx2(uint64_t state[8], const uint8_t block[128],
+                           uint64_t t0, uint64_t t1, bool last) {
+  compress_state<false>(state, block, t0, t1, last);
+}
+
+void blake2b_compress_avx2_aligned(uint64_t state[8], const uint8_t block[128],
+                                   uint64_t t0, uint64_t t1, bool last) {
+  compress_state<true>(state, block, t0, t1, last);
+}
+
+/*
+ * Iterated hashing: the digest stays in row1/row2 between steps and only
+ * round-trips through the (L1-resident) message array the rounds index.
+ * Chaining value, counter and finalization row are loop constants.
+ */
+void blake2b_iterate_avx2(uint64_t digest[8], size_t outlen, uint64_t n) {
+  alignas(32) uint64_t m[16] = {};
+  uint64_t mask[8];
+  for (size_t i = 0; i < 8; ++i) {
+    mask[i] = blake2b_digest_mask(outlen, i);
+  }
+
+  const __m256i mask1 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask));
+  const __m256i mask2 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask + 4));
+  const __m256i h1 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[3]), static_cast<int64_t>(IV[2]),
+      static_cast<int64_t>(IV[1]),
+      static_cast<int64_t>(IV[0] ^ (0x01010000ULL | outlen)));
+  const __m256i h2 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(IV + 4));
+  const __m256i row4 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[7]),
+      static_cast<int64_t>(IV[6] ^ 0xFFFFFFFFFFFFFFFFULL),
+      static_cast<int64_t>(IV[5]), static_cast<int64_t>(IV[4] ^ outlen));
+
+  __m256i d1 = _mm256_and_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest)), mask1);
+  __m256i d2 = _mm256_and_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest + 4)),
+      mask2);
+
+  for (uint64_t k = 0; k < n; ++k) {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(m), d1);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(m + 4), d2);
+    __m256i row1 = h1;
+    __m256i row2 = h2;
+    compress_rows(row1, row2, row4, m);
+    d1 = _mm256_and_si256(row1, mask1);
+    d2 = _mm256_and_si256(row2, mask2);
+  }
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest), d1);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest + 4), d2);
+}
+
+/*
+ * 4-way transposed kernel: each __m256i holds the same working word for four
+ * independent messages, so G runs on whole registers with no diagonal
+ * permutes. Message blocks and chaining values are transposed in and out
+ * with 4x4 64-bit transposes.
+ */
+
+alignas(32) static const uint8_t rotr24_mask[32] = {
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+    3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10};
+
+static inline void transpose4x4(__m256i &r0, __m256i &r1, __m256i &r2,
+                                __m256i &r3) {
+  __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+  __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+  __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+  __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+  r0 = _mm256_permute2x128_si256(t0, t2, 0x20);
+  r1 = _mm256_permute2x128_si256(t1, t3, 0x20);
+  r2 = _mm256_permute2x128_si256(t0, t2, 0x31);
+  r3 = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+#define G4(a, b, c, d, mx, my)                                                 \
+  do {                                                                         \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), mx);                          \
+    d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), _MM_SHUFFLE(2, 3, 0, 1)); \
+    c = _mm256_add_epi64(c, d);                                                \
+    b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rot24);                    \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), my);                          \
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot16);                    \
+    c = _mm256_add_epi64(c, d);                                                \
+    b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));     \
+  } while (0)
+
+void blake2b_compress_4way_avx2(uint64_t *const state[],
+                                const uint8_t *const block[],
+                                const uint64_t t0[], const uint64_t t1[],
+                                const uint64_t f0[]) {
+  const __m256i rot24 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr24_mask));
+  const __m256i rot16 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr16_mask));
+
+  __m256i m[16];
+  for (int i = 0; i < 16; i += 4) {
+    __m256i r0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block[0] + i * 8));
+    __m256i r1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block[1] + i * 8));
+    __m256i r2 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block[2] + i * 8));
+    __m256i r3 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block[3] + i * 8));
+    transpose4x4(r0, r1, r2, r3);
+    m[i + 0] = r0;
+    m[i + 1] = r1;
+    m[i + 2] = r2;
+    m[i + 3] = r3;
+  }
+
+  __m256i v[16];
+  for (int i = 0; i < 8; i += 4) {
+    __m256i r0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[0] + i));
+    __m256i r1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[1] + i));
+    __m256i r2 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[2] + i));
+    __m256i r3 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[3] + i));
+    transpose4x4(r0, r1, r2, r3);
+    v[i + 0] = r0;
+    v[i + 1] = r1;
+    v[i + 2] = r2;
+    v[i + 3] = r3;
+  }
+
+  __m256i h[8];
+  for (int i = 0; i < 8; ++i)
+    h[i] = v[i];
+
+  for (int i = 0; i < 4; ++i)
+    v[8 + i] = _mm256_set1_epi64x(static_cast<int64_t>(IV[i]));
+  v[12] = _mm256_xor_si256(
+      _mm256_set1_epi64x(static_cast<int64_t>(IV[4])),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t0)));
+  v[13] = _mm256_xor_si256(
+      _mm256_set1_epi64x(static_cast<int64_t>(IV[5])),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t1)));
+  v[14] = _mm256_xor_si256(
+      _mm256_set1_epi64x(static_cast<int64_t>(IV[6])),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(f0)));
+  v[15] = _mm256_set1_epi64x(static_cast<int64_t>(IV[7]));
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    G4(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+    G4(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+    G4(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+    G4(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+    G4(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+    G4(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    G4(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+    G4(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm256_xor_si256(h[i], _mm256_xor_si256(v[i], v[i + 8]));
+
+  for (int i = 0; i < 8; i += 4) {
+    transpose4x4(h[i + 0], h[i + 1], h[i + 2], h[i + 3]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[0] + i), h[i + 0]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[1] + i), h[i + 1]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[2] + i), h[i + 2]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[3] + i), h[i + 3]);
+  }
+}
+
+/*
+ * 4-way iterated hashing. In the transposed layout the next message words
+ * are simply the masked chaining-value vectors, so digests never leave
+ * registers between steps.
+ */
+void blake2b_iterate_4way_avx2(uint64_t *const digest[], size_t outlen,
+                               uint64_t n) {
+  const __m256i rot24 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr24_mask));
+  const __m256i rot16 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr16_mask));
+
+  /* Loop constants: initial chaining value, and the counter/final row */
+  __m256i mask[8];
+  __m256i h0[8];
+  __m256i iv[8];
+  for (size_t i = 0; i < 8; ++i) {
+    mask[i] = _mm256_set1_epi64x(
+        static_cast<int64_t>(blake2b_digest_mask(outlen, i)));
+    iv[i] = _mm256_set1_epi64x(static_cast<int64_t>(IV[i]));
+    h0[i] = iv[i];
+  }
+  h0[0] = _mm256_set1_epi64x(
+      static_cast<int64_t>(IV[0] ^ (0x01010000ULL | outlen)));
+  const __m256i v12 =
+      _mm256_set1_epi64x(static_cast<int64_t>(IV[4] ^ outlen));
+  const __m256i v14 = _mm256_set1_epi64x(static_cast<int64_t>(~IV[6]));
+
+  /* m[8..15] stay zero: the message is one zero-padded digest */
+  __m256i m[16];
+  for (int i = 0; i < 8; i += 4) {
+    __m256i r0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest[0] + i));
+    __m256i r1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest[1] + i));
+    __m256i r2 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest[2] + i));
+    __m256i r3 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest[3] + i));
+    transpose4x4(r0, r1, r2, r3);
+    m[i + 0] = _mm256_and_si256(r0, mask[i + 0]);
+    m[i + 1] = _mm256_and_si256(r1, mask[i + 1]);
+    m[i + 2] = _mm256_and_si256(r2, mask[i + 2]);
+    m[i + 3] = _mm256_and_si256(r3, mask[i + 3]);
+  }
+  for (int i = 8; i < 16; ++i)
+    m[i] = _mm256_setzero_si256();
+
+  for (uint64_t k = 0; k < n; ++k) {
+    __m256i v[16];
+    for (int i = 0; i < 8; ++i)
+      v[i] = h0[i];
+    for (int i = 0; i < 4; ++i)
+      v[8 + i] = iv[i];
+    v[12] = v12;
+    v[13] = iv[5];
+    v[14] = v14;
+    v[15] = iv[7];
+
+    for (int r = 0; r < 12; ++r) {
+      const uint8_t *s = SIGMA[r];
+      G4(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+      G4(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+      G4(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+      G4(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+      G4(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+      G4(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      G4(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+      G4(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i)
+      m[i] = _mm256_and_si256(
+          _mm256_xor_si256(h0[i], _mm256_xor_si256(v[i], v[i + 8])), mask[i]);
+  }
+
+  for (int i = 0; i < 8; i += 4) {
+    __m256i r0 = m[i + 0], r1 = m[i + 1], r2 = m[i + 2], r3 = m[i + 3];
+    transpose4x4(r0, r1, r2, r3);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest[0] + i), r0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest[1] + i), r1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest[2] + i), r2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest[3] + i), r3);
+  }
+}
+
+/*
+ * 4-way shared-message kernel: four chaining values (e.g. one per key)
+ * absorb the same block. Message words and the counter/finalization row
+ * are identical in every lane, so they are broadcast from the scalar block
+ * instead of transposed; only the chaining values go through transposes.
+ */
+void blake2b_compress_4way_bcast_avx2(uint64_t *const state[],
+                                      const uint8_t block[128], uint64_t t0,
+                                      uint64_t t1, bool last) {
+  const __m256i rot24 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr24_mask));
+  const __m256i rot16 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr16_mask));
+
+  __m256i m[16];
+  for (int i = 0; i < 16; ++i)
+    m[i] = _mm256_set1_epi64x(
+        static_cast<int64_t>(detail::load_le64(block + i * 8)));
+
+  __m256i v[16];
+  for (int i = 0; i < 8; i += 4) {
+    __m256i r0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[0] + i));
+    __m256i r1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[1] + i));
+    __m256i r2 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[2] + i));
+    __m256i r3 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[3] + i));
+    transpose4x4(r0, r1, r2, r3);
+    v[i + 0] = r0;
+    v[i + 1] = r1;
+    v[i + 2] = r2;
+    v[i + 3] = r3;
+  }
+
+  __m256i h[8];
+  for (int i = 0; i < 8; ++i)
+    h[i] = v[i];
+
+  for (int i = 0; i < 4; ++i)
+    v[8 + i] = _mm256_set1_epi64x(static_cast<int64_t>(IV[i]));
+  v[12] = _mm256_set1_epi64x(static_cast<int64_t>(IV[4] ^ t0));
+  v[13] = _mm256_set1_epi64x(static_cast<int64_t>(IV[5] ^ t1));
+  v[14] = _mm256_set1_epi64x(static_cast<int64_t>(last ? ~IV[6] : IV[6]));
+  v[15] = _mm256_set1_epi64x(static_cast<int64_t>(IV[7]));
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    G4(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+    G4(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+    G4(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+    G4(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+    G4(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+    G4(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    G4(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+    G4(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm256_xor_si256(h[i], _mm256_xor_si256(v[i], v[i + 8]));
+
+  for (int i = 0; i < 8; i += 4) {
+    transpose4x4(h[i + 0], h[i + 1], h[i + 2], h[i + 3]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[0] + i), h[i + 0]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[1] + i), h[i + 1]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[2] + i), h[i + 2]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[3] + i), h[i + 3]);
+  }
+}
+
+#undef G4
+
 } /* namespace tinyblake */
 
 #else /* No x86-64 support — provide a stub that forwards to portable */
@@ -187,6 +544,36 @@ void blake2b_compress_avx2(uint64_t state[8], const uint8_t block[128],
   blake2b_compress_portable(state, block, t0, t1, last);
 }
 
+void blake2b_compress_avx2_aligned(uint64_t state[8], const uint8_t block[128],
+                                   uint64_t t0, uint64_t t1, bool last) {
+  blake2b_compress_portable(state, block, t0, t1, last);
+}
+
+void blake2b_iterate_avx2(uint64_t digest[8], size_t outlen, uint64_t n) {
+  blake2b_iterate_portable(digest, outlen, n);
+}
+
+void blake2b_compress_4way_avx2(uint64_t *const state[],
+                                const uint8_t *const block[],
+                                const uint64_t t0[], const uint64_t t1[],
+                                const uint64_t f0[]) {
+  for (int i = 0; i < 4; ++i)
+    blake2b_compress_portable(state[i], block[i], t0[i], t1[i], f0[i] != 0);
+}
+
+void blake2b_iterate_4way_avx2(uint64_t *const digest[], size_t outlen,
+                               uint64_t n) {
+  for (int i = 0; i < 4; ++i)
+    blake2b_iterate_portable(digest[i], outlen, n);
+}
+
+void blake2b_compress_4way_bcast_avx2(uint64_t *const state[],
+                                      const uint8_t block[128], uint64_t t0,
+                                      uint64_t t1, bool last) {
+  for (int i = 0; i < 4; ++i)
+    blake2b_compress_portable(state[i], block, t0, t1, last);
+}
+
 } /* namespace tinyblake */
 
 #endif
\ No newline at end of file
@@ -94,27 +94,16 @@ static inline void g_column(__m256i &a, __m256i &b, __m256i &c, __m256i &d,
   b = _mm256_rorv_epi64(_mm256_xor_si256(b, c), rot63);
 }
 
-void blake2b_compress_avx512(uint64_t state[8], const uint8_t block[128],
-                             uint64_t t0, uint64_t t1, bool last) {
-  uint64_t m[16];
-  for (int i = 0; i < 16; ++i) {
-    m[i] = detail::load_le64(block + i * 8);
-  }
-
+/* Twelve rounds plus feed-forward on register-resident rows */
+static inline void compress_rows(__m256i &row1, __m256i &row2, __m256i row4,
+                                 const uint64_t m[16]) {
   /* Rotation constants — each lane holds the same shift amount */
   const __m256i rot32 = _mm256_set1_epi64x(32);
   const __m256i rot24 = _mm256_set1_epi64x(24);
   const __m256i rot16 = _mm256_set1_epi64x(16);
   const __m256i rot63 = _mm256_set1_epi64x(63);
 
-  __m256i row1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state));
-  __m256i row2 =
-      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + 4));
   __m256i row3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(IV));
-  __m256i row4 = _mm256_set_epi64x(
-      static_cast<int64_t>(IV[7]),
-      static_cast<int64_t>(last ? (IV[6] ^ 0xFFFFFFFFFFFFFFFFULL) : IV[6]),
-      static_cast<int64_t>(IV[5] ^ t1), static_cast<int64_t>(IV[4] ^ t0));
 
   __m256i orig1 = row1;
   __m256i orig2 = row2;
@@ -145,11 +134,328 @@ void blake2b_compress_avx512(uint64_t state[8], const uint8_t block[128],
 
   row1 = _mm256_xor_si256(_mm256_xor_si256(row1, row3), orig1);
   row2 = _mm256_xor_si256(_mm256_xor_si256(row2, row4), orig2);
+}
+
+/* Aligned selects VMOVDQA for the chaining value (state 32-byte aligned) */
+template <bool Aligned>
+static inline void compress_state(uint64_t state[8], const uint8_t block[128],
+                                  uint64_t t0, uint64_t t1, bool last) {
+  uint64_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le64(block + i * 8);
+  }
+
+  const __m256i *src = reinterpret_cast<const __m256i *>(state);
+  __m256i row1, row2;
+  if constexpr (Aligned) {
+    row1 = _mm256_load_si256(src);
+    row2 = _mm256_load_si256(src + 1);
+  } else {
+    row1 = _mm256_loadu_si256(src);
+    row2 = _mm256_loadu_si256(src + 1);
+  }
+  __m256i row4 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[7]),
+      static_cast<int64_t>(last ? (IV[6] ^ 0xFFFFFFFFFFFFFFFFULL) : IV[6]),
+      static_cast<int64_t>(IV[5] ^ t1), static_cast<int64_t>(IV[4] ^ t0));
+
+  compress_rows(row1, row2, row4, m);
+
+  __m256i *dst = reinterpret_cast<__m256i *>(state);
+  if constexpr (Aligned) {
+    _mm256_store_si256(dst, row1);
+    _mm256_store_si256(dst + 1, row2);
+  } else {
+    _mm256_storeu_si256(dst, row1);
+    _mm256_storeu_si256(dst + 1, row2);
+  }
+}
+
+void blake2b_compress_avx512(uint64_t state[8], const uint8_t block[128],
+                             uint64_t t0, uint64_t t1, bool last) {
+  compress_state<false>(state, block, t0, t1, last);
+}
+
+void blake2b_compress_avx512_aligned(uint64_t state[8],
+                                     const uint8_t block[128], uint64_t t0,
+                                     uint64_t t1, bool last) {
+  compress_state<true>(state, block, t0, t1, last);
+}
+
+/*
+ * Iterated hashing: the digest stays in row1/row2 between steps and only
+ * round-trips through the (L1-resident) message array the rounds index.
+ * Chaining value, counter and finalization row are loop constants.
+ */
+void blake2b_iterate_avx512(uint64_t digest[8], size_t outlen, uint64_t n) {
+  alignas(32) uint64_t m[16] = {};
+  uint64_t mask[8];
+  for (size_t i = 0; i < 8; ++i) {
+    mask[i] = blake2b_digest_mask(outlen, i);
+  }
+
+  const __m256i mask1 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask));
+  const __m256i mask2 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask + 4));
+  const __m256i h1 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[3]), static_cast<int64_t>(IV[2]),
+      static_cast<int64_t>(IV[1]),
+      static_cast<int64_t>(IV[0] ^ (0x01010000ULL | outlen)));
+  const __m256i h2 =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(IV + 4));
+  const __m256i row4 = _mm256_set_epi64x(
+      static_cast<int64_t>(IV[7]),
+      static_cast<int64_t>(IV[6] ^ 0xFFFFFFFFFFFFFFFFULL),
+      static_cast<int64_t>(IV[5]), static_cast<int64_t>(IV[4] ^ outlen));
+
+  __m256i d1 = _mm256_and_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest)), mask1);
+  __m256i d2 = _mm256_and_si256(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(digest + 4)),
+      mask2);
+
+  for (uint64_t k = 0; k < n; ++k) {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(m), d1);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(m + 4), d2);
+    __m256i row1 = h1;
+    __m256i row2 = h2;
+    compress_rows(row1, row2, row4, m);
+    d1 = _mm256_and_si256(row1, mask1);
+    d2 = _mm256_and_si256(row2, mask2);
+  }
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest), d1);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(digest + 4), d2);
+}
+
+/*
+ * 8-way transposed kernel: one message per 64-bit ZMM lane. Unlike the
+ * single-message path above this does use 512-bit registers — with eight
+ * independent messages the extra width outweighs the frequency cost.
+ * All 16 working words stay resident in the 32 ZMM registers.
+ */
+
+/* GCC 12's unpack/shuffle/rotate intrinsics pass _mm512_undefined_epi32()
+ * as the merge source, which trips -W(maybe-)uninitialized (GCC PR 105593). */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
 
-  _mm256_storeu_si256(reinterpret_cast<__m256i *>(state), row1);
-  _mm256_storeu_si256(reinterpret_cast<__m256i *>(state + 4), row2);
+/* Transpose 8 rows of 8 x uint64 (row i = lane i) into 8 word vectors */
+static inline void transpose8x8(__m512i r[8]) {
+  __m512i t0 = _mm512_unpacklo_epi64(r[0], r[1]);
+  __m512i t1 = _mm512_unpackhi_epi64(r[0], r[1]);
+  __m512i t2 = _mm512_unpacklo_epi64(r[2], r[3]);
+  __m512i t3 = _mm512_unpackhi_epi64(r[2], r[3]);
+  __m512i t4 = _mm512_unpacklo_epi64(r[4], r[5]);
+  __m512i t5 = _mm512_unpackhi_epi64(r[4], r[5]);
+  __m512i t6 = _mm512_unpacklo_epi64(r[6], r[7]);
+  __m512i t7 = _mm512_unpackhi_epi64(r[6], r[7]);
+
+  __m512i u0 = _mm512_shuffle_i64x2(t0, t2, 0x88);
+  __m512i u1 = _mm512_shuffle_i64x2(t0, t2, 0xDD);
+  __m512i u2 = _mm512_shuffle_i64x2(t1, t3, 0x88);
+  __m512i u3 = _mm512_shuffle_i64x2(t1, t3, 0xDD);
+  __m512i u4 = _mm512_shuffle_i64x2(t4, t6, 0x88);
+  __m512i u5 = _mm512_shuffle_i64x2(t4, t6, 0xDD);
+  __m512i u6 = _mm512_shuffle_i64x2(t5, t7, 0x88);
+  __m512i u7 = _mm512_shuffle_i64x2(t5, t7, 0xDD);
+
+  r[0] = _mm512_shuffle_i64x2(u0, u4, 0x88);
+  r[4] = _mm512_shuffle_i64x2(u0, u4, 0xDD);
+  r[2] = _mm512_shuffle_i64x2(u1, u5, 0x88);
+  r[6] = _mm512_shuffle_i64x2(u1, u5, 0xDD);
+  r[1] = _mm512_shuffle_i64x2(u2, u6, 0x88);
+  r[5] = _mm512_shuffle_i64x2(u2, u6, 0xDD);
+  r[3] = _mm512_shuffle_i64x2(u3, u7, 0x88);
+  r[7] = _mm512_shuffle_i64x2(u3, u7, 0xDD);
+}
+
+#define G8(a, b, c, d, mx, my)                                                 \
+  do {                                                                         \
+    a = _mm512_add_epi64(_mm512_add_epi64(a, b), mx);                          \
+    d = _mm512_ror_epi64(_mm512_xor_si512(d, a), 32);                          \
+    c = _mm512_add_epi64(c, d);                                                \
+    b = _mm512_ror_epi64(_mm512_xor_si512(b, c), 24);                          \
+    a = _mm512_add_epi64(_mm512_add_epi64(a, b), my);                          \
+    d = _mm512_ror_epi64(_mm512_xor_si512(d, a), 16);                          \
+    c = _mm512_add_epi64(c, d);                                                \
+    b = _mm512_ror_epi64(_mm512_xor_si512(b, c), 63);                          \
+  } while (0)
+
+void blake2b_compress_8way_avx512(uint64_t *const state[],
+                                  const uint8_t *const block[],
+                                  const uint64_t t0[], const uint64_t t1[],
+                                  const uint64_t f0[]) {
+  __m512i m[16];
+  for (int half = 0; half < 2; ++half) {
+    __m512i r[8];
+    for (int l = 0; l < 8; ++l)
+      r[l] = _mm512_loadu_si512(block[l] + half * 64);
+    transpose8x8(r);
+    for (int i = 0; i < 8; ++i)
+      m[half * 8 + i] = r[i];
+  }
+
+  __m512i h[8];
+  for (int l = 0; l < 8; ++l)
+    h[l] = _mm512_loadu_si512(state[l]);
+  transpose8x8(h);
+
+  __m512i v[16];
+  for (int i = 0; i < 8; ++i)
+    v[i] = h[i];
+  for (int i = 0; i < 4; ++i)
+    v[8 + i] = _mm512_set1_epi64(static_cast<int64_t>(IV[i]));
+  v[12] = _mm512_xor_si512(_mm512_set1_epi64(static_cast<int64_t>(IV[4])),
+                           _mm512_loadu_si512(t0));
+  v[13] = _mm512_xor_si512(_mm512_set1_epi64(static_cast<int64_t>(IV[5])),
+                           _mm512_loadu_si512(t1));
+  v[14] = _mm512_xor_si512(_mm512_set1_epi64(static_cast<int64_t>(IV[6])),
+                           _mm512_loadu_si512(f0));
+  v[15] = _mm512_set1_epi64(static_cast<int64_t>(IV[7]));
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    G8(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+    G8(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+    G8(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+    G8(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+    G8(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+    G8(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    G8(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+    G8(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm512_ternarylogic_epi64(h[i], v[i], v[i + 8], 0x96);
+  transpose8x8(h);
+  for (int l = 0; l < 8; ++l)
+    _mm512_storeu_si512(state[l], h[l]);
 }
 
+/*
+ * 8-way iterated hashing: the masked chaining-value vectors are the next
+ * step's message words, so the digests stay in ZMM registers throughout.
+ */
+void blake2b_iterate_8way_avx512(uint64_t *const digest[], size_t outlen,
+                                 uint64_t n) {
+  /* Loop constants: initial chaining value, and the counter/final row */
+  __m512i mask[8];
+  __m512i h0[8];
+  __m512i iv[8];
+  for (size_t i = 0; i < 8; ++i) {
+    mask[i] =
+        _mm512_set1_epi64(static_cast<int64_t>(blake2b_digest_mask(outlen, i)));
+    iv[i] = _mm512_set1_epi64(static_cast<int64_t>(IV[i]));
+    h0[i] = iv[i];
+  }
+  h0[0] =
+      _mm512_set1_epi64(static_cast<int64_t>(IV[0] ^ (0x01010000ULL | outlen)));
+  const __m512i v12 = _mm512_set1_epi64(static_cast<int64_t>(IV[4] ^ outlen));
+  const __m512i v14 = _mm512_set1_epi64(static_cast<int64_t>(~IV[6]));
+
+  /* m[8..15] stay zero: the message is one zero-padded digest */
+  __m512i m[16];
+  for (int l = 0; l < 8; ++l)
+    m[l] = _mm512_loadu_si512(digest[l]);
+  transpose8x8(m);
+  for (int i = 0; i < 8; ++i)
+    m[i] = _mm512_and_si512(m[i], mask[i]);
+  for (int i = 8; i < 16; ++i)
+    m[i] = _mm512_setzero_si512();
+
+  for (uint64_t k = 0; k < n; ++k) {
+    __m512i v[16];
+    for (int i = 0; i < 8; ++i)
+      v[i] = h0[i];
+    for (int i = 0; i < 4; ++i)
+      v[8 + i] = iv[i];
+    v[12] = v12;
+    v[13] = iv[5];
+    v[14] = v14;
+    v[15] = iv[7];
+
+    for (int r = 0; r < 12; ++r) {
+      const uint8_t *s = SIGMA[r];
+      G8(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+      G8(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+      G8(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+      G8(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+      G8(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+      G8(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      G8(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+      G8(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i)
+      m[i] = _mm512_and_si512(
+          _mm512_ternarylogic_epi64(h0[i], v[i], v[i + 8], 0x96), mask[i]);
+  }
+
+  transpose8x8(m);
+  for (int l = 0; l < 8; ++l)
+    _mm512_storeu_si512(digest[l], m[l]);
+}
+
+/*
+ * 8-way shared-message kernel: eight chaining values absorb the same block.
+ * Message words stay scalar and are broadcast at each use, which the
+ * compiler folds into the adds as {1to8} memory operands; only the
+ * chaining values are transposed.
+ */
+void blake2b_compress_8way_bcast_avx512(uint64_t *const state[],
+                                        const uint8_t block[128], uint64_t t0,
+                                        uint64_t t1, bool last) {
+  uint64_t mw[16];
+  for (int i = 0; i < 16; ++i)
+    mw[i] = detail::load_le64(block + i * 8);
+
+  __m512i h[8];
+  for (int l = 0; l < 8; ++l)
+    h[l] = _mm512_loadu_si512(state[l]);
+  transpose8x8(h);
+
+  __m512i v[16];
+  for (int i = 0; i < 8; ++i)
+    v[i] = h[i];
+  for (int i = 0; i < 4; ++i)
+    v[8 + i] = _mm512_set1_epi64(static_cast<int64_t>(IV[i]));
+  v[12] = _mm512_set1_epi64(static_cast<int64_t>(IV[4] ^ t0));
+  v[13] = _mm512_set1_epi64(static_cast<int64_t>(IV[5] ^ t1));
+  v[14] = _mm512_set1_epi64(static_cast<int64_t>(last ? ~IV[6] : IV[6]));
+  v[15] = _mm512_set1_epi64(static_cast<int64_t>(IV[7]));
+
+#define MW(i) _mm512_set1_epi64(static_cast<int64_t>(mw[s[i]]))
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    G8(v[0], v[4], v[8], v[12], MW(0), MW(1));
+    G8(v[1], v[5], v[9], v[13], MW(2), MW(3));
+    G8(v[2], v[6], v[10], v[14], MW(4), MW(5));
+    G8(v[3], v[7], v[11], v[15], MW(6), MW(7));
+    G8(v[0], v[5], v[10], v[15], MW(8), MW(9));
+    G8(v[1], v[6], v[11], v[12], MW(10), MW(11));
+    G8(v[2], v[7], v[8], v[13], MW(12), MW(13));
+    G8(v[3], v[4], v[9], v[14], MW(14), MW(15));
+  }
+#undef MW
+
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm512_ternarylogic_epi64(h[i], v[i], v[i + 8], 0x96);
+  transpose8x8(h);
+  for (int l = 0; l < 8; ++l)
+    _mm512_storeu_si512(state[l], h[l]);
+}
+
+#undef G8
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 } /* namespace tinyblake */
 
 #else
@@ -163,6 +469,37 @@ void blake2b_compress_avx512(uint64_t state[8], const uint8_t block[128],
   blake2b_compress_portable(state, block, t0, t1, last);
 }
 
+void blake2b_compress_avx512_aligned(uint64_t state[8],
+                                     const uint8_t block[128], uint64_t t0,
+                                     uint64_t t1, bool last) {
+  blake2b_compress_portable(state, block, t0, t1, last);
+}
+
+void blake2b_iterate_avx512(uint64_t digest[8], size_t outlen, uint64_t n) {
+  blake2b_iterate_portable(digest, outlen, n);
+}
+
+void blake2b_compress_8way_avx512(uint64_t *const state[],
+                                  const uint8_t *const block[],
+                                  const uint64_t t0[], const uint64_t t1[],
+                                  const uint64_t f0[]) {
+  for (int i = 0; i < 8; ++i)
+    blake2b_compress_portable(state[i], block[i], t0[i], t1[i], f0[i] != 0);
+}
+
+void blake2b_iterate_8way_avx512(uint64_t *const digest[], size_t outlen,
+                                 uint64_t n) {
+  for (int i = 0; i < 8; ++i)
+    blake2b_iterate_portable(digest[i], outlen, n);
+}
+
+void blake2b_compress_8way_bcast_avx512(uint64_t *const state[],
+                                        const uint8_t block[128], uint64_t t0,
+                                        uint64_t t1, bool last) {
+  for (int i = 0; i < 8; ++i)
+    blake2b_compress_portable(state[i], block, t0, t1, last);
+}
+
 } /* namespace tinyblake */
 
 #endif
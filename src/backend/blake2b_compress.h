@@ -29,8 +29,16 @@
 #ifndef TINYBLAKE_BACKEND_BLAKE2B_COMPRESS_H
 #define TINYBLAKE_BACKEND_BLAKE2B_COMPRESS_H
 
+#include "tinyblake/common.h"
+
+#include <cstddef>
 #include <cstdint>
 
+/*
+ * Kernels the unit tests call directly are marked TINYBLAKE_API so the
+ * tests still link against a shared build with hidden visibility.
+ */
+
 namespace tinyblake {
 
 /**
@@ -46,8 +54,16 @@ using blake2b_compress_fn = void (*)(uint64_t state[8],
                                      uint64_t t1, bool last);
 
 /* Backend implementations */
-void blake2b_compress_portable(uint64_t state[8], const uint8_t block[128],
-                               uint64_t t0, uint64_t t1, bool last);
+TINYBLAKE_API void blake2b_compress_portable(uint64_t state[8],
+                                             const uint8_t block[128],
+                                             uint64_t t0, uint64_t t1,
+                                             bool last);
+
+/* Final block of the last node at a tree level: sets the last-node flag f1
+ * alongside f0. Only tree hashing needs it, so there is no SIMD variant. */
+void blake2b_compress_portable_last_node(uint64_t state[8],
+                                         const uint8_t block[128],
+                                         uint64_t t0, uint64_t t1);
 
 void blake2b_compress_x64(uint64_t state[8], const uint8_t block[128],
                           uint64_t t0, uint64_t t1, bool last);
@@ -58,9 +74,161 @@ void blake2b_compress_avx2(uint64_t state[8], const uint8_t block[128],
 void blake2b_compress_avx512(uint64_t state[8], const uint8_t block[128],
                              uint64_t t0, uint64_t t1, bool last);
 
+/* Same kernels with aligned loads/stores of the chaining value; state must
+ * be 32-byte aligned (tinyblake_blake2b_state_v2::h is) */
+TINYBLAKE_API void blake2b_compress_avx2_aligned(uint64_t state[8],
+                                                 const uint8_t block[128],
+                                                 uint64_t t0, uint64_t t1,
+                                                 bool last);
+
+TINYBLAKE_API void
+blake2b_compress_avx512_aligned(uint64_t state[8], const uint8_t block[128],
+                                uint64_t t0, uint64_t t1, bool last);
+
 void blake2b_compress_neon(uint64_t state[8], const uint8_t block[128],
                            uint64_t t0, uint64_t t1, bool last);
 
+void blake2b_compress_neon_sha3(uint64_t state[8], const uint8_t block[128],
+                                uint64_t t0, uint64_t t1, bool last);
+
+void blake2b_compress_rvv(uint64_t state[8], const uint8_t block[128],
+                          uint64_t t0, uint64_t t1, bool last);
+
+/**
+ * Iterated-hash kernel signature: replaces the digest d with
+ * BLAKE2b-<outlen>(d) `n` times (unkeyed, default parameters), keeping the
+ * chaining value in registers between steps.
+ *
+ * @param digest    current digest as 8 little-endian words; bytes past
+ *                  outlen are ignored on input and zero on output
+ * @param outlen    digest length in bytes (1..64)
+ * @param n         number of steps
+ */
+using blake2b_iterate_fn = void (*)(uint64_t digest[8], size_t outlen,
+                                    uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_portable(uint64_t digest[8], size_t outlen,
+                                            uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_x64(uint64_t digest[8], size_t outlen,
+                                       uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_avx2(uint64_t digest[8], size_t outlen,
+                                        uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_avx512(uint64_t digest[8], size_t outlen,
+                                          uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_neon(uint64_t digest[8], size_t outlen,
+                                        uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_neon_sha3(uint64_t digest[8], size_t outlen,
+                                             uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_rvv(uint64_t digest[8], size_t outlen,
+                                       uint64_t n);
+
+/* Mask selecting the digest bytes held in word i of an outlen-byte digest */
+inline uint64_t blake2b_digest_mask(size_t outlen, size_t i) {
+  if (outlen >= (i + 1) * 8)
+    return ~uint64_t{0};
+  if (outlen <= i * 8)
+    return 0;
+  return (uint64_t{1} << (8 * (outlen - i * 8))) - 1;
+}
+
+/**
+ * Multi-lane compress signature: advances several independent chaining
+ * values by one block each, in lockstep (one message per SIMD lane).
+ *
+ * @param state     per-lane 8-word chaining values (modified in place)
+ * @param block     per-lane 128-byte message blocks
+ * @param t0, t1    per-lane byte counters (low, high)
+ * @param f0        per-lane finalization word (~0 for the final block, else 0)
+ */
+using blake2b_compress_lanes_fn = void (*)(uint64_t *const state[],
+                                           const uint8_t *const block[],
+                                           const uint64_t t0[],
+                                           const uint64_t t1[],
+                                           const uint64_t f0[]);
+
+/* Multi-lane backend implementations (lane count in the name) */
+TINYBLAKE_API void blake2b_compress_4way_avx2(uint64_t *const state[],
+                                              const uint8_t *const block[],
+                                              const uint64_t t0[],
+                                              const uint64_t t1[],
+                                              const uint64_t f0[]);
+
+TINYBLAKE_API void blake2b_compress_8way_avx512(uint64_t *const state[],
+                                                const uint8_t *const block[],
+                                                const uint64_t t0[],
+                                                const uint64_t t1[],
+                                                const uint64_t f0[]);
+
+TINYBLAKE_API void blake2b_compress_2way_neon(uint64_t *const state[],
+                                              const uint8_t *const block[],
+                                              const uint64_t t0[],
+                                              const uint64_t t1[],
+                                              const uint64_t f0[]);
+
+/**
+ * Shared-message multi-lane compress: advances several chaining values by
+ * the same block (one message under several keys), so the message words,
+ * counter and finalization flag are common to every lane.
+ *
+ * @param state     per-lane 8-word chaining values (modified in place)
+ * @param block     the 128-byte message block all lanes absorb
+ * @param t0, t1    byte counter (low, high), shared by all lanes
+ * @param last      true if this is the final block
+ */
+using blake2b_compress_bcast_fn = void (*)(uint64_t *const state[],
+                                           const uint8_t block[128],
+                                           uint64_t t0, uint64_t t1,
+                                           bool last);
+
+TINYBLAKE_API void
+blake2b_compress_4way_bcast_avx2(uint64_t *const state[],
+                                 const uint8_t block[128], uint64_t t0,
+                                 uint64_t t1, bool last);
+
+TINYBLAKE_API void
+blake2b_compress_8way_bcast_avx512(uint64_t *const state[],
+                                   const uint8_t block[128], uint64_t t0,
+                                   uint64_t t1, bool last);
+
+/* RVV lane count follows the hardware vector length: VLEN / 64, capped at 8
+ * (1 when the RVV backend was not compiled in) */
+TINYBLAKE_API size_t blake2b_rvv_lanes();
+
+TINYBLAKE_API void blake2b_compress_lanes_rvv(uint64_t *const state[],
+                                              const uint8_t *const block[],
+                                              const uint64_t t0[],
+                                              const uint64_t t1[],
+                                              const uint64_t f0[]);
+
+/**
+ * Multi-lane iterated-hash signature: runs the iterate kernel on several
+ * independent digests at once, all for the same number of steps.
+ *
+ * @param digest    per-lane 8-word digests (see blake2b_iterate_fn)
+ * @param outlen    digest length in bytes (1..64), shared by all lanes
+ * @param n         number of steps
+ */
+using blake2b_iterate_lanes_fn = void (*)(uint64_t *const digest[],
+                                          size_t outlen, uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_4way_avx2(uint64_t *const digest[],
+                                             size_t outlen, uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_8way_avx512(uint64_t *const digest[],
+                                               size_t outlen, uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_2way_neon(uint64_t *const digest[],
+                                             size_t outlen, uint64_t n);
+
+TINYBLAKE_API void blake2b_iterate_lanes_rvv(uint64_t *const digest[],
+                                             size_t outlen, uint64_t n);
+
 } /* namespace tinyblake */
 
 #endif /* TINYBLAKE_BACKEND_BLAKE2B_COMPRESS_H */
\ No newline at end of file
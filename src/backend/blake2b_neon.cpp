@@ -37,6 +37,10 @@
  *  - vqtbl1q_u8 byte-shuffle for 16-bit and 24-bit rotations (AArch64)
  *  - vsli for 63-bit rotation (2 ops instead of 3)
  *  - Direct vectorized row4 initialization
+ *
+ * The 2-way kernels below transpose two independent messages instead:
+ * each uint64x2_t holds the same working word of both, so G runs on full
+ * registers with no diagonalization shuffles.
  */
 
 #if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
@@ -226,6 +230,173 @@ void blake2b_compress_neon(uint64_t state[8], const uint8_t block[128],
   vst1q_u64(state + 6, row2b);
 }
 
+/*
+ * Iterated hashing: each step hashes one zero-padded block holding the
+ * previous digest. The digest is carried between steps in the message
+ * block itself, so nothing is re-initialized or zeroized per step.
+ */
+void blake2b_iterate_neon(uint64_t digest[8], size_t outlen, uint64_t n) {
+  uint64_t h0[8];
+  uint64_t mask[8];
+  for (size_t i = 0; i < 8; ++i) {
+    h0[i] = IV[i];
+    mask[i] = blake2b_digest_mask(outlen, i);
+  }
+  h0[0] ^= 0x01010000ULL | outlen;
+
+  uint8_t block[128] = {};
+  uint64_t state[8];
+  for (int i = 0; i < 8; ++i) {
+    detail::store_le64(block + i * 8, digest[i] & mask[i]);
+  }
+
+  for (uint64_t k = 0; k < n; ++k) {
+    for (int i = 0; i < 8; ++i) {
+      state[i] = h0[i];
+    }
+    blake2b_compress_neon(state, block, outlen, 0, true);
+    for (int i = 0; i < 8; ++i) {
+      detail::store_le64(block + i * 8, state[i] & mask[i]);
+    }
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    digest[i] = detail::load_le64(block + i * 8);
+  }
+}
+
+/* ─── 2-way transposed kernels ─── */
+
+/* Split two 2-word rows (one per message) into two per-word vectors */
+static inline void zip2(uint64x2_t r0, uint64x2_t r1, uint64x2_t &w0,
+                        uint64x2_t &w1) {
+  w0 = vcombine_u64(vget_low_u64(r0), vget_low_u64(r1));
+  w1 = vcombine_u64(vget_high_u64(r0), vget_high_u64(r1));
+}
+
+static inline uint64x2_t load_words(const uint8_t *p) {
+  return vreinterpretq_u64_u8(vld1q_u8(p));
+}
+
+#define ROUND_2WAY(s)                                                          \
+  do {                                                                         \
+    G_NEON(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);                         \
+    G_NEON(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);                         \
+    G_NEON(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);                        \
+    G_NEON(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);                        \
+    G_NEON(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);                        \
+    G_NEON(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);                      \
+    G_NEON(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);                       \
+    G_NEON(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);                       \
+  } while (0)
+
+void blake2b_compress_2way_neon(uint64_t *const state[],
+                                const uint8_t *const block[],
+                                const uint64_t t0[], const uint64_t t1[],
+                                const uint64_t f0[]) {
+  static const uint8_t rot16_bytes[16] = {2,  3,  4,  5,  6,  7,  0, 1,
+                                          10, 11, 12, 13, 14, 15, 8, 9};
+  static const uint8_t rot24_bytes[16] = {3,  4,  5,  6,  7,  0, 1, 2,
+                                          11, 12, 13, 14, 15, 8, 9, 10};
+  const uint8x16_t rot16_tbl = vld1q_u8(rot16_bytes);
+  const uint8x16_t rot24_tbl = vld1q_u8(rot24_bytes);
+
+  uint64x2_t m[16];
+  for (int i = 0; i < 16; i += 2) {
+    zip2(load_words(block[0] + i * 8), load_words(block[1] + i * 8), m[i],
+         m[i + 1]);
+  }
+
+  uint64x2_t h[8];
+  for (int i = 0; i < 8; i += 2) {
+    zip2(vld1q_u64(state[0] + i), vld1q_u64(state[1] + i), h[i], h[i + 1]);
+  }
+
+  uint64x2_t v[16];
+  for (int i = 0; i < 8; ++i)
+    v[i] = h[i];
+  for (int i = 0; i < 4; ++i)
+    v[8 + i] = vdupq_n_u64(IV[i]);
+  v[12] = veorq_u64(vdupq_n_u64(IV[4]), vld1q_u64(t0));
+  v[13] = veorq_u64(vdupq_n_u64(IV[5]), vld1q_u64(t1));
+  v[14] = veorq_u64(vdupq_n_u64(IV[6]), vld1q_u64(f0));
+  v[15] = vdupq_n_u64(IV[7]);
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    ROUND_2WAY(s);
+  }
+
+  for (int i = 0; i < 8; ++i)
+    h[i] = veorq_u64(h[i], veorq_u64(v[i], v[i + 8]));
+  for (int i = 0; i < 8; i += 2) {
+    uint64x2_t s0, s1;
+    zip2(h[i], h[i + 1], s0, s1);
+    vst1q_u64(state[0] + i, s0);
+    vst1q_u64(state[1] + i, s1);
+  }
+}
+
+void blake2b_iterate_2way_neon(uint64_t *const digest[], size_t outlen,
+                               uint64_t n) {
+  static const uint8_t rot16_bytes[16] = {2,  3,  4,  5,  6,  7,  0, 1,
+                                          10, 11, 12, 13, 14, 15, 8, 9};
+  static const uint8_t rot24_bytes[16] = {3,  4,  5,  6,  7,  0, 1, 2,
+                                          11, 12, 13, 14, 15, 8, 9, 10};
+  const uint8x16_t rot16_tbl = vld1q_u8(rot16_bytes);
+  const uint8x16_t rot24_tbl = vld1q_u8(rot24_bytes);
+
+  /* Loop constants: initial chaining value, and the counter/final row */
+  uint64x2_t mask[8];
+  uint64x2_t h0[8];
+  for (size_t i = 0; i < 8; ++i) {
+    mask[i] = vdupq_n_u64(blake2b_digest_mask(outlen, i));
+    h0[i] = vdupq_n_u64(IV[i]);
+  }
+  h0[0] = vdupq_n_u64(IV[0] ^ (0x01010000ULL | outlen));
+  const uint64x2_t v12 = vdupq_n_u64(IV[4] ^ outlen);
+  const uint64x2_t v14 = vdupq_n_u64(~IV[6]);
+
+  /* m[8..15] stay zero: the message is one zero-padded digest */
+  uint64x2_t m[16];
+  for (int i = 0; i < 8; i += 2) {
+    zip2(vld1q_u64(digest[0] + i), vld1q_u64(digest[1] + i), m[i], m[i + 1]);
+    m[i] = vandq_u64(m[i], mask[i]);
+    m[i + 1] = vandq_u64(m[i + 1], mask[i + 1]);
+  }
+  for (int i = 8; i < 16; ++i)
+    m[i] = vdupq_n_u64(0);
+
+  for (uint64_t k = 0; k < n; ++k) {
+    uint64x2_t v[16];
+    for (int i = 0; i < 8; ++i)
+      v[i] = h0[i];
+    for (int i = 0; i < 4; ++i)
+      v[8 + i] = vdupq_n_u64(IV[i]);
+    v[12] = v12;
+    v[13] = vdupq_n_u64(IV[5]);
+    v[14] = v14;
+    v[15] = vdupq_n_u64(IV[7]);
+
+    for (int r = 0; r < 12; ++r) {
+      const uint8_t *s = SIGMA[r];
+      ROUND_2WAY(s);
+    }
+
+    for (int i = 0; i < 8; ++i)
+      m[i] = vandq_u64(veorq_u64(h0[i], veorq_u64(v[i], v[i + 8])), mask[i]);
+  }
+
+  for (int i = 0; i < 8; i += 2) {
+    uint64x2_t s0, s1;
+    zip2(m[i], m[i + 1], s0, s1);
+    vst1q_u64(digest[0] + i, s0);
+    vst1q_u64(digest[1] + i, s1);
+  }
+}
+
+#undef ROUND_2WAY
+
 } /* namespace tinyblake */
 
 #else
@@ -239,6 +410,24 @@ void blake2b_compress_neon(uint64_t state[8], const uint8_t block[128],
   blake2b_compress_portable(state, block, t0, t1, last);
 }
 
+void blake2b_iterate_neon(uint64_t digest[8], size_t outlen, uint64_t n) {
+  blake2b_iterate_portable(digest, outlen, n);
+}
+
+void blake2b_compress_2way_neon(uint64_t *const state[],
+                                const uint8_t *const block[],
+                                const uint64_t t0[], const uint64_t t1[],
+                                const uint64_t f0[]) {
+  for (int i = 0; i < 2; ++i)
+    blake2b_compress_portable(state[i], block[i], t0[i], t1[i], f0[i] != 0);
+}
+
+void blake2b_iterate_2way_neon(uint64_t *const digest[], size_t outlen,
+                               uint64_t n) {
+  for (int i = 0; i < 2; ++i)
+    blake2b_iterate_portable(digest[i], outlen, n);
+}
+
 } /* namespace tinyblake */
 
 #endif
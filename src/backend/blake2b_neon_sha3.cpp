@@ -0,0 +1,211 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "blake2b_compress.h"
+
+/*
+ * ARMv8.2 SHA3-extension BLAKE2b compression.
+ * Same row layout as blake2b_compress_neon, but every xor-then-rotate in G
+ * is a single XAR (vxarq_u64) and the feed-forward uses EOR3 (veor3q_u64).
+ * RAX1 rotates before xoring, which does not match G, so it is not used.
+ *
+ * Compiled with -march=armv8.2-a+sha3 and only selected when the CPU
+ * reports the SHA3 feature (cpu::Features::sha3).
+ */
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SHA3)
+
+#include "../internal/endian.h"
+#include <arm_neon.h>
+
+namespace tinyblake {
+
+static const uint64_t IV[8] = {0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL,
+                               0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL,
+                               0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+                               0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL};
+
+static const uint8_t SIGMA[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+};
+
+/* XAR: (x ^ y) rotated right by n, in one instruction */
+#define G_SHA3(a, b, c, d, mx, my)                                             \
+  do {                                                                         \
+    a = vaddq_u64(vaddq_u64(a, b), mx);                                        \
+    d = vxarq_u64(d, a, 32);                                                   \
+    c = vaddq_u64(c, d);                                                       \
+    b = vxarq_u64(b, c, 24);                                                   \
+    a = vaddq_u64(vaddq_u64(a, b), my);                                        \
+    d = vxarq_u64(d, a, 16);                                                   \
+    c = vaddq_u64(c, d);                                                       \
+    b = vxarq_u64(b, c, 63);                                                   \
+  } while (0)
+
+static inline uint64x2_t pair(uint64_t lo, uint64_t hi) {
+  return vcombine_u64(vcreate_u64(lo), vcreate_u64(hi));
+}
+
+void blake2b_compress_neon_sha3(uint64_t state[8], const uint8_t block[128],
+                                uint64_t t0, uint64_t t1, bool last) {
+  uint64_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le64(block + i * 8);
+  }
+
+  uint64x2_t row1a = vld1q_u64(state);     /* v0, v1 */
+  uint64x2_t row1b = vld1q_u64(state + 2); /* v2, v3 */
+  uint64x2_t row2a = vld1q_u64(state + 4); /* v4, v5 */
+  uint64x2_t row2b = vld1q_u64(state + 6); /* v6, v7 */
+
+  uint64x2_t row3a = vld1q_u64(&IV[0]); /* v8, v9 */
+  uint64x2_t row3b = vld1q_u64(&IV[2]); /* v10, v11 */
+  uint64x2_t row4a = pair(IV[4] ^ t0, IV[5] ^ t1);
+  uint64x2_t row4b = pair(last ? ~IV[6] : IV[6], IV[7]);
+
+  const uint64x2_t orig1a = row1a, orig1b = row1b;
+  const uint64x2_t orig2a = row2a, orig2b = row2b;
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+
+    /* Column step: G(0..3) */
+    G_SHA3(row1a, row2a, row3a, row4a, pair(m[s[0]], m[s[2]]),
+           pair(m[s[1]], m[s[3]]));
+    G_SHA3(row1b, row2b, row3b, row4b, pair(m[s[4]], m[s[6]]),
+           pair(m[s[5]], m[s[7]]));
+
+    /* Diagonalize */
+    {
+      uint64x2_t t2a = vextq_u64(row2a, row2b, 1);
+      uint64x2_t t2b = vextq_u64(row2b, row2a, 1);
+      row2a = t2a;
+      row2b = t2b;
+
+      uint64x2_t t3 = row3a;
+      row3a = row3b;
+      row3b = t3;
+
+      uint64x2_t t4a = vextq_u64(row4b, row4a, 1);
+      uint64x2_t t4b = vextq_u64(row4a, row4b, 1);
+      row4a = t4a;
+      row4b = t4b;
+    }
+
+    /* Diagonal step: G(4..7) */
+    G_SHA3(row1a, row2a, row3a, row4a, pair(m[s[8]], m[s[10]]),
+           pair(m[s[9]], m[s[11]]));
+    G_SHA3(row1b, row2b, row3b, row4b, pair(m[s[12]], m[s[14]]),
+           pair(m[s[13]], m[s[15]]));
+
+    /* Undiagonalize */
+    {
+      uint64x2_t t2a = vextq_u64(row2b, row2a, 1);
+      uint64x2_t t2b = vextq_u64(row2a, row2b, 1);
+      row2a = t2a;
+      row2b = t2b;
+
+      uint64x2_t t3 = row3a;
+      row3a = row3b;
+      row3b = t3;
+
+      uint64x2_t t4a = vextq_u64(row4a, row4b, 1);
+      uint64x2_t t4b = vextq_u64(row4b, row4a, 1);
+      row4a = t4a;
+      row4b = t4b;
+    }
+  }
+
+  /* Finalize: state[i] ^= v[i] ^ v[i+8], one EOR3 per register */
+  vst1q_u64(state, veor3q_u64(orig1a, row1a, row3a));
+  vst1q_u64(state + 2, veor3q_u64(orig1b, row1b, row3b));
+  vst1q_u64(state + 4, veor3q_u64(orig2a, row2a, row4a));
+  vst1q_u64(state + 6, veor3q_u64(orig2b, row2b, row4b));
+}
+
+#undef G_SHA3
+
+/* See blake2b_iterate_neon: the digest rides in the message block */
+void blake2b_iterate_neon_sha3(uint64_t digest[8], size_t outlen, uint64_t n) {
+  uint64_t h0[8];
+  uint64_t mask[8];
+  for (size_t i = 0; i < 8; ++i) {
+    h0[i] = IV[i];
+    mask[i] = blake2b_digest_mask(outlen, i);
+  }
+  h0[0] ^= 0x01010000ULL | outlen;
+
+  uint8_t block[128] = {};
+  uint64_t state[8];
+  for (int i = 0; i < 8; ++i) {
+    detail::store_le64(block + i * 8, digest[i] & mask[i]);
+  }
+
+  for (uint64_t k = 0; k < n; ++k) {
+    for (int i = 0; i < 8; ++i) {
+      state[i] = h0[i];
+    }
+    blake2b_compress_neon_sha3(state, block, outlen, 0, true);
+    for (int i = 0; i < 8; ++i) {
+      detail::store_le64(block + i * 8, state[i] & mask[i]);
+    }
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    digest[i] = detail::load_le64(block + i * 8);
+  }
+}
+
+} /* namespace tinyblake */
+
+#else
+
+namespace tinyblake {
+
+void blake2b_compress_neon_sha3(uint64_t state[8], const uint8_t block[128],
+                                uint64_t t0, uint64_t t1, bool last) {
+  blake2b_compress_neon(state, block, t0, t1, last);
+}
+
+void blake2b_iterate_neon_sha3(uint64_t digest[8], size_t outlen, uint64_t n) {
+  blake2b_iterate_neon(digest, outlen, n);
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -83,8 +83,9 @@ static inline uint64_t rotr64(uint64_t x, int n) {
     G(r, 7, v[3], v[4], v[9], v[14]);                                          \
   } while (0)
 
-void blake2b_compress_portable(uint64_t state[8], const uint8_t block[128],
-                               uint64_t t0, uint64_t t1, bool last) {
+static inline void compress(uint64_t state[8], const uint8_t block[128],
+                            uint64_t t0, uint64_t t1, uint64_t f0,
+                            uint64_t f1) {
   uint64_t m[16];
   uint64_t v[16];
 
@@ -101,8 +102,8 @@ void blake2b_compress_portable(uint64_t state[8], const uint8_t block[128],
   v[11] = IV[3];
   v[12] = IV[4] ^ t0;
   v[13] = IV[5] ^ t1;
-  v[14] = last ? (IV[6] ^ 0xFFFFFFFFFFFFFFFFULL) : IV[6];
-  v[15] = IV[7];
+  v[14] = IV[6] ^ f0;
+  v[15] = IV[7] ^ f1;
 
   ROUND(0);
   ROUND(1);
@@ -122,6 +123,72 @@ void blake2b_compress_portable(uint64_t state[8], const uint8_t block[128],
   }
 }
 
+void blake2b_compress_portable(uint64_t state[8], const uint8_t block[128],
+                               uint64_t t0, uint64_t t1, bool last) {
+  compress(state, block, t0, t1, last ? ~uint64_t{0} : 0, 0);
+}
+
+void blake2b_compress_portable_last_node(uint64_t state[8],
+                                         const uint8_t block[128],
+                                         uint64_t t0, uint64_t t1) {
+  compress(state, block, t0, t1, ~uint64_t{0}, ~uint64_t{0});
+}
+
+/*
+ * Iterated hashing: every step after the first hashes a single zero-padded
+ * block holding the previous digest, so the parameter-derived chaining
+ * value, counter and finalization flag are constants and message words
+ * 8..15 are always zero.
+ */
+void blake2b_iterate_portable(uint64_t digest[8], size_t outlen, uint64_t n) {
+  const uint64_t h0 = IV[0] ^ (0x01010000ULL | outlen);
+  uint64_t mask[8];
+  uint64_t m[16] = {};
+  uint64_t v[16];
+
+  for (int i = 0; i < 8; ++i) {
+    mask[i] = blake2b_digest_mask(outlen, static_cast<size_t>(i));
+    m[i] = digest[i] & mask[i];
+  }
+
+  for (uint64_t k = 0; k < n; ++k) {
+    v[0] = h0;
+    for (int i = 1; i < 8; ++i) {
+      v[i] = IV[i];
+    }
+    v[8] = IV[0];
+    v[9] = IV[1];
+    v[10] = IV[2];
+    v[11] = IV[3];
+    v[12] = IV[4] ^ outlen;
+    v[13] = IV[5];
+    v[14] = IV[6] ^ 0xFFFFFFFFFFFFFFFFULL;
+    v[15] = IV[7];
+
+    ROUND(0);
+    ROUND(1);
+    ROUND(2);
+    ROUND(3);
+    ROUND(4);
+    ROUND(5);
+    ROUND(6);
+    ROUND(7);
+    ROUND(8);
+    ROUND(9);
+    ROUND(10);
+    ROUND(11);
+
+    m[0] = (h0 ^ v[0] ^ v[8]) & mask[0];
+    for (int i = 1; i < 8; ++i) {
+      m[i] = (IV[i] ^ v[i] ^ v[i + 8]) & mask[i];
+    }
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    digest[i] = m[i];
+  }
+}
+
 #undef G
 #undef ROUND
 
@@ -0,0 +1,411 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "blake2b_compress.h"
+
+/*
+ * RISC-V Vector (RVV 1.0) BLAKE2b.
+ *
+ * Single message: each row of the 4x4 working state is one LMUL=2 register
+ * group (4 x 64-bit words fit any VLEN >= 128). Message words are gathered
+ * per G step with an indexed load driven by a precomputed SIGMA offset
+ * table, and rows are rotated for the diagonal step with vrgather.
+ *
+ * Multi-lane: one message per vector element at LMUL=1, so the lane count
+ * is VLEN / 64 (capped at 8) and the same binary scales with the hardware.
+ * RVV register types are sizeless and cannot live in arrays, so the
+ * working state is sixteen named registers and the transposed message
+ * words are reloaded from a staging buffer on each use.
+ *
+ * Requires the v1.0 intrinsics (__riscv_ prefix) and -march=rv64gcv.
+ */
+
+#if defined(__riscv_vector) && defined(__riscv_v_intrinsic)
+#if __riscv_v_intrinsic >= 12000
+#define TINYBLAKE_RVV 1
+#endif
+#endif
+
+#if defined(TINYBLAKE_RVV)
+
+#include "../internal/endian.h"
+#include <riscv_vector.h>
+
+namespace tinyblake {
+
+static const uint64_t IV[8] = {0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL,
+                               0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL,
+                               0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+                               0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL};
+
+static constexpr uint8_t SIGMA[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+};
+
+/* Byte offsets of the message words each row-wide G step consumes, in the
+ * order column-x, column-y, diagonal-x, diagonal-y */
+struct sigma_offsets {
+  uint64_t off[12][16];
+
+  constexpr sigma_offsets() : off() {
+    for (int r = 0; r < 12; ++r) {
+      for (int i = 0; i < 4; ++i) {
+        off[r][i] = uint64_t{SIGMA[r][2 * i]} * 8;
+        off[r][4 + i] = uint64_t{SIGMA[r][2 * i + 1]} * 8;
+        off[r][8 + i] = uint64_t{SIGMA[r][8 + 2 * i]} * 8;
+        off[r][12 + i] = uint64_t{SIGMA[r][9 + 2 * i]} * 8;
+      }
+    }
+  }
+};
+
+static constexpr sigma_offsets SIGMA_OFF{};
+
+/* vrgather indices rotating a 4-word row left by 1, 2 and 3 words */
+static const uint64_t ROT1[4] = {1, 2, 3, 0};
+static const uint64_t ROT2[4] = {2, 3, 0, 1};
+static const uint64_t ROT3[4] = {3, 0, 1, 2};
+
+/* Base RVV 1.0 has no vector rotate (that is Zvbb), so shift and or */
+static inline vuint64m2_t rotr(vuint64m2_t x, size_t n, size_t vl) {
+  return __riscv_vor_vv_u64m2(__riscv_vsrl_vx_u64m2(x, n, vl),
+                              __riscv_vsll_vx_u64m2(x, 64 - n, vl), vl);
+}
+
+static inline vuint64m1_t rotr(vuint64m1_t x, size_t n, size_t vl) {
+  return __riscv_vor_vv_u64m1(__riscv_vsrl_vx_u64m1(x, n, vl),
+                              __riscv_vsll_vx_u64m1(x, 64 - n, vl), vl);
+}
+
+static inline vuint64m2_t add(vuint64m2_t a, vuint64m2_t b, size_t vl) {
+  return __riscv_vadd_vv_u64m2(a, b, vl);
+}
+
+static inline vuint64m1_t add(vuint64m1_t a, vuint64m1_t b, size_t vl) {
+  return __riscv_vadd_vv_u64m1(a, b, vl);
+}
+
+static inline vuint64m2_t xor_(vuint64m2_t a, vuint64m2_t b, size_t vl) {
+  return __riscv_vxor_vv_u64m2(a, b, vl);
+}
+
+static inline vuint64m1_t xor_(vuint64m1_t a, vuint64m1_t b, size_t vl) {
+  return __riscv_vxor_vv_u64m1(a, b, vl);
+}
+
+#define G_RVV(a, b, c, d, mx, my)                                              \
+  do {                                                                         \
+    a = add(add(a, b, vl), mx, vl);                                            \
+    d = rotr(xor_(d, a, vl), 32, vl);                                          \
+    c = add(c, d, vl);                                                         \
+    b = rotr(xor_(b, c, vl), 24, vl);                                          \
+    a = add(add(a, b, vl), my, vl);                                            \
+    d = rotr(xor_(d, a, vl), 16, vl);                                          \
+    c = add(c, d, vl);                                                         \
+    b = rotr(xor_(b, c, vl), 63, vl);                                          \
+  } while (0)
+
+/* ─── Single message, one row per LMUL=2 register group ─── */
+
+void blake2b_compress_rvv(uint64_t state[8], const uint8_t block[128],
+                          uint64_t t0, uint64_t t1, bool last) {
+  const size_t vl = __riscv_vsetvl_e64m2(4);
+
+  uint64_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le64(block + i * 8);
+  }
+
+  const vuint64m2_t rot1 = __riscv_vle64_v_u64m2(ROT1, vl);
+  const vuint64m2_t rot2 = __riscv_vle64_v_u64m2(ROT2, vl);
+  const vuint64m2_t rot3 = __riscv_vle64_v_u64m2(ROT3, vl);
+
+  const uint64_t row4[4] = {IV[4] ^ t0, IV[5] ^ t1, last ? ~IV[6] : IV[6],
+                            IV[7]};
+  const vuint64m2_t h_lo = __riscv_vle64_v_u64m2(state, vl);
+  const vuint64m2_t h_hi = __riscv_vle64_v_u64m2(state + 4, vl);
+  vuint64m2_t a = h_lo;
+  vuint64m2_t b = h_hi;
+  vuint64m2_t c = __riscv_vle64_v_u64m2(IV, vl);
+  vuint64m2_t d = __riscv_vle64_v_u64m2(row4, vl);
+
+  for (int r = 0; r < 12; ++r) {
+    const uint64_t *off = SIGMA_OFF.off[r];
+
+    G_RVV(a, b, c, d,
+          __riscv_vluxei64_v_u64m2(m, __riscv_vle64_v_u64m2(off, vl), vl),
+          __riscv_vluxei64_v_u64m2(m, __riscv_vle64_v_u64m2(off + 4, vl),
+                                   vl));
+
+    /* Diagonalize */
+    b = __riscv_vrgather_vv_u64m2(b, rot1, vl);
+    c = __riscv_vrgather_vv_u64m2(c, rot2, vl);
+    d = __riscv_vrgather_vv_u64m2(d, rot3, vl);
+
+    G_RVV(a, b, c, d,
+          __riscv_vluxei64_v_u64m2(m, __riscv_vle64_v_u64m2(off + 8, vl), vl),
+          __riscv_vluxei64_v_u64m2(m, __riscv_vle64_v_u64m2(off + 12, vl),
+                                   vl));
+
+    /* Undiagonalize */
+    b = __riscv_vrgather_vv_u64m2(b, rot3, vl);
+    c = __riscv_vrgather_vv_u64m2(c, rot2, vl);
+    d = __riscv_vrgather_vv_u64m2(d, rot1, vl);
+  }
+
+  __riscv_vse64_v_u64m2(state, xor_(h_lo, xor_(a, c, vl), vl), vl);
+  __riscv_vse64_v_u64m2(state + 4, xor_(h_hi, xor_(b, d, vl), vl), vl);
+}
+
+/* See blake2b_iterate_neon: the digest rides in the message block */
+void blake2b_iterate_rvv(uint64_t digest[8], size_t outlen, uint64_t n) {
+  uint64_t h0[8];
+  uint64_t mask[8];
+  for (size_t i = 0; i < 8; ++i) {
+    h0[i] = IV[i];
+    mask[i] = blake2b_digest_mask(outlen, i);
+  }
+  h0[0] ^= 0x01010000ULL | outlen;
+
+  uint8_t block[128] = {};
+  uint64_t state[8];
+  for (int i = 0; i < 8; ++i) {
+    detail::store_le64(block + i * 8, digest[i] & mask[i]);
+  }
+
+  for (uint64_t k = 0; k < n; ++k) {
+    for (int i = 0; i < 8; ++i) {
+      state[i] = h0[i];
+    }
+    blake2b_compress_rvv(state, block, outlen, 0, true);
+    for (int i = 0; i < 8; ++i) {
+      detail::store_le64(block + i * 8, state[i] & mask[i]);
+    }
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    digest[i] = detail::load_le64(block + i * 8);
+  }
+}
+
+/* ─── Multi-lane, one message per LMUL=1 element ─── */
+
+static constexpr size_t RVV_MAX_LANES = 8;
+
+size_t blake2b_rvv_lanes() {
+  const size_t vlmax = __riscv_vsetvlmax_e64m1();
+  return vlmax < RVV_MAX_LANES ? vlmax : RVV_MAX_LANES;
+}
+
+#define LOAD_M(i) __riscv_vle64_v_u64m1(m[i], vl)
+
+#define ROUND_LANES(s)                                                         \
+  do {                                                                         \
+    G_RVV(v0, v4, v8, v12, LOAD_M(s[0]), LOAD_M(s[1]));                        \
+    G_RVV(v1, v5, v9, v13, LOAD_M(s[2]), LOAD_M(s[3]));                        \
+    G_RVV(v2, v6, v10, v14, LOAD_M(s[4]), LOAD_M(s[5]));                       \
+    G_RVV(v3, v7, v11, v15, LOAD_M(s[6]), LOAD_M(s[7]));                       \
+    G_RVV(v0, v5, v10, v15, LOAD_M(s[8]), LOAD_M(s[9]));                       \
+    G_RVV(v1, v6, v11, v12, LOAD_M(s[10]), LOAD_M(s[11]));                     \
+    G_RVV(v2, v7, v8, v13, LOAD_M(s[12]), LOAD_M(s[13]));                      \
+    G_RVV(v3, v4, v9, v14, LOAD_M(s[14]), LOAD_M(s[15]));                      \
+  } while (0)
+
+/* Sixteen working registers: v0..v7 from h[], v8..v15 from the row
+ * constants. Used by both lane kernels. */
+#define LOAD_WORKING_STATE(h, v12_init, v13_init, v14_init)                    \
+  vuint64m1_t v0 = __riscv_vle64_v_u64m1(h[0], vl);                            \
+  vuint64m1_t v1 = __riscv_vle64_v_u64m1(h[1], vl);                            \
+  vuint64m1_t v2 = __riscv_vle64_v_u64m1(h[2], vl);                            \
+  vuint64m1_t v3 = __riscv_vle64_v_u64m1(h[3], vl);                            \
+  vuint64m1_t v4 = __riscv_vle64_v_u64m1(h[4], vl);                            \
+  vuint64m1_t v5 = __riscv_vle64_v_u64m1(h[5], vl);                            \
+  vuint64m1_t v6 = __riscv_vle64_v_u64m1(h[6], vl);                            \
+  vuint64m1_t v7 = __riscv_vle64_v_u64m1(h[7], vl);                            \
+  vuint64m1_t v8 = __riscv_vmv_v_x_u64m1(IV[0], vl);                           \
+  vuint64m1_t v9 = __riscv_vmv_v_x_u64m1(IV[1], vl);                           \
+  vuint64m1_t v10 = __riscv_vmv_v_x_u64m1(IV[2], vl);                          \
+  vuint64m1_t v11 = __riscv_vmv_v_x_u64m1(IV[3], vl);                          \
+  vuint64m1_t v12 = v12_init;                                                  \
+  vuint64m1_t v13 = v13_init;                                                  \
+  vuint64m1_t v14 = v14_init;                                                  \
+  vuint64m1_t v15 = __riscv_vmv_v_x_u64m1(IV[7], vl)
+
+/* h[i] ^= v[i] ^ v[i + 8], written back to the staging row h[i] */
+#define STORE_FEED_FORWARD(h, i, vi, vi8)                                      \
+  __riscv_vse64_v_u64m1(                                                       \
+      h[i], xor_(__riscv_vle64_v_u64m1(h[i], vl), xor_(vi, vi8, vl), vl), vl)
+
+void blake2b_compress_lanes_rvv(uint64_t *const state[],
+                                const uint8_t *const block[],
+                                const uint64_t t0[], const uint64_t t1[],
+                                const uint64_t f0[]) {
+  const size_t lanes = blake2b_rvv_lanes();
+  const size_t vl = __riscv_vsetvl_e64m1(lanes);
+
+  /* Transpose through memory: m[w][l] is word w of lane l's message */
+  uint64_t m[16][RVV_MAX_LANES];
+  uint64_t h[8][RVV_MAX_LANES];
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t w = 0; w < 16; ++w)
+      m[w][l] = detail::load_le64(block[l] + w * 8);
+    for (size_t w = 0; w < 8; ++w)
+      h[w][l] = state[l][w];
+  }
+
+  LOAD_WORKING_STATE(
+      h,
+      __riscv_vxor_vx_u64m1(__riscv_vle64_v_u64m1(t0, vl), IV[4], vl),
+      __riscv_vxor_vx_u64m1(__riscv_vle64_v_u64m1(t1, vl), IV[5], vl),
+      __riscv_vxor_vx_u64m1(__riscv_vle64_v_u64m1(f0, vl), IV[6], vl));
+
+  for (int r = 0; r < 12; ++r) {
+    const uint8_t *s = SIGMA[r];
+    ROUND_LANES(s);
+  }
+
+  STORE_FEED_FORWARD(h, 0, v0, v8);
+  STORE_FEED_FORWARD(h, 1, v1, v9);
+  STORE_FEED_FORWARD(h, 2, v2, v10);
+  STORE_FEED_FORWARD(h, 3, v3, v11);
+  STORE_FEED_FORWARD(h, 4, v4, v12);
+  STORE_FEED_FORWARD(h, 5, v5, v13);
+  STORE_FEED_FORWARD(h, 6, v6, v14);
+  STORE_FEED_FORWARD(h, 7, v7, v15);
+
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t w = 0; w < 8; ++w)
+      state[l][w] = h[w][l];
+  }
+}
+
+void blake2b_iterate_lanes_rvv(uint64_t *const digest[], size_t outlen,
+                               uint64_t n) {
+  const size_t lanes = blake2b_rvv_lanes();
+  const size_t vl = __riscv_vsetvl_e64m1(lanes);
+
+  /* The message is the masked digest; words 8..15 stay zero */
+  uint64_t mask[8];
+  uint64_t m[16][RVV_MAX_LANES] = {};
+  uint64_t h0[8][RVV_MAX_LANES];
+  for (size_t w = 0; w < 8; ++w) {
+    mask[w] = blake2b_digest_mask(outlen, w);
+    const uint64_t iv = w == 0 ? IV[0] ^ (0x01010000ULL | outlen) : IV[w];
+    for (size_t l = 0; l < lanes; ++l) {
+      m[w][l] = digest[l][w] & mask[w];
+      h0[w][l] = iv;
+    }
+  }
+
+  for (uint64_t k = 0; k < n; ++k) {
+    uint64_t h[8][RVV_MAX_LANES];
+    for (size_t w = 0; w < 8; ++w) {
+      for (size_t l = 0; l < lanes; ++l)
+        h[w][l] = h0[w][l];
+    }
+
+    LOAD_WORKING_STATE(h, __riscv_vmv_v_x_u64m1(IV[4] ^ outlen, vl),
+                       __riscv_vmv_v_x_u64m1(IV[5], vl),
+                       __riscv_vmv_v_x_u64m1(~IV[6], vl));
+
+    for (int r = 0; r < 12; ++r) {
+      const uint8_t *s = SIGMA[r];
+      ROUND_LANES(s);
+    }
+
+    STORE_FEED_FORWARD(h, 0, v0, v8);
+    STORE_FEED_FORWARD(h, 1, v1, v9);
+    STORE_FEED_FORWARD(h, 2, v2, v10);
+    STORE_FEED_FORWARD(h, 3, v3, v11);
+    STORE_FEED_FORWARD(h, 4, v4, v12);
+    STORE_FEED_FORWARD(h, 5, v5, v13);
+    STORE_FEED_FORWARD(h, 6, v6, v14);
+    STORE_FEED_FORWARD(h, 7, v7, v15);
+
+    for (size_t w = 0; w < 8; ++w) {
+      __riscv_vse64_v_u64m1(
+          m[w],
+          __riscv_vand_vx_u64m1(__riscv_vle64_v_u64m1(h[w], vl), mask[w], vl),
+          vl);
+    }
+  }
+
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t w = 0; w < 8; ++w)
+      digest[l][w] = m[w][l];
+  }
+}
+
+#undef STORE_FEED_FORWARD
+#undef LOAD_WORKING_STATE
+#undef ROUND_LANES
+#undef LOAD_M
+#undef G_RVV
+
+} /* namespace tinyblake */
+
+#else
+
+namespace tinyblake {
+
+void blake2b_compress_rvv(uint64_t state[8], const uint8_t block[128],
+                          uint64_t t0, uint64_t t1, bool last) {
+  blake2b_compress_portable(state, block, t0, t1, last);
+}
+
+void blake2b_iterate_rvv(uint64_t digest[8], size_t outlen, uint64_t n) {
+  blake2b_iterate_portable(digest, outlen, n);
+}
+
+size_t blake2b_rvv_lanes() { return 1; }
+
+void blake2b_compress_lanes_rvv(uint64_t *const state[],
+                                const uint8_t *const block[],
+                                const uint64_t t0[], const uint64_t t1[],
+                                const uint64_t f0[]) {
+  blake2b_compress_portable(state[0], block[0], t0[0], t1[0], f0[0] != 0);
+}
+
+void blake2b_iterate_lanes_rvv(uint64_t *const digest[], size_t outlen,
+                               uint64_t n) {
+  blake2b_iterate_portable(digest[0], outlen, n);
+}
+
+} /* namespace tinyblake */
+
+#endif
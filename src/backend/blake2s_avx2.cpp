@@ -0,0 +1,199 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "blake2s_compress.h"
+
+/*
+ * AVX2 8-way transposed BLAKE2s kernel: each __m256i holds the same 32-bit
+ * working word for eight independent messages, so G runs on whole
+ * registers with no diagonal shuffles. Message blocks and chaining values
+ * are transposed in and out with 8x8 32-bit transposes.
+ *
+ * A single BLAKE2s compression only fills 128-bit rows, so single-lane
+ * hashing on AVX2 machines uses the SSE4.1 kernel. The build system must
+ * pass -mavx2 (GCC/Clang) or /arch:AVX2 (MSVC).
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__AVX2__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace tinyblake {
+
+static const uint32_t IV[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                               0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                               0x1F83D9ABUL, 0x5BE0CD19UL};
+
+static const uint8_t SIGMA[10][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+};
+
+alignas(32) static const uint8_t rotr16_mask[32] = {
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13};
+
+alignas(32) static const uint8_t rotr8_mask[32] = {
+    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12};
+
+/* r[i] holds eight words of lane i on input, word i of all lanes on output */
+static inline void transpose8x8(__m256i r[8]) {
+  const __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+  const __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+  const __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+  const __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+  const __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+  const __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+  const __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+  const __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+  const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+  const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+  const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+  const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+  const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+  const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+  const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+  const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+  r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+  r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+#define G8(a, b, c, d, mx, my)                                                 \
+  do {                                                                         \
+    a = _mm256_add_epi32(_mm256_add_epi32(a, b), mx);                          \
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot16);                    \
+    c = _mm256_add_epi32(c, d);                                                \
+    b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_srli_epi32(b, 12), _mm256_slli_epi32(b, 20));   \
+    a = _mm256_add_epi32(_mm256_add_epi32(a, b), my);                          \
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot8);                     \
+    c = _mm256_add_epi32(c, d);                                                \
+    b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_srli_epi32(b, 7), _mm256_slli_epi32(b, 25));    \
+  } while (0)
+
+void blake2s_compress_8way_avx2(uint32_t *const state[],
+                                const uint8_t *const block[],
+                                const uint32_t t0[], const uint32_t t1[],
+                                const uint32_t f0[]) {
+  const __m256i rot16 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr16_mask));
+  const __m256i rot8 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr8_mask));
+
+  __m256i m[16];
+  for (int half = 0; half < 2; ++half) {
+    __m256i r[8];
+    for (int l = 0; l < 8; ++l) {
+      r[l] = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(block[l] + half * 32));
+    }
+    transpose8x8(r);
+    for (int j = 0; j < 8; ++j)
+      m[half * 8 + j] = r[j];
+  }
+
+  __m256i h[8];
+  for (int l = 0; l < 8; ++l) {
+    h[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[l]));
+  }
+  transpose8x8(h);
+
+  __m256i v[16];
+  for (int i = 0; i < 8; ++i)
+    v[i] = h[i];
+  for (int i = 0; i < 4; ++i)
+    v[8 + i] = _mm256_set1_epi32(static_cast<int>(IV[i]));
+  v[12] = _mm256_xor_si256(
+      _mm256_set1_epi32(static_cast<int>(IV[4])),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t0)));
+  v[13] = _mm256_xor_si256(
+      _mm256_set1_epi32(static_cast<int>(IV[5])),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t1)));
+  v[14] = _mm256_xor_si256(
+      _mm256_set1_epi32(static_cast<int>(IV[6])),
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(f0)));
+  v[15] = _mm256_set1_epi32(static_cast<int>(IV[7]));
+
+  for (int r = 0; r < 10; ++r) {
+    const uint8_t *s = SIGMA[r];
+    G8(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+    G8(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+    G8(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+    G8(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+    G8(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+    G8(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    G8(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+    G8(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm256_xor_si256(h[i], _mm256_xor_si256(v[i], v[i + 8]));
+  transpose8x8(h);
+  for (int l = 0; l < 8; ++l) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[l]), h[l]);
+  }
+}
+
+#undef G8
+
+} /* namespace tinyblake */
+
+#else /* No x86-64 support — provide a stub that forwards to portable */
+
+namespace tinyblake {
+
+void blake2s_compress_8way_avx2(uint32_t *const state[],
+                                const uint8_t *const block[],
+                                const uint32_t t0[], const uint32_t t1[],
+                                const uint32_t f0[]) {
+  for (int i = 0; i < 8; ++i)
+    blake2s_compress_portable(state[i], block[i], t0[i], t1[i], f0[i] != 0);
+}
+
+} /* namespace tinyblake */
+
+#endif
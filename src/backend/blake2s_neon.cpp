@@ -0,0 +1,141 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "blake2s_compress.h"
+
+/*
+ * ARM NEON vectorised BLAKE2s compression: the four rows of the working
+ * matrix are uint32x4_t registers and diagonalisation is a VEXT rotation.
+ * Rotations use VREV32 (16 bits) and VSRI/VSLI pairs (12, 8, 7 bits); this
+ * is the backend 32-bit ARM targets get.
+ */
+
+#if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+
+#include "../internal/endian.h"
+#include <arm_neon.h>
+
+namespace tinyblake {
+
+static const uint32_t IV[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                               0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                               0x1F83D9ABUL, 0x5BE0CD19UL};
+
+static const uint8_t SIGMA[10][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+};
+
+static inline uint32x4_t rotr32_16(uint32x4_t x) {
+  return vreinterpretq_u32_u16(vrev32q_u16(vreinterpretq_u16_u32(x)));
+}
+
+static inline uint32x4_t rotr32_12(uint32x4_t x) {
+  return vsliq_n_u32(vshrq_n_u32(x, 12), x, 20);
+}
+
+static inline uint32x4_t rotr32_8(uint32x4_t x) {
+  return vsliq_n_u32(vshrq_n_u32(x, 8), x, 24);
+}
+
+static inline uint32x4_t rotr32_7(uint32x4_t x) {
+  return vsliq_n_u32(vshrq_n_u32(x, 7), x, 25);
+}
+
+static inline void g_rows(uint32x4_t &a, uint32x4_t &b, uint32x4_t &c,
+                          uint32x4_t &d, uint32x4_t mx, uint32x4_t my) {
+  a = vaddq_u32(vaddq_u32(a, b), mx);
+  d = rotr32_16(veorq_u32(d, a));
+  c = vaddq_u32(c, d);
+  b = rotr32_12(veorq_u32(b, c));
+  a = vaddq_u32(vaddq_u32(a, b), my);
+  d = rotr32_8(veorq_u32(d, a));
+  c = vaddq_u32(c, d);
+  b = rotr32_7(veorq_u32(b, c));
+}
+
+static inline uint32x4_t gather(const uint32_t m[16], const uint8_t *s) {
+  const uint32_t w[4] = {m[s[0]], m[s[2]], m[s[4]], m[s[6]]};
+  return vld1q_u32(w);
+}
+
+void blake2s_compress_neon(uint32_t state[8], const uint8_t block[64],
+                           uint32_t t0, uint32_t t1, bool last) {
+  uint32_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le32(block + i * 4);
+  }
+
+  const uint32x4_t h0 = vld1q_u32(state);
+  const uint32x4_t h1 = vld1q_u32(state + 4);
+  const uint32_t tf[4] = {t0, t1, last ? 0xFFFFFFFFUL : 0, 0};
+  uint32x4_t row1 = h0;
+  uint32x4_t row2 = h1;
+  uint32x4_t row3 = vld1q_u32(IV);
+  uint32x4_t row4 = veorq_u32(vld1q_u32(IV + 4), vld1q_u32(tf));
+
+  for (int r = 0; r < 10; ++r) {
+    const uint8_t *s = SIGMA[r];
+
+    g_rows(row1, row2, row3, row4, gather(m, s), gather(m, s + 1));
+
+    row2 = vextq_u32(row2, row2, 1);
+    row3 = vextq_u32(row3, row3, 2);
+    row4 = vextq_u32(row4, row4, 3);
+    g_rows(row1, row2, row3, row4, gather(m, s + 8), gather(m, s + 9));
+    row2 = vextq_u32(row2, row2, 3);
+    row3 = vextq_u32(row3, row3, 2);
+    row4 = vextq_u32(row4, row4, 1);
+  }
+
+  vst1q_u32(state, veorq_u32(h0, veorq_u32(row1, row3)));
+  vst1q_u32(state + 4, veorq_u32(h1, veorq_u32(row2, row4)));
+}
+
+} /* namespace tinyblake */
+
+#else
+
+namespace tinyblake {
+
+void blake2s_compress_neon(uint32_t state[8], const uint8_t block[64],
+                           uint32_t t0, uint32_t t1, bool last) {
+  blake2s_compress_portable(state, block, t0, t1, last);
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,226 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "blake3_impl.h"
+
+/*
+ * AVX2 8-way BLAKE3 hash_many: each __m256i holds the same 32-bit working
+ * word for eight chunks or parent nodes, so every G step is a vertical
+ * operation. Message blocks and the output chaining values are moved in
+ * and out with 8x8 32-bit transposes. Leftover inputs (fewer than eight)
+ * go to the SSE4.1 kernel. The build system must pass -mavx2 (GCC/Clang)
+ * or /arch:AVX2 (MSVC).
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__AVX2__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace tinyblake {
+
+static const uint32_t IV[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                               0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                               0x1F83D9ABUL, 0x5BE0CD19UL};
+
+static const uint8_t MSG_SCHEDULE[7][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+    {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+    {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+    {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+    {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+    {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+};
+
+alignas(32) static const uint8_t rotr16_mask[32] = {
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13};
+
+alignas(32) static const uint8_t rotr8_mask[32] = {
+    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12};
+
+/* r[i] holds eight words of input i on entry, word i of all inputs on exit */
+static inline void transpose8x8(__m256i r[8]) {
+  const __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+  const __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+  const __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+  const __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+  const __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+  const __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+  const __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+  const __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+  const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+  const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+  const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+  const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+  const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+  const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+  const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+  const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+  r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+  r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+  r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+  r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+  r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+  r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+  r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+  r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+#define G8(a, b, c, d, mx, my)                                                 \
+  do {                                                                         \
+    a = _mm256_add_epi32(_mm256_add_epi32(a, b), mx);                          \
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot16);                    \
+    c = _mm256_add_epi32(c, d);                                                \
+    b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_srli_epi32(b, 12), _mm256_slli_epi32(b, 20));   \
+    a = _mm256_add_epi32(_mm256_add_epi32(a, b), my);                          \
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rot8);                     \
+    c = _mm256_add_epi32(c, d);                                                \
+    b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_srli_epi32(b, 7), _mm256_slli_epi32(b, 25));    \
+  } while (0)
+
+static void hash8(const uint8_t *const inputs[8], size_t blocks,
+                  const uint32_t key[8], uint64_t counter,
+                  bool increment_counter, uint8_t flags, uint8_t flags_start,
+                  uint8_t flags_end, uint8_t *out) {
+  const __m256i rot16 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr16_mask));
+  const __m256i rot8 =
+      _mm256_load_si256(reinterpret_cast<const __m256i *>(rotr8_mask));
+
+  __m256i h[8];
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm256_set1_epi32(static_cast<int>(key[i]));
+
+  uint32_t lo[8], hi[8];
+  for (int l = 0; l < 8; ++l) {
+    const uint64_t c = counter + (increment_counter ? uint64_t(l) : 0);
+    lo[l] = static_cast<uint32_t>(c);
+    hi[l] = static_cast<uint32_t>(c >> 32);
+  }
+  const __m256i counter_lo =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lo));
+  const __m256i counter_hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hi));
+
+  uint8_t block_flags = static_cast<uint8_t>(flags | flags_start);
+  for (size_t b = 0; b < blocks; ++b) {
+    if (b + 1 == blocks)
+      block_flags = static_cast<uint8_t>(block_flags | flags_end);
+
+    __m256i m[16];
+    for (int half = 0; half < 2; ++half) {
+      __m256i r[8];
+      for (int l = 0; l < 8; ++l) {
+        r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+            inputs[l] + b * 64 + half * 32));
+      }
+      transpose8x8(r);
+      for (int j = 0; j < 8; ++j)
+        m[half * 8 + j] = r[j];
+    }
+
+    __m256i v[16];
+    for (int i = 0; i < 8; ++i)
+      v[i] = h[i];
+    for (int i = 0; i < 4; ++i)
+      v[8 + i] = _mm256_set1_epi32(static_cast<int>(IV[i]));
+    v[12] = counter_lo;
+    v[13] = counter_hi;
+    v[14] = _mm256_set1_epi32(64);
+    v[15] = _mm256_set1_epi32(block_flags);
+
+    for (int r = 0; r < 7; ++r) {
+      const uint8_t *s = MSG_SCHEDULE[r];
+      G8(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+      G8(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+      G8(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+      G8(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+      G8(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+      G8(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      G8(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+      G8(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i)
+      h[i] = _mm256_xor_si256(v[i], v[i + 8]);
+    block_flags = flags;
+  }
+
+  transpose8x8(h);
+  for (int l = 0; l < 8; ++l) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + l * 32), h[l]);
+  }
+}
+
+#undef G8
+
+void blake3_hash_many_avx2(const uint8_t *const inputs[], size_t num_inputs,
+                           size_t blocks, const uint32_t key[8],
+                           uint64_t counter, bool increment_counter,
+                           uint8_t flags, uint8_t flags_start,
+                           uint8_t flags_end, uint8_t *out) {
+  while (num_inputs >= 8) {
+    hash8(inputs, blocks, key, counter, increment_counter, flags, flags_start,
+          flags_end, out);
+    if (increment_counter)
+      counter += 8;
+    inputs += 8;
+    num_inputs -= 8;
+    out += 8 * 32;
+  }
+  blake3_hash_many_sse41(inputs, num_inputs, blocks, key, counter,
+                         increment_counter, flags, flags_start, flags_end,
+                         out);
+}
+
+} /* namespace tinyblake */
+
+#else /* No x86-64 support — provide a stub that forwards to portable */
+
+namespace tinyblake {
+
+void blake3_hash_many_avx2(const uint8_t *const inputs[], size_t num_inputs,
+                           size_t blocks, const uint32_t key[8],
+                           uint64_t counter, bool increment_counter,
+                           uint8_t flags, uint8_t flags_start,
+                           uint8_t flags_end, uint8_t *out) {
+  blake3_hash_many_portable(inputs, num_inputs, blocks, key, counter,
+                            increment_counter, flags, flags_start, flags_end,
+                            out);
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,223 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "blake3_impl.h"
+
+/*
+ * AVX-512 16-way BLAKE3 hash_many. One input block is exactly one __m512i,
+ * so the message is a 16x16 32-bit transpose of sixteen loads, and the
+ * rotations are single VPRORD instructions. Leftover inputs (fewer than
+ * sixteen) go to the AVX2 kernel. The build system must pass
+ * -mavx512f -mavx512vl (GCC/Clang) or /arch:AVX512 (MSVC).
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__AVX512F__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace tinyblake {
+
+static const uint32_t IV[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                               0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                               0x1F83D9ABUL, 0x5BE0CD19UL};
+
+static const uint8_t MSG_SCHEDULE[7][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+    {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+    {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+    {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+    {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+    {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+};
+
+/* GCC 12's unpack/shuffle/rotate intrinsics pass _mm512_undefined_epi32()
+ * as the merge source, which trips -W(maybe-)uninitialized (GCC PR 105593). */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/*
+ * r[i] holds sixteen words of input i on entry, word i of all inputs on
+ * exit. Unpacks transpose within each 128-bit quarter; two rounds of
+ * 128-bit shuffles then transpose the 4x4 grid of quarters.
+ */
+static inline void transpose16x16(__m512i r[16]) {
+  __m512i a[16], b[16];
+  for (int k = 0; k < 8; ++k) {
+    a[2 * k] = _mm512_unpacklo_epi32(r[2 * k], r[2 * k + 1]);
+    a[2 * k + 1] = _mm512_unpackhi_epi32(r[2 * k], r[2 * k + 1]);
+  }
+  /* b[4g + c]: quarter q holds word 4q + c of inputs 4g..4g+3 */
+  for (int g = 0; g < 4; ++g) {
+    b[4 * g + 0] = _mm512_unpacklo_epi64(a[4 * g], a[4 * g + 2]);
+    b[4 * g + 1] = _mm512_unpackhi_epi64(a[4 * g], a[4 * g + 2]);
+    b[4 * g + 2] = _mm512_unpacklo_epi64(a[4 * g + 1], a[4 * g + 3]);
+    b[4 * g + 3] = _mm512_unpackhi_epi64(a[4 * g + 1], a[4 * g + 3]);
+  }
+  for (int c = 0; c < 4; ++c) {
+    const __m512i y0 =
+        _mm512_shuffle_i32x4(b[c], b[4 + c], _MM_SHUFFLE(2, 0, 2, 0));
+    const __m512i y1 =
+        _mm512_shuffle_i32x4(b[c], b[4 + c], _MM_SHUFFLE(3, 1, 3, 1));
+    const __m512i y2 =
+        _mm512_shuffle_i32x4(b[8 + c], b[12 + c], _MM_SHUFFLE(2, 0, 2, 0));
+    const __m512i y3 =
+        _mm512_shuffle_i32x4(b[8 + c], b[12 + c], _MM_SHUFFLE(3, 1, 3, 1));
+    r[0 + c] = _mm512_shuffle_i32x4(y0, y2, _MM_SHUFFLE(2, 0, 2, 0));
+    r[4 + c] = _mm512_shuffle_i32x4(y1, y3, _MM_SHUFFLE(2, 0, 2, 0));
+    r[8 + c] = _mm512_shuffle_i32x4(y0, y2, _MM_SHUFFLE(3, 1, 3, 1));
+    r[12 + c] = _mm512_shuffle_i32x4(y1, y3, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+}
+
+#define G16(a, b, c, d, mx, my)                                                \
+  do {                                                                         \
+    a = _mm512_add_epi32(_mm512_add_epi32(a, b), mx);                          \
+    d = _mm512_ror_epi32(_mm512_xor_si512(d, a), 16);                          \
+    c = _mm512_add_epi32(c, d);                                                \
+    b = _mm512_ror_epi32(_mm512_xor_si512(b, c), 12);                          \
+    a = _mm512_add_epi32(_mm512_add_epi32(a, b), my);                          \
+    d = _mm512_ror_epi32(_mm512_xor_si512(d, a), 8);                           \
+    c = _mm512_add_epi32(c, d);                                                \
+    b = _mm512_ror_epi32(_mm512_xor_si512(b, c), 7);                           \
+  } while (0)
+
+static void hash16(const uint8_t *const inputs[16], size_t blocks,
+                   const uint32_t key[8], uint64_t counter,
+                   bool increment_counter, uint8_t flags, uint8_t flags_start,
+                   uint8_t flags_end, uint8_t *out) {
+  __m512i h[8];
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm512_set1_epi32(static_cast<int>(key[i]));
+
+  uint32_t lo[16], hi[16];
+  for (int l = 0; l < 16; ++l) {
+    const uint64_t c = counter + (increment_counter ? uint64_t(l) : 0);
+    lo[l] = static_cast<uint32_t>(c);
+    hi[l] = static_cast<uint32_t>(c >> 32);
+  }
+  const __m512i counter_lo = _mm512_loadu_si512(lo);
+  const __m512i counter_hi = _mm512_loadu_si512(hi);
+
+  uint8_t block_flags = static_cast<uint8_t>(flags | flags_start);
+  for (size_t b = 0; b < blocks; ++b) {
+    if (b + 1 == blocks)
+      block_flags = static_cast<uint8_t>(block_flags | flags_end);
+
+    __m512i m[16];
+    for (int l = 0; l < 16; ++l)
+      m[l] = _mm512_loadu_si512(inputs[l] + b * 64);
+    transpose16x16(m);
+
+    __m512i v[16];
+    for (int i = 0; i < 8; ++i)
+      v[i] = h[i];
+    for (int i = 0; i < 4; ++i)
+      v[8 + i] = _mm512_set1_epi32(static_cast<int>(IV[i]));
+    v[12] = counter_lo;
+    v[13] = counter_hi;
+    v[14] = _mm512_set1_epi32(64);
+    v[15] = _mm512_set1_epi32(block_flags);
+
+    for (int r = 0; r < 7; ++r) {
+      const uint8_t *s = MSG_SCHEDULE[r];
+      G16(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+      G16(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+      G16(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+      G16(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+      G16(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+      G16(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      G16(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+      G16(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i)
+      h[i] = _mm512_xor_si512(v[i], v[i + 8]);
+    block_flags = flags;
+  }
+
+  /* Pad to 16 rows; after the transpose row l's low half is input l's CV */
+  __m512i t[16];
+  for (int i = 0; i < 8; ++i) {
+    t[i] = h[i];
+    t[8 + i] = _mm512_setzero_si512();
+  }
+  transpose16x16(t);
+  for (int l = 0; l < 16; ++l) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + l * 32),
+                        _mm512_castsi512_si256(t[l]));
+  }
+}
+
+#undef G16
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+void blake3_hash_many_avx512(const uint8_t *const inputs[], size_t num_inputs,
+                             size_t blocks, const uint32_t key[8],
+                             uint64_t counter, bool increment_counter,
+                             uint8_t flags, uint8_t flags_start,
+                             uint8_t flags_end, uint8_t *out) {
+  while (num_inputs >= 16) {
+    hash16(inputs, blocks, key, counter, increment_counter, flags,
+           flags_start, flags_end, out);
+    if (increment_counter)
+      counter += 16;
+    inputs += 16;
+    num_inputs -= 16;
+    out += 16 * 32;
+  }
+  blake3_hash_many_avx2(inputs, num_inputs, blocks, key, counter,
+                        increment_counter, flags, flags_start, flags_end, out);
+}
+
+} /* namespace tinyblake */
+
+#else /* No x86-64 support — provide a stub that forwards to portable */
+
+namespace tinyblake {
+
+void blake3_hash_many_avx512(const uint8_t *const inputs[], size_t num_inputs,
+                             size_t blocks, const uint32_t key[8],
+                             uint64_t counter, bool increment_counter,
+                             uint8_t flags, uint8_t flags_start,
+                             uint8_t flags_end, uint8_t *out) {
+  blake3_hash_many_portable(inputs, num_inputs, blocks, key, counter,
+                            increment_counter, flags, flags_start, flags_end,
+                            out);
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,145 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BACKEND_BLAKE3_IMPL_H
+#define TINYBLAKE_BACKEND_BLAKE3_IMPL_H
+
+#include "tinyblake/common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tinyblake {
+
+constexpr size_t BLAKE3_BLOCK_LEN = 64;
+constexpr size_t BLAKE3_CHUNK_LEN = 1024;
+
+/* Domain separation flags (BLAKE3 spec, section 2.1) */
+constexpr uint8_t BLAKE3_CHUNK_START = 1 << 0;
+constexpr uint8_t BLAKE3_CHUNK_END = 1 << 1;
+constexpr uint8_t BLAKE3_PARENT = 1 << 2;
+constexpr uint8_t BLAKE3_ROOT = 1 << 3;
+constexpr uint8_t BLAKE3_KEYED_HASH = 1 << 4;
+constexpr uint8_t BLAKE3_DERIVE_KEY_CONTEXT = 1 << 5;
+constexpr uint8_t BLAKE3_DERIVE_KEY_MATERIAL = 1 << 6;
+
+/**
+ * Compress one block into a chaining value.
+ *
+ * @param cv         8-word chaining value (modified in place)
+ * @param block      64-byte block, zero-padded past block_len
+ * @param block_len  number of message bytes in the block (0..64)
+ * @param counter    chunk counter (or output block counter for the root)
+ * @param flags      domain separation flags
+ */
+using blake3_compress_in_place_fn = void (*)(uint32_t cv[8],
+                                             const uint8_t block[64],
+                                             uint8_t block_len,
+                                             uint64_t counter, uint8_t flags);
+
+/**
+ * Compress one block and emit the full 64-byte extended output, as used
+ * for root output blocks. cv is left untouched.
+ */
+using blake3_compress_xof_fn = void (*)(const uint32_t cv[8],
+                                        const uint8_t block[64],
+                                        uint8_t block_len, uint64_t counter,
+                                        uint8_t flags, uint8_t out[64]);
+
+/**
+ * Hash num_inputs independent inputs of exactly `blocks` full blocks each,
+ * all starting from `key`, and write each 32-byte chaining value to
+ * out + i * 32. Input i uses counter + i when increment_counter is set
+ * (chunks), or counter for every input (parent nodes). flags_start is
+ * added to the first block's flags and flags_end to the last block's.
+ *
+ * Outputs are written only after the inputs of the same group have been
+ * read, so out[i] may overlap inputs that precede input i + 1.
+ */
+using blake3_hash_many_fn = void (*)(const uint8_t *const inputs[],
+                                     size_t num_inputs, size_t blocks,
+                                     const uint32_t key[8], uint64_t counter,
+                                     bool increment_counter, uint8_t flags,
+                                     uint8_t flags_start, uint8_t flags_end,
+                                     uint8_t *out);
+
+/* Backend implementations */
+TINYBLAKE_API void
+blake3_compress_in_place_portable(uint32_t cv[8],
+                                  const uint8_t block[64], uint8_t block_len,
+                                  uint64_t counter, uint8_t flags);
+TINYBLAKE_API void blake3_compress_xof_portable(const uint32_t cv[8],
+                                                const uint8_t block[64],
+                                                uint8_t block_len,
+                                                uint64_t counter, uint8_t flags,
+                                                uint8_t out[64]);
+TINYBLAKE_API void blake3_hash_many_portable(const uint8_t *const inputs[],
+                                             size_t num_inputs, size_t blocks,
+                                             const uint32_t key[8],
+                                             uint64_t counter,
+                                             bool increment_counter,
+                                             uint8_t flags, uint8_t flags_start,
+                                             uint8_t flags_end, uint8_t *out);
+
+TINYBLAKE_API void blake3_compress_in_place_sse41(uint32_t cv[8],
+                                                  const uint8_t block[64],
+                                                  uint8_t block_len,
+                                                  uint64_t counter,
+                                                  uint8_t flags);
+TINYBLAKE_API void blake3_compress_xof_sse41(const uint32_t cv[8],
+                                             const uint8_t block[64],
+                                             uint8_t block_len,
+                                             uint64_t counter, uint8_t flags,
+                                             uint8_t out[64]);
+TINYBLAKE_API void blake3_hash_many_sse41(const uint8_t *const inputs[],
+                                          size_t num_inputs, size_t blocks,
+                                          const uint32_t key[8],
+                                          uint64_t counter,
+                                          bool increment_counter, uint8_t flags,
+                                          uint8_t flags_start,
+                                          uint8_t flags_end, uint8_t *out);
+
+TINYBLAKE_API void blake3_hash_many_avx2(const uint8_t *const inputs[],
+                                         size_t num_inputs, size_t blocks,
+                                         const uint32_t key[8],
+                                         uint64_t counter,
+                                         bool increment_counter, uint8_t flags,
+                                         uint8_t flags_start, uint8_t flags_end,
+                                         uint8_t *out);
+
+TINYBLAKE_API void blake3_hash_many_avx512(const uint8_t *const inputs[],
+                                           size_t num_inputs, size_t blocks,
+                                           const uint32_t key[8],
+                                           uint64_t counter,
+                                           bool increment_counter,
+                                           uint8_t flags, uint8_t flags_start,
+                                           uint8_t flags_end, uint8_t *out);
+
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_BACKEND_BLAKE3_IMPL_H */
@@ -0,0 +1,161 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../internal/endian.h"
+#include "blake3_impl.h"
+
+namespace tinyblake {
+
+/* BLAKE3 IV (same constants as BLAKE2s / SHA-256) */
+static const uint32_t IV[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                               0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                               0x1F83D9ABUL, 0x5BE0CD19UL};
+
+/* Message word order per round: the fixed permutation applied r times */
+static const uint8_t MSG_SCHEDULE[7][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+    {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+    {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+    {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+    {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+    {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+};
+
+static inline uint32_t rotr32(uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+#define G(r, i, a, b, c, d)                                                    \
+  do {                                                                         \
+    a = a + b + m[MSG_SCHEDULE[r][2 * i + 0]];                                 \
+    d = rotr32(d ^ a, 16);                                                     \
+    c = c + d;                                                                 \
+    b = rotr32(b ^ c, 12);                                                     \
+    a = a + b + m[MSG_SCHEDULE[r][2 * i + 1]];                                 \
+    d = rotr32(d ^ a, 8);                                                      \
+    c = c + d;                                                                 \
+    b = rotr32(b ^ c, 7);                                                      \
+  } while (0)
+
+#define ROUND(r)                                                               \
+  do {                                                                         \
+    G(r, 0, v[0], v[4], v[8], v[12]);                                          \
+    G(r, 1, v[1], v[5], v[9], v[13]);                                          \
+    G(r, 2, v[2], v[6], v[10], v[14]);                                         \
+    G(r, 3, v[3], v[7], v[11], v[15]);                                         \
+    G(r, 4, v[0], v[5], v[10], v[15]);                                         \
+    G(r, 5, v[1], v[6], v[11], v[12]);                                         \
+    G(r, 6, v[2], v[7], v[8], v[13]);                                          \
+    G(r, 7, v[3], v[4], v[9], v[14]);                                          \
+  } while (0)
+
+static void compress_core(uint32_t v[16], const uint32_t cv[8],
+                          const uint8_t block[64], uint8_t block_len,
+                          uint64_t counter, uint8_t flags) {
+  uint32_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le32(block + i * 4);
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    v[i] = cv[i];
+  }
+  v[8] = IV[0];
+  v[9] = IV[1];
+  v[10] = IV[2];
+  v[11] = IV[3];
+  v[12] = static_cast<uint32_t>(counter);
+  v[13] = static_cast<uint32_t>(counter >> 32);
+  v[14] = block_len;
+  v[15] = flags;
+
+  ROUND(0);
+  ROUND(1);
+  ROUND(2);
+  ROUND(3);
+  ROUND(4);
+  ROUND(5);
+  ROUND(6);
+}
+
+#undef ROUND
+#undef G
+
+void blake3_compress_in_place_portable(uint32_t cv[8], const uint8_t block[64],
+                                       uint8_t block_len, uint64_t counter,
+                                       uint8_t flags) {
+  uint32_t v[16];
+  compress_core(v, cv, block, block_len, counter, flags);
+  for (int i = 0; i < 8; ++i) {
+    cv[i] = v[i] ^ v[i + 8];
+  }
+}
+
+void blake3_compress_xof_portable(const uint32_t cv[8],
+                                  const uint8_t block[64], uint8_t block_len,
+                                  uint64_t counter, uint8_t flags,
+                                  uint8_t out[64]) {
+  uint32_t v[16];
+  compress_core(v, cv, block, block_len, counter, flags);
+  for (int i = 0; i < 8; ++i) {
+    detail::store_le32(out + i * 4, v[i] ^ v[i + 8]);
+    detail::store_le32(out + 32 + i * 4, v[i + 8] ^ cv[i]);
+  }
+}
+
+void blake3_hash_many_portable(const uint8_t *const inputs[],
+                               size_t num_inputs, size_t blocks,
+                               const uint32_t key[8], uint64_t counter,
+                               bool increment_counter, uint8_t flags,
+                               uint8_t flags_start, uint8_t flags_end,
+                               uint8_t *out) {
+  for (size_t n = 0; n < num_inputs; ++n) {
+    uint32_t cv[8];
+    for (int i = 0; i < 8; ++i) {
+      cv[i] = key[i];
+    }
+
+    uint8_t block_flags = static_cast<uint8_t>(flags | flags_start);
+    for (size_t b = 0; b < blocks; ++b) {
+      if (b + 1 == blocks)
+        block_flags = static_cast<uint8_t>(block_flags | flags_end);
+      blake3_compress_in_place_portable(cv, inputs[n] + b * 64, 64, counter,
+                                        block_flags);
+      block_flags = flags;
+    }
+
+    for (int i = 0; i < 8; ++i) {
+      detail::store_le32(out + n * 32 + i * 4, cv[i]);
+    }
+    if (increment_counter)
+      ++counter;
+  }
+}
+
+} /* namespace tinyblake */
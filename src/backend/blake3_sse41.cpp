@@ -0,0 +1,344 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "blake3_impl.h"
+
+/*
+ * SSE4.1 BLAKE3 kernels.
+ *
+ * Single-block compression keeps the 4x4 state as four __m128i rows and
+ * diagonalizes with word shuffles, as in the BLAKE2s SSE4.1 kernel.
+ * hash_many runs four inputs at once with the state transposed, so each
+ * __m128i holds the same word from four chunks or parent nodes. The build
+ * system must pass -msse4.1 (GCC/Clang); MSVC accepts the intrinsics as is.
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__SSE4_1__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include "../internal/endian.h"
+#include <smmintrin.h>
+
+namespace tinyblake {
+
+static const uint32_t IV[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                               0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                               0x1F83D9ABUL, 0x5BE0CD19UL};
+
+static const uint8_t MSG_SCHEDULE[7][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+    {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+    {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+    {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+    {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+    {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+};
+
+static inline __m128i rotr32_12(__m128i x) {
+  return _mm_or_si128(_mm_srli_epi32(x, 12), _mm_slli_epi32(x, 20));
+}
+
+static inline __m128i rotr32_7(__m128i x) {
+  return _mm_or_si128(_mm_srli_epi32(x, 7), _mm_slli_epi32(x, 25));
+}
+
+static inline void g_rows(__m128i &a, __m128i &b, __m128i &c, __m128i &d,
+                          __m128i mx, __m128i my, __m128i r16, __m128i r8) {
+  a = _mm_add_epi32(_mm_add_epi32(a, b), mx);
+  d = _mm_shuffle_epi8(_mm_xor_si128(d, a), r16);
+  c = _mm_add_epi32(c, d);
+  b = rotr32_12(_mm_xor_si128(b, c));
+  a = _mm_add_epi32(_mm_add_epi32(a, b), my);
+  d = _mm_shuffle_epi8(_mm_xor_si128(d, a), r8);
+  c = _mm_add_epi32(c, d);
+  b = rotr32_7(_mm_xor_si128(b, c));
+}
+
+static inline __m128i gather(const uint32_t m[16], const uint8_t *s) {
+  return _mm_set_epi32(static_cast<int>(m[s[6]]), static_cast<int>(m[s[4]]),
+                       static_cast<int>(m[s[2]]), static_cast<int>(m[s[0]]));
+}
+
+static inline __m128i rot16_mask() {
+  return _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+}
+
+static inline __m128i rot8_mask() {
+  return _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+}
+
+/* Runs the 7 rounds; rows hold the final working state */
+static void compress_rows(__m128i rows[4], const uint32_t cv[8],
+                          const uint8_t block[64], uint8_t block_len,
+                          uint64_t counter, uint8_t flags) {
+  const __m128i r16 = rot16_mask();
+  const __m128i r8 = rot8_mask();
+
+  uint32_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = detail::load_le32(block + i * 4);
+  }
+
+  __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cv));
+  __m128i row2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cv + 4));
+  __m128i row3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(IV));
+  __m128i row4 = _mm_setr_epi32(static_cast<int>(counter),
+                                static_cast<int>(counter >> 32),
+                                static_cast<int>(block_len),
+                                static_cast<int>(flags));
+
+  for (int r = 0; r < 7; ++r) {
+    const uint8_t *s = MSG_SCHEDULE[r];
+
+    g_rows(row1, row2, row3, row4, gather(m, s), gather(m, s + 1), r16, r8);
+
+    row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(0, 3, 2, 1));
+    row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1, 0, 3, 2));
+    row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(2, 1, 0, 3));
+    g_rows(row1, row2, row3, row4, gather(m, s + 8), gather(m, s + 9), r16,
+           r8);
+    row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(2, 1, 0, 3));
+    row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1, 0, 3, 2));
+    row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(0, 3, 2, 1));
+  }
+
+  rows[0] = row1;
+  rows[1] = row2;
+  rows[2] = row3;
+  rows[3] = row4;
+}
+
+void blake3_compress_in_place_sse41(uint32_t cv[8], const uint8_t block[64],
+                                    uint8_t block_len, uint64_t counter,
+                                    uint8_t flags) {
+  __m128i rows[4];
+  compress_rows(rows, cv, block, block_len, counter, flags);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(cv),
+                   _mm_xor_si128(rows[0], rows[2]));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(cv + 4),
+                   _mm_xor_si128(rows[1], rows[3]));
+}
+
+void blake3_compress_xof_sse41(const uint32_t cv[8], const uint8_t block[64],
+                               uint8_t block_len, uint64_t counter,
+                               uint8_t flags, uint8_t out[64]) {
+  __m128i rows[4];
+  compress_rows(rows, cv, block, block_len, counter, flags);
+  const __m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cv));
+  const __m128i h1 =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(cv + 4));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                   _mm_xor_si128(rows[0], rows[2]));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                   _mm_xor_si128(rows[1], rows[3]));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 32),
+                   _mm_xor_si128(rows[2], h0));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 48),
+                   _mm_xor_si128(rows[3], h1));
+}
+
+/* ─── 4-way transposed hash_many ─── */
+
+/* r[i] holds four words of input i on entry, word i of all inputs on exit */
+static inline void transpose4x4(__m128i r[4]) {
+  const __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+  const __m128i t1 = _mm_unpackhi_epi32(r[0], r[1]);
+  const __m128i t2 = _mm_unpacklo_epi32(r[2], r[3]);
+  const __m128i t3 = _mm_unpackhi_epi32(r[2], r[3]);
+  r[0] = _mm_unpacklo_epi64(t0, t2);
+  r[1] = _mm_unpackhi_epi64(t0, t2);
+  r[2] = _mm_unpacklo_epi64(t1, t3);
+  r[3] = _mm_unpackhi_epi64(t1, t3);
+}
+
+#define G4(a, b, c, d, mx, my)                                                 \
+  do {                                                                         \
+    a = _mm_add_epi32(_mm_add_epi32(a, b), mx);                                \
+    d = _mm_shuffle_epi8(_mm_xor_si128(d, a), r16);                            \
+    c = _mm_add_epi32(c, d);                                                   \
+    b = rotr32_12(_mm_xor_si128(b, c));                                        \
+    a = _mm_add_epi32(_mm_add_epi32(a, b), my);                                \
+    d = _mm_shuffle_epi8(_mm_xor_si128(d, a), r8);                             \
+    c = _mm_add_epi32(c, d);                                                   \
+    b = rotr32_7(_mm_xor_si128(b, c));                                         \
+  } while (0)
+
+static void hash4(const uint8_t *const inputs[4], size_t blocks,
+                  const uint32_t key[8], uint64_t counter,
+                  bool increment_counter, uint8_t flags, uint8_t flags_start,
+                  uint8_t flags_end, uint8_t *out) {
+  const __m128i r16 = rot16_mask();
+  const __m128i r8 = rot8_mask();
+
+  __m128i h[8];
+  for (int i = 0; i < 8; ++i)
+    h[i] = _mm_set1_epi32(static_cast<int>(key[i]));
+
+  uint32_t lo[4], hi[4];
+  for (int l = 0; l < 4; ++l) {
+    const uint64_t c = counter + (increment_counter ? uint64_t(l) : 0);
+    lo[l] = static_cast<uint32_t>(c);
+    hi[l] = static_cast<uint32_t>(c >> 32);
+  }
+  const __m128i counter_lo =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo));
+  const __m128i counter_hi =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi));
+
+  uint8_t block_flags = static_cast<uint8_t>(flags | flags_start);
+  for (size_t b = 0; b < blocks; ++b) {
+    if (b + 1 == blocks)
+      block_flags = static_cast<uint8_t>(block_flags | flags_end);
+
+    __m128i m[16];
+    for (int q = 0; q < 4; ++q) {
+      __m128i r[4];
+      for (int l = 0; l < 4; ++l) {
+        r[l] = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(inputs[l] + b * 64 + q * 16));
+      }
+      transpose4x4(r);
+      for (int j = 0; j < 4; ++j)
+        m[q * 4 + j] = r[j];
+    }
+
+    __m128i v[16];
+    for (int i = 0; i < 8; ++i)
+      v[i] = h[i];
+    for (int i = 0; i < 4; ++i)
+      v[8 + i] = _mm_set1_epi32(static_cast<int>(IV[i]));
+    v[12] = counter_lo;
+    v[13] = counter_hi;
+    v[14] = _mm_set1_epi32(64);
+    v[15] = _mm_set1_epi32(block_flags);
+
+    for (int r = 0; r < 7; ++r) {
+      const uint8_t *s = MSG_SCHEDULE[r];
+      G4(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+      G4(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+      G4(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+      G4(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+      G4(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+      G4(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      G4(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+      G4(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i)
+      h[i] = _mm_xor_si128(v[i], v[i + 8]);
+    block_flags = flags;
+  }
+
+  /* h[0..3] -> words 0..3 of each input, h[4..7] -> words 4..7 */
+  transpose4x4(h);
+  transpose4x4(h + 4);
+  for (int l = 0; l < 4; ++l) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + l * 32), h[l]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + l * 32 + 16),
+                     h[4 + l]);
+  }
+}
+
+#undef G4
+
+static void hash_one(const uint8_t *input, size_t blocks,
+                     const uint32_t key[8], uint64_t counter, uint8_t flags,
+                     uint8_t flags_start, uint8_t flags_end, uint8_t out[32]) {
+  uint32_t cv[8];
+  for (int i = 0; i < 8; ++i)
+    cv[i] = key[i];
+
+  uint8_t block_flags = static_cast<uint8_t>(flags | flags_start);
+  for (size_t b = 0; b < blocks; ++b) {
+    if (b + 1 == blocks)
+      block_flags = static_cast<uint8_t>(block_flags | flags_end);
+    blake3_compress_in_place_sse41(cv, input + b * 64, 64, counter,
+                                   block_flags);
+    block_flags = flags;
+  }
+  for (int i = 0; i < 8; ++i)
+    detail::store_le32(out + i * 4, cv[i]);
+}
+
+void blake3_hash_many_sse41(const uint8_t *const inputs[], size_t num_inputs,
+                            size_t blocks, const uint32_t key[8],
+                            uint64_t counter, bool increment_counter,
+                            uint8_t flags, uint8_t flags_start,
+                            uint8_t flags_end, uint8_t *out) {
+  while (num_inputs >= 4) {
+    hash4(inputs, blocks, key, counter, increment_counter, flags, flags_start,
+          flags_end, out);
+    if (increment_counter)
+      counter += 4;
+    inputs += 4;
+    num_inputs -= 4;
+    out += 4 * 32;
+  }
+  while (num_inputs > 0) {
+    hash_one(inputs[0], blocks, key, counter, flags, flags_start, flags_end,
+             out);
+    if (increment_counter)
+      ++counter;
+    ++inputs;
+    --num_inputs;
+    out += 32;
+  }
+}
+
+} /* namespace tinyblake */
+
+#else /* No x86-64 support — provide stubs that forward to portable */
+
+namespace tinyblake {
+
+void blake3_compress_in_place_sse41(uint32_t cv[8], const uint8_t block[64],
+                                    uint8_t block_len, uint64_t counter,
+                                    uint8_t flags) {
+  blake3_compress_in_place_portable(cv, block, block_len, counter, flags);
+}
+
+void blake3_compress_xof_sse41(const uint32_t cv[8], const uint8_t block[64],
+                               uint8_t block_len, uint64_t counter,
+                               uint8_t flags, uint8_t out[64]) {
+  blake3_compress_xof_portable(cv, block, block_len, counter, flags, out);
+}
+
+void blake3_hash_many_sse41(const uint8_t *const inputs[], size_t num_inputs,
+                            size_t blocks, const uint32_t key[8],
+                            uint64_t counter, bool increment_counter,
+                            uint8_t flags, uint8_t flags_start,
+                            uint8_t flags_end, uint8_t *out) {
+  blake3_hash_many_portable(inputs, num_inputs, blocks, key, counter,
+                            increment_counter, flags, flags_start, flags_end,
+                            out);
+}
+
+} /* namespace tinyblake */
+
+#endif
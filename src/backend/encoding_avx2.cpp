@@ -0,0 +1,222 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "encoding_impl.h"
+
+/*
+ * AVX2 hex / base64url kernels: the SSSE3 algorithms on two 128-bit lanes
+ * at a time, with a cross-lane permute where the output must be
+ * contiguous. The build system must pass -mavx2 (GCC/Clang) or /arch:AVX2
+ * (MSVC).
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__AVX2__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace tinyblake {
+
+namespace {
+
+inline __m256i in_range(__m256i c, char lo, char hi) {
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi8(c, _mm256_set1_epi8(static_cast<char>(lo - 1))),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), c));
+}
+
+inline __m256i hex_values(__m256i c, __m256i &bad) {
+  const __m256i lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+  const __m256i digit = in_range(c, '0', '9');
+  const __m256i alpha = in_range(lower, 'a', 'f');
+  bad = _mm256_or_si256(bad, _mm256_cmpeq_epi8(_mm256_or_si256(digit, alpha),
+                                               _mm256_setzero_si256()));
+  return _mm256_or_si256(
+      _mm256_and_si256(digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0'))),
+      _mm256_and_si256(alpha,
+                       _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+}
+
+inline __m256i base64url_values(__m256i c, __m256i &bad) {
+  const __m256i upper = in_range(c, 'A', 'Z');
+  const __m256i lower = in_range(c, 'a', 'z');
+  const __m256i digit = in_range(c, '0', '9');
+  const __m256i dash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('-'));
+  const __m256i under = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_'));
+  const __m256i any =
+      _mm256_or_si256(_mm256_or_si256(upper, lower),
+                      _mm256_or_si256(digit, _mm256_or_si256(dash, under)));
+  bad = _mm256_or_si256(bad, _mm256_cmpeq_epi8(any, _mm256_setzero_si256()));
+  __m256i v =
+      _mm256_and_si256(upper, _mm256_sub_epi8(c, _mm256_set1_epi8('A')));
+  v = _mm256_or_si256(
+      v, _mm256_and_si256(lower,
+                          _mm256_sub_epi8(c, _mm256_set1_epi8('a' - 26))));
+  v = _mm256_or_si256(
+      v, _mm256_and_si256(digit,
+                          _mm256_add_epi8(c, _mm256_set1_epi8(52 - '0'))));
+  v = _mm256_or_si256(v, _mm256_and_si256(dash, _mm256_set1_epi8(62)));
+  return _mm256_or_si256(v, _mm256_and_si256(under, _mm256_set1_epi8(63)));
+}
+
+inline void flag_error(uint8_t *err, __m256i bad) {
+  *err |= static_cast<uint8_t>(
+      0u - static_cast<uint32_t>(_mm256_movemask_epi8(bad) != 0));
+}
+
+} /* namespace */
+
+size_t hex_encode_avx2(char *out, const uint8_t *in, size_t inlen) {
+  const __m256i digits = _mm256_setr_epi8(
+      '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+      'e', 'f', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b',
+      'c', 'd', 'e', 'f');
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 32 <= inlen; i += 32) {
+    const __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+    const __m256i hi = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+    const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(x, nibble));
+    /* Lane-local interleave: bytes 0-7 | 16-23 and 8-15 | 24-31 */
+    const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i),
+                        _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i + 32),
+                        _mm256_permute2x128_si256(a, b, 0x31));
+  }
+  return i;
+}
+
+size_t hex_decode_avx2(uint8_t *out, const char *in, size_t inlen,
+                       uint8_t *err) {
+  const __m256i weights = _mm256_set1_epi16(0x0110);
+  __m256i bad = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 64 <= inlen; i += 64) {
+    const __m256i c0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+    const __m256i c1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i + 32));
+    const __m256i w0 = _mm256_maddubs_epi16(hex_values(c0, bad), weights);
+    const __m256i w1 = _mm256_maddubs_epi16(hex_values(c1, bad), weights);
+    /* packus works per lane: restore w0.lo, w0.hi, w1.lo, w1.hi order */
+    const __m256i packed = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(w0, w1), 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i / 2), packed);
+  }
+  flag_error(err, bad);
+  return i;
+}
+
+size_t base64url_encode_avx2(char *out, const uint8_t *in, size_t inlen) {
+  const __m256i spread = _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7, 8,
+      6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  const __m256i offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+  size_t i = 0, o = 0;
+  /* 24 bytes per step as two 12-byte lanes; the upper load reads to +28 */
+  for (; i + 28 <= inlen; i += 24, o += 32) {
+    const __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + 12));
+    __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    x = _mm256_shuffle_epi8(x, spread);
+    const __m256i t0 = _mm256_and_si256(x, _mm256_set1_epi32(0x0FC0FC00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(x, _mm256_set1_epi32(0x003F03F0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i idx = _mm256_or_si256(t1, t3);
+
+    __m256i cls = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+    cls = _mm256_or_si256(
+        cls, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx),
+                              _mm256_set1_epi8(13)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(out + o),
+        _mm256_add_epi8(_mm256_shuffle_epi8(offsets, cls), idx));
+  }
+  return i;
+}
+
+size_t base64url_decode_avx2(uint8_t *out, const char *in, size_t inlen,
+                             uint8_t *err) {
+  const __m256i pack = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4,
+      10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+  __m256i bad = _mm256_setzero_si256();
+  size_t i = 0, o = 0;
+  for (; i + 32 <= inlen; i += 32, o += 24) {
+    const __m256i c =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+    const __m256i v = base64url_values(c, bad);
+    const __m256i ab = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+    const __m256i abcd = _mm256_madd_epi16(ab, _mm256_set1_epi32(0x00011000));
+    /* 12 bytes at the bottom of each lane, then 24 contiguous bytes */
+    const __m256i bytes = _mm256_permutevar8x32_epi32(
+        _mm256_shuffle_epi8(abcd, pack), compact);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + o),
+                     _mm256_castsi256_si128(bytes));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out + o + 16),
+                     _mm256_extracti128_si256(bytes, 1));
+  }
+  flag_error(err, bad);
+  return i;
+}
+
+} /* namespace tinyblake */
+
+#else
+
+/* Nothing consumed: the scalar codecs handle the whole input */
+
+namespace tinyblake {
+
+size_t hex_encode_avx2(char *, const uint8_t *, size_t) { return 0; }
+
+size_t hex_decode_avx2(uint8_t *, const char *, size_t, uint8_t *) {
+  return 0;
+}
+
+size_t base64url_encode_avx2(char *, const uint8_t *, size_t) { return 0; }
+
+size_t base64url_decode_avx2(uint8_t *, const char *, size_t, uint8_t *) {
+  return 0;
+}
+
+} /* namespace tinyblake */
+
+#endif
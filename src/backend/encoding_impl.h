@@ -0,0 +1,105 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BACKEND_ENCODING_IMPL_H
+#define TINYBLAKE_BACKEND_ENCODING_IMPL_H
+
+#include "tinyblake/common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tinyblake {
+
+/*
+ * Hex and base64url (RFC 4648 section 5, unpadded) codecs.
+ *
+ * The SIMD kernels handle a whole number of vector blocks from the start of
+ * the input and return how much they consumed; the scalar routines finish
+ * the tail. Kernels keep every lookup table in registers and never branch
+ * on data, so they serve both the fast and the constant-time mode. Decoders
+ * OR 0xFF into *err for any invalid character instead of stopping early.
+ */
+
+using hex_encode_fn = size_t (*)(char *out, const uint8_t *in, size_t inlen);
+using hex_decode_fn = size_t (*)(uint8_t *out, const char *in, size_t inlen,
+                                 uint8_t *err);
+using base64url_encode_fn = size_t (*)(char *out, const uint8_t *in,
+                                       size_t inlen);
+using base64url_decode_fn = size_t (*)(uint8_t *out, const char *in,
+                                       size_t inlen, uint8_t *err);
+
+/*
+ * Scalar codecs over the whole input. With constant_time set they use
+ * masked arithmetic only (no branches or table lookups on data); otherwise
+ * 16- and 256-entry tables. Decoders require inlen to be a valid encoded
+ * length; base64url_decode_scalar also flags non-zero trailing bits.
+ */
+TINYBLAKE_API void hex_encode_scalar(char *out, const uint8_t *in, size_t inlen,
+                                     bool constant_time);
+TINYBLAKE_API void hex_decode_scalar(uint8_t *out, const char *in, size_t inlen,
+                                     uint8_t *err, bool constant_time);
+TINYBLAKE_API void base64url_encode_scalar(char *out, const uint8_t *in,
+                                           size_t inlen, bool constant_time);
+TINYBLAKE_API void base64url_decode_scalar(uint8_t *out, const char *in,
+                                           size_t inlen, uint8_t *err,
+                                           bool constant_time);
+
+/* SSSE3: 16 bytes per hex step, 12 bytes per base64url step */
+TINYBLAKE_API size_t hex_encode_ssse3(char *out, const uint8_t *in,
+                                      size_t inlen);
+TINYBLAKE_API size_t hex_decode_ssse3(uint8_t *out, const char *in,
+                                      size_t inlen, uint8_t *err);
+TINYBLAKE_API size_t base64url_encode_ssse3(char *out, const uint8_t *in,
+                                            size_t inlen);
+TINYBLAKE_API size_t base64url_decode_ssse3(uint8_t *out, const char *in,
+                                            size_t inlen, uint8_t *err);
+
+/* AVX2: 32 bytes per hex step, 24 bytes per base64url step */
+TINYBLAKE_API size_t hex_encode_avx2(char *out, const uint8_t *in,
+                                     size_t inlen);
+TINYBLAKE_API size_t hex_decode_avx2(uint8_t *out, const char *in, size_t inlen,
+                                     uint8_t *err);
+TINYBLAKE_API size_t base64url_encode_avx2(char *out, const uint8_t *in,
+                                           size_t inlen);
+TINYBLAKE_API size_t base64url_decode_avx2(uint8_t *out, const char *in,
+                                           size_t inlen, uint8_t *err);
+
+/* NEON: 16 bytes per hex step, 48 bytes per base64url step */
+TINYBLAKE_API size_t hex_encode_neon(char *out, const uint8_t *in,
+                                     size_t inlen);
+TINYBLAKE_API size_t hex_decode_neon(uint8_t *out, const char *in, size_t inlen,
+                                     uint8_t *err);
+TINYBLAKE_API size_t base64url_encode_neon(char *out, const uint8_t *in,
+                                           size_t inlen);
+TINYBLAKE_API size_t base64url_decode_neon(uint8_t *out, const char *in,
+                                           size_t inlen, uint8_t *err);
+
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_BACKEND_ENCODING_IMPL_H */
@@ -0,0 +1,188 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "encoding_impl.h"
+
+/*
+ * ARM NEON hex / base64url kernels. VLD2/VLD3/VLD4 and their stores do the
+ * (de)interleaving, so hex pairs and base64 quads land in separate
+ * registers; characters are produced and classified with compares and
+ * masks rather than table lookups, which also keeps the code valid on
+ * ARMv7 (no VQTBL).
+ */
+
+#if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+
+#include <arm_neon.h>
+
+namespace tinyblake {
+
+namespace {
+
+/* 0xFF in lanes where lo <= c <= hi */
+inline uint8x16_t in_range(uint8x16_t c, uint8_t lo, uint8_t hi) {
+  return vcleq_u8(vsubq_u8(c, vdupq_n_u8(lo)),
+                  vdupq_n_u8(static_cast<uint8_t>(hi - lo)));
+}
+
+inline uint8x16_t hex_chars(uint8x16_t nibble) {
+  const uint8x16_t letter = vcgtq_u8(nibble, vdupq_n_u8(9));
+  return vaddq_u8(vaddq_u8(nibble, vdupq_n_u8('0')),
+                  vandq_u8(letter, vdupq_n_u8('a' - '0' - 10)));
+}
+
+inline uint8x16_t hex_values(uint8x16_t c, uint8x16_t &bad) {
+  const uint8x16_t lower = vorrq_u8(c, vdupq_n_u8(0x20));
+  const uint8x16_t digit = in_range(c, '0', '9');
+  const uint8x16_t alpha = in_range(lower, 'a', 'f');
+  bad = vorrq_u8(bad, vmvnq_u8(vorrq_u8(digit, alpha)));
+  return vorrq_u8(vandq_u8(digit, vsubq_u8(c, vdupq_n_u8('0'))),
+                  vandq_u8(alpha, vsubq_u8(lower, vdupq_n_u8('a' - 10))));
+}
+
+/* A-Z, then a-z (+6), 0-9 (-75), '-' (-13), '_' (+49), modulo 256 */
+inline uint8x16_t base64url_chars(uint8x16_t i) {
+  uint8x16_t c = vaddq_u8(i, vdupq_n_u8('A'));
+  c = vaddq_u8(c, vandq_u8(vcgtq_u8(i, vdupq_n_u8(25)), vdupq_n_u8(6)));
+  c = vsubq_u8(c, vandq_u8(vcgtq_u8(i, vdupq_n_u8(51)), vdupq_n_u8(75)));
+  c = vsubq_u8(c, vandq_u8(vcgtq_u8(i, vdupq_n_u8(61)), vdupq_n_u8(13)));
+  return vaddq_u8(c, vandq_u8(vcgtq_u8(i, vdupq_n_u8(62)), vdupq_n_u8(49)));
+}
+
+inline uint8x16_t base64url_values(uint8x16_t c, uint8x16_t &bad) {
+  const uint8x16_t upper = in_range(c, 'A', 'Z');
+  const uint8x16_t lower = in_range(c, 'a', 'z');
+  const uint8x16_t digit = in_range(c, '0', '9');
+  const uint8x16_t dash = vceqq_u8(c, vdupq_n_u8('-'));
+  const uint8x16_t under = vceqq_u8(c, vdupq_n_u8('_'));
+  const uint8x16_t any = vorrq_u8(vorrq_u8(upper, lower),
+                                  vorrq_u8(digit, vorrq_u8(dash, under)));
+  bad = vorrq_u8(bad, vmvnq_u8(any));
+  uint8x16_t v = vandq_u8(upper, vsubq_u8(c, vdupq_n_u8('A')));
+  v = vorrq_u8(v, vandq_u8(lower, vsubq_u8(c, vdupq_n_u8('a' - 26))));
+  v = vorrq_u8(v, vandq_u8(digit, vaddq_u8(c, vdupq_n_u8(52 - '0'))));
+  v = vorrq_u8(v, vandq_u8(dash, vdupq_n_u8(62)));
+  return vorrq_u8(v, vandq_u8(under, vdupq_n_u8(63)));
+}
+
+inline void flag_error(uint8_t *err, uint8x16_t bad) {
+  const uint64x2_t wide = vreinterpretq_u64_u8(bad);
+  const uint64_t any = vgetq_lane_u64(wide, 0) | vgetq_lane_u64(wide, 1);
+  *err |= static_cast<uint8_t>(0u - static_cast<uint32_t>(any != 0));
+}
+
+} /* namespace */
+
+size_t hex_encode_neon(char *out, const uint8_t *in, size_t inlen) {
+  size_t i = 0;
+  for (; i + 16 <= inlen; i += 16) {
+    const uint8x16_t x = vld1q_u8(in + i);
+    uint8x16x2_t pair;
+    pair.val[0] = hex_chars(vshrq_n_u8(x, 4));
+    pair.val[1] = hex_chars(vandq_u8(x, vdupq_n_u8(0x0F)));
+    vst2q_u8(reinterpret_cast<uint8_t *>(out + 2 * i), pair);
+  }
+  return i;
+}
+
+size_t hex_decode_neon(uint8_t *out, const char *in, size_t inlen,
+                       uint8_t *err) {
+  uint8x16_t bad = vdupq_n_u8(0);
+  size_t i = 0;
+  for (; i + 32 <= inlen; i += 32) {
+    const uint8x16x2_t c = vld2q_u8(reinterpret_cast<const uint8_t *>(in + i));
+    const uint8x16_t hi = hex_values(c.val[0], bad);
+    const uint8x16_t lo = hex_values(c.val[1], bad);
+    vst1q_u8(out + i / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+  }
+  flag_error(err, bad);
+  return i;
+}
+
+size_t base64url_encode_neon(char *out, const uint8_t *in, size_t inlen) {
+  const uint8x16_t six = vdupq_n_u8(63);
+  size_t i = 0, o = 0;
+  for (; i + 48 <= inlen; i += 48, o += 64) {
+    const uint8x16x3_t x = vld3q_u8(in + i);
+    uint8x16x4_t idx;
+    idx.val[0] = vshrq_n_u8(x.val[0], 2);
+    idx.val[1] = vandq_u8(
+        vorrq_u8(vshlq_n_u8(x.val[0], 4), vshrq_n_u8(x.val[1], 4)), six);
+    idx.val[2] = vandq_u8(
+        vorrq_u8(vshlq_n_u8(x.val[1], 2), vshrq_n_u8(x.val[2], 6)), six);
+    idx.val[3] = vandq_u8(x.val[2], six);
+    for (int k = 0; k < 4; ++k)
+      idx.val[k] = base64url_chars(idx.val[k]);
+    vst4q_u8(reinterpret_cast<uint8_t *>(out + o), idx);
+  }
+  return i;
+}
+
+size_t base64url_decode_neon(uint8_t *out, const char *in, size_t inlen,
+                             uint8_t *err) {
+  uint8x16_t bad = vdupq_n_u8(0);
+  size_t i = 0, o = 0;
+  for (; i + 64 <= inlen; i += 64, o += 48) {
+    const uint8x16x4_t c = vld4q_u8(reinterpret_cast<const uint8_t *>(in + i));
+    const uint8x16_t a = base64url_values(c.val[0], bad);
+    const uint8x16_t b = base64url_values(c.val[1], bad);
+    const uint8x16_t d = base64url_values(c.val[2], bad);
+    const uint8x16_t e = base64url_values(c.val[3], bad);
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(d, 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(d, 6), e);
+    vst3q_u8(out + o, bytes);
+  }
+  flag_error(err, bad);
+  return i;
+}
+
+} /* namespace tinyblake */
+
+#else
+
+/* Nothing consumed: the scalar codecs handle the whole input */
+
+namespace tinyblake {
+
+size_t hex_encode_neon(char *, const uint8_t *, size_t) { return 0; }
+
+size_t hex_decode_neon(uint8_t *, const char *, size_t, uint8_t *) {
+  return 0;
+}
+
+size_t base64url_encode_neon(char *, const uint8_t *, size_t) { return 0; }
+
+size_t base64url_decode_neon(uint8_t *, const char *, size_t, uint8_t *) {
+  return 0;
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,213 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "encoding_impl.h"
+
+/*
+ * Scalar hex / base64url codecs. The fast mode indexes small tables by the
+ * data; the constant-time mode derives every character and value with
+ * masked arithmetic, so neither timing nor cache state depends on secret
+ * bytes. Range tests use the sign bit of a 32-bit difference, which is
+ * exact for the byte-sized operands here.
+ */
+
+namespace tinyblake {
+
+namespace {
+
+const char HEX_DIGITS[] = "0123456789abcdef";
+const char BASE64URL_DIGITS[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/* 0xFF for characters outside the alphabet */
+struct decode_table {
+  uint8_t hex[256];
+  uint8_t base64url[256];
+};
+
+constexpr decode_table make_decode_table() {
+  decode_table t{};
+  for (int c = 0; c < 256; ++c) {
+    t.hex[c] = 0xFF;
+    t.base64url[c] = 0xFF;
+  }
+  for (int i = 0; i < 10; ++i)
+    t.hex['0' + i] = static_cast<uint8_t>(i);
+  for (int i = 0; i < 6; ++i) {
+    t.hex['a' + i] = static_cast<uint8_t>(10 + i);
+    t.hex['A' + i] = static_cast<uint8_t>(10 + i);
+  }
+  for (int i = 0; i < 64; ++i)
+    t.base64url[static_cast<uint8_t>(BASE64URL_DIGITS[i])] =
+        static_cast<uint8_t>(i);
+  return t;
+}
+
+constexpr decode_table DECODE = make_decode_table();
+
+/* All ones if lo <= c <= hi, else zero */
+inline uint32_t ct_range(uint32_t c, uint32_t lo, uint32_t hi) {
+  return 0u - (((lo - 1 - c) & (c - hi - 1)) >> 31);
+}
+
+/* All ones if x > k, else zero (x, k < 2^31) */
+inline uint32_t ct_gt(uint32_t x, uint32_t k) { return 0u - ((k - x) >> 31); }
+
+inline char ct_hex_char(uint32_t nibble) {
+  return static_cast<char>(nibble + '0' +
+                           (ct_gt(nibble, 9) & ('a' - '0' - 10)));
+}
+
+/* Nibble value, with *err accumulating 0xFF for a non-hex character */
+inline uint32_t ct_hex_value(uint32_t c, uint8_t *err) {
+  const uint32_t digit = ct_range(c, '0', '9');
+  const uint32_t upper = ct_range(c, 'A', 'F');
+  const uint32_t lower = ct_range(c, 'a', 'f');
+  *err |= static_cast<uint8_t>(~(digit | upper | lower));
+  return ((c - '0') & digit) | ((c - 'A' + 10) & upper) |
+         ((c - 'a' + 10) & lower);
+}
+
+inline char ct_base64url_char(uint32_t i) {
+  /* A-Z, then a-z (+6), 0-9 (-75), '-' (-13), '_' (+49) */
+  uint32_t c = i + 'A';
+  c += ct_gt(i, 25) & 6;
+  c -= ct_gt(i, 51) & 75;
+  c -= ct_gt(i, 61) & 13;
+  c += ct_gt(i, 62) & 49;
+  return static_cast<char>(c);
+}
+
+inline uint32_t ct_base64url_value(uint32_t c, uint8_t *err) {
+  const uint32_t upper = ct_range(c, 'A', 'Z');
+  const uint32_t lower = ct_range(c, 'a', 'z');
+  const uint32_t digit = ct_range(c, '0', '9');
+  const uint32_t dash = ct_range(c, '-', '-');
+  const uint32_t under = ct_range(c, '_', '_');
+  *err |= static_cast<uint8_t>(~(upper | lower | digit | dash | under));
+  return ((c - 'A') & upper) | ((c - 'a' + 26) & lower) |
+         ((c - '0' + 52) & digit) | (62u & dash) | (63u & under);
+}
+
+inline uint32_t fast_value(const uint8_t table[256], char c, uint8_t *err) {
+  const uint8_t v = table[static_cast<uint8_t>(c)];
+  *err |= static_cast<uint8_t>(v == 0xFF ? 0xFF : 0);
+  return v;
+}
+
+} /* namespace */
+
+void hex_encode_scalar(char *out, const uint8_t *in, size_t inlen,
+                       bool constant_time) {
+  if (constant_time) {
+    for (size_t i = 0; i < inlen; ++i) {
+      out[2 * i] = ct_hex_char(in[i] >> 4u);
+      out[2 * i + 1] = ct_hex_char(in[i] & 15u);
+    }
+    return;
+  }
+  for (size_t i = 0; i < inlen; ++i) {
+    out[2 * i] = HEX_DIGITS[in[i] >> 4];
+    out[2 * i + 1] = HEX_DIGITS[in[i] & 15];
+  }
+}
+
+void hex_decode_scalar(uint8_t *out, const char *in, size_t inlen,
+                       uint8_t *err, bool constant_time) {
+  for (size_t i = 0; i + 1 < inlen; i += 2) {
+    uint32_t hi, lo;
+    if (constant_time) {
+      hi = ct_hex_value(static_cast<uint8_t>(in[i]), err);
+      lo = ct_hex_value(static_cast<uint8_t>(in[i + 1]), err);
+    } else {
+      hi = fast_value(DECODE.hex, in[i], err);
+      lo = fast_value(DECODE.hex, in[i + 1], err);
+    }
+    out[i / 2] = static_cast<uint8_t>((hi << 4) | (lo & 15u));
+  }
+}
+
+void base64url_encode_scalar(char *out, const uint8_t *in, size_t inlen,
+                             bool constant_time) {
+  auto put = [constant_time](uint32_t index) {
+    return constant_time ? ct_base64url_char(index)
+                         : BASE64URL_DIGITS[index];
+  };
+
+  size_t i = 0;
+  for (; i + 3 <= inlen; i += 3) {
+    const uint32_t w = (uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8) |
+                       in[i + 2];
+    *out++ = put(w >> 18);
+    *out++ = put((w >> 12) & 63u);
+    *out++ = put((w >> 6) & 63u);
+    *out++ = put(w & 63u);
+  }
+  if (inlen - i == 1) {
+    const uint32_t w = uint32_t{in[i]} << 16;
+    *out++ = put(w >> 18);
+    *out++ = put((w >> 12) & 63u);
+  } else if (inlen - i == 2) {
+    const uint32_t w = (uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8);
+    *out++ = put(w >> 18);
+    *out++ = put((w >> 12) & 63u);
+    *out++ = put((w >> 6) & 63u);
+  }
+}
+
+void base64url_decode_scalar(uint8_t *out, const char *in, size_t inlen,
+                             uint8_t *err, bool constant_time) {
+  auto get = [constant_time, err](char c) {
+    return constant_time ? ct_base64url_value(static_cast<uint8_t>(c), err)
+                         : fast_value(DECODE.base64url, c, err);
+  };
+
+  size_t i = 0;
+  for (; i + 4 <= inlen; i += 4) {
+    const uint32_t w = (get(in[i]) << 18) | (get(in[i + 1]) << 12) |
+                       (get(in[i + 2]) << 6) | get(in[i + 3]);
+    *out++ = static_cast<uint8_t>(w >> 16);
+    *out++ = static_cast<uint8_t>(w >> 8);
+    *out++ = static_cast<uint8_t>(w);
+  }
+  /* Unpadded tail: 2 chars -> 1 byte, 3 chars -> 2 bytes. The leftover
+   * low bits must be zero so every byte string has one encoding. */
+  if (inlen - i == 2) {
+    const uint32_t w = (get(in[i]) << 18) | (get(in[i + 1]) << 12);
+    *out++ = static_cast<uint8_t>(w >> 16);
+    *err |= static_cast<uint8_t>(0u - (((w >> 12 & 15u) + 15u) >> 4));
+  } else if (inlen - i == 3) {
+    const uint32_t w =
+        (get(in[i]) << 18) | (get(in[i + 1]) << 12) | (get(in[i + 2]) << 6);
+    *out++ = static_cast<uint8_t>(w >> 16);
+    *out++ = static_cast<uint8_t>(w >> 8);
+    *err |= static_cast<uint8_t>(0u - (((w >> 6 & 3u) + 3u) >> 2));
+  }
+}
+
+} /* namespace tinyblake */
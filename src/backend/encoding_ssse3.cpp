@@ -0,0 +1,207 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "encoding_impl.h"
+
+/*
+ * SSSE3 hex / base64url kernels. Hex digits come from a PSHUFB lookup in a
+ * register; base64url uses the multiply-shift index extraction and PSHUFB
+ * offset table of Muła and Lemire, with the '-' and '_' offsets of the URL
+ * alphabet. Decoding classifies characters with range compares and packs
+ * the 4- or 6-bit values with PMADDUBSW/PMADDWD. The build system must pass
+ * -mssse3 (GCC/Clang).
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__SSSE3__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+#include <cstring>
+
+namespace tinyblake {
+
+namespace {
+
+/* 0xFF in lanes where lo <= c <= hi (signed, so bytes >= 0x80 never match) */
+inline __m128i in_range(__m128i c, char lo, char hi) {
+  return _mm_and_si128(
+      _mm_cmpgt_epi8(c, _mm_set1_epi8(static_cast<char>(lo - 1))),
+      _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(hi + 1)), c));
+}
+
+inline __m128i hex_values(__m128i c, __m128i &bad) {
+  const __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+  const __m128i digit = in_range(c, '0', '9');
+  const __m128i alpha = in_range(lower, 'a', 'f');
+  bad = _mm_or_si128(bad, _mm_cmpeq_epi8(_mm_or_si128(digit, alpha),
+                                         _mm_setzero_si128()));
+  return _mm_or_si128(
+      _mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+      _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+inline __m128i base64url_values(__m128i c, __m128i &bad) {
+  const __m128i upper = in_range(c, 'A', 'Z');
+  const __m128i lower = in_range(c, 'a', 'z');
+  const __m128i digit = in_range(c, '0', '9');
+  const __m128i dash = _mm_cmpeq_epi8(c, _mm_set1_epi8('-'));
+  const __m128i under = _mm_cmpeq_epi8(c, _mm_set1_epi8('_'));
+  const __m128i any =
+      _mm_or_si128(_mm_or_si128(upper, lower),
+                   _mm_or_si128(digit, _mm_or_si128(dash, under)));
+  bad = _mm_or_si128(bad, _mm_cmpeq_epi8(any, _mm_setzero_si128()));
+  __m128i v = _mm_and_si128(upper, _mm_sub_epi8(c, _mm_set1_epi8('A')));
+  v = _mm_or_si128(
+      v, _mm_and_si128(lower, _mm_sub_epi8(c, _mm_set1_epi8('a' - 26))));
+  v = _mm_or_si128(
+      v, _mm_and_si128(digit, _mm_add_epi8(c, _mm_set1_epi8(52 - '0'))));
+  v = _mm_or_si128(v, _mm_and_si128(dash, _mm_set1_epi8(62)));
+  return _mm_or_si128(v, _mm_and_si128(under, _mm_set1_epi8(63)));
+}
+
+inline void flag_error(uint8_t *err, __m128i bad) {
+  *err |= static_cast<uint8_t>(0u - static_cast<uint32_t>(
+                                        _mm_movemask_epi8(bad) != 0));
+}
+
+} /* namespace */
+
+size_t hex_encode_ssse3(char *out, const uint8_t *in, size_t inlen) {
+  const __m128i digits =
+      _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a',
+                    'b', 'c', 'd', 'e', 'f');
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 16 <= inlen; i += 16) {
+    const __m128i x =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    const __m128i hi =
+        _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+    const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(x, nibble));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i),
+                     _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i + 16),
+                     _mm_unpackhi_epi8(hi, lo));
+  }
+  return i;
+}
+
+size_t hex_decode_ssse3(uint8_t *out, const char *in, size_t inlen,
+                        uint8_t *err) {
+  const __m128i weights = _mm_set1_epi16(0x0110); /* hi * 16 + lo */
+  __m128i bad = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 32 <= inlen; i += 32) {
+    const __m128i c0 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    const __m128i c1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + 16));
+    const __m128i w0 = _mm_maddubs_epi16(hex_values(c0, bad), weights);
+    const __m128i w1 = _mm_maddubs_epi16(hex_values(c1, bad), weights);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i / 2),
+                     _mm_packus_epi16(w0, w1));
+  }
+  flag_error(err, bad);
+  return i;
+}
+
+size_t base64url_encode_ssse3(char *out, const uint8_t *in, size_t inlen) {
+  const __m128i spread =
+      _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  const __m128i offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+  size_t i = 0, o = 0;
+  /* 12 bytes per step, but each load reads 16 */
+  for (; i + 16 <= inlen; i += 12, o += 16) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    x = _mm_shuffle_epi8(x, spread);
+    const __m128i t0 = _mm_and_si128(x, _mm_set1_epi32(0x0FC0FC00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(x, _mm_set1_epi32(0x003F03F0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i idx = _mm_or_si128(t1, t3);
+
+    /* 13 for A-Z, 0 for a-z, 1..10 for 0-9, 11 for '-', 12 for '_' */
+    __m128i cls = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+    cls = _mm_or_si128(cls,
+                       _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx),
+                                     _mm_set1_epi8(13)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + o),
+                     _mm_add_epi8(_mm_shuffle_epi8(offsets, cls), idx));
+  }
+  return i;
+}
+
+size_t base64url_decode_ssse3(uint8_t *out, const char *in, size_t inlen,
+                              uint8_t *err) {
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                     -1, -1, -1, -1);
+  __m128i bad = _mm_setzero_si128();
+  size_t i = 0, o = 0;
+  for (; i + 16 <= inlen; i += 16, o += 12) {
+    const __m128i c =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    const __m128i v = base64url_values(c, bad);
+    /* a * 64 + b per byte pair, then (ab) * 4096 + (cd) per word pair */
+    const __m128i ab = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+    const __m128i abcd = _mm_madd_epi16(ab, _mm_set1_epi32(0x00011000));
+    const __m128i bytes = _mm_shuffle_epi8(abcd, pack);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out + o), bytes);
+    const uint32_t tail =
+        static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(bytes, 8)));
+    std::memcpy(out + o + 8, &tail, 4);
+  }
+  flag_error(err, bad);
+  return i;
+}
+
+} /* namespace tinyblake */
+
+#else
+
+/* Nothing consumed: the scalar codecs handle the whole input */
+
+namespace tinyblake {
+
+size_t hex_encode_ssse3(char *, const uint8_t *, size_t) { return 0; }
+
+size_t hex_decode_ssse3(uint8_t *, const char *, size_t, uint8_t *) {
+  return 0;
+}
+
+size_t base64url_encode_ssse3(char *, const uint8_t *, size_t) { return 0; }
+
+size_t base64url_decode_ssse3(uint8_t *, const char *, size_t, uint8_t *) {
+  return 0;
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,90 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "lthash_combine.h"
+
+/*
+ * AVX2 LtHash16 combine: 16 lanes per VPADDW/VPSUBW, 64 iterations per
+ * 2 KiB checksum. The build system must pass -mavx2 (GCC/Clang) or
+ * /arch:AVX2 (MSVC).
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__AVX2__) || defined(__GNUC__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace tinyblake {
+
+void lthash16_add_avx2(uint8_t acc[2048], const uint8_t x[2048]) {
+  for (int i = 0; i < 2048; i += 64) {
+    __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + i));
+    __m256i a1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + i + 32));
+    __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+    __m256i b1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i),
+                        _mm256_add_epi16(a0, b0));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i + 32),
+                        _mm256_add_epi16(a1, b1));
+  }
+}
+
+void lthash16_sub_avx2(uint8_t acc[2048], const uint8_t x[2048]) {
+  for (int i = 0; i < 2048; i += 64) {
+    __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + i));
+    __m256i a1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + i + 32));
+    __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+    __m256i b1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i),
+                        _mm256_sub_epi16(a0, b0));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i + 32),
+                        _mm256_sub_epi16(a1, b1));
+  }
+}
+
+} /* namespace tinyblake */
+
+#else
+
+namespace tinyblake {
+
+void lthash16_add_avx2(uint8_t acc[2048], const uint8_t x[2048]) {
+  lthash16_add_portable(acc, x);
+}
+
+void lthash16_sub_avx2(uint8_t acc[2048], const uint8_t x[2048]) {
+  lthash16_sub_portable(acc, x);
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,57 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_BACKEND_LTHASH_COMBINE_H
+#define TINYBLAKE_BACKEND_LTHASH_COMBINE_H
+
+#include <cstdint>
+
+namespace tinyblake {
+
+/**
+ * LtHash16 combine signature shared by all backends: lane-wise addition or
+ * subtraction (mod 2^16) of 1024 little-endian uint16 lanes.
+ *
+ * @param acc  2048-byte accumulator (modified in place)
+ * @param x    2048-byte operand
+ */
+using lthash16_combine_fn = void (*)(uint8_t acc[2048], const uint8_t x[2048]);
+
+/* Backend implementations */
+void lthash16_add_portable(uint8_t acc[2048], const uint8_t x[2048]);
+void lthash16_sub_portable(uint8_t acc[2048], const uint8_t x[2048]);
+
+void lthash16_add_avx2(uint8_t acc[2048], const uint8_t x[2048]);
+void lthash16_sub_avx2(uint8_t acc[2048], const uint8_t x[2048]);
+
+void lthash16_add_neon(uint8_t acc[2048], const uint8_t x[2048]);
+void lthash16_sub_neon(uint8_t acc[2048], const uint8_t x[2048]);
+
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_BACKEND_LTHASH_COMBINE_H */
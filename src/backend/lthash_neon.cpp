@@ -0,0 +1,81 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "lthash_combine.h"
+
+/*
+ * ARM NEON LtHash16 combine: 8 lanes per VADD.I16/VSUB.I16, two vectors
+ * per iteration. Lanes are little-endian in memory, matching AArch64 and
+ * little-endian ARMv7 hosts.
+ */
+
+#if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+
+#include <arm_neon.h>
+
+namespace tinyblake {
+
+void lthash16_add_neon(uint8_t acc[2048], const uint8_t x[2048]) {
+  for (int i = 0; i < 2048; i += 32) {
+    uint16x8_t a0 = vreinterpretq_u16_u8(vld1q_u8(acc + i));
+    uint16x8_t a1 = vreinterpretq_u16_u8(vld1q_u8(acc + i + 16));
+    uint16x8_t b0 = vreinterpretq_u16_u8(vld1q_u8(x + i));
+    uint16x8_t b1 = vreinterpretq_u16_u8(vld1q_u8(x + i + 16));
+    vst1q_u8(acc + i, vreinterpretq_u8_u16(vaddq_u16(a0, b0)));
+    vst1q_u8(acc + i + 16, vreinterpretq_u8_u16(vaddq_u16(a1, b1)));
+  }
+}
+
+void lthash16_sub_neon(uint8_t acc[2048], const uint8_t x[2048]) {
+  for (int i = 0; i < 2048; i += 32) {
+    uint16x8_t a0 = vreinterpretq_u16_u8(vld1q_u8(acc + i));
+    uint16x8_t a1 = vreinterpretq_u16_u8(vld1q_u8(acc + i + 16));
+    uint16x8_t b0 = vreinterpretq_u16_u8(vld1q_u8(x + i));
+    uint16x8_t b1 = vreinterpretq_u16_u8(vld1q_u8(x + i + 16));
+    vst1q_u8(acc + i, vreinterpretq_u8_u16(vsubq_u16(a0, b0)));
+    vst1q_u8(acc + i + 16, vreinterpretq_u8_u16(vsubq_u16(a1, b1)));
+  }
+}
+
+} /* namespace tinyblake */
+
+#else
+
+namespace tinyblake {
+
+void lthash16_add_neon(uint8_t acc[2048], const uint8_t x[2048]) {
+  lthash16_add_portable(acc, x);
+}
+
+void lthash16_sub_neon(uint8_t acc[2048], const uint8_t x[2048]) {
+  lthash16_sub_portable(acc, x);
+}
+
+} /* namespace tinyblake */
+
+#endif
@@ -0,0 +1,58 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "lthash_combine.h"
+
+#include <cstddef>
+
+namespace tinyblake {
+
+/* Lanes are stored little-endian; assemble byte-wise so the loop is correct
+ * on any host and still vectorizes on little-endian targets. */
+
+void lthash16_add_portable(uint8_t acc[2048], const uint8_t x[2048]) {
+  for (size_t i = 0; i < 2048; i += 2) {
+    const unsigned a = acc[i] | (static_cast<unsigned>(acc[i + 1]) << 8);
+    const unsigned b = x[i] | (static_cast<unsigned>(x[i + 1]) << 8);
+    const unsigned s = a + b;
+    acc[i] = static_cast<uint8_t>(s);
+    acc[i + 1] = static_cast<uint8_t>(s >> 8);
+  }
+}
+
+void lthash16_sub_portable(uint8_t acc[2048], const uint8_t x[2048]) {
+  for (size_t i = 0; i < 2048; i += 2) {
+    const unsigned a = acc[i] | (static_cast<unsigned>(acc[i + 1]) << 8);
+    const unsigned b = x[i] | (static_cast<unsigned>(x[i + 1]) << 8);
+    const unsigned s = a - b;
+    acc[i] = static_cast<uint8_t>(s);
+    acc[i + 1] = static_cast<uint8_t>(s >> 8);
+  }
+}
+
+} /* namespace tinyblake */
@@ -0,0 +1,340 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/balloon.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "internal/page_arena.h"
+#include "internal/thread_pool.h"
+#include "tinyblake/blake2b.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+/*
+ * Balloon hashing. The block array lives in a page arena; every
+ * block-dependent hash (H(cnt, a, b) over 136 bytes, or H(cnt, a) over 72)
+ * is a fixed two- or one-block compression straight from the IV, with no
+ * streaming state. The index hashes H(cnt, salt, t, m, i) depend only on
+ * public values, so for each run of BALLOON_BATCH blocks they are computed
+ * up front through the multi-lane driver and reduced to block indices
+ * before the sequential mixing pass.
+ */
+
+namespace tinyblake {
+
+static const size_t BALLOON_BATCH = 64; /* blocks per index-hash batch */
+static const size_t BALLOON_IDX = BALLOON_BATCH * TINYBLAKE_BALLOON_DELTA;
+
+/* Counters consumed per block per round: one mix plus two per dependency */
+static const uint64_t BALLOON_STEP = 1 + 2 * TINYBLAKE_BALLOON_DELTA;
+
+namespace {
+
+struct balloon_scratch {
+  alignas(64) uint8_t block[256];
+  uint64_t h[8];
+
+  /* one batch of index hashes */
+  uint8_t ctr[BALLOON_IDX][8];
+  uint8_t tmi[BALLOON_IDX][24];
+  detail::blake2b_segment seg[BALLOON_IDX][3];
+  const detail::blake2b_segment *segp[BALLOON_IDX];
+  size_t nseg[BALLOON_IDX];
+  uint64_t ih[BALLOON_IDX][8];
+  uint64_t other[BALLOON_IDX];
+};
+
+/* BLAKE2b kernels for a run, resolved on the calling thread: instances of
+ * tinyblake_balloon_m() run on pool workers, which do not inherit the
+ * caller's engine */
+struct balloon_kernels {
+  const tinyblake_engine *engine;
+  blake2b_compress_fn compress;
+  const detail::blake2b_lanes_kernel *lanes;
+};
+
+balloon_kernels balloon_resolve() {
+  return {detail::blake2b_thread_engine(), detail::blake2b_get_compress(),
+          &detail::blake2b_get_lanes()};
+}
+
+/* BLAKE2b-512 chaining value for the default parameter block */
+void balloon_init(uint64_t h[8]) {
+  std::memcpy(h, detail::BLAKE2B_IV, 64);
+  h[0] ^= 0x01010040ULL; /* digest_length 64, fanout 1, depth 1 */
+}
+
+void balloon_store(uint8_t out[64], const uint64_t h[8]) {
+  for (int i = 0; i < 8; ++i) {
+    detail::store_le64(out + i * 8, h[i]);
+  }
+}
+
+/* out = H(cnt, a); out may alias a */
+void balloon_h1(uint8_t *out, uint64_t cnt, const uint8_t *a,
+                balloon_scratch &s, blake2b_compress_fn compress) {
+  detail::store_le64(s.block, cnt);
+  std::memcpy(s.block + 8, a, 64);
+  std::memset(s.block + 72, 0, 56);
+  balloon_init(s.h);
+  compress(s.h, s.block, 72, 0, true);
+  balloon_store(out, s.h);
+}
+
+/* out = H(cnt, a, b); out may alias a or b */
+void balloon_h2(uint8_t *out, uint64_t cnt, const uint8_t *a,
+                const uint8_t *b, balloon_scratch &s,
+                blake2b_compress_fn compress) {
+  detail::store_le64(s.block, cnt);
+  std::memcpy(s.block + 8, a, 64);
+  std::memcpy(s.block + 72, b, 64);
+  balloon_init(s.h);
+  compress(s.h, s.block, 128, 0, false);
+  compress(s.h, s.block + 128, 136, 0, true);
+  balloon_store(out, s.h);
+}
+
+/* Little-endian 512-bit digest modulo n (n <= 2^32), 32 bits at a time */
+uint64_t balloon_mod(const uint64_t h[8], uint64_t n) {
+  uint64_t r = 0;
+  for (int w = 7; w >= 0; --w) {
+    r = ((r << 32) | (h[w] >> 32)) % n;
+    r = ((r << 32) | (h[w] & 0xFFFFFFFFULL)) % n;
+  }
+  return r;
+}
+
+} /* namespace */
+
+/* One Balloon instance over `salt` */
+static int balloon_run(uint8_t out[64], const void *passwd, size_t passwdlen,
+                       const uint8_t *salt, size_t saltlen, uint64_t s_cost,
+                       uint64_t t_cost, const balloon_kernels &kern) {
+  /* Blocks, then the scratch: s_cost * 64 keeps it 64-byte aligned */
+  const size_t blocks_bytes = static_cast<size_t>(s_cost) * 64;
+  detail::page_arena arena(blocks_bytes + sizeof(balloon_scratch));
+  uint8_t *buf = arena.data();
+  if (!buf)
+    return -1;
+
+  balloon_scratch &s = *new (buf + blocks_bytes) balloon_scratch;
+  const blake2b_compress_fn compress = kern.compress;
+
+  /* buf[0] = H(0, passwd, salt) */
+  uint8_t zero_ctr[8] = {};
+  tinyblake_blake2b_state S;
+  if (tinyblake_blake2b_init(&S, 64) != 0 ||
+      tinyblake_blake2b_update_ex(kern.engine, &S, zero_ctr, 8) != 0 ||
+      tinyblake_blake2b_update_ex(kern.engine, &S, passwd, passwdlen) != 0 ||
+      tinyblake_blake2b_update_ex(kern.engine, &S, salt, saltlen) != 0 ||
+      tinyblake_blake2b_final_ex(kern.engine, &S, buf, 64) != 0) {
+    tinyblake_secure_zero(&S, sizeof(S));
+    return -1;
+  }
+
+  /* Expand */
+  for (uint64_t m = 1; m < s_cost; ++m) {
+    balloon_h1(buf + m * 64, m, buf + (m - 1) * 64, s, compress);
+  }
+
+  /* Mix */
+  for (uint64_t t = 0; t < t_cost; ++t) {
+    for (uint64_t m0 = 0; m0 < s_cost; m0 += BALLOON_BATCH) {
+      const size_t nb = (s_cost - m0 < BALLOON_BATCH)
+                            ? static_cast<size_t>(s_cost - m0)
+                            : BALLOON_BATCH;
+      const size_t nidx = nb * TINYBLAKE_BALLOON_DELTA;
+
+      for (size_t j = 0; j < nidx; ++j) {
+        const uint64_t m = m0 + j / TINYBLAKE_BALLOON_DELTA;
+        const uint64_t i = j % TINYBLAKE_BALLOON_DELTA;
+        const uint64_t base = s_cost + (t * s_cost + m) * BALLOON_STEP;
+        detail::store_le64(s.ctr[j], base + 1 + 2 * i);
+        detail::store_le64(s.tmi[j], t);
+        detail::store_le64(s.tmi[j] + 8, m);
+        detail::store_le64(s.tmi[j] + 16, i);
+
+        size_t k = 0;
+        s.seg[j][k++] = {s.ctr[j], 8};
+        if (saltlen > 0)
+          s.seg[j][k++] = {salt, saltlen};
+        s.seg[j][k++] = {s.tmi[j], 24};
+        s.segp[j] = s.seg[j];
+        s.nseg[j] = k;
+        balloon_init(s.ih[j]);
+      }
+      detail::blake2b_lanes_hash_segments(*kern.lanes, compress, s.ih, s.segp,
+                                          s.nseg, nidx);
+      for (size_t j = 0; j < nidx; ++j) {
+        s.other[j] = balloon_mod(s.ih[j], s_cost);
+      }
+
+      for (size_t j = 0; j < nb; ++j) {
+        const uint64_t m = m0 + j;
+        const uint64_t base = s_cost + (t * s_cost + m) * BALLOON_STEP;
+        uint8_t *cur = buf + m * 64;
+        const uint8_t *prev = buf + ((m + s_cost - 1) % s_cost) * 64;
+
+        balloon_h2(cur, base, prev, cur, s, compress);
+        for (size_t i = 0; i < TINYBLAKE_BALLOON_DELTA; ++i) {
+          const uint8_t *dep =
+              buf + s.other[j * TINYBLAKE_BALLOON_DELTA + i] * 64;
+          balloon_h2(cur, base + 2 + 2 * i, cur, dep, s, compress);
+        }
+      }
+    }
+  }
+
+  std::memcpy(out, buf + (s_cost - 1) * 64, 64);
+  return 0;
+}
+
+static bool balloon_costs_ok(uint64_t s_cost, uint64_t t_cost) {
+  if (s_cost == 0 || s_cost > (uint64_t{1} << 32) || t_cost == 0)
+    return false;
+  if (s_cost > (SIZE_MAX - sizeof(balloon_scratch)) / 64)
+    return false;
+  /* every counter must fit in 64 bits */
+  return t_cost <= (UINT64_MAX - s_cost) / (s_cost * BALLOON_STEP);
+}
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_balloon(void *out, const void *passwd, size_t passwdlen,
+                      const void *salt, size_t saltlen, uint64_t s_cost,
+                      uint64_t t_cost) {
+  if (!out || (!passwd && passwdlen > 0) || (!salt && saltlen > 0))
+    return -1;
+  if (!tinyblake::balloon_costs_ok(s_cost, t_cost))
+    return -1;
+
+  return tinyblake::balloon_run(static_cast<uint8_t *>(out), passwd,
+                                passwdlen, static_cast<const uint8_t *>(salt),
+                                saltlen, s_cost, t_cost,
+                                tinyblake::balloon_resolve());
+}
+
+int tinyblake_balloon_m(void *out, const void *passwd, size_t passwdlen,
+                        const void *salt, size_t saltlen, uint64_t s_cost,
+                        uint64_t t_cost, uint32_t p_cost, size_t threads) {
+  if (!out || (!passwd && passwdlen > 0) || (!salt && saltlen > 0))
+    return -1;
+  if (!tinyblake::balloon_costs_ok(s_cost, t_cost) || p_cost == 0)
+    return -1;
+  if (saltlen > TINYBLAKE_BALLOON_M_MAXSALT)
+    return -1;
+  if (p_cost > SIZE_MAX / 64)
+    return -1;
+
+  tinyblake::detail::page_arena results(static_cast<size_t>(p_cost) * 64);
+  if (!results.data())
+    return -1;
+  std::atomic<bool> failed{false};
+  const tinyblake::balloon_kernels kernels = tinyblake::balloon_resolve();
+
+  tinyblake::detail::thread_pool::shared().parallel_for(
+      p_cost,
+      [&](size_t p) {
+        uint8_t psalt[TINYBLAKE_BALLOON_M_MAXSALT + 8];
+        if (saltlen > 0)
+          std::memcpy(psalt, salt, saltlen);
+        tinyblake::detail::store_le64(psalt + saltlen,
+                                      static_cast<uint64_t>(p) + 1);
+        if (tinyblake::balloon_run(results.data() + p * 64, passwd, passwdlen,
+                                   psalt, saltlen + 8, s_cost, t_cost,
+                                   kernels) != 0)
+          failed.store(true);
+        tinyblake_secure_zero(psalt, saltlen + 8);
+      },
+      threads);
+
+  if (failed.load())
+    return -1;
+
+  uint8_t acc[64] = {};
+  for (size_t p = 0; p < p_cost; ++p) {
+    for (size_t i = 0; i < 64; ++i) {
+      acc[i] ^= results.data()[p * 64 + i];
+    }
+  }
+
+  tinyblake_blake2b_state S;
+  int rc = 0;
+  if (tinyblake_blake2b_init(&S, 64) != 0 ||
+      tinyblake_blake2b_update(&S, passwd, passwdlen) != 0 ||
+      tinyblake_blake2b_update(&S, salt, saltlen) != 0 ||
+      tinyblake_blake2b_update(&S, acc, 64) != 0 ||
+      tinyblake_blake2b_final(&S, out, 64) != 0) {
+    tinyblake_secure_zero(&S, sizeof(S));
+    rc = -1;
+  }
+  tinyblake_secure_zero(acc, sizeof(acc));
+  return rc;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::balloon {
+
+std::vector<uint8_t> hash(const void *passwd, size_t passwdlen,
+                          const void *salt, size_t saltlen, uint64_t s_cost,
+                          uint64_t t_cost) {
+  if (!tinyblake::balloon_costs_ok(s_cost, t_cost))
+    throw std::invalid_argument(
+        "balloon::hash: s_cost must be 1..2^32 and t_cost >= 1");
+  std::vector<uint8_t> out(OUT_BYTES);
+  if (tinyblake_balloon(out.data(), passwd, passwdlen, salt, saltlen, s_cost,
+                        t_cost) != 0)
+    throw std::runtime_error("balloon::hash failed");
+  return out;
+}
+
+std::vector<uint8_t> hash_m(const void *passwd, size_t passwdlen,
+                            const void *salt, size_t saltlen, uint64_t s_cost,
+                            uint64_t t_cost, uint32_t p_cost, size_t threads) {
+  if (!tinyblake::balloon_costs_ok(s_cost, t_cost) || p_cost == 0)
+    throw std::invalid_argument("balloon::hash_m: s_cost must be 1..2^32, "
+                                "t_cost >= 1 and p_cost >= 1");
+  if (saltlen > TINYBLAKE_BALLOON_M_MAXSALT)
+    throw std::invalid_argument("balloon::hash_m: salt too long");
+  std::vector<uint8_t> out(OUT_BYTES);
+  if (tinyblake_balloon_m(out.data(), passwd, passwdlen, salt, saltlen,
+                          s_cost, t_cost, p_cost, threads) != 0)
+    throw std::runtime_error("balloon::hash_m failed");
+  return out;
+}
+
+} /* namespace tinyblake::balloon */
@@ -26,22 +26,31 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include "internal/multiversion.h"
+
 #include "tinyblake/blake2b.h"
 #include "backend/blake2b_compress.h"
 #include "cpu_features.h"
+#include "internal/blake2b_dispatch.h"
 #include "internal/endian.h"
+#include "internal/stats.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
+#include <new>
 #include <stdexcept>
 
 namespace tinyblake {
 
+#if TINYBLAKE_MV_EMIT_SHARED
+
 /* ─── BLAKE2b IV ─── */
-static const uint64_t IV[8] = {0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL,
-                               0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL,
-                               0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
-                               0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL};
+const uint64_t detail::BLAKE2B_IV[8] = {
+    0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL, 0x3C6EF372FE94F82BULL,
+    0xA54FF53A5F1D36F1ULL, 0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+    0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL};
 
 /* ─── Dispatch (atomic function pointer, no mutex) ─── */
 
@@ -59,9 +68,15 @@ static blake2b_compress_fn resolve_compress() {
   return blake2b_compress_x64;
 #elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
     !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.neon && feat.sha3)
+    return blake2b_compress_neon_sha3;
   if (feat.neon)
     return blake2b_compress_neon;
   return blake2b_compress_portable;
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.rvv)
+    return blake2b_compress_rvv;
+  return blake2b_compress_portable;
 #else
   return blake2b_compress_portable;
 #endif
@@ -78,6 +93,370 @@ static blake2b_compress_fn get_compress() {
   return fn;
 }
 
+/* Engine installed with tinyblake_engine_set_thread_default(); null means
+ * the process-wide dispatch above. A plain thread_local, so reading it on
+ * every call costs a TLS load and no atomic. */
+static thread_local const tinyblake_engine *t_engine = nullptr;
+
+/* ─── Iterated-hash dispatch ─── */
+
+static blake2b_iterate_fn resolve_iterate() {
+#if !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+#endif
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2)
+    return blake2b_iterate_avx512;
+  if (feat.avx2)
+    return blake2b_iterate_avx2;
+  return blake2b_iterate_x64;
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.neon && feat.sha3)
+    return blake2b_iterate_neon_sha3;
+  if (feat.neon)
+    return blake2b_iterate_neon;
+  return blake2b_iterate_portable;
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.rvv)
+    return blake2b_iterate_rvv;
+  return blake2b_iterate_portable;
+#else
+  return blake2b_iterate_portable;
+#endif
+}
+
+/* ─── Multi-lane dispatch ─── */
+
+static void compress_lanes_scalar(uint64_t *const state[],
+                                  const uint8_t *const block[],
+                                  const uint64_t t0[], const uint64_t t1[],
+                                  const uint64_t f0[]) {
+  get_compress()(state[0], block[0], t0[0], t1[0], f0[0] != 0);
+}
+
+static void iterate_lanes_scalar(uint64_t *const digest[], size_t outlen,
+                                 uint64_t n) {
+  detail::blake2b_get_iterate()(digest[0], outlen, n);
+}
+
+static detail::blake2b_lanes_kernel resolve_lanes() {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2)
+    return {blake2b_compress_8way_avx512, blake2b_iterate_8way_avx512, 8,
+            blake2b_compress_8way_bcast_avx512};
+  if (feat.avx2)
+    return {blake2b_compress_4way_avx2, blake2b_iterate_4way_avx2, 4,
+            blake2b_compress_4way_bcast_avx2};
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().neon)
+    return {blake2b_compress_2way_neon, blake2b_iterate_2way_neon, 2, nullptr};
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().rvv && blake2b_rvv_lanes() > 1)
+    return {blake2b_compress_lanes_rvv, blake2b_iterate_lanes_rvv,
+            blake2b_rvv_lanes(), nullptr};
+#endif
+  return {compress_lanes_scalar, iterate_lanes_scalar, 1, nullptr};
+}
+
+/* Kernels for 32-byte-aligned chaining values (tinyblake_blake2b_state_v2);
+ * backends without an aligned form reuse the regular one */
+static blake2b_compress_fn resolve_compress_aligned() {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2)
+    return blake2b_compress_avx512_aligned;
+  if (feat.avx2)
+    return blake2b_compress_avx2_aligned;
+#endif
+  return get_compress();
+}
+
+blake2b_compress_fn detail::blake2b_get_compress() {
+  if (const tinyblake_engine *e = t_engine)
+    return e->compress;
+  return get_compress();
+}
+
+blake2b_compress_fn detail::blake2b_get_compress_aligned() {
+  if (const tinyblake_engine *e = t_engine)
+    return e->compress_aligned;
+  static const blake2b_compress_fn cached = resolve_compress_aligned();
+  return cached;
+}
+
+const detail::blake2b_lanes_kernel &detail::blake2b_get_lanes() {
+  if (const tinyblake_engine *e = t_engine)
+    return e->lanes;
+  static const blake2b_lanes_kernel cached = resolve_lanes();
+  return cached;
+}
+
+blake2b_iterate_fn detail::blake2b_get_iterate() {
+  if (const tinyblake_engine *e = t_engine)
+    return e->iterate;
+  static const blake2b_iterate_fn cached = resolve_iterate();
+  return cached;
+}
+
+const tinyblake_engine *detail::blake2b_thread_engine() { return t_engine; }
+
+void detail::blake2b_param_to_h(uint64_t h[8], const uint8_t param[64]) {
+  for (int i = 0; i < 8; ++i) {
+    h[i] = BLAKE2B_IV[i] ^ load_le64(param + i * 8);
+  }
+}
+
+/* ─── Size-class dispatch ───
+ *
+ * Calls that compress at most single_max bytes, at most small_max bytes, or
+ * more each get their own kernel. The bulk slot is g_compress itself, so
+ * every internal user of blake2b_get_compress() follows it. All classes
+ * default to resolve_compress(): measured per-call cost on AVX-512 parts
+ * favours the widest kernel even at one block, and where a CPU disagrees
+ * (frequency licences, slow vector warm-up) the TINYBLAKE_BLAKE2B_*
+ * environment variables, the setter API or tinyblake_blake2b_autotune()
+ * move the short classes elsewhere. Until one of those runs, every class
+ * uses the same kernel and the split has no effect.
+ */
+
+namespace {
+
+/* ─── Engines: one immutable kernel bundle per backend ─── */
+
+template <blake2b_compress_fn Compress>
+void compress_lanes_one(uint64_t *const state[], const uint8_t *const block[],
+                        const uint64_t t0[], const uint64_t t1[],
+                        const uint64_t f0[]) {
+  Compress(state[0], block[0], t0[0], t1[0], f0[0] != 0);
+}
+
+template <blake2b_iterate_fn Iterate>
+void iterate_lanes_one(uint64_t *const digest[], size_t outlen, uint64_t n) {
+  Iterate(digest[0], outlen, n);
+}
+
+/* Engine for a backend without a multi-lane or aligned kernel */
+template <blake2b_compress_fn Compress, blake2b_iterate_fn Iterate>
+tinyblake_engine scalar_engine(const char *name) {
+  return {name,
+          Compress,
+          Compress,
+          Iterate,
+          {compress_lanes_one<Compress>, iterate_lanes_one<Iterate>, 1,
+           nullptr}};
+}
+
+struct engine_table {
+  tinyblake_engine entries[6];
+  size_t count;
+};
+
+/* Every backend compiled in that this CPU can run, portable first */
+engine_table build_engine_table() {
+  engine_table t{};
+  t.entries[t.count++] =
+      scalar_engine<blake2b_compress_portable, blake2b_iterate_portable>(
+          "portable");
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  t.entries[t.count++] =
+      scalar_engine<blake2b_compress_x64, blake2b_iterate_x64>("x64");
+  if (feat.avx2)
+    t.entries[t.count++] = {"avx2",
+                            blake2b_compress_avx2,
+                            blake2b_compress_avx2_aligned,
+                            blake2b_iterate_avx2,
+                            {blake2b_compress_4way_avx2,
+                             blake2b_iterate_4way_avx2, 4,
+                             blake2b_compress_4way_bcast_avx2}};
+  if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2)
+    t.entries[t.count++] = {"avx512",
+                            blake2b_compress_avx512,
+                            blake2b_compress_avx512_aligned,
+                            blake2b_iterate_avx512,
+                            {blake2b_compress_8way_avx512,
+                             blake2b_iterate_8way_avx512, 8,
+                             blake2b_compress_8way_bcast_avx512}};
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  if (feat.neon)
+    t.entries[t.count++] = {"neon",
+                            blake2b_compress_neon,
+                            blake2b_compress_neon,
+                            blake2b_iterate_neon,
+                            {blake2b_compress_2way_neon,
+                             blake2b_iterate_2way_neon, 2, nullptr}};
+  if (feat.neon && feat.sha3)
+    t.entries[t.count++] = {"neon_sha3",
+                            blake2b_compress_neon_sha3,
+                            blake2b_compress_neon_sha3,
+                            blake2b_iterate_neon_sha3,
+                            {blake2b_compress_2way_neon,
+                             blake2b_iterate_2way_neon, 2, nullptr}};
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().rvv) {
+    if (blake2b_rvv_lanes() > 1)
+      t.entries[t.count++] = {"rvv",
+                              blake2b_compress_rvv,
+                              blake2b_compress_rvv,
+                              blake2b_iterate_rvv,
+                              {blake2b_compress_lanes_rvv,
+                               blake2b_iterate_lanes_rvv, blake2b_rvv_lanes(),
+                               nullptr}};
+    else
+      t.entries[t.count++] =
+          scalar_engine<blake2b_compress_rvv, blake2b_iterate_rvv>("rvv");
+  }
+#endif
+  return t;
+}
+
+const engine_table &engines() {
+  static const engine_table table = build_engine_table();
+  return table;
+}
+
+const tinyblake_engine *find_engine(const char *name) {
+  const engine_table &t = engines();
+  for (size_t i = 0; i < t.count; ++i)
+    if (std::strcmp(t.entries[i].name, name) == 0)
+      return &t.entries[i];
+  return nullptr;
+}
+
+constexpr int CLASS_COUNT = 3;
+
+std::atomic<blake2b_compress_fn> g_class[CLASS_COUNT - 1];
+std::atomic<size_t> g_single_max{128};
+std::atomic<size_t> g_small_max{4 * 128};
+
+blake2b_compress_fn class_fn(int cls) {
+  return cls == TINYBLAKE_BLAKE2B_SIZE_BULK
+             ? get_compress()
+             : g_class[cls].load(std::memory_order_acquire);
+}
+
+void store_class_fn(int cls, blake2b_compress_fn fn) {
+  if (cls == TINYBLAKE_BLAKE2B_SIZE_BULK)
+    g_compress.store(fn, std::memory_order_release);
+  else
+    g_class[cls].store(fn, std::memory_order_release);
+}
+
+const char *env_value(const char *name) {
+#if defined(_MSC_VER)
+#pragma warning(suppress : 4996)
+#endif
+  const char *v = std::getenv(name);
+  return (v && *v) ? v : nullptr;
+}
+
+/* Time `blocks` compressions with fn, best of several trials */
+double time_kernel(blake2b_compress_fn fn, size_t blocks) {
+  alignas(64) uint8_t buf[128 * 8] = {};
+  uint64_t h[8] = {};
+  const size_t reps = (2048 + blocks - 1) / blocks;
+  double best = 0;
+  for (int trial = 0; trial < 5; ++trial) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < reps; ++r)
+      for (size_t b = 0; b < blocks; ++b)
+        fn(h, buf + (b % 8) * 128, (b + 1) * 128, 0, b + 1 == blocks);
+    const double secs = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+    if (trial == 0 || secs < best)
+      best = secs;
+  }
+  return best;
+}
+
+void autotune_classes() {
+  const engine_table &t = engines();
+  const size_t small_blocks =
+      g_small_max.load(std::memory_order_relaxed) / 128;
+  const size_t blocks[CLASS_COUNT] = {1, small_blocks ? small_blocks : 1, 64};
+  for (int cls = 0; cls < CLASS_COUNT; ++cls) {
+    blake2b_compress_fn best = t.entries[0].compress;
+    double best_time = 0;
+    for (size_t i = 0; i < t.count; ++i) {
+      const double secs = time_kernel(t.entries[i].compress, blocks[cls]);
+      if (i == 0 || secs < best_time) {
+        best = t.entries[i].compress;
+        best_time = secs;
+      }
+    }
+    store_class_fn(cls, best);
+  }
+}
+
+size_t env_size(const char *name, size_t fallback) {
+  const char *v = env_value(name);
+  if (!v)
+    return fallback;
+  char *end = nullptr;
+  const unsigned long long n = std::strtoull(v, &end, 10);
+  return (end && *end == '\0') ? static_cast<size_t>(n) : fallback;
+}
+
+bool init_size_classes() {
+  const blake2b_compress_fn small = resolve_compress();
+  g_class[TINYBLAKE_BLAKE2B_SIZE_SINGLE].store(small);
+  g_class[TINYBLAKE_BLAKE2B_SIZE_SMALL].store(small);
+
+  const size_t single_max = env_size("TINYBLAKE_BLAKE2B_SINGLE_MAX", 128);
+  const size_t small_max = env_size("TINYBLAKE_BLAKE2B_SMALL_MAX", 4 * 128);
+  if (single_max <= small_max) {
+    g_single_max.store(single_max);
+    g_small_max.store(small_max);
+  }
+
+  const char *tune = env_value("TINYBLAKE_BLAKE2B_AUTOTUNE");
+  if (tune && std::strcmp(tune, "0") != 0)
+    autotune_classes();
+
+  static const char *const ENV_KERNEL[CLASS_COUNT] = {
+      "TINYBLAKE_BLAKE2B_KERNEL_SINGLE", "TINYBLAKE_BLAKE2B_KERNEL_SMALL",
+      "TINYBLAKE_BLAKE2B_KERNEL_BULK"};
+  for (int cls = 0; cls < CLASS_COUNT; ++cls) {
+    const char *name = env_value(ENV_KERNEL[cls]);
+    if (const tinyblake_engine *k = name ? find_engine(name) : nullptr)
+      store_class_fn(cls, k->compress);
+  }
+  return true;
+}
+
+void ensure_size_classes() {
+  static const bool ready = init_size_classes();
+  (void)ready;
+}
+
+} /* namespace */
+
+blake2b_compress_fn detail::blake2b_select_compress(size_t nbytes) {
+  if (const tinyblake_engine *e = t_engine)
+    return e->compress;
+  ensure_size_classes();
+  if (nbytes <= g_single_max.load(std::memory_order_relaxed))
+    return g_class[TINYBLAKE_BLAKE2B_SIZE_SINGLE].load(
+        std::memory_order_acquire);
+  if (nbytes <= g_small_max.load(std::memory_order_relaxed))
+    return g_class[TINYBLAKE_BLAKE2B_SIZE_SMALL].load(
+        std::memory_order_acquire);
+  return get_compress();
+}
+
+#endif /* TINYBLAKE_MV_EMIT_SHARED */
+
 /* ─── Parameter block helpers ─── */
 
 static void build_default_param(uint8_t param[64], uint8_t outlen,
@@ -97,46 +476,39 @@ static int init_from_param(tinyblake_blake2b_state *S,
 
   std::memset(S, 0, sizeof(*S));
   S->outlen = param[0];
-
-  for (int i = 0; i < 8; ++i) {
-    S->h[i] = IV[i] ^ detail::load_le64(param + i * 8);
-  }
+  detail::blake2b_param_to_h(S->h, param);
   return 0;
 }
 
-/* ─── Incremental compress helper ─── */
-
-static void compress_block(tinyblake_blake2b_state *S, const uint8_t block[128],
-                           bool last) {
-  get_compress()(S->h, block, S->t[0], S->t[1], last);
-}
-
-/* ─── C API ─── */
+#if TINYBLAKE_MV_EMIT_C_API
 
-} /* namespace tinyblake */
-
-extern "C" {
-
-int tinyblake_blake2b_init(tinyblake_blake2b_state *state, size_t outlen) {
-  if (!state || outlen == 0 || outlen > 64)
+static int init_from_param(tinyblake_blake2b_state_v2 *S,
+                           const uint8_t param[64]) {
+  if (param[0] == 0 || param[0] > 64)
     return -1;
 
-  uint8_t param[64];
-  tinyblake::build_default_param(param, static_cast<uint8_t>(outlen), 0);
-  return tinyblake::init_from_param(state, param);
+  std::memset(S, 0, sizeof(*S));
+  S->outlen = param[0];
+  S->version = TINYBLAKE_BLAKE2B_STATE_V2;
+  detail::blake2b_param_to_h(S->h, param);
+  return 0;
 }
 
-int tinyblake_blake2b_init_key(tinyblake_blake2b_state *state, size_t outlen,
-                               const void *key, size_t keylen) {
+/* ─── Incremental hashing, shared by both state layouts ─── */
+
+template <typename State>
+static int init_key(State *state, size_t outlen, const void *key,
+                    size_t keylen,
+                    int (*update)(State *, const void *, size_t)) {
   if (!state || outlen == 0 || outlen > 64)
     return -1;
   if (!key || keylen == 0 || keylen > 64)
     return -1;
 
   uint8_t param[64];
-  tinyblake::build_default_param(param, static_cast<uint8_t>(outlen),
-                                 static_cast<uint8_t>(keylen));
-  if (tinyblake::init_from_param(state, param) != 0)
+  build_default_param(param, static_cast<uint8_t>(outlen),
+                      static_cast<uint8_t>(keylen));
+  if (init_from_param(state, param) != 0)
     return -1;
 
   /* Pad key to block size and feed through update.
@@ -146,23 +518,15 @@ int tinyblake_blake2b_init_key(tinyblake_blake2b_state *state, size_t outlen,
   std::memset(block, 0, 128);
   std::memcpy(block, key, keylen);
 
-  tinyblake_blake2b_update(state, block, 128);
+  update(state, block, 128);
 
   tinyblake_secure_zero(block, 128);
   return 0;
 }
 
-int tinyblake_blake2b_init_param(tinyblake_blake2b_state *state,
-                                 const uint8_t param[64]) {
-  if (!state || !param)
-    return -1;
-  return tinyblake::init_from_param(state, param);
-}
-
-int tinyblake_blake2b_update(tinyblake_blake2b_state *state, const void *in,
-                             size_t inlen) {
-  if (!state)
-    return -1;
+template <typename State>
+static int update_state(State *state, blake2b_compress_fn compress,
+                        const void *in, size_t inlen) {
   if (state->buflen > 128)
     return -1;
   if (inlen == 0)
@@ -181,7 +545,7 @@ int tinyblake_blake2b_update(tinyblake_blake2b_state *state, const void *in,
       state->t[0] += 128;
       if (state->t[0] < 128)
         state->t[1]++;
-      tinyblake::compress_block(state, state->buf, false);
+      compress(state->h, state->buf, state->t[0], state->t[1], false);
       state->buflen = 0;
       pin += left;
       inlen -= left;
@@ -197,7 +561,7 @@ int tinyblake_blake2b_update(tinyblake_blake2b_state *state, const void *in,
     state->t[0] += 128;
     if (state->t[0] < 128)
       state->t[1]++;
-    tinyblake::compress_block(state, pin, false);
+    compress(state->h, pin, state->t[0], state->t[1], false);
     pin += 128;
     inlen -= 128;
   }
@@ -211,10 +575,16 @@ int tinyblake_blake2b_update(tinyblake_blake2b_state *state, const void *in,
   return 0;
 }
 
-int tinyblake_blake2b_final(tinyblake_blake2b_state *state, void *out,
-                            size_t outlen) {
-  if (!state || !out)
-    return -1;
+/* Only the v1 layout carries the tree-hashing last-node flag */
+static bool is_last_node(const tinyblake_blake2b_state *state) {
+  return state->last_node != 0;
+}
+
+static bool is_last_node(const tinyblake_blake2b_state_v2 *) { return false; }
+
+template <typename State>
+static int final_state(State *state, blake2b_compress_fn compress, void *out,
+                       size_t outlen) {
   if (outlen < state->outlen)
     return -1;
 
@@ -228,12 +598,17 @@ int tinyblake_blake2b_final(tinyblake_blake2b_state *state, void *out,
     std::memset(state->buf + state->buflen, 0, 128 - state->buflen);
   }
 
-  tinyblake::compress_block(state, state->buf, true);
+  if (is_last_node(state)) {
+    blake2b_compress_portable_last_node(state->h, state->buf, state->t[0],
+                                        state->t[1]);
+  } else {
+    compress(state->h, state->buf, state->t[0], state->t[1], true);
+  }
 
   /* Store output (little-endian) */
   uint8_t buffer[64];
   for (int i = 0; i < 8; ++i) {
-    tinyblake::detail::store_le64(buffer + i * 8, state->h[i]);
+    detail::store_le64(buffer + i * 8, state->h[i]);
   }
   std::memcpy(out, buffer, state->outlen);
   tinyblake_secure_zero(buffer, 64);
@@ -242,8 +617,83 @@ int tinyblake_blake2b_final(tinyblake_blake2b_state *state, void *out,
   return 0;
 }
 
+/* Kernel for a v1 call compressing about `nbytes` bytes: the explicit
+ * engine's, else the thread default's, else the size-class choice */
+static blake2b_compress_fn engine_compress(const tinyblake_engine *engine,
+                                           size_t nbytes) {
+  return engine ? engine->compress : detail::blake2b_select_compress(nbytes);
+}
+
+#endif /* TINYBLAKE_MV_EMIT_C_API */
+
+/* ─── C API ─── */
+
+} /* namespace tinyblake */
+
+#if TINYBLAKE_MV_EMIT_C_API
+
+extern "C" {
+
+int tinyblake_blake2b_init(tinyblake_blake2b_state *state, size_t outlen) {
+  if (!state || outlen == 0 || outlen > 64)
+    return -1;
+
+  uint8_t param[64];
+  tinyblake::build_default_param(param, static_cast<uint8_t>(outlen), 0);
+  return tinyblake::init_from_param(state, param);
+}
+
+int tinyblake_blake2b_init_key(tinyblake_blake2b_state *state, size_t outlen,
+                               const void *key, size_t keylen) {
+  return tinyblake::init_key(state, outlen, key, keylen,
+                             tinyblake_blake2b_update);
+}
+
+int tinyblake_blake2b_init_param(tinyblake_blake2b_state *state,
+                                 const uint8_t param[64]) {
+  if (!state || !param)
+    return -1;
+  return tinyblake::init_from_param(state, param);
+}
+
+int tinyblake_blake2b_update(tinyblake_blake2b_state *state, const void *in,
+                             size_t inlen) {
+  return tinyblake_blake2b_update_ex(nullptr, state, in, inlen);
+}
+
+int tinyblake_blake2b_final(tinyblake_blake2b_state *state, void *out,
+                            size_t outlen) {
+  return tinyblake_blake2b_final_ex(nullptr, state, out, outlen);
+}
+
 int tinyblake_blake2b(void *out, size_t outlen, const void *in, size_t inlen,
                       const void *key, size_t keylen) {
+  return tinyblake_blake2b_ex(nullptr, out, outlen, in, inlen, key, keylen);
+}
+
+int tinyblake_blake2b_update_ex(const tinyblake_engine *engine,
+                                tinyblake_blake2b_state *state, const void *in,
+                                size_t inlen) {
+  if (!state)
+    return -1;
+  return tinyblake::update_state(
+      state, tinyblake::engine_compress(engine, state->buflen + inlen), in,
+      inlen);
+}
+
+int tinyblake_blake2b_final_ex(const tinyblake_engine *engine,
+                               tinyblake_blake2b_state *state, void *out,
+                               size_t outlen) {
+  if (!state || !out)
+    return -1;
+  return tinyblake::final_state(
+      state, tinyblake::engine_compress(engine, state->buflen), out, outlen);
+}
+
+int tinyblake_blake2b_ex(const tinyblake_engine *engine, void *out,
+                         size_t outlen, const void *in, size_t inlen,
+                         const void *key, size_t keylen) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_BLAKE2B);
   tinyblake_blake2b_state S;
   int rc;
 
@@ -255,11 +705,170 @@ int tinyblake_blake2b(void *out, size_t outlen, const void *in, size_t inlen,
   if (rc != 0)
     return rc;
 
-  rc = tinyblake_blake2b_update(&S, in, inlen);
-  if (rc != 0)
-    return rc;
+  /* One kernel for the whole message, chosen by its total size */
+  const tinyblake::blake2b_compress_fn compress =
+      tinyblake::engine_compress(engine, S.buflen + inlen);
+  rc = tinyblake::update_state(&S, compress, in, inlen);
+  if (rc == 0)
+    rc = tinyblake::final_state(&S, compress, out, outlen);
+  tinyblake_secure_zero(&S, sizeof(S));
+  return rc;
+}
+
+/* ─── v2 (cache-line-aligned) state ─── */
 
-  return tinyblake_blake2b_final(&S, out, outlen);
+int tinyblake_blake2b_init_v2(tinyblake_blake2b_state_v2 *state,
+                              size_t outlen) {
+  if (!state || outlen == 0 || outlen > 64)
+    return -1;
+
+  uint8_t param[64];
+  tinyblake::build_default_param(param, static_cast<uint8_t>(outlen), 0);
+  return tinyblake::init_from_param(state, param);
+}
+
+int tinyblake_blake2b_init_key_v2(tinyblake_blake2b_state_v2 *state,
+                                  size_t outlen, const void *key,
+                                  size_t keylen) {
+  return tinyblake::init_key(state, outlen, key, keylen,
+                             tinyblake_blake2b_update_v2);
+}
+
+int tinyblake_blake2b_init_param_v2(tinyblake_blake2b_state_v2 *state,
+                                    const uint8_t param[64]) {
+  if (!state || !param)
+    return -1;
+  return tinyblake::init_from_param(state, param);
+}
+
+int tinyblake_blake2b_update_v2(tinyblake_blake2b_state_v2 *state,
+                                const void *in, size_t inlen) {
+  if (!state || state->version != TINYBLAKE_BLAKE2B_STATE_V2)
+    return -1;
+  return tinyblake::update_state(
+      state, tinyblake::detail::blake2b_get_compress_aligned(), in, inlen);
+}
+
+int tinyblake_blake2b_final_v2(tinyblake_blake2b_state_v2 *state, void *out,
+                               size_t outlen) {
+  if (!state || !out || state->version != TINYBLAKE_BLAKE2B_STATE_V2)
+    return -1;
+  return tinyblake::final_state(
+      state, tinyblake::detail::blake2b_get_compress_aligned(), out, outlen);
+}
+
+} /* extern "C" */
+
+#endif /* TINYBLAKE_MV_EMIT_C_API */
+
+#if TINYBLAKE_MV_EMIT_SHARED
+
+/* ─── Arrays of v2 states ─── */
+
+static_assert(alignof(tinyblake_blake2b_state_v2) == 64 &&
+                  sizeof(tinyblake_blake2b_state_v2) % 64 == 0,
+              "v2 states must tile whole cache lines");
+
+extern "C" {
+
+tinyblake_blake2b_state_v2 *tinyblake_blake2b_state_array_alloc(size_t count) {
+  if (count == 0)
+    return nullptr;
+  /* C++17 aligned new honours the 64-byte alignment of the element type */
+  auto *states = new (std::nothrow) tinyblake_blake2b_state_v2[count];
+  if (states)
+    std::memset(states, 0, count * sizeof(*states));
+  return states;
+}
+
+void tinyblake_blake2b_state_array_free(tinyblake_blake2b_state_v2 *states,
+                                        size_t count) {
+  if (!states)
+    return;
+  tinyblake_secure_zero(states, count * sizeof(*states));
+  delete[] states;
+}
+
+/* ─── Size-class configuration ─── */
+
+int tinyblake_blake2b_set_kernel(int size_class, const char *name) {
+  if (size_class < 0 || size_class >= tinyblake::CLASS_COUNT || !name)
+    return -1;
+  tinyblake::ensure_size_classes();
+  if (std::strcmp(name, "auto") == 0) {
+    tinyblake::store_class_fn(size_class, tinyblake::resolve_compress());
+    return 0;
+  }
+  const tinyblake_engine *k = tinyblake::find_engine(name);
+  if (!k)
+    return -1;
+  tinyblake::store_class_fn(size_class, k->compress);
+  return 0;
+}
+
+const char *tinyblake_blake2b_get_kernel(int size_class) {
+  if (size_class < 0 || size_class >= tinyblake::CLASS_COUNT)
+    return nullptr;
+  tinyblake::ensure_size_classes();
+  const tinyblake::blake2b_compress_fn fn = tinyblake::class_fn(size_class);
+  const tinyblake::engine_table &t = tinyblake::engines();
+  for (size_t i = 0; i < t.count; ++i)
+    if (t.entries[i].compress == fn)
+      return t.entries[i].name;
+  return nullptr;
+}
+
+int tinyblake_blake2b_set_thresholds(size_t single_max, size_t small_max) {
+  if (single_max > small_max)
+    return -1;
+  tinyblake::ensure_size_classes();
+  /* Readers may briefly see one new and one old bound; either pairing
+   * still picks a valid kernel */
+  tinyblake::g_single_max.store(single_max, std::memory_order_relaxed);
+  tinyblake::g_small_max.store(small_max, std::memory_order_relaxed);
+  return 0;
+}
+
+void tinyblake_blake2b_get_thresholds(size_t *single_max, size_t *small_max) {
+  tinyblake::ensure_size_classes();
+  if (single_max)
+    *single_max = tinyblake::g_single_max.load(std::memory_order_relaxed);
+  if (small_max)
+    *small_max = tinyblake::g_small_max.load(std::memory_order_relaxed);
+}
+
+int tinyblake_blake2b_autotune(void) {
+  tinyblake::ensure_size_classes();
+  tinyblake::autotune_classes();
+  return 0;
+}
+
+/* ─── Engines ─── */
+
+const tinyblake_engine *tinyblake_engine_get(const char *name) {
+  if (!name)
+    return nullptr;
+  if (std::strcmp(name, "auto") == 0) {
+    const tinyblake::blake2b_compress_fn best = tinyblake::resolve_compress();
+    const tinyblake::engine_table &t = tinyblake::engines();
+    for (size_t i = 0; i < t.count; ++i)
+      if (t.entries[i].compress == best)
+        return &t.entries[i];
+    return &t.entries[0];
+  }
+  return tinyblake::find_engine(name);
+}
+
+const char *tinyblake_engine_name(const tinyblake_engine *engine) {
+  return engine ? engine->name : nullptr;
+}
+
+void tinyblake_engine_set_thread_default(const tinyblake_engine *engine) {
+  tinyblake::t_engine = engine;
+}
+
+const tinyblake_engine *tinyblake_engine_thread_default(void) {
+  return tinyblake::t_engine;
 }
 
 } /* extern "C" */
@@ -268,6 +877,20 @@ int tinyblake_blake2b(void *out, size_t outlen, const void *in, size_t inlen,
 
 namespace tinyblake::blake2b {
 
+engine::engine(const char *name) : engine_(tinyblake_engine_get(name)) {
+  if (!engine_)
+    throw std::invalid_argument("Blake2b: engine backend unavailable");
+}
+
+engine::thread_scope::thread_scope(const engine &e)
+    : previous_(tinyblake_engine_thread_default()) {
+  tinyblake_engine_set_thread_default(e.get());
+}
+
+engine::thread_scope::~thread_scope() {
+  tinyblake_engine_set_thread_default(previous_);
+}
+
 hasher::hasher(size_t outlen) : keyed_(false) {
   if (outlen == 0 || outlen > 64)
     throw std::invalid_argument("Blake2b: outlen must be 1..64");
@@ -309,7 +932,8 @@ hasher::~hasher() {
   tinyblake_secure_zero(key_block_, sizeof(key_block_));
 }
 
-hasher::hasher(hasher &&o) noexcept : state_(o.state_), keyed_(o.keyed_) {
+hasher::hasher(hasher &&o) noexcept
+    : state_(o.state_), keyed_(o.keyed_), engine_(o.engine_) {
   std::memcpy(param_, o.param_, 64);
   std::memcpy(key_block_, o.key_block_, 128);
   tinyblake_secure_zero(&o.state_, sizeof(o.state_));
@@ -322,6 +946,7 @@ hasher &hasher::operator=(hasher &&o) noexcept {
     tinyblake_secure_zero(key_block_, 128);
     state_ = o.state_;
     keyed_ = o.keyed_;
+    engine_ = o.engine_;
     std::memcpy(param_, o.param_, 64);
     std::memcpy(key_block_, o.key_block_, 128);
     tinyblake_secure_zero(&o.state_, sizeof(o.state_));
@@ -331,7 +956,7 @@ hasher &hasher::operator=(hasher &&o) noexcept {
 }
 
 void hasher::update(const void *data, size_t len) {
-  if (tinyblake_blake2b_update(&state_, data, len) != 0)
+  if (tinyblake_blake2b_update_ex(engine_, &state_, data, len) != 0)
     throw std::runtime_error("Blake2b::update failed");
 }
 
@@ -345,13 +970,14 @@ void hasher::update(const std::string &data) {
 
 std::vector<uint8_t> hasher::final_() {
   std::vector<uint8_t> out(state_.outlen);
-  if (tinyblake_blake2b_final(&state_, out.data(), out.size()) != 0)
+  if (tinyblake_blake2b_final_ex(engine_, &state_, out.data(), out.size()) !=
+      0)
     throw std::runtime_error("Blake2b::final_ failed");
   return out;
 }
 
 void hasher::final_(void *out, size_t outlen) {
-  if (tinyblake_blake2b_final(&state_, out, outlen) != 0)
+  if (tinyblake_blake2b_final_ex(engine_, &state_, out, outlen) != 0)
     throw std::runtime_error("Blake2b::final_ failed");
 }
 
@@ -364,6 +990,35 @@ void hasher::reset() {
   }
 }
 
+state_array::state_array(size_t count) : states_(nullptr), count_(count) {
+  if (count == 0)
+    throw std::invalid_argument("Blake2b: state_array count must be > 0");
+  states_ = tinyblake_blake2b_state_array_alloc(count);
+  if (!states_)
+    throw std::bad_alloc();
+}
+
+state_array::~state_array() {
+  tinyblake_blake2b_state_array_free(states_, count_);
+}
+
+state_array::state_array(state_array &&other) noexcept
+    : states_(other.states_), count_(other.count_) {
+  other.states_ = nullptr;
+  other.count_ = 0;
+}
+
+state_array &state_array::operator=(state_array &&other) noexcept {
+  if (this != &other) {
+    tinyblake_blake2b_state_array_free(states_, count_);
+    states_ = other.states_;
+    count_ = other.count_;
+    other.states_ = nullptr;
+    other.count_ = 0;
+  }
+  return *this;
+}
+
 std::vector<uint8_t> hash(const void *data, size_t len, size_t outlen) {
   std::vector<uint8_t> out(outlen);
   if (tinyblake_blake2b(out.data(), outlen, data, len, nullptr, 0) != 0)
@@ -375,6 +1030,15 @@ std::vector<uint8_t> hash(const std::vector<uint8_t> &data, size_t outlen) {
   return hash(data.data(), data.size(), outlen);
 }
 
+std::vector<uint8_t> hash(const engine &e, const void *data, size_t len,
+                          size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake2b_ex(e.get(), out.data(), outlen, data, len, nullptr,
+                           0) != 0)
+    throw std::runtime_error("tinyblake::blake2b::hash failed");
+  return out;
+}
+
 std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
                                 const void *data, size_t datalen,
                                 size_t outlen) {
@@ -384,4 +1048,6 @@ std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
   return out;
 }
 
-} /* namespace tinyblake::blake2b */
\ No newline at end of file
+} /* namespace tinyblake::blake2b */
+
+#endif /* TINYBLAKE_MV_EMIT_SHARED */
\ No newline at end of file
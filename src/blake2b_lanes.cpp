@@ -0,0 +1,358 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "internal/stats.h"
+#include "tinyblake/blake2b.h"
+#include "tinyblake/common.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * Multi-lane driver: runs groups of independent BLAKE2b computations through
+ * the widest available lane kernel. Each lane walks its own list of input
+ * segments; a block that lies entirely inside one segment is passed to the
+ * kernel in place, anything else (segment boundaries, the final partial
+ * block) is gathered into a zero-padded staging buffer. Steps where only one
+ * lane is still active fall back to the single-block kernel so a long
+ * straggler doesn't pay for idle lanes.
+ */
+
+namespace tinyblake {
+namespace detail {
+
+namespace {
+
+struct lane_cursor {
+  size_t seg;
+  size_t off;
+};
+
+void skip_empty(lane_cursor &c, const blake2b_segment *segs, size_t nsegs) {
+  while (c.seg < nsegs && c.off == segs[c.seg].len) {
+    ++c.seg;
+    c.off = 0;
+  }
+}
+
+/* Next `need` bytes of the lane's input, in place when possible. */
+const uint8_t *next_block(lane_cursor &c, const blake2b_segment *segs,
+                          size_t nsegs, size_t need, uint8_t stage[128]) {
+  skip_empty(c, segs, nsegs);
+  if (need == 128 && c.seg < nsegs && segs[c.seg].len - c.off >= 128) {
+    const uint8_t *p = segs[c.seg].ptr + c.off;
+    c.off += 128;
+    return p;
+  }
+
+  std::memset(stage, 0, 128);
+  size_t copied = 0;
+  while (copied < need) {
+    skip_empty(c, segs, nsegs);
+    const size_t avail = segs[c.seg].len - c.off;
+    const size_t take = (need - copied) < avail ? (need - copied) : avail;
+    std::memcpy(stage + copied, segs[c.seg].ptr + c.off, take);
+    c.off += take;
+    copied += take;
+  }
+  return stage;
+}
+
+} /* namespace */
+
+void blake2b_lanes_hash_segments(uint64_t (*h)[8],
+                                 const blake2b_segment *const segs[],
+                                 const size_t nsegs[], size_t n) {
+  blake2b_lanes_hash_segments(blake2b_get_lanes(), blake2b_get_compress(), h,
+                              segs, nsegs, n);
+}
+
+void blake2b_lanes_hash_segments(const blake2b_lanes_kernel &kernel,
+                                 blake2b_compress_fn single,
+                                 uint64_t (*h)[8],
+                                 const blake2b_segment *const segs[],
+                                 const size_t nsegs[], size_t n) {
+  blake2b_lanes_absorb_segments(kernel, single, h, nullptr, segs, nsegs, n,
+                                nullptr, nullptr);
+}
+
+void blake2b_lanes_absorb_segments(const blake2b_lanes_kernel &kernel,
+                                   blake2b_compress_fn single,
+                                   uint64_t (*h)[8], uint64_t t[],
+                                   const blake2b_segment *const segs[],
+                                   const size_t nsegs[], size_t n,
+                                   uint8_t (*tail)[128], size_t tail_len[]) {
+  const size_t lanes = kernel.lanes;
+  const bool final = (tail == nullptr);
+
+  alignas(64) uint8_t stage[BLAKE2B_MAX_LANES][128];
+  alignas(64) static const uint8_t zero_block[128] = {};
+  uint64_t idle_h[8] = {};
+
+  for (size_t base = 0; base < n; base += lanes) {
+    const size_t count = (n - base) < lanes ? (n - base) : lanes;
+
+    uint64_t total[BLAKE2B_MAX_LANES];
+    uint64_t nblocks[BLAKE2B_MAX_LANES];
+    uint64_t t_base[BLAKE2B_MAX_LANES];
+    lane_cursor cursor[BLAKE2B_MAX_LANES];
+    uint64_t steps = 0;
+    for (size_t l = 0; l < count; ++l) {
+      total[l] = 0;
+      for (size_t s = 0; s < nsegs[base + l]; ++s)
+        total[l] += segs[base + l][s].len;
+      /* Unless finalizing, the last 1..128 bytes stay behind: BLAKE2b
+       * must not compress a block before knowing whether it is the last. */
+      if (final)
+        nblocks[l] = total[l] == 0 ? 1 : (total[l] + 127) / 128;
+      else
+        nblocks[l] = total[l] == 0 ? 0 : (total[l] - 1) / 128;
+      t_base[l] = t ? t[base + l] : 0;
+      cursor[l] = {0, 0};
+      if (nblocks[l] > steps)
+        steps = nblocks[l];
+    }
+
+    for (uint64_t k = 0; k < steps; ++k) {
+      uint64_t *state[BLAKE2B_MAX_LANES];
+      const uint8_t *block[BLAKE2B_MAX_LANES];
+      uint64_t t0[BLAKE2B_MAX_LANES];
+      uint64_t t1[BLAKE2B_MAX_LANES];
+      uint64_t f0[BLAKE2B_MAX_LANES];
+      size_t active = 0;
+      size_t last_active = 0;
+
+      for (size_t l = 0; l < lanes; ++l) {
+        t1[l] = 0;
+        if (l >= count || k >= nblocks[l]) {
+          state[l] = idle_h;
+          block[l] = zero_block;
+          t0[l] = 0;
+          f0[l] = 0;
+          continue;
+        }
+
+        const uint64_t off = k * 128;
+        const bool last = final && (k + 1 == nblocks[l]);
+        const size_t need = last ? static_cast<size_t>(total[l] - off) : 128;
+        state[l] = h[base + l];
+        block[l] = next_block(cursor[l], segs[base + l], nsegs[base + l],
+                              need, stage[l]);
+        t0[l] = t_base[l] + (last ? total[l] : off + 128);
+        f0[l] = last ? ~uint64_t{0} : 0;
+        ++active;
+        last_active = l;
+      }
+
+      if (active == 1) {
+        single(state[last_active], block[last_active], t0[last_active], 0,
+               f0[last_active] != 0);
+      } else {
+        kernel.fn(state, block, t0, t1, f0);
+      }
+    }
+
+    if (final)
+      continue;
+    for (size_t l = 0; l < count; ++l) {
+      const uint64_t done = nblocks[l] * 128;
+      const size_t rest = static_cast<size_t>(total[l] - done);
+      /* The held-back bytes may start inside tail[] itself when nothing
+       * was compressed, hence memmove. */
+      if (rest > 0)
+        std::memmove(tail[base + l],
+                     next_block(cursor[l], segs[base + l], nsegs[base + l],
+                                rest, stage[l]),
+                     rest);
+      tail_len[base + l] = rest;
+      if (t)
+        t[base + l] += done;
+    }
+  }
+
+  tinyblake_secure_zero(stage, sizeof(stage));
+  tinyblake_secure_zero(idle_h, sizeof(idle_h));
+}
+
+void blake2b_lanes_hash(uint64_t (*h)[8], const uint8_t *prefix,
+                        const uint8_t *const in[], const size_t inlen[],
+                        size_t n) {
+  blake2b_segment seg[BLAKE2B_MAX_LANES][2];
+  const blake2b_segment *segs[BLAKE2B_MAX_LANES];
+  size_t nsegs[BLAKE2B_MAX_LANES];
+
+  for (size_t base = 0; base < n; base += BLAKE2B_MAX_LANES) {
+    const size_t count =
+        (n - base) < BLAKE2B_MAX_LANES ? (n - base) : BLAKE2B_MAX_LANES;
+    for (size_t l = 0; l < count; ++l) {
+      size_t k = 0;
+      if (prefix)
+        seg[l][k++] = {prefix, 128};
+      seg[l][k++] = {in[base + l], inlen[base + l]};
+      segs[l] = seg[l];
+      nsegs[l] = k;
+    }
+    blake2b_lanes_hash_segments(h + base, segs, nsegs, count);
+  }
+}
+
+void blake2b_lanes_hash_shared(uint64_t (*h)[8], uint64_t t,
+                               const uint8_t *in, size_t inlen, size_t n) {
+  const blake2b_lanes_kernel &kernel = blake2b_get_lanes();
+  const blake2b_compress_fn single = blake2b_get_compress();
+  const size_t lanes = kernel.lanes;
+  const size_t nblocks = (inlen + 127) / 128;
+
+  alignas(64) uint8_t last_block[128] = {};
+  const size_t tail = inlen - (nblocks - 1) * 128;
+  std::memcpy(last_block, in + (nblocks - 1) * 128, tail);
+  uint64_t idle_h[BLAKE2B_MAX_LANES][8] = {};
+
+  for (size_t base = 0; base < n; base += lanes) {
+    const size_t count = (n - base) < lanes ? (n - base) : lanes;
+    uint64_t *state[BLAKE2B_MAX_LANES];
+    for (size_t l = 0; l < lanes; ++l)
+      state[l] = l < count ? h[base + l] : idle_h[l];
+
+    for (size_t k = 0; k < nblocks; ++k) {
+      const bool last = (k + 1 == nblocks);
+      const uint8_t *block = last ? last_block : in + k * 128;
+      const uint64_t t0 = t + (last ? inlen : (k + 1) * 128);
+
+      if (count == 1) {
+        single(state[0], block, t0, 0, last);
+      } else if (kernel.bcast) {
+        kernel.bcast(state, block, t0, 0, last);
+      } else {
+        const uint8_t *blocks[BLAKE2B_MAX_LANES];
+        uint64_t t0s[BLAKE2B_MAX_LANES];
+        uint64_t t1s[BLAKE2B_MAX_LANES];
+        uint64_t f0s[BLAKE2B_MAX_LANES];
+        for (size_t l = 0; l < lanes; ++l) {
+          blocks[l] = block;
+          t0s[l] = t0;
+          t1s[l] = 0;
+          f0s[l] = last ? ~uint64_t{0} : 0;
+        }
+        kernel.fn(state, blocks, t0s, t1s, f0s);
+      }
+    }
+  }
+
+  tinyblake_secure_zero(last_block, sizeof(last_block));
+  tinyblake_secure_zero(idle_h, sizeof(idle_h));
+}
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+/* ─── Batch hashing ─── */
+
+extern "C" {
+
+int tinyblake_blake2b_hash_many(void *out, size_t outlen,
+                                const void *const in[], const size_t inlen[],
+                                size_t n, const void *key, size_t keylen) {
+  using tinyblake::detail::BLAKE2B_MAX_LANES;
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_BLAKE2B_HASH_MANY);
+
+  if (n == 0)
+    return 0;
+  if (!out || !in || !inlen || outlen == 0 || outlen > 64)
+    return -1;
+  if (keylen > 64 || (keylen > 0 && !key))
+    return -1;
+  for (size_t i = 0; i < n; ++i) {
+    if (!in[i] && inlen[i] > 0)
+      return -1;
+  }
+
+  uint8_t param[64] = {};
+  param[0] = static_cast<uint8_t>(outlen); /* digest_length */
+  param[1] = static_cast<uint8_t>(keylen); /* key_length */
+  param[2] = 1;                            /* fanout */
+  param[3] = 1;                            /* depth */
+  uint64_t h_init[8];
+  tinyblake::detail::blake2b_param_to_h(h_init, param);
+
+  uint8_t key_block[128] = {};
+  if (keylen > 0)
+    std::memcpy(key_block, key, keylen);
+
+  uint8_t *dst = static_cast<uint8_t *>(out);
+  const uint8_t *const *msgs = reinterpret_cast<const uint8_t *const *>(in);
+  uint64_t h[BLAKE2B_MAX_LANES][8];
+  uint8_t digest[64];
+  for (size_t base = 0; base < n; base += BLAKE2B_MAX_LANES) {
+    const size_t count =
+        (n - base) < BLAKE2B_MAX_LANES ? (n - base) : BLAKE2B_MAX_LANES;
+    for (size_t l = 0; l < count; ++l)
+      std::memcpy(h[l], h_init, sizeof(h_init));
+
+    tinyblake::detail::blake2b_lanes_hash(
+        h, keylen > 0 ? key_block : nullptr, msgs + base, inlen + base, count);
+
+    for (size_t l = 0; l < count; ++l) {
+      for (size_t w = 0; w < 8; ++w)
+        tinyblake::detail::store_le64(digest + w * 8, h[l][w]);
+      std::memcpy(dst + (base + l) * outlen, digest, outlen);
+    }
+  }
+
+  tinyblake_secure_zero(h, sizeof(h));
+  tinyblake_secure_zero(digest, sizeof(digest));
+  tinyblake_secure_zero(key_block, sizeof(key_block));
+  return 0;
+}
+
+} /* extern "C" */
+
+namespace tinyblake::blake2b {
+
+std::vector<uint8_t> hash_many(const std::vector<std::vector<uint8_t>> &messages,
+                               size_t outlen) {
+  if (outlen == 0 || outlen > 64)
+    throw std::invalid_argument("blake2b::hash_many: outlen must be 1..64");
+
+  std::vector<const void *> ptrs(messages.size());
+  std::vector<size_t> lens(messages.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    ptrs[i] = messages[i].data();
+    lens[i] = messages[i].size();
+  }
+
+  std::vector<uint8_t> out(messages.size() * outlen);
+  if (tinyblake_blake2b_hash_many(out.data(), outlen, ptrs.data(), lens.data(),
+                                  messages.size(), nullptr, 0) != 0)
+    throw std::runtime_error("tinyblake::blake2b::hash_many failed");
+  return out;
+}
+
+} /* namespace tinyblake::blake2b */
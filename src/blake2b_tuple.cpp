@@ -0,0 +1,317 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/blake2b_tuple.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "internal/stats.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+/*
+ * Tuple hashing: framing (tag + LE64 length) is absorbed straight into the
+ * running BLAKE2b state between fields, so records never need to be
+ * serialized into a scratch buffer. The batched path describes each record
+ * as a segment list (header, data, header, data, ...) for the multi-lane
+ * driver, which reads field data in place.
+ */
+
+namespace tinyblake {
+
+static const size_t FIELD_HEADER_BYTES = 9;
+static const size_t TUPLE_CHUNK_FIELDS = 16;
+
+static bool build_tuple_param(uint8_t param[64], size_t outlen,
+                              const void *personal, size_t personal_len) {
+  if (outlen == 0 || outlen > 64)
+    return false;
+  if (personal_len > 16 || (personal_len > 0 && !personal))
+    return false;
+
+  std::memset(param, 0, 64);
+  param[0] = static_cast<uint8_t>(outlen); /* digest_length */
+  param[2] = 1;                            /* fanout */
+  param[3] = 1;                            /* depth */
+  if (personal_len > 0)
+    std::memcpy(param + 48, personal, personal_len);
+  return true;
+}
+
+static void encode_header(uint8_t hdr[FIELD_HEADER_BYTES], uint8_t tag,
+                          size_t len) {
+  hdr[0] = tag;
+  detail::store_le64(hdr + 1, static_cast<uint64_t>(len));
+}
+
+static bool is_integer_tag(uint8_t tag) {
+  return tag == TINYBLAKE_TUPLE_U64 || tag == TINYBLAKE_TUPLE_I64;
+}
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_blake2b_tuple_init(tinyblake_blake2b_state *state, size_t outlen,
+                                 const void *personal, size_t personal_len) {
+  uint8_t param[64];
+  if (!state ||
+      !tinyblake::build_tuple_param(param, outlen, personal, personal_len))
+    return -1;
+  return tinyblake_blake2b_init_param(state, param);
+}
+
+int tinyblake_blake2b_tuple_add(tinyblake_blake2b_state *state, uint8_t tag,
+                                const void *data, size_t len) {
+  if (!state)
+    return -1;
+  if (!data && len > 0)
+    return -1;
+  if (tinyblake::is_integer_tag(tag) && len != 8)
+    return -1;
+
+  uint8_t hdr[tinyblake::FIELD_HEADER_BYTES];
+  tinyblake::encode_header(hdr, tag, len);
+  if (tinyblake_blake2b_update(state, hdr, sizeof(hdr)) != 0)
+    return -1;
+  return tinyblake_blake2b_update(state, data, len);
+}
+
+int tinyblake_blake2b_tuple_add_u64(tinyblake_blake2b_state *state,
+                                    uint64_t v) {
+  uint8_t buf[8];
+  tinyblake::detail::store_le64(buf, v);
+  return tinyblake_blake2b_tuple_add(state, TINYBLAKE_TUPLE_U64, buf, 8);
+}
+
+int tinyblake_blake2b_tuple_add_i64(tinyblake_blake2b_state *state,
+                                    int64_t v) {
+  uint8_t buf[8];
+  tinyblake::detail::store_le64(buf, static_cast<uint64_t>(v));
+  return tinyblake_blake2b_tuple_add(state, TINYBLAKE_TUPLE_I64, buf, 8);
+}
+
+int tinyblake_blake2b_tuple_hash_many(
+    void *out, size_t outlen, const tinyblake_blake2b_tuple_field *fields,
+    size_t nfields, size_t nrecords, const void *personal,
+    size_t personal_len) {
+  using tinyblake::detail::BLAKE2B_MAX_LANES;
+  using tinyblake::detail::blake2b_segment;
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_TUPLE_HASH_MANY);
+
+  uint8_t param[64];
+  if (!tinyblake::build_tuple_param(param, outlen, personal, personal_len))
+    return -1;
+  if (nrecords == 0)
+    return 0;
+  if (!out || (!fields && nfields > 0))
+    return -1;
+
+  if (nfields != 0 && nrecords > SIZE_MAX / nfields)
+    return -1;
+  for (size_t i = 0; i < nfields * nrecords; ++i) {
+    if (!fields[i].data && fields[i].len > 0)
+      return -1;
+    if (tinyblake::is_integer_tag(fields[i].tag) && fields[i].len != 8)
+      return -1;
+  }
+
+  /* Headers and segment lists for one chunk of TUPLE_CHUNK_FIELDS fields
+   * per lane. Wider records are absorbed chunk by chunk, each lane carrying
+   * its unfinished block into the next chunk, so scratch stays on the
+   * stack whatever the record width. */
+  uint8_t hdr[BLAKE2B_MAX_LANES][tinyblake::TUPLE_CHUNK_FIELDS *
+                                 tinyblake::FIELD_HEADER_BYTES];
+  blake2b_segment seg[BLAKE2B_MAX_LANES]
+                     [tinyblake::TUPLE_CHUNK_FIELDS * 2 + 1];
+  alignas(64) uint8_t tail[BLAKE2B_MAX_LANES][128];
+  size_t tail_len[BLAKE2B_MAX_LANES];
+  uint64_t t[BLAKE2B_MAX_LANES];
+  const blake2b_segment *segs[BLAKE2B_MAX_LANES];
+  size_t nsegs[BLAKE2B_MAX_LANES];
+  uint64_t h[BLAKE2B_MAX_LANES][8];
+
+  const tinyblake::detail::blake2b_lanes_kernel &kernel =
+      tinyblake::detail::blake2b_get_lanes();
+  const tinyblake::blake2b_compress_fn single =
+      tinyblake::detail::blake2b_get_compress();
+
+  uint8_t *dst = static_cast<uint8_t *>(out);
+  for (size_t base = 0; base < nrecords; base += BLAKE2B_MAX_LANES) {
+    const size_t count = (nrecords - base) < BLAKE2B_MAX_LANES
+                             ? (nrecords - base)
+                             : BLAKE2B_MAX_LANES;
+
+    for (size_t l = 0; l < count; ++l) {
+      tinyblake::detail::blake2b_param_to_h(h[l], param);
+      tail_len[l] = 0;
+      t[l] = 0;
+    }
+
+    size_t first = 0;
+    for (;;) {
+      const size_t chunk =
+          (nfields - first) < tinyblake::TUPLE_CHUNK_FIELDS
+              ? (nfields - first)
+              : tinyblake::TUPLE_CHUNK_FIELDS;
+      const bool last = (first + chunk == nfields);
+
+      for (size_t l = 0; l < count; ++l) {
+        const tinyblake_blake2b_tuple_field *rec =
+            fields + (base + l) * nfields + first;
+        size_t k = 0;
+        if (tail_len[l] > 0)
+          seg[l][k++] = {tail[l], tail_len[l]};
+        for (size_t f = 0; f < chunk; ++f) {
+          uint8_t *fh = hdr[l] + f * tinyblake::FIELD_HEADER_BYTES;
+          tinyblake::encode_header(fh, rec[f].tag, rec[f].len);
+          seg[l][k++] = {fh, tinyblake::FIELD_HEADER_BYTES};
+          seg[l][k++] = {static_cast<const uint8_t *>(rec[f].data),
+                         rec[f].len};
+        }
+        segs[l] = seg[l];
+        nsegs[l] = k;
+      }
+
+      tinyblake::detail::blake2b_lanes_absorb_segments(
+          kernel, single, h, t, segs, nsegs, count, last ? nullptr : tail,
+          tail_len);
+      if (last)
+        break;
+      first += chunk;
+    }
+
+    for (size_t l = 0; l < count; ++l) {
+      uint8_t digest[64];
+      for (int w = 0; w < 8; ++w) {
+        tinyblake::detail::store_le64(digest + w * 8, h[l][w]);
+      }
+      std::memcpy(dst, digest, outlen);
+      tinyblake_secure_zero(digest, 64);
+      dst += outlen;
+    }
+  }
+
+  tinyblake_secure_zero(h, sizeof(h));
+  tinyblake_secure_zero(tail, sizeof(tail));
+  return 0;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::blake2b {
+
+tuple_hasher::tuple_hasher(size_t outlen, const void *personal,
+                           size_t personal_len) {
+  if (outlen == 0 || outlen > MAX_OUT_BYTES)
+    throw std::invalid_argument("Blake2b tuple: outlen must be 1..64");
+  if (!build_tuple_param(param_, outlen, personal, personal_len))
+    throw std::invalid_argument(
+        "Blake2b tuple: personalization must be 0..16 bytes");
+  if (tinyblake_blake2b_init_param(&state_, param_) != 0)
+    throw std::runtime_error("Blake2b tuple: init failed");
+}
+
+tuple_hasher::~tuple_hasher() {
+  tinyblake_secure_zero(&state_, sizeof(state_));
+}
+
+tuple_hasher::tuple_hasher(tuple_hasher &&o) noexcept : state_(o.state_) {
+  std::memcpy(param_, o.param_, 64);
+  tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+}
+
+tuple_hasher &tuple_hasher::operator=(tuple_hasher &&o) noexcept {
+  if (this != &o) {
+    tinyblake_secure_zero(&state_, sizeof(state_));
+    state_ = o.state_;
+    std::memcpy(param_, o.param_, 64);
+    tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+  }
+  return *this;
+}
+
+void tuple_hasher::add_field(const void *data, size_t len) {
+  if (tinyblake_blake2b_tuple_add(&state_, TINYBLAKE_TUPLE_BYTES, data, len) !=
+      0)
+    throw std::runtime_error("Blake2b tuple::add_field failed");
+}
+
+void tuple_hasher::add_field(const std::vector<uint8_t> &data) {
+  add_field(data.data(), data.size());
+}
+
+void tuple_hasher::add_string(const std::string &s) {
+  if (tinyblake_blake2b_tuple_add(&state_, TINYBLAKE_TUPLE_STRING, s.data(),
+                                  s.size()) != 0)
+    throw std::runtime_error("Blake2b tuple::add_string failed");
+}
+
+void tuple_hasher::add_u64(uint64_t v) {
+  if (tinyblake_blake2b_tuple_add_u64(&state_, v) != 0)
+    throw std::runtime_error("Blake2b tuple::add_u64 failed");
+}
+
+void tuple_hasher::add_i64(int64_t v) {
+  if (tinyblake_blake2b_tuple_add_i64(&state_, v) != 0)
+    throw std::runtime_error("Blake2b tuple::add_i64 failed");
+}
+
+std::vector<uint8_t> tuple_hasher::final_() {
+  std::vector<uint8_t> out(param_[0]);
+  if (tinyblake_blake2b_final(&state_, out.data(), out.size()) != 0)
+    throw std::runtime_error("Blake2b tuple::final_ failed");
+  return out;
+}
+
+void tuple_hasher::final_(void *out, size_t outlen) {
+  if (tinyblake_blake2b_final(&state_, out, outlen) != 0)
+    throw std::runtime_error("Blake2b tuple::final_ failed");
+}
+
+void tuple_hasher::reset() {
+  if (tinyblake_blake2b_init_param(&state_, param_) != 0)
+    throw std::runtime_error("Blake2b tuple::reset failed");
+}
+
+std::vector<uint8_t> hash_tuples(const tuple_field *fields, size_t nfields,
+                                 size_t nrecords, size_t outlen,
+                                 const void *personal, size_t personal_len) {
+  std::vector<uint8_t> out(nrecords * outlen);
+  if (tinyblake_blake2b_tuple_hash_many(out.data(), outlen, fields, nfields,
+                                        nrecords, personal,
+                                        personal_len) != 0)
+    throw std::invalid_argument("tinyblake::blake2b::hash_tuples failed");
+  return out;
+}
+
+} /* namespace tinyblake::blake2b */
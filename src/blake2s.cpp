@@ -0,0 +1,563 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/blake2s.h"
+#include "backend/blake2s_compress.h"
+#include "cpu_features.h"
+#include "internal/blake2s_dispatch.h"
+#include "internal/endian.h"
+#include "internal/stats.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+namespace tinyblake {
+
+/* ─── BLAKE2s IV ─── */
+const uint32_t detail::BLAKE2S_IV[8] = {0x6A09E667UL, 0xBB67AE85UL,
+                                        0x3C6EF372UL, 0xA54FF53AUL,
+                                        0x510E527FUL, 0x9B05688CUL,
+                                        0x1F83D9ABUL, 0x5BE0CD19UL};
+
+/* ─── Dispatch (atomic function pointer, no mutex) ─── */
+
+static blake2s_compress_fn resolve_compress_s() {
+#if !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+#endif
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.sse41)
+    return blake2s_compress_sse41;
+  return blake2s_compress_portable;
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.neon)
+    return blake2s_compress_neon;
+  return blake2s_compress_portable;
+#else
+  return blake2s_compress_portable;
+#endif
+}
+
+static std::atomic<blake2s_compress_fn> g_compress_s{nullptr};
+
+static blake2s_compress_fn get_compress_s() {
+  blake2s_compress_fn fn = g_compress_s.load(std::memory_order_acquire);
+  if (!fn) {
+    fn = resolve_compress_s();
+    g_compress_s.store(fn, std::memory_order_release);
+  }
+  return fn;
+}
+
+/* ─── Multi-lane dispatch ─── */
+
+static void compress_lanes_scalar_s(uint32_t *const state[],
+                                    const uint8_t *const block[],
+                                    const uint32_t t0[], const uint32_t t1[],
+                                    const uint32_t f0[]) {
+  get_compress_s()(state[0], block[0], t0[0], t1[0], f0[0] != 0);
+}
+
+static detail::blake2s_lanes_kernel resolve_lanes_s() {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().avx2)
+    return {blake2s_compress_8way_avx2, 8};
+#endif
+  return {compress_lanes_scalar_s, 1};
+}
+
+blake2s_compress_fn detail::blake2s_get_compress() { return get_compress_s(); }
+
+const detail::blake2s_lanes_kernel &detail::blake2s_get_lanes() {
+  static const blake2s_lanes_kernel cached = resolve_lanes_s();
+  return cached;
+}
+
+void detail::blake2s_param_to_h(uint32_t h[8], const uint8_t param[32]) {
+  for (int i = 0; i < 8; ++i) {
+    h[i] = BLAKE2S_IV[i] ^ load_le32(param + i * 4);
+  }
+}
+
+/* ─── Parameter block helpers ─── */
+
+static void build_default_param_s(uint8_t param[32], uint8_t outlen,
+                                  uint8_t keylen) {
+  std::memset(param, 0, 32);
+  param[0] = outlen; /* digest_length */
+  param[1] = keylen; /* key_length */
+  param[2] = 1;      /* fanout */
+  param[3] = 1;      /* depth */
+}
+
+static int init_from_param_s(tinyblake_blake2s_state *S,
+                             const uint8_t param[32]) {
+  if (param[0] == 0 || param[0] > 32)
+    return -1;
+
+  std::memset(S, 0, sizeof(*S));
+  S->outlen = param[0];
+  detail::blake2s_param_to_h(S->h, param);
+  return 0;
+}
+
+static void compress_block_s(tinyblake_blake2s_state *S,
+                             const uint8_t block[64], bool last) {
+  get_compress_s()(S->h, block, S->t[0], S->t[1], last);
+}
+
+/* ─── Multi-message driver ─── */
+
+/*
+ * Hashes groups of messages through the lane kernel. Each lane optionally
+ * starts with the padded key block, then walks its message: full blocks
+ * are passed in place, the final partial block is staged zero-padded.
+ * Steps with a single live lane use the single-block kernel.
+ */
+static void hash_many_s(uint8_t *out, size_t outlen,
+                        const uint8_t *const in[], const size_t inlen[],
+                        size_t n, const uint8_t *key_block,
+                        const uint32_t h_init[8]) {
+  using detail::BLAKE2S_MAX_LANES;
+  const detail::blake2s_lanes_kernel &kernel = detail::blake2s_get_lanes();
+  const blake2s_compress_fn single = get_compress_s();
+  const size_t lanes = kernel.lanes;
+  const uint64_t prefix = key_block ? 64 : 0;
+
+  alignas(32) uint8_t stage[BLAKE2S_MAX_LANES][64];
+  alignas(32) static const uint8_t zero_block[64] = {};
+  uint32_t h[BLAKE2S_MAX_LANES][8];
+  uint32_t idle_h[8] = {};
+
+  for (size_t base = 0; base < n; base += lanes) {
+    const size_t count = (n - base) < lanes ? (n - base) : lanes;
+
+    uint64_t total[BLAKE2S_MAX_LANES];
+    uint64_t nblocks[BLAKE2S_MAX_LANES];
+    uint64_t steps = 0;
+    for (size_t l = 0; l < count; ++l) {
+      std::memcpy(h[l], h_init, 32);
+      total[l] = prefix + inlen[base + l];
+      nblocks[l] = total[l] == 0 ? 1 : (total[l] + 63) / 64;
+      if (nblocks[l] > steps)
+        steps = nblocks[l];
+    }
+
+    for (uint64_t k = 0; k < steps; ++k) {
+      uint32_t *state[BLAKE2S_MAX_LANES];
+      const uint8_t *block[BLAKE2S_MAX_LANES];
+      uint32_t t0[BLAKE2S_MAX_LANES];
+      uint32_t t1[BLAKE2S_MAX_LANES];
+      uint32_t f0[BLAKE2S_MAX_LANES];
+      size_t active = 0;
+      size_t last_active = 0;
+
+      for (size_t l = 0; l < lanes; ++l) {
+        if (l >= count || k >= nblocks[l]) {
+          state[l] = idle_h;
+          block[l] = zero_block;
+          t0[l] = t1[l] = f0[l] = 0;
+          continue;
+        }
+
+        const uint64_t off = k * 64;
+        const bool last = (k + 1 == nblocks[l]);
+        const uint8_t *msg = in[base + l];
+        state[l] = h[l];
+
+        if (off < prefix) {
+          block[l] = key_block;
+        } else {
+          const size_t moff = static_cast<size_t>(off - prefix);
+          const size_t avail = inlen[base + l] - moff;
+          if (avail >= 64) {
+            block[l] = msg + moff;
+          } else {
+            std::memset(stage[l], 0, 64);
+            if (avail > 0)
+              std::memcpy(stage[l], msg + moff, avail);
+            block[l] = stage[l];
+          }
+        }
+
+        const uint64_t counter = last ? total[l] : off + 64;
+        t0[l] = static_cast<uint32_t>(counter);
+        t1[l] = static_cast<uint32_t>(counter >> 32);
+        f0[l] = last ? 0xFFFFFFFFUL : 0;
+        ++active;
+        last_active = l;
+      }
+
+      if (active == 1) {
+        single(state[last_active], block[last_active], t0[last_active],
+               t1[last_active], f0[last_active] != 0);
+      } else {
+        kernel.fn(state, block, t0, t1, f0);
+      }
+    }
+
+    for (size_t l = 0; l < count; ++l) {
+      uint8_t digest[32];
+      for (int i = 0; i < 8; ++i) {
+        detail::store_le32(digest + i * 4, h[l][i]);
+      }
+      std::memcpy(out + (base + l) * outlen, digest, outlen);
+      tinyblake_secure_zero(digest, sizeof(digest));
+    }
+  }
+
+  tinyblake_secure_zero(stage, sizeof(stage));
+  tinyblake_secure_zero(h, sizeof(h));
+  tinyblake_secure_zero(idle_h, sizeof(idle_h));
+}
+
+} /* namespace tinyblake */
+
+/* ─── C API ─── */
+
+extern "C" {
+
+int tinyblake_blake2s_init(tinyblake_blake2s_state *state, size_t outlen) {
+  if (!state || outlen == 0 || outlen > 32)
+    return -1;
+
+  uint8_t param[32];
+  tinyblake::build_default_param_s(param, static_cast<uint8_t>(outlen), 0);
+  return tinyblake::init_from_param_s(state, param);
+}
+
+int tinyblake_blake2s_init_key(tinyblake_blake2s_state *state, size_t outlen,
+                               const void *key, size_t keylen) {
+  if (!state || outlen == 0 || outlen > 32)
+    return -1;
+  if (!key || keylen == 0 || keylen > 32)
+    return -1;
+
+  uint8_t param[32];
+  tinyblake::build_default_param_s(param, static_cast<uint8_t>(outlen),
+                                   static_cast<uint8_t>(keylen));
+  if (tinyblake::init_from_param_s(state, param) != 0)
+    return -1;
+
+  /* The padded key block stays buffered and is compressed as a normal
+   * (possibly final) block. */
+  uint8_t block[64];
+  std::memset(block, 0, 64);
+  std::memcpy(block, key, keylen);
+
+  tinyblake_blake2s_update(state, block, 64);
+
+  tinyblake_secure_zero(block, 64);
+  return 0;
+}
+
+int tinyblake_blake2s_init_param(tinyblake_blake2s_state *state,
+                                 const uint8_t param[32]) {
+  if (!state || !param)
+    return -1;
+  return tinyblake::init_from_param_s(state, param);
+}
+
+int tinyblake_blake2s_update(tinyblake_blake2s_state *state, const void *in,
+                             size_t inlen) {
+  if (!state)
+    return -1;
+  if (state->buflen > 64)
+    return -1;
+  if (inlen == 0)
+    return 0;
+  if (!in)
+    return -1;
+
+  const uint8_t *pin = static_cast<const uint8_t *>(in);
+
+  if (state->buflen > 0) {
+    size_t left = 64 - state->buflen;
+    if (inlen > left) {
+      std::memcpy(state->buf + state->buflen, pin, left);
+      state->t[0] += 64;
+      if (state->t[0] < 64)
+        state->t[1]++;
+      tinyblake::compress_block_s(state, state->buf, false);
+      state->buflen = 0;
+      pin += left;
+      inlen -= left;
+    } else {
+      std::memcpy(state->buf + state->buflen, pin, inlen);
+      state->buflen += inlen;
+      return 0;
+    }
+  }
+
+  /* Compress full blocks, keeping at least 1 byte for final */
+  while (inlen > 64) {
+    state->t[0] += 64;
+    if (state->t[0] < 64)
+      state->t[1]++;
+    tinyblake::compress_block_s(state, pin, false);
+    pin += 64;
+    inlen -= 64;
+  }
+
+  if (inlen > 0) {
+    std::memcpy(state->buf, pin, inlen);
+    state->buflen = inlen;
+  }
+
+  return 0;
+}
+
+int tinyblake_blake2s_final(tinyblake_blake2s_state *state, void *out,
+                            size_t outlen) {
+  if (!state || !out)
+    return -1;
+  if (outlen < state->outlen)
+    return -1;
+
+  const uint32_t buflen = static_cast<uint32_t>(state->buflen);
+  state->t[0] += buflen;
+  if (state->t[0] < buflen)
+    state->t[1]++;
+
+  if (state->buflen < 64) {
+    std::memset(state->buf + state->buflen, 0, 64 - state->buflen);
+  }
+
+  tinyblake::compress_block_s(state, state->buf, true);
+
+  uint8_t buffer[32];
+  for (int i = 0; i < 8; ++i) {
+    tinyblake::detail::store_le32(buffer + i * 4, state->h[i]);
+  }
+  std::memcpy(out, buffer, state->outlen);
+  tinyblake_secure_zero(buffer, 32);
+
+  tinyblake_secure_zero(state, sizeof(*state));
+  return 0;
+}
+
+int tinyblake_blake2s(void *out, size_t outlen, const void *in, size_t inlen,
+                      const void *key, size_t keylen) {
+  tinyblake_blake2s_state S;
+  int rc;
+
+  if (keylen > 0) {
+    rc = tinyblake_blake2s_init_key(&S, outlen, key, keylen);
+  } else {
+    rc = tinyblake_blake2s_init(&S, outlen);
+  }
+  if (rc != 0)
+    return rc;
+
+  rc = tinyblake_blake2s_update(&S, in, inlen);
+  if (rc != 0)
+    return rc;
+
+  return tinyblake_blake2s_final(&S, out, outlen);
+}
+
+int tinyblake_blake2s_hash_many(void *out, size_t outlen,
+                                const void *const in[], const size_t inlen[],
+                                size_t n, const void *key, size_t keylen) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_BLAKE2S_HASH_MANY);
+  if (n == 0)
+    return 0;
+  if (!out || !in || !inlen || outlen == 0 || outlen > 32)
+    return -1;
+  if (keylen > 32 || (keylen > 0 && !key))
+    return -1;
+  for (size_t i = 0; i < n; ++i) {
+    if (!in[i] && inlen[i] > 0)
+      return -1;
+  }
+
+  uint8_t param[32];
+  tinyblake::build_default_param_s(param, static_cast<uint8_t>(outlen),
+                                   static_cast<uint8_t>(keylen));
+  uint32_t h[8];
+  tinyblake::detail::blake2s_param_to_h(h, param);
+
+  uint8_t key_block[64] = {};
+  if (keylen > 0)
+    std::memcpy(key_block, key, keylen);
+
+  tinyblake::hash_many_s(static_cast<uint8_t *>(out), outlen,
+                         reinterpret_cast<const uint8_t *const *>(in), inlen,
+                         n, keylen > 0 ? key_block : nullptr, h);
+
+  tinyblake_secure_zero(key_block, sizeof(key_block));
+  return 0;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::blake2s {
+
+hasher::hasher(size_t outlen) : keyed_(false) {
+  if (outlen == 0 || outlen > 32)
+    throw std::invalid_argument("Blake2s: outlen must be 1..32");
+  std::memset(key_block_, 0, 64);
+  build_default_param_s(param_, static_cast<uint8_t>(outlen), 0);
+  if (init_from_param_s(&state_, param_) != 0)
+    throw std::runtime_error("Blake2s: init_from_param failed");
+}
+
+hasher::hasher(const void *key, size_t keylen, size_t outlen) : keyed_(true) {
+  if (outlen == 0 || outlen > 32)
+    throw std::invalid_argument("Blake2s: outlen must be 1..32");
+  if (!key || keylen == 0 || keylen > 32)
+    throw std::invalid_argument(
+        "Blake2s: key must be non-null with keylen 1..32");
+  std::memset(key_block_, 0, 64);
+  std::memcpy(key_block_, key, keylen);
+  build_default_param_s(param_, static_cast<uint8_t>(outlen),
+                        static_cast<uint8_t>(keylen));
+  if (init_from_param_s(&state_, param_) != 0)
+    throw std::runtime_error("Blake2s: init_from_param failed");
+
+  if (tinyblake_blake2s_update(&state_, key_block_, 64) != 0)
+    throw std::runtime_error("Blake2s: key block update failed");
+}
+
+hasher::hasher(const uint8_t param[32]) : keyed_(false) {
+  if (!param)
+    throw std::invalid_argument("Blake2s: param must be non-null");
+  std::memset(key_block_, 0, 64);
+  std::memcpy(param_, param, 32);
+  if (init_from_param_s(&state_, param_) != 0)
+    throw std::invalid_argument(
+        "Blake2s: invalid parameter block (outlen must be 1..32)");
+}
+
+hasher::~hasher() {
+  tinyblake_secure_zero(&state_, sizeof(state_));
+  tinyblake_secure_zero(key_block_, sizeof(key_block_));
+}
+
+hasher::hasher(hasher &&o) noexcept : state_(o.state_), keyed_(o.keyed_) {
+  std::memcpy(param_, o.param_, 32);
+  std::memcpy(key_block_, o.key_block_, 64);
+  tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+  tinyblake_secure_zero(o.key_block_, 64);
+}
+
+hasher &hasher::operator=(hasher &&o) noexcept {
+  if (this != &o) {
+    tinyblake_secure_zero(&state_, sizeof(state_));
+    tinyblake_secure_zero(key_block_, 64);
+    state_ = o.state_;
+    keyed_ = o.keyed_;
+    std::memcpy(param_, o.param_, 32);
+    std::memcpy(key_block_, o.key_block_, 64);
+    tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+    tinyblake_secure_zero(o.key_block_, 64);
+  }
+  return *this;
+}
+
+void hasher::update(const void *data, size_t len) {
+  if (tinyblake_blake2s_update(&state_, data, len) != 0)
+    throw std::runtime_error("Blake2s::update failed");
+}
+
+void hasher::update(const std::vector<uint8_t> &data) {
+  update(data.data(), data.size());
+}
+
+void hasher::update(const std::string &data) {
+  update(data.data(), data.size());
+}
+
+std::vector<uint8_t> hasher::final_() {
+  std::vector<uint8_t> out(state_.outlen);
+  if (tinyblake_blake2s_final(&state_, out.data(), out.size()) != 0)
+    throw std::runtime_error("Blake2s::final_ failed");
+  return out;
+}
+
+void hasher::final_(void *out, size_t outlen) {
+  if (tinyblake_blake2s_final(&state_, out, outlen) != 0)
+    throw std::runtime_error("Blake2s::final_ failed");
+}
+
+void hasher::reset() {
+  if (init_from_param_s(&state_, param_) != 0)
+    throw std::runtime_error("Blake2s::reset failed");
+  if (keyed_) {
+    if (tinyblake_blake2s_update(&state_, key_block_, 64) != 0)
+      throw std::runtime_error("Blake2s::reset key update failed");
+  }
+}
+
+std::vector<uint8_t> hash(const void *data, size_t len, size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake2s(out.data(), outlen, data, len, nullptr, 0) != 0)
+    throw std::runtime_error("tinyblake::blake2s::hash failed");
+  return out;
+}
+
+std::vector<uint8_t> hash(const std::vector<uint8_t> &data, size_t outlen) {
+  return hash(data.data(), data.size(), outlen);
+}
+
+std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
+                                const void *data, size_t datalen,
+                                size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake2s(out.data(), outlen, data, datalen, key, keylen) != 0)
+    throw std::runtime_error("tinyblake::blake2s::keyed_hash failed");
+  return out;
+}
+
+std::vector<uint8_t> hash_many(const std::vector<std::vector<uint8_t>> &messages,
+                               size_t outlen) {
+  if (outlen == 0 || outlen > 32)
+    throw std::invalid_argument("blake2s::hash_many: outlen must be 1..32");
+
+  std::vector<const void *> ptrs(messages.size());
+  std::vector<size_t> lens(messages.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    ptrs[i] = messages[i].data();
+    lens[i] = messages[i].size();
+  }
+
+  std::vector<uint8_t> out(messages.size() * outlen);
+  if (tinyblake_blake2s_hash_many(out.data(), outlen, ptrs.data(), lens.data(),
+                                  messages.size(), nullptr, 0) != 0)
+    throw std::runtime_error("tinyblake::blake2s::hash_many failed");
+  return out;
+}
+
+} /* namespace tinyblake::blake2s */
@@ -0,0 +1,279 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/blake2xb.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/blake2xb.h"
+#include "internal/endian.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * BLAKE2Xb (BLAKE2X paper, Aumasson et al. 2016).
+ *
+ * Parameter block differences from BLAKE2b: bytes 8..11 hold a 32-bit
+ * node_offset and bytes 12..15 the 32-bit xof_length.
+ *
+ * H0  = BLAKE2b-512(M) with xof_length = L
+ * B_i = BLAKE2b(H0) with digest_length = min(64, L - 64i), key_length = 0,
+ *       fanout = 0, depth = 0, leaf_length = 64, node_offset = i,
+ *       inner_length = 64, xof_length = L, same salt and personalization
+ * out = B_0 || B_1 || ...
+ */
+
+namespace tinyblake {
+
+static const size_t EXPAND_BATCH = 32; /* output nodes per lane run */
+
+static void build_root_param(uint8_t param[64], uint32_t xof_len,
+                             uint8_t keylen) {
+  std::memset(param, 0, 64);
+  param[0] = 64;     /* digest_length */
+  param[1] = keylen; /* key_length */
+  param[2] = 1;      /* fanout */
+  param[3] = 1;      /* depth */
+  detail::store_le32(param + 12, xof_len);
+}
+
+void detail::blake2xb_expand(const uint8_t root[64], const uint8_t param[64],
+                             uint8_t *out, size_t outlen) {
+  uint8_t node[64];
+  std::memcpy(node, param, 64);
+  node[1] = 0;              /* key_length */
+  node[2] = 0;              /* fanout */
+  node[3] = 0;              /* depth */
+  store_le32(node + 4, 64); /* leaf_length */
+  node[16] = 0;             /* node_depth */
+  node[17] = 64;            /* inner_length */
+
+  uint64_t h[EXPAND_BATCH][8];
+  const uint8_t *in[EXPAND_BATCH];
+  size_t inlen[EXPAND_BATCH];
+  for (size_t i = 0; i < EXPAND_BATCH; ++i) {
+    in[i] = root;
+    inlen[i] = 64;
+  }
+
+  uint32_t index = 0;
+  while (outlen > 0) {
+    size_t batch = 0;
+    size_t remaining = outlen;
+    while (batch < EXPAND_BATCH && remaining > 0) {
+      const size_t len = remaining < 64 ? remaining : 64;
+      node[0] = static_cast<uint8_t>(len);
+      store_le32(node + 8, index + static_cast<uint32_t>(batch));
+      blake2b_param_to_h(h[batch], node);
+      remaining -= len;
+      ++batch;
+    }
+
+    blake2b_lanes_hash(h, nullptr, in, inlen, batch);
+
+    for (size_t b = 0; b < batch; ++b) {
+      const size_t len = outlen < 64 ? outlen : 64;
+      uint8_t block[64];
+      for (int w = 0; w < 8; ++w) {
+        store_le64(block + w * 8, h[b][w]);
+      }
+      std::memcpy(out, block, len);
+      tinyblake_secure_zero(block, 64);
+      out += len;
+      outlen -= len;
+    }
+    index += static_cast<uint32_t>(batch);
+  }
+
+  tinyblake_secure_zero(h, sizeof(h));
+}
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_blake2xb_init(tinyblake_blake2xb_state *state, size_t outlen) {
+  if (!state || outlen == 0 || outlen > TINYBLAKE_BLAKE2XB_MAXOUTBYTES)
+    return -1;
+
+  tinyblake::build_root_param(state->param, static_cast<uint32_t>(outlen), 0);
+  return tinyblake_blake2b_init_param(&state->root, state->param);
+}
+
+int tinyblake_blake2xb_init_key(tinyblake_blake2xb_state *state, size_t outlen,
+                                const void *key, size_t keylen) {
+  if (!state || outlen == 0 || outlen > TINYBLAKE_BLAKE2XB_MAXOUTBYTES)
+    return -1;
+  if (!key || keylen == 0 || keylen > 64)
+    return -1;
+
+  tinyblake::build_root_param(state->param, static_cast<uint32_t>(outlen),
+                              static_cast<uint8_t>(keylen));
+  if (tinyblake_blake2b_init_param(&state->root, state->param) != 0)
+    return -1;
+
+  uint8_t block[128];
+  std::memset(block, 0, 128);
+  std::memcpy(block, key, keylen);
+
+  tinyblake_blake2b_update(&state->root, block, 128);
+
+  tinyblake_secure_zero(block, 128);
+  return 0;
+}
+
+int tinyblake_blake2xb_update(tinyblake_blake2xb_state *state, const void *in,
+                              size_t inlen) {
+  if (!state)
+    return -1;
+  return tinyblake_blake2b_update(&state->root, in, inlen);
+}
+
+int tinyblake_blake2xb_final(tinyblake_blake2xb_state *state, void *out,
+                             size_t outlen) {
+  if (!state || !out)
+    return -1;
+  const size_t xof_len = tinyblake::detail::load_le32(state->param + 12);
+  if (xof_len == 0 || outlen < xof_len)
+    return -1;
+
+  uint8_t root[64];
+  if (tinyblake_blake2b_final(&state->root, root, 64) != 0) {
+    tinyblake_secure_zero(state, sizeof(*state));
+    return -1;
+  }
+
+  tinyblake::detail::blake2xb_expand(root, state->param,
+                                     static_cast<uint8_t *>(out), xof_len);
+
+  tinyblake_secure_zero(root, 64);
+  tinyblake_secure_zero(state, sizeof(*state));
+  return 0;
+}
+
+int tinyblake_blake2xb(void *out, size_t outlen, const void *in, size_t inlen,
+                       const void *key, size_t keylen) {
+  tinyblake_blake2xb_state S;
+  int rc;
+
+  if (keylen > 0) {
+    rc = tinyblake_blake2xb_init_key(&S, outlen, key, keylen);
+  } else {
+    rc = tinyblake_blake2xb_init(&S, outlen);
+  }
+  if (rc != 0)
+    return rc;
+
+  rc = tinyblake_blake2xb_update(&S, in, inlen);
+  if (rc != 0)
+    return rc;
+
+  return tinyblake_blake2xb_final(&S, out, outlen);
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::blake2xb {
+
+hasher::hasher(size_t outlen) : outlen_(outlen) {
+  if (outlen == 0 || outlen > MAX_OUT_BYTES)
+    throw std::invalid_argument("Blake2xb: outlen must be 1..2^32-2");
+  if (tinyblake_blake2xb_init(&state_, outlen) != 0)
+    throw std::runtime_error("Blake2xb: init failed");
+}
+
+hasher::hasher(const void *key, size_t keylen, size_t outlen)
+    : outlen_(outlen) {
+  if (outlen == 0 || outlen > MAX_OUT_BYTES)
+    throw std::invalid_argument("Blake2xb: outlen must be 1..2^32-2");
+  if (!key || keylen == 0 || keylen > 64)
+    throw std::invalid_argument(
+        "Blake2xb: key must be non-null with keylen 1..64");
+  if (tinyblake_blake2xb_init_key(&state_, outlen, key, keylen) != 0)
+    throw std::runtime_error("Blake2xb: init failed");
+}
+
+hasher::~hasher() { tinyblake_secure_zero(&state_, sizeof(state_)); }
+
+hasher::hasher(hasher &&o) noexcept : state_(o.state_), outlen_(o.outlen_) {
+  tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+}
+
+hasher &hasher::operator=(hasher &&o) noexcept {
+  if (this != &o) {
+    tinyblake_secure_zero(&state_, sizeof(state_));
+    state_ = o.state_;
+    outlen_ = o.outlen_;
+    tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+  }
+  return *this;
+}
+
+void hasher::update(const void *data, size_t len) {
+  if (tinyblake_blake2xb_update(&state_, data, len) != 0)
+    throw std::runtime_error("Blake2xb::update failed");
+}
+
+void hasher::update(const std::vector<uint8_t> &data) {
+  update(data.data(), data.size());
+}
+
+void hasher::update(const std::string &data) {
+  update(data.data(), data.size());
+}
+
+std::vector<uint8_t> hasher::final_() {
+  std::vector<uint8_t> out(outlen_);
+  if (tinyblake_blake2xb_final(&state_, out.data(), out.size()) != 0)
+    throw std::runtime_error("Blake2xb::final_ failed");
+  return out;
+}
+
+void hasher::final_(void *out, size_t outlen) {
+  if (tinyblake_blake2xb_final(&state_, out, outlen) != 0)
+    throw std::runtime_error("Blake2xb::final_ failed");
+}
+
+std::vector<uint8_t> hash(const void *data, size_t len, size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake2xb(out.data(), outlen, data, len, nullptr, 0) != 0)
+    throw std::runtime_error("tinyblake::blake2xb::hash failed");
+  return out;
+}
+
+std::vector<uint8_t> keyed_hash(const void *key, size_t keylen,
+                                const void *data, size_t datalen,
+                                size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake2xb(out.data(), outlen, data, datalen, key, keylen) != 0)
+    throw std::runtime_error("tinyblake::blake2xb::keyed_hash failed");
+  return out;
+}
+
+} /* namespace tinyblake::blake2xb */
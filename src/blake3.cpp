@@ -0,0 +1,627 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/blake3.h"
+#include "backend/blake3_impl.h"
+#include "cpu_features.h"
+#include "internal/blake3_dispatch.h"
+#include "internal/endian.h"
+#include "internal/thread_pool.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+/*
+ * BLAKE3 glue: chunk state, chaining-value stack and subtree hashing.
+ *
+ * Chunk and parent chaining values are pushed onto a stack and merged
+ * eagerly, one merge per carry of the chunk counter, so the stack always
+ * holds one subtree per set bit of the counter. A chunk is only flushed
+ * once more input is known to follow, which keeps the root node in the
+ * state until final().
+ *
+ * Bulk input bypasses the chunk state: whole chunks are grouped into
+ * power-of-two subtrees aligned to the chunk counter, hashed with the
+ * backend's hash_many (degree 4/8/16 chunks per pass), and the subtree's
+ * parents are reduced a level at a time, again through hash_many. The
+ * subtree's root chaining value is then pushed like a single chunk's.
+ */
+
+namespace tinyblake {
+
+static const uint32_t IV3[8] = {0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL,
+                                0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL,
+                                0x1F83D9ABUL, 0x5BE0CD19UL};
+
+/* Largest subtree hashed without the thread pool (stack-allocated CVs) */
+static constexpr size_t SERIAL_SUBTREE_CHUNKS = 64;
+
+/* Largest subtree per parallel pass (64 MiB of input, 2 MiB of CVs) */
+static constexpr size_t PARALLEL_SUBTREE_CHUNKS = size_t{1} << 16;
+
+/* Smallest slice of a subtree handed to one pool task */
+static constexpr size_t PARALLEL_MIN_TASK_CHUNKS = 16;
+
+/* ─── Dispatch ─── */
+
+static detail::blake3_kernels resolve_kernels3() {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  if (feat.avx512f && feat.avx512vl)
+    return {blake3_compress_in_place_sse41, blake3_compress_xof_sse41,
+            blake3_hash_many_avx512, 16};
+  if (feat.avx2)
+    return {blake3_compress_in_place_sse41, blake3_compress_xof_sse41,
+            blake3_hash_many_avx2, 8};
+  if (feat.sse41)
+    return {blake3_compress_in_place_sse41, blake3_compress_xof_sse41,
+            blake3_hash_many_sse41, 4};
+#endif
+  return {blake3_compress_in_place_portable, blake3_compress_xof_portable,
+          blake3_hash_many_portable, 1};
+}
+
+const detail::blake3_kernels &detail::blake3_get_kernels() {
+  static const blake3_kernels cached = resolve_kernels3();
+  return cached;
+}
+
+/* ─── Nodes ─── */
+
+/* A node whose compression is deferred until we know if it is the root */
+struct output3 {
+  uint32_t cv[8];
+  uint8_t block[64];
+  uint8_t block_len;
+  uint64_t counter;
+  uint8_t flags;
+};
+
+static size_t chunk_len3(const tinyblake_blake3_state *S) {
+  return size_t{S->blocks_compressed} * BLAKE3_BLOCK_LEN + S->buflen;
+}
+
+static uint8_t chunk_start_flag3(const tinyblake_blake3_state *S) {
+  return S->blocks_compressed == 0 ? BLAKE3_CHUNK_START : 0;
+}
+
+static void chunk_output3(const tinyblake_blake3_state *S, output3 *o) {
+  std::memcpy(o->cv, S->cv, 32);
+  std::memset(o->block, 0, 64);
+  std::memcpy(o->block, S->buf, S->buflen);
+  o->block_len = S->buflen;
+  o->counter = S->chunk_counter;
+  o->flags = static_cast<uint8_t>(S->flags | chunk_start_flag3(S) |
+                                  BLAKE3_CHUNK_END);
+}
+
+static void parent_output3(const uint8_t left[32], const uint8_t right[32],
+                           const uint32_t key[8], uint8_t flags, output3 *o) {
+  std::memcpy(o->cv, key, 32);
+  std::memcpy(o->block, left, 32);
+  std::memcpy(o->block + 32, right, 32);
+  o->block_len = 64;
+  o->counter = 0;
+  o->flags = static_cast<uint8_t>(flags | BLAKE3_PARENT);
+}
+
+static void output_cv3(const output3 &o, uint8_t out[32]) {
+  uint32_t cv[8];
+  std::memcpy(cv, o.cv, 32);
+  detail::blake3_get_kernels().compress_in_place(cv, o.block, o.block_len,
+                                                 o.counter, o.flags);
+  for (int i = 0; i < 8; ++i)
+    detail::store_le32(out + i * 4, cv[i]);
+  tinyblake_secure_zero(cv, sizeof(cv));
+}
+
+static void root_bytes3(const output3 &o, uint64_t seek, uint8_t *out,
+                        size_t outlen) {
+  const detail::blake3_kernels &k = detail::blake3_get_kernels();
+  uint64_t counter = seek / 64;
+  size_t offset = static_cast<size_t>(seek % 64);
+  uint8_t wide[64];
+
+  while (outlen > 0) {
+    k.compress_xof(o.cv, o.block, o.block_len, counter,
+                   static_cast<uint8_t>(o.flags | BLAKE3_ROOT), wide);
+    const size_t take = (64 - offset) < outlen ? (64 - offset) : outlen;
+    std::memcpy(out, wide + offset, take);
+    out += take;
+    outlen -= take;
+    offset = 0;
+    ++counter;
+  }
+  tinyblake_secure_zero(wide, sizeof(wide));
+}
+
+/* ─── State ─── */
+
+static void init3(tinyblake_blake3_state *S, const uint32_t key[8],
+                  uint8_t flags) {
+  uint32_t k[8];
+  std::memcpy(k, key, 32); /* key may point into *S */
+  std::memset(S, 0, sizeof(*S));
+  std::memcpy(S->key, k, 32);
+  std::memcpy(S->cv, k, 32);
+  S->flags = flags;
+  tinyblake_secure_zero(k, sizeof(k));
+}
+
+static unsigned popcount64(uint64_t x) {
+  unsigned n = 0;
+  for (; x != 0; x &= x - 1)
+    ++n;
+  return n;
+}
+
+/* Push the CV of a subtree ending at total_chunks, merging completed pairs */
+static void push_cv3(tinyblake_blake3_state *S, const uint8_t cv[32],
+                     uint64_t total_chunks) {
+  std::memcpy(S->cv_stack + size_t{S->cv_stack_len} * 32, cv, 32);
+  ++S->cv_stack_len;
+
+  while (S->cv_stack_len > popcount64(total_chunks)) {
+    uint8_t *left = S->cv_stack + size_t{S->cv_stack_len - 2u} * 32;
+    output3 parent;
+    parent_output3(left, left + 32, S->key, S->flags, &parent);
+    output_cv3(parent, left);
+    --S->cv_stack_len;
+    tinyblake_secure_zero(&parent, sizeof(parent));
+  }
+  std::memset(S->cv_stack + size_t{S->cv_stack_len} * 32, 0, 32);
+}
+
+/* Flush the (full) current chunk and start the next one */
+static void finish_chunk3(tinyblake_blake3_state *S) {
+  output3 o;
+  uint8_t cv[32];
+  chunk_output3(S, &o);
+  output_cv3(o, cv);
+
+  const uint64_t total = S->chunk_counter + 1;
+  push_cv3(S, cv, total);
+
+  std::memcpy(S->cv, S->key, 32);
+  S->chunk_counter = total;
+  S->blocks_compressed = 0;
+  S->buflen = 0;
+  std::memset(S->buf, 0, sizeof(S->buf));
+
+  tinyblake_secure_zero(&o, sizeof(o));
+  tinyblake_secure_zero(cv, sizeof(cv));
+}
+
+/* Absorb at most the rest of the current chunk */
+static void chunk_update3(tinyblake_blake3_state *S, const uint8_t *in,
+                          size_t len) {
+  const blake3_compress_in_place_fn compress =
+      detail::blake3_get_kernels().compress_in_place;
+
+  while (len > 0) {
+    if (S->buflen == BLAKE3_BLOCK_LEN) {
+      compress(S->cv, S->buf, 64, S->chunk_counter,
+               static_cast<uint8_t>(S->flags | chunk_start_flag3(S)));
+      ++S->blocks_compressed;
+      S->buflen = 0;
+    }
+
+    /* Whole blocks straight from the input; the last stays buffered */
+    while (S->buflen == 0 && len > BLAKE3_BLOCK_LEN) {
+      compress(S->cv, in, 64, S->chunk_counter,
+               static_cast<uint8_t>(S->flags | chunk_start_flag3(S)));
+      ++S->blocks_compressed;
+      in += BLAKE3_BLOCK_LEN;
+      len -= BLAKE3_BLOCK_LEN;
+    }
+
+    const size_t room = BLAKE3_BLOCK_LEN - S->buflen;
+    const size_t take = len < room ? len : room;
+    std::memcpy(S->buf + S->buflen, in, take);
+    S->buflen = static_cast<uint8_t>(S->buflen + take);
+    in += take;
+    len -= take;
+  }
+}
+
+/* ─── Subtrees ─── */
+
+/* CVs of n consecutive whole chunks, written to cvs[0..32n) */
+static void hash_chunks3(const uint8_t *in, size_t n, const uint32_t key[8],
+                         uint64_t counter, uint8_t flags, uint8_t *cvs) {
+  const detail::blake3_kernels &k = detail::blake3_get_kernels();
+  const uint8_t *ptrs[SERIAL_SUBTREE_CHUNKS];
+
+  for (size_t done = 0; done < n; done += SERIAL_SUBTREE_CHUNKS) {
+    const size_t count = (n - done) < SERIAL_SUBTREE_CHUNKS
+                             ? (n - done)
+                             : SERIAL_SUBTREE_CHUNKS;
+    for (size_t i = 0; i < count; ++i)
+      ptrs[i] = in + (done + i) * BLAKE3_CHUNK_LEN;
+    k.hash_many(ptrs, count, BLAKE3_CHUNK_LEN / BLAKE3_BLOCK_LEN, key,
+                counter + done, true, flags, BLAKE3_CHUNK_START,
+                BLAKE3_CHUNK_END, cvs + done * 32);
+  }
+}
+
+/*
+ * Reduce n (a power of two) adjacent CVs to their subtree's CV in cvs[0..32).
+ * Each level reads pairs cvs[64i..64i+64) and writes cvs[32i..32i+32).
+ */
+static void reduce_parents3(uint8_t *cvs, size_t n, const uint32_t key[8],
+                            uint8_t flags) {
+  const detail::blake3_kernels &k = detail::blake3_get_kernels();
+  const uint8_t *ptrs[SERIAL_SUBTREE_CHUNKS];
+  const uint8_t parent_flags = static_cast<uint8_t>(flags | BLAKE3_PARENT);
+
+  while (n > 1) {
+    const size_t pairs = n / 2;
+    for (size_t done = 0; done < pairs; done += SERIAL_SUBTREE_CHUNKS) {
+      const size_t count = (pairs - done) < SERIAL_SUBTREE_CHUNKS
+                               ? (pairs - done)
+                               : SERIAL_SUBTREE_CHUNKS;
+      for (size_t i = 0; i < count; ++i)
+        ptrs[i] = cvs + (done + i) * 64;
+      k.hash_many(ptrs, count, 1, key, 0, false, parent_flags, 0, 0,
+                  cvs + done * 32);
+    }
+    n = pairs;
+  }
+}
+
+static void subtree_cv_serial(const tinyblake_blake3_state *S,
+                              const uint8_t *in, size_t n, uint8_t cv[32]) {
+  uint8_t cvs[SERIAL_SUBTREE_CHUNKS * 32];
+  hash_chunks3(in, n, S->key, S->chunk_counter, S->flags, cvs);
+  reduce_parents3(cvs, n, S->key, S->flags);
+  std::memcpy(cv, cvs, 32);
+  tinyblake_secure_zero(cvs, n * 32);
+}
+
+/* Split the subtree into power-of-two slices, one pool task each */
+static void subtree_cv_parallel(const tinyblake_blake3_state *S,
+                                const uint8_t *in, size_t n, size_t nthreads,
+                                uint8_t cv[32]) {
+  size_t parts = 1;
+  while (parts < nthreads * 4 && n / (parts * 2) >= PARALLEL_MIN_TASK_CHUNKS)
+    parts *= 2;
+  const size_t per = n / parts;
+
+  std::vector<uint8_t> cvs(n * 32);
+  auto task = [&](size_t p) {
+    uint8_t *slice = cvs.data() + p * per * 32;
+    hash_chunks3(in + p * per * BLAKE3_CHUNK_LEN, per, S->key,
+                 S->chunk_counter + p * per, S->flags, slice);
+    reduce_parents3(slice, per, S->key, S->flags);
+  };
+  detail::thread_pool::shared().parallel_for(parts, task, nthreads);
+
+  if (per > 1) {
+    for (size_t p = 1; p < parts; ++p)
+      std::memcpy(cvs.data() + p * 32, cvs.data() + p * per * 32, 32);
+  }
+  reduce_parents3(cvs.data(), parts, S->key, S->flags);
+  std::memcpy(cv, cvs.data(), 32);
+  tinyblake_secure_zero(cvs.data(), cvs.size());
+}
+
+static int update3(tinyblake_blake3_state *S, const void *in, size_t inlen,
+                   size_t nthreads) {
+  if (!S)
+    return -1;
+  if (S->buflen > BLAKE3_BLOCK_LEN ||
+      S->blocks_compressed >= BLAKE3_CHUNK_LEN / BLAKE3_BLOCK_LEN ||
+      S->cv_stack_len > TINYBLAKE_BLAKE3_MAX_DEPTH)
+    return -1;
+  if (inlen == 0)
+    return 0;
+  if (!in)
+    return -1;
+
+  const uint8_t *pin = static_cast<const uint8_t *>(in);
+  const size_t cap =
+      nthreads > 1 ? PARALLEL_SUBTREE_CHUNKS : SERIAL_SUBTREE_CHUNKS;
+
+  while (inlen > 0) {
+    if (chunk_len3(S) == BLAKE3_CHUNK_LEN)
+      finish_chunk3(S);
+
+    /* Whole subtrees, always leaving input behind for the current chunk */
+    if (chunk_len3(S) == 0 && inlen > BLAKE3_CHUNK_LEN) {
+      const size_t avail = (inlen - 1) / BLAKE3_CHUNK_LEN;
+      const size_t limit = avail < cap ? avail : cap;
+      size_t n = 1;
+      while (n * 2 <= limit)
+        n *= 2;
+      while ((S->chunk_counter & (n - 1)) != 0)
+        n /= 2;
+
+      uint8_t cv[32];
+      if (n > SERIAL_SUBTREE_CHUNKS)
+        subtree_cv_parallel(S, pin, n, nthreads, cv);
+      else
+        subtree_cv_serial(S, pin, n, cv);
+
+      S->chunk_counter += n;
+      push_cv3(S, cv, S->chunk_counter);
+      tinyblake_secure_zero(cv, sizeof(cv));
+
+      pin += n * BLAKE3_CHUNK_LEN;
+      inlen -= n * BLAKE3_CHUNK_LEN;
+      continue;
+    }
+
+    const size_t room = BLAKE3_CHUNK_LEN - chunk_len3(S);
+    const size_t take = inlen < room ? inlen : room;
+    chunk_update3(S, pin, take);
+    pin += take;
+    inlen -= take;
+  }
+  return 0;
+}
+
+static void final3(const tinyblake_blake3_state *S, uint64_t seek,
+                   uint8_t *out, size_t outlen) {
+  output3 o;
+  uint8_t cv[32];
+  chunk_output3(S, &o);
+  for (size_t i = S->cv_stack_len; i-- > 0;) {
+    output_cv3(o, cv);
+    parent_output3(S->cv_stack + i * 32, cv, S->key, S->flags, &o);
+  }
+  root_bytes3(o, seek, out, outlen);
+  tinyblake_secure_zero(&o, sizeof(o));
+  tinyblake_secure_zero(cv, sizeof(cv));
+}
+
+/* Requested split width; the pool itself caps the threads that run it */
+static size_t resolve_threads3(size_t threads) {
+  return threads != 0 ? threads : detail::thread_pool::shared().size();
+}
+
+} /* namespace tinyblake */
+
+/* ─── C API ─── */
+
+extern "C" {
+
+int tinyblake_blake3_init(tinyblake_blake3_state *state) {
+  if (!state)
+    return -1;
+  tinyblake::init3(state, tinyblake::IV3, 0);
+  return 0;
+}
+
+int tinyblake_blake3_init_keyed(tinyblake_blake3_state *state,
+                                const uint8_t key[32]) {
+  if (!state || !key)
+    return -1;
+
+  uint32_t words[8];
+  for (int i = 0; i < 8; ++i)
+    words[i] = tinyblake::detail::load_le32(key + i * 4);
+  tinyblake::init3(state, words, tinyblake::BLAKE3_KEYED_HASH);
+  tinyblake_secure_zero(words, sizeof(words));
+  return 0;
+}
+
+int tinyblake_blake3_init_derive_key(tinyblake_blake3_state *state,
+                                     const void *context, size_t contextlen) {
+  if (!state || (!context && contextlen > 0))
+    return -1;
+
+  tinyblake_blake3_state ctx;
+  tinyblake::init3(&ctx, tinyblake::IV3,
+                   tinyblake::BLAKE3_DERIVE_KEY_CONTEXT);
+  tinyblake::update3(&ctx, context, contextlen, 1);
+
+  uint8_t context_key[32];
+  tinyblake::final3(&ctx, 0, context_key, 32);
+
+  uint32_t words[8];
+  for (int i = 0; i < 8; ++i)
+    words[i] = tinyblake::detail::load_le32(context_key + i * 4);
+  tinyblake::init3(state, words, tinyblake::BLAKE3_DERIVE_KEY_MATERIAL);
+
+  tinyblake_secure_zero(&ctx, sizeof(ctx));
+  tinyblake_secure_zero(context_key, sizeof(context_key));
+  tinyblake_secure_zero(words, sizeof(words));
+  return 0;
+}
+
+int tinyblake_blake3_update(tinyblake_blake3_state *state, const void *in,
+                            size_t inlen) {
+  return tinyblake::update3(state, in, inlen, 1);
+}
+
+int tinyblake_blake3_update_parallel(tinyblake_blake3_state *state,
+                                     const void *in, size_t inlen,
+                                     size_t threads) {
+  return tinyblake::update3(state, in, inlen,
+                            tinyblake::resolve_threads3(threads));
+}
+
+int tinyblake_blake3_final(const tinyblake_blake3_state *state, void *out,
+                           size_t outlen) {
+  return tinyblake_blake3_final_seek(state, 0, out, outlen);
+}
+
+int tinyblake_blake3_final_seek(const tinyblake_blake3_state *state,
+                                uint64_t seek, void *out, size_t outlen) {
+  if (!state || !out || outlen == 0)
+    return -1;
+  if (state->buflen > 64 ||
+      state->cv_stack_len > TINYBLAKE_BLAKE3_MAX_DEPTH)
+    return -1;
+
+  tinyblake::final3(state, seek, static_cast<uint8_t *>(out), outlen);
+  return 0;
+}
+
+int tinyblake_blake3(void *out, size_t outlen, const void *in, size_t inlen,
+                     const uint8_t *key) {
+  tinyblake_blake3_state S;
+  int rc = key ? tinyblake_blake3_init_keyed(&S, key)
+               : tinyblake_blake3_init(&S);
+  if (rc == 0)
+    rc = tinyblake_blake3_update(&S, in, inlen);
+  if (rc == 0)
+    rc = tinyblake_blake3_final(&S, out, outlen);
+  tinyblake_secure_zero(&S, sizeof(S));
+  return rc;
+}
+
+int tinyblake_blake3_derive_key(void *out, size_t outlen, const void *context,
+                                size_t contextlen, const void *material,
+                                size_t materiallen) {
+  tinyblake_blake3_state S;
+  int rc = tinyblake_blake3_init_derive_key(&S, context, contextlen);
+  if (rc == 0)
+    rc = tinyblake_blake3_update(&S, material, materiallen);
+  if (rc == 0)
+    rc = tinyblake_blake3_final(&S, out, outlen);
+  tinyblake_secure_zero(&S, sizeof(S));
+  return rc;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::blake3 {
+
+hasher::hasher() { init3(&state_, IV3, 0); }
+
+hasher::hasher(const uint8_t key[32]) {
+  if (!key)
+    throw std::invalid_argument("Blake3: key must be non-null");
+  if (tinyblake_blake3_init_keyed(&state_, key) != 0)
+    throw std::runtime_error("Blake3: init_keyed failed");
+}
+
+hasher hasher::derive_key(const std::string &context) {
+  hasher h;
+  if (tinyblake_blake3_init_derive_key(&h.state_, context.data(),
+                                       context.size()) != 0)
+    throw std::runtime_error("Blake3: init_derive_key failed");
+  return h;
+}
+
+hasher::~hasher() { tinyblake_secure_zero(&state_, sizeof(state_)); }
+
+hasher::hasher(hasher &&o) noexcept : state_(o.state_) {
+  tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+}
+
+hasher &hasher::operator=(hasher &&o) noexcept {
+  if (this != &o) {
+    state_ = o.state_;
+    tinyblake_secure_zero(&o.state_, sizeof(o.state_));
+  }
+  return *this;
+}
+
+void hasher::update(const void *data, size_t len) {
+  if (tinyblake_blake3_update(&state_, data, len) != 0)
+    throw std::runtime_error("Blake3::update failed");
+}
+
+void hasher::update(const std::vector<uint8_t> &data) {
+  update(data.data(), data.size());
+}
+
+void hasher::update(const std::string &data) {
+  update(data.data(), data.size());
+}
+
+void hasher::update_parallel(const void *data, size_t len, size_t threads) {
+  if (tinyblake_blake3_update_parallel(&state_, data, len, threads) != 0)
+    throw std::runtime_error("Blake3::update_parallel failed");
+}
+
+std::vector<uint8_t> hasher::final_(size_t outlen) const {
+  if (outlen == 0)
+    throw std::invalid_argument("Blake3: outlen must be non-zero");
+  std::vector<uint8_t> out(outlen);
+  final_(out.data(), out.size());
+  return out;
+}
+
+void hasher::final_(void *out, size_t outlen) const {
+  if (tinyblake_blake3_final(&state_, out, outlen) != 0)
+    throw std::runtime_error("Blake3::final_ failed");
+}
+
+void hasher::final_seek(uint64_t seek, void *out, size_t outlen) const {
+  if (tinyblake_blake3_final_seek(&state_, seek, out, outlen) != 0)
+    throw std::runtime_error("Blake3::final_seek failed");
+}
+
+void hasher::reset() { init3(&state_, state_.key, state_.flags); }
+
+std::vector<uint8_t> hash(const void *data, size_t len, size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake3(out.data(), outlen, data, len, nullptr) != 0)
+    throw std::runtime_error("tinyblake::blake3::hash failed");
+  return out;
+}
+
+std::vector<uint8_t> hash(const std::vector<uint8_t> &data, size_t outlen) {
+  return hash(data.data(), data.size(), outlen);
+}
+
+std::vector<uint8_t> keyed_hash(const uint8_t key[32], const void *data,
+                                size_t len, size_t outlen) {
+  if (!key)
+    throw std::invalid_argument("blake3::keyed_hash: key must be non-null");
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake3(out.data(), outlen, data, len, key) != 0)
+    throw std::runtime_error("tinyblake::blake3::keyed_hash failed");
+  return out;
+}
+
+std::vector<uint8_t> derive_key(const std::string &context,
+                                const void *material, size_t len,
+                                size_t outlen) {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake3_derive_key(out.data(), outlen, context.data(),
+                                  context.size(), material, len) != 0)
+    throw std::runtime_error("tinyblake::blake3::derive_key failed");
+  return out;
+}
+
+std::vector<uint8_t> hash_parallel(const void *data, size_t len,
+                                   size_t outlen, size_t threads) {
+  hasher h;
+  h.update_parallel(data, len, threads);
+  return h.final_(outlen);
+}
+
+} /* namespace tinyblake::blake3 */
@@ -0,0 +1,297 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/chain.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "internal/stats.h"
+#include "internal/thread_pool.h"
+#include "tinyblake/blake2b.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * Hash chains. Only the first step goes through the streaming API; the
+ * remaining steps run inside the backend's iterate kernel, which feeds each
+ * digest straight back in as the next single-block message.
+ *
+ * Verification splits the chain at the checkpoints. Each pool task takes
+ * one group of segments (one per SIMD lane) and steps them in lockstep
+ * with the multi-lane iterate kernel.
+ */
+
+namespace tinyblake {
+
+/* First step: digest of the arbitrary-length input, as kernel words */
+static int chain_first_step(uint64_t d[8], size_t outlen, const void *in,
+                            size_t inlen) {
+  uint8_t buf[64] = {};
+  detail::stats_internal internal;
+  if (tinyblake_blake2b(buf, outlen, in, inlen, nullptr, 0) != 0)
+    return -1;
+  for (int i = 0; i < 8; ++i) {
+    d[i] = detail::load_le64(buf + i * 8);
+  }
+  tinyblake_secure_zero(buf, 64);
+  return 0;
+}
+
+static void chain_store(uint8_t *out, const uint64_t d[8], size_t outlen) {
+  uint8_t buf[64];
+  for (int i = 0; i < 8; ++i) {
+    detail::store_le64(buf + i * 8, d[i]);
+  }
+  std::memcpy(out, buf, outlen);
+  tinyblake_secure_zero(buf, 64);
+}
+
+static void chain_load(uint64_t d[8], const uint8_t *in, size_t outlen) {
+  uint8_t buf[64] = {};
+  std::memcpy(buf, in, outlen);
+  for (int i = 0; i < 8; ++i) {
+    d[i] = detail::load_le64(buf + i * 8);
+  }
+}
+
+static void atomic_min(std::atomic<size_t> &target, size_t value) {
+  size_t cur = target.load(std::memory_order_relaxed);
+  while (value < cur &&
+         !target.compare_exchange_weak(cur, value, std::memory_order_relaxed))
+    ;
+}
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_blake2b_iterate(void *out, size_t outlen, const void *in,
+                              size_t inlen, uint64_t n) {
+  if (!out || outlen == 0 || outlen > 64 || n == 0)
+    return -1;
+
+  uint64_t d[8];
+  if (tinyblake::chain_first_step(d, outlen, in, inlen) != 0)
+    return -1;
+
+  tinyblake::detail::blake2b_get_iterate()(d, outlen, n - 1);
+  tinyblake::chain_store(static_cast<uint8_t *>(out), d, outlen);
+
+  tinyblake_secure_zero(d, sizeof(d));
+  return 0;
+}
+
+int tinyblake_blake2b_iterate_checkpoints(void *out, size_t outlen,
+                                          const void *in, size_t inlen,
+                                          uint64_t n, uint64_t interval,
+                                          void *checkpoints,
+                                          size_t checkpoints_len) {
+  if (!out || outlen == 0 || outlen > 64 || n == 0 || interval == 0)
+    return -1;
+  const uint64_t count = n / interval;
+  if (count > SIZE_MAX / outlen || checkpoints_len < count * outlen)
+    return -1;
+  if (count > 0 && !checkpoints)
+    return -1;
+
+  const tinyblake::blake2b_iterate_fn iterate =
+      tinyblake::detail::blake2b_get_iterate();
+  uint8_t *cp = static_cast<uint8_t *>(checkpoints);
+
+  uint64_t d[8];
+  if (tinyblake::chain_first_step(d, outlen, in, inlen) != 0)
+    return -1;
+
+  uint64_t done = 1;
+  for (uint64_t c = 1; c <= count; ++c) {
+    const uint64_t target = c * interval;
+    iterate(d, outlen, target - done);
+    done = target;
+    tinyblake::chain_store(cp, d, outlen);
+    cp += outlen;
+  }
+  iterate(d, outlen, n - done);
+  tinyblake::chain_store(static_cast<uint8_t *>(out), d, outlen);
+
+  tinyblake_secure_zero(d, sizeof(d));
+  return 0;
+}
+
+int tinyblake_blake2b_chain_verify(const void *seed, size_t seedlen,
+                                   const void *checkpoints,
+                                   size_t ncheckpoints, size_t outlen,
+                                   uint64_t interval, size_t threads,
+                                   size_t *first_bad) {
+  using tinyblake::detail::BLAKE2B_MAX_LANES;
+
+  if (!first_bad || outlen == 0 || outlen > 64 || interval == 0)
+    return -1;
+  if (ncheckpoints == 0)
+    return 0;
+  if (!checkpoints || ncheckpoints > SIZE_MAX / outlen)
+    return -1;
+
+  uint64_t seed_digest[8];
+  if (tinyblake::chain_first_step(seed_digest, outlen, seed, seedlen) != 0)
+    return -1;
+
+  const tinyblake::detail::blake2b_lanes_kernel &kernel =
+      tinyblake::detail::blake2b_get_lanes();
+  const tinyblake::blake2b_iterate_fn single =
+      tinyblake::detail::blake2b_get_iterate();
+  const size_t lanes = kernel.lanes;
+  const uint8_t *cp = static_cast<const uint8_t *>(checkpoints);
+  const size_t ntasks = (ncheckpoints + lanes - 1) / lanes;
+  std::atomic<size_t> bad{SIZE_MAX};
+
+  auto task = [&](size_t t) {
+    const size_t base = t * lanes;
+    if (base > bad.load(std::memory_order_relaxed))
+      return; /* an earlier segment already failed */
+    const size_t count =
+        (ncheckpoints - base) < lanes ? (ncheckpoints - base) : lanes;
+
+    uint64_t d[BLAKE2B_MAX_LANES][8] = {};
+    uint64_t *ptrs[BLAKE2B_MAX_LANES];
+    for (size_t l = 0; l < lanes; ++l) {
+      ptrs[l] = d[l];
+      if (l >= count)
+        continue; /* idle lane */
+      const size_t j = base + l;
+      if (j == 0) {
+        std::memcpy(d[l], seed_digest, sizeof(seed_digest));
+      } else {
+        tinyblake::chain_load(d[l], cp + (j - 1) * outlen, outlen);
+        single(d[l], outlen, 1);
+      }
+    }
+
+    kernel.iterate(ptrs, outlen, interval - 1);
+
+    for (size_t l = 0; l < count; ++l) {
+      uint8_t got[64];
+      tinyblake::chain_store(got, d[l], outlen);
+      if (!tinyblake_constant_time_eq(got, cp + (base + l) * outlen, outlen))
+        tinyblake::atomic_min(bad, base + l);
+    }
+    tinyblake_secure_zero(d, sizeof(d));
+  };
+
+  tinyblake::detail::thread_pool::shared().parallel_for(ntasks, task,
+                                                        threads);
+
+  tinyblake_secure_zero(seed_digest, sizeof(seed_digest));
+  const size_t result = bad.load();
+  if (result == SIZE_MAX)
+    return 0;
+  *first_bad = result;
+  return 1;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::chain {
+
+std::vector<uint8_t> iterate(const void *data, size_t len, uint64_t n,
+                             size_t outlen) {
+  if (outlen == 0 || outlen > 64)
+    throw std::invalid_argument("chain::iterate: outlen must be 1..64");
+  if (n == 0)
+    throw std::invalid_argument("chain::iterate: n must be at least 1");
+
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_blake2b_iterate(out.data(), outlen, data, len, n) != 0)
+    throw std::runtime_error("chain::iterate failed");
+  return out;
+}
+
+std::vector<std::vector<uint8_t>> checkpoints(const void *data, size_t len,
+                                              uint64_t n, uint64_t interval,
+                                              size_t outlen) {
+  if (outlen == 0 || outlen > 64)
+    throw std::invalid_argument("chain::checkpoints: outlen must be 1..64");
+  if (n == 0 || interval == 0)
+    throw std::invalid_argument(
+        "chain::checkpoints: n and interval must be at least 1");
+
+  const uint64_t count = n / interval;
+  std::vector<uint8_t> flat(static_cast<size_t>(count) * outlen);
+  std::vector<uint8_t> last(outlen);
+  if (tinyblake_blake2b_iterate_checkpoints(last.data(), outlen, data, len, n,
+                                            interval, flat.data(),
+                                            flat.size()) != 0)
+    throw std::runtime_error("chain::checkpoints failed");
+
+  std::vector<std::vector<uint8_t>> result;
+  result.reserve(static_cast<size_t>(count));
+  for (uint64_t c = 0; c < count; ++c) {
+    const uint8_t *p = flat.data() + c * outlen;
+    result.emplace_back(p, p + outlen);
+  }
+  return result;
+}
+
+verify_result verify(const void *seed, size_t seedlen,
+                     const std::vector<std::vector<uint8_t>> &checkpoints,
+                     uint64_t steps_between, size_t threads) {
+  if (steps_between == 0)
+    throw std::invalid_argument(
+        "chain::verify: steps_between must be at least 1");
+  if (checkpoints.empty())
+    return {true, 0};
+
+  const size_t outlen = checkpoints[0].size();
+  if (outlen == 0 || outlen > 64)
+    throw std::invalid_argument(
+        "chain::verify: checkpoint length must be 1..64");
+
+  std::vector<uint8_t> flat;
+  flat.reserve(checkpoints.size() * outlen);
+  for (const auto &c : checkpoints) {
+    if (c.size() != outlen)
+      throw std::invalid_argument(
+          "chain::verify: checkpoints must all have the same length");
+    flat.insert(flat.end(), c.begin(), c.end());
+  }
+
+  size_t first_bad = 0;
+  const int rc = tinyblake_blake2b_chain_verify(
+      seed, seedlen, flat.data(), checkpoints.size(), outlen, steps_between,
+      threads, &first_bad);
+  if (rc < 0)
+    throw std::runtime_error("chain::verify failed");
+  if (rc == 1)
+    return {false, first_bad};
+  return {true, 0};
+}
+
+} /* namespace tinyblake::chain */
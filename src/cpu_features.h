@@ -35,11 +35,19 @@ namespace tinyblake {
 namespace cpu {
 
 struct Features {
+  bool ssse3 = false;
+  bool sse41 = false;
   bool avx2 = false;
   bool avx512f = false;
   bool avx512vl = false;
   bool avx512vbmi2 = false;
   bool neon = false;
+  bool sha3 = false; /* ARMv8.2 SHA3 extension: EOR3, XAR, RAX1, BCAX */
+  bool rvv = false;  /* RISC-V Vector extension 1.0 (V) */
+
+  /* x86-64 psABI micro-architecture level: 1 = baseline x86-64, 2..4 =
+   * x86-64-v2/v3/v4 (OS support for the AVX state included). 0 elsewhere. */
+  unsigned x86_level = 0;
 };
 
 /**
@@ -38,6 +38,26 @@
 #endif
 #endif
 
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_SHA3
+#define HWCAP_SHA3 (1UL << 17)
+#endif
+#elif defined(__aarch64__) && defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+#if defined(__riscv) && defined(__linux__)
+#include <sys/auxv.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(__has_include)
+#if __has_include(<asm/hwprobe.h>)
+#include <asm/hwprobe.h>
+#endif
+#endif
+#endif
+
 namespace tinyblake {
 namespace cpu {
 
@@ -45,25 +65,49 @@ static Features query_features() {
   Features f;
 
 #if defined(TINYBLAKE_X86)
+  /* Raw feature words kept for the x86-64 level computation below */
+  unsigned int leaf1_ecx = 0, leaf7_ebx = 0, ext1_ecx = 0;
+
 #if defined(_MSC_VER)
   int regs[4] = {0, 0, 0, 0};
 
   /* Check max basic leaf */
   __cpuid(regs, 0);
   int max_leaf = regs[0];
+  if (max_leaf >= 1) {
+    __cpuid(regs, 1);
+    f.ssse3 = (regs[2] & (1 << 9)) != 0;
+    f.sse41 = (regs[2] & (1 << 19)) != 0;
+    leaf1_ecx = static_cast<unsigned int>(regs[2]);
+  }
   if (max_leaf >= 7) {
     __cpuidex(regs, 7, 0);
+    leaf7_ebx = static_cast<unsigned int>(regs[1]);
     f.avx2 = (regs[1] & (1 << 5)) != 0;
     f.avx512f = (regs[1] & (1 << 16)) != 0;
     f.avx512vl = (regs[1] & (1 << 31)) != 0;
     f.avx512vbmi2 = (regs[2] & (1 << 6)) != 0;
   }
+  __cpuid(regs, static_cast<int>(0x80000000));
+  if (static_cast<unsigned int>(regs[0]) >= 0x80000001) {
+    __cpuid(regs, static_cast<int>(0x80000001));
+    ext1_ecx = static_cast<unsigned int>(regs[2]);
+  }
 #else
   unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
 
   /* Check max basic leaf */
   __get_cpuid(0, &eax, &ebx, &ecx, &edx);
-  if (eax >= 7) {
+  const unsigned int max_leaf = eax;
+  if (max_leaf >= 1) {
+    __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+    /* ECX bit 9: SSSE3 */
+    f.ssse3 = (ecx & (1u << 9)) != 0;
+    /* ECX bit 19: SSE4.1 */
+    f.sse41 = (ecx & (1u << 19)) != 0;
+    leaf1_ecx = ecx;
+  }
+  if (max_leaf >= 7) {
     __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx);
     /* EBX bit 5: AVX2 */
     f.avx2 = (ebx & (1u << 5)) != 0;
@@ -73,6 +117,11 @@ static Features query_features() {
     f.avx512vl = (ebx & (1u << 31)) != 0;
     /* ECX bit 6: AVX-512 VBMI2 */
     f.avx512vbmi2 = (ecx & (1u << 6)) != 0;
+    leaf7_ebx = ebx;
+  }
+  /* __get_cpuid checks the maximum extended leaf itself */
+  if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx)) {
+    ext1_ecx = ecx;
   }
 #endif
 
@@ -99,6 +148,33 @@ static Features query_features() {
       f.avx512vbmi2 = false;
     }
   }
+
+  /* x86-64 psABI levels. f.avx2 / f.avx512f are already cleared above when
+   * the OS does not save the YMM / ZMM state. */
+#if defined(__x86_64__) || defined(_M_X64)
+  auto has_all = [](unsigned int word, unsigned int bits) {
+    return (word & bits) == bits;
+  };
+  /* SSE3, SSSE3, CMPXCHG16B, SSE4.1, SSE4.2, POPCNT; LAHF/SAHF */
+  const bool v2 = has_all(leaf1_ecx, (1u << 0) | (1u << 9) | (1u << 13) |
+                                         (1u << 19) | (1u << 20) | (1u << 23)) &&
+                  has_all(ext1_ecx, 1u << 0);
+  /* FMA, MOVBE, OSXSAVE, AVX, F16C; BMI1, AVX2, BMI2; LZCNT */
+  const bool v3 = v2 && f.avx2 &&
+                  has_all(leaf1_ecx, (1u << 12) | (1u << 22) | (1u << 27) |
+                                         (1u << 28) | (1u << 29)) &&
+                  has_all(leaf7_ebx, (1u << 3) | (1u << 5) | (1u << 8)) &&
+                  has_all(ext1_ecx, 1u << 5);
+  /* AVX-512 F, DQ, CD, BW, VL */
+  const bool v4 = v3 && f.avx512f &&
+                  has_all(leaf7_ebx, (1u << 16) | (1u << 17) | (1u << 28) |
+                                         (1u << 30) | (1u << 31));
+  f.x86_level = v4 ? 4u : v3 ? 3u : v2 ? 2u : 1u;
+#else
+  (void)leaf1_ecx;
+  (void)leaf7_ebx;
+  (void)ext1_ecx;
+#endif
 #endif /* TINYBLAKE_X86 */
 
   /* ARM/AArch64 NEON detection */
@@ -112,6 +188,35 @@ static Features query_features() {
   f.neon = false; /* conservative: no runtime detection on 32-bit Windows ARM */
 #endif
 
+  /* ARMv8.2 SHA3 extension: kernel-reported HWCAP, not the build flags */
+#if defined(__aarch64__) && defined(__linux__)
+  f.sha3 = (getauxval(AT_HWCAP) & HWCAP_SHA3) != 0;
+#elif defined(__aarch64__) && defined(__APPLE__)
+  int has_sha3 = 0;
+  size_t len = sizeof(has_sha3);
+  if (sysctlbyname("hw.optional.armv8_2_sha3", &has_sha3, &len, nullptr, 0) ==
+      0) {
+    f.sha3 = has_sha3 != 0;
+  }
+#endif
+
+  /* RISC-V V: riscv_hwprobe (Linux 6.4+) first, since it also reports
+   * whether the kernel enabled vector state for user space; older kernels
+   * only have the single-letter ISA bits in AT_HWCAP */
+#if defined(__riscv) && defined(__linux__)
+  bool probed = false;
+#if defined(__NR_riscv_hwprobe) && defined(RISCV_HWPROBE_KEY_IMA_EXT_0)
+  struct riscv_hwprobe probe = {RISCV_HWPROBE_KEY_IMA_EXT_0, 0};
+  if (syscall(__NR_riscv_hwprobe, &probe, 1, 0, nullptr, 0) == 0) {
+    f.rvv = (probe.value & RISCV_HWPROBE_IMA_V) != 0;
+    probed = true;
+  }
+#endif
+  if (!probed) {
+    f.rvv = (getauxval(AT_HWCAP) & (1UL << ('V' - 'A'))) != 0;
+  }
+#endif
+
   return f;
 }
 
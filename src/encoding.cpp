@@ -0,0 +1,314 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/encoding.h"
+#include "backend/encoding_impl.h"
+#include "cpu_features.h"
+
+#include <stdexcept>
+
+/*
+ * Hex / base64url front end: the widest SIMD kernel takes whole vector
+ * blocks and the scalar codec, in the requested mode, finishes the tail.
+ */
+
+namespace tinyblake {
+
+/* ─── Dispatch ─── */
+
+struct encoding_kernels {
+  /* Null when only the scalar codecs are available */
+  hex_encode_fn hex_encode;
+  hex_decode_fn hex_decode;
+  base64url_encode_fn base64url_encode;
+  base64url_decode_fn base64url_decode;
+};
+
+static encoding_kernels resolve_kernels() {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  if (feat.avx2)
+    return {hex_encode_avx2, hex_decode_avx2, base64url_encode_avx2,
+            base64url_decode_avx2};
+  if (feat.ssse3)
+    return {hex_encode_ssse3, hex_decode_ssse3, base64url_encode_ssse3,
+            base64url_decode_ssse3};
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().neon)
+    return {hex_encode_neon, hex_decode_neon, base64url_encode_neon,
+            base64url_decode_neon};
+#endif
+  return {nullptr, nullptr, nullptr, nullptr};
+}
+
+static const encoding_kernels &get_kernels() {
+  static const encoding_kernels cached = resolve_kernels();
+  return cached;
+}
+
+/* ─── Codecs ─── */
+
+static size_t base64url_len(size_t inlen) {
+  return inlen / 3 * 4 + (inlen % 3 == 0 ? 0 : inlen % 3 + 1);
+}
+
+static void hex_encode(char *out, const uint8_t *in, size_t inlen, bool ct) {
+  const encoding_kernels &k = get_kernels();
+  const size_t done = k.hex_encode ? k.hex_encode(out, in, inlen) : 0;
+  hex_encode_scalar(out + 2 * done, in + done, inlen - done, ct);
+  out[2 * inlen] = '\0';
+}
+
+static void base64url_encode(char *out, const uint8_t *in, size_t inlen,
+                             bool ct) {
+  const encoding_kernels &k = get_kernels();
+  /* Kernels consume whole 3-byte groups, so the output offset is exact */
+  const size_t done =
+      k.base64url_encode ? k.base64url_encode(out, in, inlen) : 0;
+  const size_t written = done / 3 * 4;
+  base64url_encode_scalar(out + written, in + done, inlen - done, ct);
+  out[base64url_len(inlen)] = '\0';
+}
+
+} /* namespace tinyblake */
+
+/* ─── C API ─── */
+
+extern "C" {
+
+size_t tinyblake_hex_encoded_len(size_t inlen) { return 2 * inlen; }
+
+size_t tinyblake_base64url_encoded_len(size_t inlen) {
+  return tinyblake::base64url_len(inlen);
+}
+
+int tinyblake_hex_encode(char *out, size_t outcap, const void *in,
+                         size_t inlen, int flags) {
+  if (!out || (!in && inlen > 0) || (flags & ~TINYBLAKE_ENCODE_CONSTANT_TIME))
+    return -1;
+  if (inlen > (SIZE_MAX - 1) / 2 || outcap < 2 * inlen + 1)
+    return -1;
+  tinyblake::hex_encode(out, static_cast<const uint8_t *>(in), inlen,
+                        (flags & TINYBLAKE_ENCODE_CONSTANT_TIME) != 0);
+  return 0;
+}
+
+int tinyblake_hex_decode(void *out, size_t outcap, size_t *outlen,
+                         const char *in, size_t inlen, int flags) {
+  if ((!out && outcap > 0) || !outlen || (!in && inlen > 0) ||
+      (flags & ~TINYBLAKE_ENCODE_CONSTANT_TIME))
+    return -1;
+  if (inlen % 2 != 0 || outcap < inlen / 2)
+    return -1;
+
+  auto *dst = static_cast<uint8_t *>(out);
+  const tinyblake::encoding_kernels &k = tinyblake::get_kernels();
+  uint8_t err = 0;
+  const size_t done = k.hex_decode ? k.hex_decode(dst, in, inlen, &err) : 0;
+  tinyblake::hex_decode_scalar(dst + done / 2, in + done, inlen - done, &err,
+                               (flags & TINYBLAKE_ENCODE_CONSTANT_TIME) != 0);
+  if (err) {
+    tinyblake_secure_zero(dst, inlen / 2);
+    return -1;
+  }
+  *outlen = inlen / 2;
+  return 0;
+}
+
+int tinyblake_base64url_encode(char *out, size_t outcap, const void *in,
+                               size_t inlen, int flags) {
+  if (!out || (!in && inlen > 0) || (flags & ~TINYBLAKE_ENCODE_CONSTANT_TIME))
+    return -1;
+  if (inlen > (SIZE_MAX - 4) / 4 * 3 ||
+      outcap < tinyblake::base64url_len(inlen) + 1)
+    return -1;
+  tinyblake::base64url_encode(out, static_cast<const uint8_t *>(in), inlen,
+                              (flags & TINYBLAKE_ENCODE_CONSTANT_TIME) != 0);
+  return 0;
+}
+
+int tinyblake_base64url_decode(void *out, size_t outcap, size_t *outlen,
+                               const char *in, size_t inlen, int flags) {
+  if ((!out && outcap > 0) || !outlen || (!in && inlen > 0) ||
+      (flags & ~TINYBLAKE_ENCODE_CONSTANT_TIME))
+    return -1;
+  if (inlen % 4 == 1)
+    return -1;
+  const size_t n = inlen / 4 * 3 + (inlen % 4 == 0 ? 0 : inlen % 4 - 1);
+  if (outcap < n)
+    return -1;
+
+  auto *dst = static_cast<uint8_t *>(out);
+  const tinyblake::encoding_kernels &k = tinyblake::get_kernels();
+  uint8_t err = 0;
+  const size_t done =
+      k.base64url_decode ? k.base64url_decode(dst, in, inlen, &err) : 0;
+  tinyblake::base64url_decode_scalar(
+      dst + done / 4 * 3, in + done, inlen - done, &err,
+      (flags & TINYBLAKE_ENCODE_CONSTANT_TIME) != 0);
+  if (err) {
+    tinyblake_secure_zero(dst, n);
+    return -1;
+  }
+  *outlen = n;
+  return 0;
+}
+
+int tinyblake_hex_encode_many(char *out, size_t outcap, const void *in,
+                              size_t itemlen, size_t count, int flags) {
+  if (!out || (!in && itemlen * count > 0) ||
+      (flags & ~TINYBLAKE_ENCODE_CONSTANT_TIME))
+    return -1;
+  if (itemlen > (SIZE_MAX - 1) / 2)
+    return -1;
+  const size_t stride = 2 * itemlen + 1;
+  if (count > 0 && outcap / count < stride)
+    return -1;
+
+  const auto *src = static_cast<const uint8_t *>(in);
+  const bool ct = (flags & TINYBLAKE_ENCODE_CONSTANT_TIME) != 0;
+  for (size_t i = 0; i < count; ++i)
+    tinyblake::hex_encode(out + i * stride, src + i * itemlen, itemlen, ct);
+  return 0;
+}
+
+int tinyblake_base64url_encode_many(char *out, size_t outcap, const void *in,
+                                    size_t itemlen, size_t count, int flags) {
+  if (!out || (!in && itemlen * count > 0) ||
+      (flags & ~TINYBLAKE_ENCODE_CONSTANT_TIME))
+    return -1;
+  if (itemlen > (SIZE_MAX - 4) / 4 * 3)
+    return -1;
+  const size_t stride = tinyblake::base64url_len(itemlen) + 1;
+  if (count > 0 && outcap / count < stride)
+    return -1;
+
+  const auto *src = static_cast<const uint8_t *>(in);
+  const bool ct = (flags & TINYBLAKE_ENCODE_CONSTANT_TIME) != 0;
+  for (size_t i = 0; i < count; ++i)
+    tinyblake::base64url_encode(out + i * stride, src + i * itemlen, itemlen,
+                                ct);
+  return 0;
+}
+
+} /* extern "C" */
+
+/* ─── C++ API ─── */
+
+namespace tinyblake::hex {
+
+std::string encode(const void *data, size_t len, bool constant_time) {
+  std::string out(2 * len + 1, '\0');
+  if (tinyblake_hex_encode(&out[0], out.size(), data, len,
+                           constant_time ? TINYBLAKE_ENCODE_CONSTANT_TIME
+                                         : 0) != 0)
+    throw std::invalid_argument("hex::encode: invalid arguments");
+  out.pop_back();
+  return out;
+}
+
+std::string encode(const std::vector<uint8_t> &data, bool constant_time) {
+  return encode(data.data(), data.size(), constant_time);
+}
+
+std::vector<uint8_t> decode(const std::string &text, bool constant_time) {
+  std::vector<uint8_t> out(text.size() / 2);
+  size_t n = 0;
+  if (tinyblake_hex_decode(out.data(), out.size(), &n, text.data(),
+                           text.size(),
+                           constant_time ? TINYBLAKE_ENCODE_CONSTANT_TIME
+                                         : 0) != 0)
+    throw std::invalid_argument("hex::decode: malformed input");
+  return out;
+}
+
+std::vector<std::string> encode_many(const void *data, size_t itemlen,
+                                     size_t count, bool constant_time) {
+  const size_t stride = 2 * itemlen + 1;
+  std::string buf(stride * count, '\0');
+  if (count > 0 &&
+      tinyblake_hex_encode_many(&buf[0], buf.size(), data, itemlen, count,
+                                constant_time ? TINYBLAKE_ENCODE_CONSTANT_TIME
+                                              : 0) != 0)
+    throw std::invalid_argument("hex::encode_many: invalid arguments");
+  std::vector<std::string> out;
+  out.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+    out.emplace_back(buf.data() + i * stride, stride - 1);
+  return out;
+}
+
+} /* namespace tinyblake::hex */
+
+namespace tinyblake::base64url {
+
+std::string encode(const void *data, size_t len, bool constant_time) {
+  std::string out(base64url_len(len) + 1, '\0');
+  if (tinyblake_base64url_encode(&out[0], out.size(), data, len,
+                                 constant_time ? TINYBLAKE_ENCODE_CONSTANT_TIME
+                                               : 0) != 0)
+    throw std::invalid_argument("base64url::encode: invalid arguments");
+  out.pop_back();
+  return out;
+}
+
+std::string encode(const std::vector<uint8_t> &data, bool constant_time) {
+  return encode(data.data(), data.size(), constant_time);
+}
+
+std::vector<uint8_t> decode(const std::string &text, bool constant_time) {
+  std::vector<uint8_t> out(text.size() / 4 * 3 + 2);
+  size_t n = 0;
+  if (tinyblake_base64url_decode(out.data(), out.size(), &n, text.data(),
+                                 text.size(),
+                                 constant_time ? TINYBLAKE_ENCODE_CONSTANT_TIME
+                                               : 0) != 0)
+    throw std::invalid_argument("base64url::decode: malformed input");
+  out.resize(n);
+  return out;
+}
+
+std::vector<std::string> encode_many(const void *data, size_t itemlen,
+                                     size_t count, bool constant_time) {
+  const size_t stride = base64url_len(itemlen) + 1;
+  std::string buf(stride * count, '\0');
+  if (count > 0 &&
+      tinyblake_base64url_encode_many(
+          &buf[0], buf.size(), data, itemlen, count,
+          constant_time ? TINYBLAKE_ENCODE_CONSTANT_TIME : 0) != 0)
+    throw std::invalid_argument("base64url::encode_many: invalid arguments");
+  std::vector<std::string> out;
+  out.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+    out.emplace_back(buf.data() + i * stride, stride - 1);
+  return out;
+}
+
+} /* namespace tinyblake::base64url */
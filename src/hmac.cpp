@@ -26,7 +26,10 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include "internal/multiversion.h"
+
 #include "tinyblake/hmac.h"
+#include "internal/stats.h"
 
 #include <cstring>
 #include <stdexcept>
@@ -43,6 +46,8 @@
  * HMAC = BLAKE2b-512(opad || BLAKE2b-512(ipad || message))
  */
 
+#if TINYBLAKE_MV_EMIT_C_API
+
 static const size_t HMAC_BLOCK = 128;
 
 static int derive_pads(const void *key, size_t keylen, uint8_t ipad[128],
@@ -52,6 +57,7 @@ static int derive_pads(const void *key, size_t keylen, uint8_t ipad[128],
 
   if (keylen > HMAC_BLOCK) {
     /* Hash key down to 64 bytes */
+    tinyblake::detail::stats_internal internal;
     if (tinyblake_blake2b(keybuf, 64, key, keylen, nullptr, 0) != 0) {
       tinyblake_secure_zero(keybuf, 128);
       return -1;
@@ -143,6 +149,7 @@ int tinyblake_hmac_final(tinyblake_hmac_state *state, void *out,
 
 int tinyblake_hmac(void *out, size_t outlen, const void *key, size_t keylen,
                    const void *in, size_t inlen) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_HMAC);
   tinyblake_hmac_state state;
   int rc = tinyblake_hmac_init(&state, key, keylen);
   if (rc != 0)
@@ -155,6 +162,10 @@ int tinyblake_hmac(void *out, size_t outlen, const void *key, size_t keylen,
 
 } /* extern "C" */
 
+#endif /* TINYBLAKE_MV_EMIT_C_API */
+
+#if TINYBLAKE_MV_EMIT_SHARED
+
 /* ─── C++ wrapper ─── */
 
 namespace tinyblake::hmac {
@@ -164,6 +175,7 @@ hasher::hasher(const void *key, size_t keylen) {
     throw std::invalid_argument("Hmac: key must be non-null with keylen > 0");
   std::memset(key_pad_, 0, 128);
   if (keylen > 128) {
+    tinyblake::detail::stats_internal internal;
     tinyblake_blake2b(key_pad_, 64, key, keylen, nullptr, 0);
   } else {
     std::memcpy(key_pad_, key, keylen);
@@ -236,4 +248,6 @@ std::vector<uint8_t> mac(const void *key, size_t keylen, const void *data,
   return out;
 }
 
-} /* namespace tinyblake::hmac */
\ No newline at end of file
+} /* namespace tinyblake::hmac */
+
+#endif /* TINYBLAKE_MV_EMIT_SHARED */
\ No newline at end of file
@@ -0,0 +1,175 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_INTERNAL_BLAKE2B_DISPATCH_H
+#define TINYBLAKE_INTERNAL_BLAKE2B_DISPATCH_H
+
+#include "../backend/blake2b_compress.h"
+
+#include <cstddef>
+#include <cstdint>
+
+struct tinyblake_engine;
+
+namespace tinyblake {
+namespace detail {
+
+/* BLAKE2b IV, shared by the glue code outside blake2b.cpp */
+extern const uint64_t BLAKE2B_IV[8];
+
+/* Largest lane count of any multi-lane backend */
+constexpr size_t BLAKE2B_MAX_LANES = 8;
+
+/**
+ * Runtime-selected single-block compress function.
+ */
+TINYBLAKE_API blake2b_compress_fn blake2b_get_compress();
+
+/**
+ * Compress function for a call that will compress about `nbytes` bytes:
+ * the single-block, small or bulk kernel by the configured thresholds.
+ */
+TINYBLAKE_API blake2b_compress_fn blake2b_select_compress(size_t nbytes);
+
+/**
+ * This thread's default engine, or null when it follows the process-wide
+ * dispatch. Every blake2b_get_* and blake2b_select_compress() above
+ * already honours it.
+ */
+const tinyblake_engine *blake2b_thread_engine();
+
+/**
+ * Runtime-selected compress function for chaining values known to be
+ * 32-byte aligned (aligned SIMD loads/stores where the backend has them).
+ */
+blake2b_compress_fn blake2b_get_compress_aligned();
+
+/**
+ * Runtime-selected iterated-hash kernel.
+ */
+TINYBLAKE_API blake2b_iterate_fn blake2b_get_iterate();
+
+struct blake2b_lanes_kernel {
+  blake2b_compress_lanes_fn fn;
+  blake2b_iterate_lanes_fn iterate;
+  size_t lanes; /* 1 when no multi-lane backend is available */
+  /* Shared-message kernel of the same width; null where the backend has
+   * none (blake2b_lanes_hash_shared then replicates the block for fn) */
+  blake2b_compress_bcast_fn bcast;
+};
+
+/**
+ * Runtime-selected multi-lane compress and iterate functions and their lane
+ * count.
+ */
+TINYBLAKE_API const blake2b_lanes_kernel &blake2b_get_lanes();
+
+/**
+ * Initial chaining value for a 64-byte parameter block (IV ^ param).
+ */
+TINYBLAKE_API void blake2b_param_to_h(uint64_t h[8], const uint8_t param[64]);
+
+/* One contiguous piece of a lane's message */
+struct blake2b_segment {
+  const uint8_t *ptr;
+  size_t len;
+};
+
+/**
+ * Hash `n` independent messages through the multi-lane kernel, each given
+ * as a list of segments (segs[i][0..nsegs[i])) absorbed back to back.
+ *
+ * Lane i starts from chaining value h[i] and is left finalized in h[i].
+ * Lets callers interleave framing bytes with caller-owned data without
+ * building a concatenated copy.
+ */
+void blake2b_lanes_hash_segments(uint64_t (*h)[8],
+                                 const blake2b_segment *const segs[],
+                                 const size_t nsegs[], size_t n);
+
+/**
+ * As above with kernels the caller resolved, for work running on pool
+ * threads that do not share the caller's engine. `single` compresses
+ * groups with one active lane.
+ */
+void blake2b_lanes_hash_segments(const blake2b_lanes_kernel &kernel,
+                                 blake2b_compress_fn single,
+                                 uint64_t (*h)[8],
+                                 const blake2b_segment *const segs[],
+                                 const size_t nsegs[], size_t n);
+
+/**
+ * Streaming form of the above for messages too long to describe in one
+ * segment list. Lane i resumes at byte counter t[i] (nullptr = 0). With
+ * `tail` set, each lane holds back its last 1..128 bytes in tail[i]
+ * (length tail_len[i]) instead of finalizing and advances t[i]; the next
+ * call passes them as the lane's first segment. With `tail` null the
+ * lanes are finalized as in blake2b_lanes_hash_segments.
+ */
+void blake2b_lanes_absorb_segments(const blake2b_lanes_kernel &kernel,
+                                   blake2b_compress_fn single,
+                                   uint64_t (*h)[8], uint64_t t[],
+                                   const blake2b_segment *const segs[],
+                                   const size_t nsegs[], size_t n,
+                                   uint8_t (*tail)[128], size_t tail_len[]);
+
+/**
+ * Absorb one message into `n` chaining values at once (the same message
+ * under several keys). Every h[i] has already absorbed `t` bytes (its key
+ * or ipad block) and is left finalized; inlen must be non-zero. Message
+ * words are shared across lanes, so the bcast kernel is used when the
+ * backend has one.
+ */
+void blake2b_lanes_hash_shared(uint64_t (*h)[8], uint64_t t,
+                               const uint8_t *in, size_t inlen, size_t n);
+
+/**
+ * Hash `n` independent messages through the multi-lane kernel.
+ *
+ * Lane i starts from chaining value h[i] (see blake2b_param_to_h), absorbs
+ * the optional 128-byte `prefix` block (e.g. a padded key) followed by
+ * in[i][0..inlen[i]), and is left finalized in h[i]. Messages of unequal
+ * length are supported; lanes that finish early idle until the group ends.
+ */
+TINYBLAKE_API void blake2b_lanes_hash(uint64_t (*h)[8], const uint8_t *prefix,
+                                      const uint8_t *const in[],
+                                      const size_t inlen[], size_t n);
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+/* One backend's kernels, fixed for the life of the process */
+struct tinyblake_engine {
+  const char *name;
+  tinyblake::blake2b_compress_fn compress; /* single and final blocks */
+  tinyblake::blake2b_compress_fn compress_aligned; /* v2 states */
+  tinyblake::blake2b_iterate_fn iterate;           /* hash chains */
+  tinyblake::detail::blake2b_lanes_kernel lanes;   /* batches */
+};
+
+#endif /* TINYBLAKE_INTERNAL_BLAKE2B_DISPATCH_H */
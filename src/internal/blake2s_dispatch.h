@@ -0,0 +1,69 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_INTERNAL_BLAKE2S_DISPATCH_H
+#define TINYBLAKE_INTERNAL_BLAKE2S_DISPATCH_H
+
+#include "../backend/blake2s_compress.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tinyblake {
+namespace detail {
+
+/* BLAKE2s IV, shared by the glue code outside blake2s.cpp */
+extern const uint32_t BLAKE2S_IV[8];
+
+/* Largest lane count of any BLAKE2s multi-lane backend */
+constexpr size_t BLAKE2S_MAX_LANES = 8;
+
+/**
+ * Runtime-selected single-block BLAKE2s compress function.
+ */
+blake2s_compress_fn blake2s_get_compress();
+
+struct blake2s_lanes_kernel {
+  blake2s_compress_lanes_fn fn;
+  size_t lanes; /* 1 when no multi-lane backend is available */
+};
+
+/**
+ * Runtime-selected BLAKE2s multi-lane compress function and lane count.
+ */
+TINYBLAKE_API const blake2s_lanes_kernel &blake2s_get_lanes();
+
+/**
+ * Initial chaining value for a 32-byte parameter block (IV ^ param).
+ */
+void blake2s_param_to_h(uint32_t h[8], const uint8_t param[32]);
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_INTERNAL_BLAKE2S_DISPATCH_H */
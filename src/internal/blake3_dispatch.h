@@ -0,0 +1,57 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_INTERNAL_BLAKE3_DISPATCH_H
+#define TINYBLAKE_INTERNAL_BLAKE3_DISPATCH_H
+
+#include "../backend/blake3_impl.h"
+
+#include <cstddef>
+
+namespace tinyblake {
+namespace detail {
+
+/* Largest hash_many width of any BLAKE3 backend */
+constexpr size_t BLAKE3_MAX_SIMD_DEGREE = 16;
+
+struct blake3_kernels {
+  blake3_compress_in_place_fn compress_in_place;
+  blake3_compress_xof_fn compress_xof;
+  blake3_hash_many_fn hash_many;
+  size_t degree; /* inputs hash_many processes in one pass */
+};
+
+/**
+ * Runtime-selected BLAKE3 kernels.
+ */
+TINYBLAKE_API const blake3_kernels &blake3_get_kernels();
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_INTERNAL_BLAKE3_DISPATCH_H */
@@ -29,11 +29,14 @@
 #ifndef TINYBLAKE_INTERNAL_ENDIAN_H
 #define TINYBLAKE_INTERNAL_ENDIAN_H
 
+#include "multiversion.h"
+
 #include <cstdint>
 #include <cstring>
 
 namespace tinyblake {
 namespace detail {
+TINYBLAKE_MV_BEGIN
 
 inline uint64_t load_le64(const void *src) {
   uint64_t v;
@@ -77,6 +80,7 @@ inline void store_le32(void *dst, uint32_t v) {
   std::memcpy(dst, &v, 4);
 }
 
+TINYBLAKE_MV_END
 } /* namespace detail */
 } /* namespace tinyblake */
 
@@ -0,0 +1,117 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#ifndef TINYBLAKE_INTERNAL_MULTIVERSION_H
+#define TINYBLAKE_INTERNAL_MULTIVERSION_H
+
+/*
+ * x86-64 micro-architecture multiversioning (CMake X86_MULTIVERSION=ON).
+ *
+ * The C API glue in blake2b.cpp, hmac.cpp and pbkdf2.cpp is compiled once
+ * per psABI level (x86-64, -v2, -v3, -v4). Each copy is built with
+ * TINYBLAKE_MV_LEVEL=N and its entry points are renamed below to
+ * tinyblake_*_x86_64_vN. multiversion.cpp defines the real entry points and
+ * forwards each call to the copy picked once from cpu::detect().x86_level.
+ *
+ * Inline helpers shared with the rest of the library sit inside
+ * TINYBLAKE_MV_BEGIN / TINYBLAKE_MV_END, an inline namespace per level, so
+ * the linker never folds a -march=x86-64-v4 copy into baseline code.
+ *
+ * This header must come before any public header in those translation
+ * units so the declarations pick up the renamed symbols.
+ */
+
+/* The C entry points are compiled everywhere except the shared copy of a
+ * multiversioned build; the level-independent parts (dispatch state, C++
+ * wrappers) everywhere except the per-level copies. */
+#if !defined(TINYBLAKE_MULTIVERSION) || defined(TINYBLAKE_MV_LEVEL)
+#define TINYBLAKE_MV_EMIT_C_API 1
+#else
+#define TINYBLAKE_MV_EMIT_C_API 0
+#endif
+
+#if !defined(TINYBLAKE_MV_LEVEL)
+#define TINYBLAKE_MV_EMIT_SHARED 1
+#else
+#define TINYBLAKE_MV_EMIT_SHARED 0
+#endif
+
+#define TINYBLAKE_MV_CAT_(a, b, c) a##b##c
+#define TINYBLAKE_MV_CAT(a, b, c) TINYBLAKE_MV_CAT_(a, b, c)
+
+#if defined(TINYBLAKE_MV_LEVEL)
+
+#define TINYBLAKE_MV_SYM(name) TINYBLAKE_MV_CAT(name, _x86_64_v, TINYBLAKE_MV_LEVEL)
+
+#define TINYBLAKE_MV_BEGIN                                                     \
+  inline namespace TINYBLAKE_MV_CAT(mv_x86_64_v, TINYBLAKE_MV_LEVEL, ) {
+#define TINYBLAKE_MV_END }
+
+/* The level copies stay internal to a shared library: only the dispatching
+ * entry points in multiversion.cpp are exported */
+#include "tinyblake/common.h"
+#undef TINYBLAKE_API
+#define TINYBLAKE_API
+
+/* blake2b.h */
+#define tinyblake_blake2b_init TINYBLAKE_MV_SYM(tinyblake_blake2b_init)
+#define tinyblake_blake2b_init_key TINYBLAKE_MV_SYM(tinyblake_blake2b_init_key)
+#define tinyblake_blake2b_init_param                                           \
+  TINYBLAKE_MV_SYM(tinyblake_blake2b_init_param)
+#define tinyblake_blake2b_update TINYBLAKE_MV_SYM(tinyblake_blake2b_update)
+#define tinyblake_blake2b_final TINYBLAKE_MV_SYM(tinyblake_blake2b_final)
+#define tinyblake_blake2b TINYBLAKE_MV_SYM(tinyblake_blake2b)
+#define tinyblake_blake2b_init_v2 TINYBLAKE_MV_SYM(tinyblake_blake2b_init_v2)
+#define tinyblake_blake2b_init_key_v2                                          \
+  TINYBLAKE_MV_SYM(tinyblake_blake2b_init_key_v2)
+#define tinyblake_blake2b_init_param_v2                                        \
+  TINYBLAKE_MV_SYM(tinyblake_blake2b_init_param_v2)
+#define tinyblake_blake2b_update_v2                                            \
+  TINYBLAKE_MV_SYM(tinyblake_blake2b_update_v2)
+#define tinyblake_blake2b_final_v2 TINYBLAKE_MV_SYM(tinyblake_blake2b_final_v2)
+#define tinyblake_blake2b_ex TINYBLAKE_MV_SYM(tinyblake_blake2b_ex)
+#define tinyblake_blake2b_update_ex                                            \
+  TINYBLAKE_MV_SYM(tinyblake_blake2b_update_ex)
+#define tinyblake_blake2b_final_ex TINYBLAKE_MV_SYM(tinyblake_blake2b_final_ex)
+
+/* hmac.h */
+#define tinyblake_hmac_init TINYBLAKE_MV_SYM(tinyblake_hmac_init)
+#define tinyblake_hmac_update TINYBLAKE_MV_SYM(tinyblake_hmac_update)
+#define tinyblake_hmac_final TINYBLAKE_MV_SYM(tinyblake_hmac_final)
+#define tinyblake_hmac TINYBLAKE_MV_SYM(tinyblake_hmac)
+
+/* pbkdf2.h */
+#define tinyblake_pbkdf2 TINYBLAKE_MV_SYM(tinyblake_pbkdf2)
+
+#else
+
+#define TINYBLAKE_MV_BEGIN
+#define TINYBLAKE_MV_END
+
+#endif /* TINYBLAKE_MV_LEVEL */
+
+#endif /* TINYBLAKE_INTERNAL_MULTIVERSION_H */
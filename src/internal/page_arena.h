@@ -0,0 +1,73 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_INTERNAL_PAGE_ARENA_H
+#define TINYBLAKE_INTERNAL_PAGE_ARENA_H
+
+#include "tinyblake/common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tinyblake {
+namespace detail {
+
+/**
+ * Zero-initialised, page-backed buffer for large working sets.
+ *
+ * On Linux the arena first asks for explicit huge pages (MAP_HUGETLB),
+ * then falls back to ordinary pages with a transparent-huge-page hint;
+ * other systems get plain anonymous pages. Memory is wiped with
+ * tinyblake_secure_zero before release. Allocation failure leaves data()
+ * null instead of throwing, so C entry points can return -1.
+ */
+class TINYBLAKE_API page_arena {
+public:
+  explicit page_arena(size_t bytes);
+  ~page_arena();
+
+  page_arena(const page_arena &) = delete;
+  page_arena &operator=(const page_arena &) = delete;
+
+  uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+  /** True when the arena is backed by explicit huge pages. */
+  bool huge_pages() const { return huge_; }
+
+private:
+  uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+  size_t mapped_ = 0; /* bytes to release; 0 for heap memory */
+  bool huge_ = false;
+};
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_INTERNAL_PAGE_ARENA_H */
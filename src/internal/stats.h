@@ -0,0 +1,125 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_INTERNAL_STATS_H
+#define TINYBLAKE_INTERNAL_STATS_H
+
+#include "tinyblake/stats.h"
+
+#ifdef TINYBLAKE_STATS
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace tinyblake {
+namespace detail {
+
+#ifdef TINYBLAKE_STATS
+
+/* Sampling period (0 = off), read on every instrumented call */
+extern std::atomic<uint32_t> g_stats_rate;
+
+/* Calls since this thread's last sample, and the number of instrumented
+ * (or stats_internal) scopes open on it: only a call entered at depth 0
+ * ticks the sampler or records */
+inline thread_local uint32_t t_stats_tick = 0;
+inline thread_local uint32_t t_stats_depth = 0;
+
+/** Add one latency to the calling thread's histogram for `op`. */
+void stats_record(int op, uint64_t ns) noexcept;
+
+/**
+ * Times its scope into the calling thread's histogram for `op` when the
+ * call is sampled. Unsampled calls cost one relaxed load and a few
+ * thread-local increments.
+ */
+class stats_timer {
+public:
+  explicit stats_timer(int op) noexcept : op_(op) {
+    if (t_stats_depth++ != 0)
+      return;
+    const uint32_t rate = g_stats_rate.load(std::memory_order_relaxed);
+    if (rate == 0 || ++t_stats_tick < rate)
+      return;
+    t_stats_tick = 0;
+    sampled_ = true;
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  ~stats_timer() {
+    --t_stats_depth;
+    if (!sampled_)
+      return;
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    stats_record(op_, static_cast<uint64_t>(
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              elapsed)
+                              .count()));
+  }
+
+  stats_timer(const stats_timer &) = delete;
+  stats_timer &operator=(const stats_timer &) = delete;
+
+private:
+  std::chrono::steady_clock::time_point start_;
+  int op_;
+  bool sampled_ = false;
+};
+
+/**
+ * Wraps the library's own calls into instrumented entry points (from
+ * uninstrumented ones such as tinyblake_lthash16_digest) so they are
+ * neither ticked nor recorded as user calls.
+ */
+class stats_internal {
+public:
+  stats_internal() noexcept { ++t_stats_depth; }
+  ~stats_internal() { --t_stats_depth; }
+
+  stats_internal(const stats_internal &) = delete;
+  stats_internal &operator=(const stats_internal &) = delete;
+};
+
+#else
+
+class stats_timer {
+public:
+  explicit constexpr stats_timer(int) noexcept {}
+};
+
+class stats_internal {
+public:
+  constexpr stats_internal() noexcept {}
+};
+
+#endif /* TINYBLAKE_STATS */
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_INTERNAL_STATS_H */
@@ -0,0 +1,103 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef TINYBLAKE_INTERNAL_THREAD_POOL_H
+#define TINYBLAKE_INTERNAL_THREAD_POOL_H
+
+#include "tinyblake/common.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tinyblake {
+namespace detail {
+
+/**
+ * Fixed-size worker pool for data-parallel loops.
+ *
+ * parallel_for() hands out indices from a shared counter; the calling
+ * thread participates, so a pool of size 1 has no workers and runs
+ * everything inline. One loop runs at a time — calls from other threads
+ * queue on an internal mutex, and task bodies must not call back into the
+ * same pool.
+ *
+ * Members are exported one by one rather than the whole class, which
+ * would also export the standard-library members (MSVC C4251), so the
+ * unit tests can drive a pool in shared builds.
+ */
+class thread_pool {
+public:
+  /** @param threads  total threads including the caller (0 = hardware) */
+  TINYBLAKE_API explicit thread_pool(size_t threads);
+  TINYBLAKE_API ~thread_pool();
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  /** Threads that execute tasks, counting the caller. */
+  size_t size() const { return workers_.size() + 1; }
+
+  /**
+   * Run fn(i) for every i in [0, count) and wait for completion. At most
+   * max_threads threads (0 = all) work on the loop.
+   */
+  TINYBLAKE_API void parallel_for(size_t count,
+                                  const std::function<void(size_t)> &fn,
+                                  size_t max_threads = 0);
+
+  /** Process-wide pool sized to the hardware, created on first use. */
+  TINYBLAKE_API static thread_pool &shared();
+
+private:
+  void worker_loop(size_t id);
+  void run_tasks();
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_; /* serializes parallel_for calls */
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+
+  /* current job, guarded by mutex_ */
+  const std::function<void(size_t)> *fn_ = nullptr;
+  size_t count_ = 0;
+  size_t next_ = 0;
+  size_t active_limit_ = 0; /* workers with id < limit join the job */
+  size_t busy_ = 0;
+  size_t generation_ = 0;
+  bool stop_ = false;
+};
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+#endif /* TINYBLAKE_INTERNAL_THREAD_POOL_H */
@@ -0,0 +1,390 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "tinyblake/keyed_multi.h"
+#include "tinyblake/blake2b.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "internal/stats.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * One message, many keys. Each key is reduced once to a context holding the
+ * chaining value after its key (or ipad/opad) block, so every key has
+ * absorbed exactly 128 bytes and all lanes share the message counter. Keys
+ * are then processed in groups of BLAKE2B_MAX_LANES: the group's chaining
+ * values go through blake2b_lanes_hash_shared(), which broadcasts each
+ * message block to every lane, and the finished digests are handed to a
+ * sink while still hot, which is where verification compares them.
+ */
+
+namespace tinyblake {
+
+namespace {
+
+constexpr size_t GROUP = detail::BLAKE2B_MAX_LANES;
+
+void default_param(uint8_t param[64], size_t outlen, size_t keylen) {
+  std::memset(param, 0, 64);
+  param[0] = static_cast<uint8_t>(outlen);
+  param[1] = static_cast<uint8_t>(keylen);
+  param[2] = 1; /* fanout */
+  param[3] = 1; /* depth */
+}
+
+void store_digest(uint8_t out[64], const uint64_t h[8]) {
+  for (int i = 0; i < 8; ++i)
+    detail::store_le64(out + i * 8, h[i]);
+}
+
+bool valid_blake2b_ctxs(const tinyblake_blake2b_key_ctx ctxs[], size_t n) {
+  if (!ctxs || n == 0)
+    return false;
+  for (size_t i = 0; i < n; ++i)
+    if (ctxs[i].outlen == 0 || ctxs[i].outlen > 64)
+      return false;
+  return true;
+}
+
+/* sink(i, digest) receives the full 64-byte digest of key i */
+template <typename Sink>
+void blake2b_multi(const uint8_t *msg, size_t len,
+                   const tinyblake_blake2b_key_ctx ctxs[], size_t n,
+                   Sink &&sink) {
+  const blake2b_compress_fn single = detail::blake2b_get_compress();
+  uint64_t h[GROUP][8];
+  uint8_t digest[64];
+
+  for (size_t base = 0; base < n; base += GROUP) {
+    const size_t count = (n - base) < GROUP ? (n - base) : GROUP;
+    if (len == 0) {
+      /* The key block is the final block */
+      for (size_t l = 0; l < count; ++l) {
+        std::memcpy(h[l], ctxs[base + l].h0, sizeof(h[l]));
+        single(h[l], ctxs[base + l].key_block, 128, 0, true);
+      }
+    } else {
+      for (size_t l = 0; l < count; ++l)
+        std::memcpy(h[l], ctxs[base + l].h, sizeof(h[l]));
+      detail::blake2b_lanes_hash_shared(h, 128, msg, len, count);
+    }
+    for (size_t l = 0; l < count; ++l) {
+      store_digest(digest, h[l]);
+      sink(base + l, digest);
+    }
+  }
+
+  tinyblake_secure_zero(h, sizeof(h));
+  tinyblake_secure_zero(digest, sizeof(digest));
+}
+
+template <typename Sink>
+void hmac_multi(const uint8_t *msg, size_t len,
+                const tinyblake_hmac_key_ctx ctxs[], size_t n, Sink &&sink) {
+  const blake2b_compress_fn single = detail::blake2b_get_compress();
+  const detail::blake2b_lanes_kernel &kernel = detail::blake2b_get_lanes();
+  uint64_t inner[GROUP][8];
+  uint64_t outer[GROUP][8];
+  uint64_t idle[GROUP][8] = {};
+  alignas(64) uint8_t block[GROUP][128] = {};
+  uint8_t digest[64];
+
+  for (size_t base = 0; base < n; base += GROUP) {
+    const size_t count = (n - base) < GROUP ? (n - base) : GROUP;
+
+    /* Inner: BLAKE2b-512(ipad || msg), message shared across lanes */
+    if (len == 0) {
+      uint8_t param[64];
+      default_param(param, 64, 0);
+      for (size_t l = 0; l < count; ++l) {
+        detail::blake2b_param_to_h(inner[l], param);
+        single(inner[l], ctxs[base + l].ipad, 128, 0, true);
+      }
+    } else {
+      for (size_t l = 0; l < count; ++l)
+        std::memcpy(inner[l], ctxs[base + l].inner, sizeof(inner[l]));
+      detail::blake2b_lanes_hash_shared(inner, 128, msg, len, count);
+    }
+
+    /* Outer: BLAKE2b-512(opad || inner), one padded block per lane */
+    for (size_t l = 0; l < count; ++l) {
+      std::memcpy(outer[l], ctxs[base + l].outer, sizeof(outer[l]));
+      store_digest(block[l], inner[l]);
+    }
+    for (size_t g = 0; g < count; g += kernel.lanes) {
+      uint64_t *state[GROUP];
+      const uint8_t *blocks[GROUP];
+      uint64_t t0[GROUP], t1[GROUP], f0[GROUP];
+      for (size_t l = 0; l < kernel.lanes; ++l) {
+        const bool live = (g + l) < count;
+        state[l] = live ? outer[g + l] : idle[l];
+        blocks[l] = block[live ? g + l : 0];
+        t0[l] = 128 + 64;
+        t1[l] = 0;
+        f0[l] = ~uint64_t{0};
+      }
+      if (count - g == 1)
+        single(state[0], blocks[0], t0[0], 0, true);
+      else
+        kernel.fn(state, blocks, t0, t1, f0);
+    }
+
+    for (size_t l = 0; l < count; ++l) {
+      store_digest(digest, outer[l]);
+      sink(base + l, digest);
+    }
+  }
+
+  tinyblake_secure_zero(inner, sizeof(inner));
+  tinyblake_secure_zero(outer, sizeof(outer));
+  tinyblake_secure_zero(idle, sizeof(idle));
+  tinyblake_secure_zero(block, sizeof(block));
+  tinyblake_secure_zero(digest, sizeof(digest));
+}
+
+/* Branch-free match accumulator: remembers the first matching index */
+struct match_state {
+  size_t found = 0; /* 0 or 1 */
+  size_t index = 0;
+
+  void add(size_t i, const uint8_t *digest, const void *tag, size_t taglen) {
+    const size_t eq =
+        static_cast<size_t>(tinyblake_constant_time_eq(digest, tag, taglen));
+    const size_t take = eq & (found ^ 1);
+    index |= (size_t{0} - take) & i;
+    found |= eq;
+  }
+};
+
+} /* namespace */
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_blake2b_key_ctx_init(tinyblake_blake2b_key_ctx *ctx,
+                                   size_t outlen, const void *key,
+                                   size_t keylen) {
+  if (!ctx || outlen == 0 || outlen > 64)
+    return -1;
+  if (!key || keylen == 0 || keylen > 64)
+    return -1;
+
+  uint8_t param[64];
+  tinyblake::default_param(param, outlen, keylen);
+  std::memset(ctx, 0, sizeof(*ctx));
+  ctx->outlen = static_cast<uint8_t>(outlen);
+  tinyblake::detail::blake2b_param_to_h(ctx->h0, param);
+  std::memcpy(ctx->key_block, key, keylen);
+
+  std::memcpy(ctx->h, ctx->h0, sizeof(ctx->h));
+  tinyblake::detail::blake2b_get_compress()(ctx->h, ctx->key_block, 128, 0,
+                                            false);
+  return 0;
+}
+
+int tinyblake_hmac_key_ctx_init(tinyblake_hmac_key_ctx *ctx, const void *key,
+                                size_t keylen) {
+  if (!ctx || !key || keylen == 0)
+    return -1;
+
+  uint8_t keybuf[128] = {};
+  if (keylen > 128) {
+    tinyblake::detail::stats_internal internal;
+    if (tinyblake_blake2b(keybuf, 64, key, keylen, nullptr, 0) != 0)
+      return -1;
+  } else {
+    std::memcpy(keybuf, key, keylen);
+  }
+
+  uint8_t opad[128];
+  for (size_t i = 0; i < 128; ++i) {
+    ctx->ipad[i] = keybuf[i] ^ 0x36;
+    opad[i] = keybuf[i] ^ 0x5C;
+  }
+
+  uint8_t param[64];
+  tinyblake::default_param(param, 64, 0);
+  const tinyblake::blake2b_compress_fn compress =
+      tinyblake::detail::blake2b_get_compress();
+  tinyblake::detail::blake2b_param_to_h(ctx->inner, param);
+  std::memcpy(ctx->outer, ctx->inner, sizeof(ctx->outer));
+  compress(ctx->inner, ctx->ipad, 128, 0, false);
+  compress(ctx->outer, opad, 128, 0, false);
+
+  tinyblake_secure_zero(keybuf, sizeof(keybuf));
+  tinyblake_secure_zero(opad, sizeof(opad));
+  return 0;
+}
+
+int tinyblake_blake2b_keyed_multi(const void *msg, size_t len,
+                                  const tinyblake_blake2b_key_ctx key_ctxs[],
+                                  size_t nkeys, void *outs) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_KEYED_MULTI);
+  if ((len > 0 && !msg) || !outs ||
+      !tinyblake::valid_blake2b_ctxs(key_ctxs, nkeys))
+    return -1;
+
+  uint8_t *out = static_cast<uint8_t *>(outs);
+  tinyblake::blake2b_multi(
+      static_cast<const uint8_t *>(msg), len, key_ctxs, nkeys,
+      [&](size_t i, const uint8_t *digest) {
+        std::memcpy(out, digest, key_ctxs[i].outlen);
+        out += key_ctxs[i].outlen;
+      });
+  return 0;
+}
+
+int tinyblake_blake2b_keyed_multi_verify(
+    const void *msg, size_t len, const tinyblake_blake2b_key_ctx key_ctxs[],
+    size_t nkeys, const void *tag, size_t taglen, size_t *matched) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_KEYED_MULTI_VERIFY);
+  if ((len > 0 && !msg) || !tag ||
+      !tinyblake::valid_blake2b_ctxs(key_ctxs, nkeys))
+    return -1;
+  for (size_t i = 0; i < nkeys; ++i)
+    if (key_ctxs[i].outlen != taglen)
+      return -1;
+
+  tinyblake::match_state m;
+  tinyblake::blake2b_multi(static_cast<const uint8_t *>(msg), len, key_ctxs,
+                           nkeys, [&](size_t i, const uint8_t *digest) {
+                             m.add(i, digest, tag, taglen);
+                           });
+  if (!m.found)
+    return -1;
+  if (matched)
+    *matched = m.index;
+  return 0;
+}
+
+int tinyblake_hmac_multi(const void *msg, size_t len,
+                         const tinyblake_hmac_key_ctx key_ctxs[], size_t nkeys,
+                         void *outs) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_HMAC_MULTI);
+  if ((len > 0 && !msg) || !outs || !key_ctxs || nkeys == 0)
+    return -1;
+
+  uint8_t *out = static_cast<uint8_t *>(outs);
+  tinyblake::hmac_multi(static_cast<const uint8_t *>(msg), len, key_ctxs,
+                        nkeys, [&](size_t i, const uint8_t *digest) {
+                          std::memcpy(out + i * 64, digest, 64);
+                        });
+  return 0;
+}
+
+int tinyblake_hmac_multi_verify(const void *msg, size_t len,
+                                const tinyblake_hmac_key_ctx key_ctxs[],
+                                size_t nkeys, const void *tag, size_t taglen,
+                                size_t *matched) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_HMAC_VERIFY);
+  if ((len > 0 && !msg) || !tag || taglen == 0 || taglen > 64 || !key_ctxs ||
+      nkeys == 0)
+    return -1;
+
+  tinyblake::match_state m;
+  tinyblake::hmac_multi(static_cast<const uint8_t *>(msg), len, key_ctxs,
+                        nkeys, [&](size_t i, const uint8_t *digest) {
+                          m.add(i, digest, tag, taglen);
+                        });
+  if (!m.found)
+    return -1;
+  if (matched)
+    *matched = m.index;
+  return 0;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrappers ─── */
+
+namespace tinyblake::blake2b {
+
+key_ctx make_key_ctx(const void *key, size_t keylen, size_t outlen) {
+  key_ctx ctx;
+  if (tinyblake_blake2b_key_ctx_init(&ctx, outlen, key, keylen) != 0)
+    throw std::invalid_argument(
+        "Blake2b: key_ctx needs outlen 1..64 and a non-null key of 1..64 "
+        "bytes");
+  return ctx;
+}
+
+std::vector<uint8_t> keyed_multi(const void *msg, size_t len,
+                                 const std::vector<key_ctx> &keys) {
+  size_t total = 0;
+  for (const auto &k : keys)
+    total += k.outlen;
+  std::vector<uint8_t> out(total);
+  if (tinyblake_blake2b_keyed_multi(msg, len, keys.data(), keys.size(),
+                                    out.data()) != 0)
+    throw std::invalid_argument("tinyblake::blake2b::keyed_multi failed");
+  return out;
+}
+
+std::optional<size_t> keyed_multi_verify(const void *msg, size_t len,
+                                         const std::vector<key_ctx> &keys,
+                                         const void *tag, size_t taglen) {
+  size_t matched = 0;
+  if (tinyblake_blake2b_keyed_multi_verify(msg, len, keys.data(), keys.size(),
+                                           tag, taglen, &matched) != 0)
+    return std::nullopt;
+  return matched;
+}
+
+} /* namespace tinyblake::blake2b */
+
+namespace tinyblake::hmac {
+
+key_ctx make_key_ctx(const void *key, size_t keylen) {
+  key_ctx ctx;
+  if (tinyblake_hmac_key_ctx_init(&ctx, key, keylen) != 0)
+    throw std::invalid_argument("Hmac: key must be non-null with keylen > 0");
+  return ctx;
+}
+
+std::vector<uint8_t> mac_multi(const void *msg, size_t len,
+                               const std::vector<key_ctx> &keys) {
+  std::vector<uint8_t> out(keys.size() * 64);
+  if (tinyblake_hmac_multi(msg, len, keys.data(), keys.size(), out.data()) !=
+      0)
+    throw std::invalid_argument("tinyblake::hmac::mac_multi failed");
+  return out;
+}
+
+std::optional<size_t> verify_multi(const void *msg, size_t len,
+                                   const std::vector<key_ctx> &keys,
+                                   const void *tag, size_t taglen) {
+  size_t matched = 0;
+  if (tinyblake_hmac_multi_verify(msg, len, keys.data(), keys.size(), tag,
+                                  taglen, &matched) != 0)
+    return std::nullopt;
+  return matched;
+}
+
+} /* namespace tinyblake::hmac */
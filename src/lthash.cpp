@@ -0,0 +1,273 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/lthash.h"
+#include "backend/lthash_combine.h"
+#include "cpu_features.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/blake2xb.h"
+#include "internal/endian.h"
+#include "internal/stats.h"
+#include "tinyblake/blake2b.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * LtHash16: element -> BLAKE2Xb(element, 2048 bytes) -> 1024 x uint16 LE,
+ * checksum = sum of expansions mod 2^16 per lane.
+ *
+ * Batched updates hash element roots together on the multi-lane kernel
+ * (ELEM_BATCH at a time); each root's 32 output nodes are then expanded
+ * on the multi-lane kernel as well.
+ */
+
+namespace tinyblake {
+
+static const size_t ELEM_BATCH = 8;
+
+/* ─── Dispatch ─── */
+
+struct lthash16_kernels {
+  lthash16_combine_fn add;
+  lthash16_combine_fn sub;
+};
+
+static lthash16_kernels resolve_kernels() {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().avx2)
+    return {lthash16_add_avx2, lthash16_sub_avx2};
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (cpu::detect().neon)
+    return {lthash16_add_neon, lthash16_sub_neon};
+#endif
+  return {lthash16_add_portable, lthash16_sub_portable};
+}
+
+static const lthash16_kernels &get_kernels() {
+  static const lthash16_kernels cached = resolve_kernels();
+  return cached;
+}
+
+/* ─── Element expansion ─── */
+
+static void build_root_param(uint8_t param[64]) {
+  std::memset(param, 0, 64);
+  param[0] = 64; /* digest_length */
+  param[2] = 1;  /* fanout */
+  param[3] = 1;  /* depth */
+  detail::store_le32(param + 12, TINYBLAKE_LTHASH16_BYTES); /* xof_length */
+}
+
+static int update_many(tinyblake_lthash16 *state, const void *const elems[],
+                       const size_t lens[], size_t n, bool subtract) {
+  if (!state || (n > 0 && (!elems || !lens)))
+    return -1;
+  for (size_t i = 0; i < n; ++i) {
+    if (!elems[i] && lens[i] > 0)
+      return -1;
+  }
+
+  const lthash16_kernels &k = get_kernels();
+  const lthash16_combine_fn combine = subtract ? k.sub : k.add;
+
+  uint8_t param[64];
+  build_root_param(param);
+  uint64_t h0[8];
+  detail::blake2b_param_to_h(h0, param);
+
+  alignas(64) uint8_t expanded[TINYBLAKE_LTHASH16_BYTES];
+  uint64_t h[ELEM_BATCH][8];
+  const uint8_t *in[ELEM_BATCH];
+  size_t inlen[ELEM_BATCH];
+
+  for (size_t base = 0; base < n; base += ELEM_BATCH) {
+    const size_t count = (n - base) < ELEM_BATCH ? (n - base) : ELEM_BATCH;
+    for (size_t i = 0; i < count; ++i) {
+      std::memcpy(h[i], h0, sizeof(h0));
+      in[i] = static_cast<const uint8_t *>(elems[base + i]);
+      inlen[i] = lens[base + i];
+    }
+
+    detail::blake2b_lanes_hash(h, nullptr, in, inlen, count);
+
+    for (size_t i = 0; i < count; ++i) {
+      uint8_t root[64];
+      for (int w = 0; w < 8; ++w) {
+        detail::store_le64(root + w * 8, h[i][w]);
+      }
+      detail::blake2xb_expand(root, param, expanded, sizeof(expanded));
+      combine(state->sum, expanded);
+      tinyblake_secure_zero(root, 64);
+    }
+  }
+
+  tinyblake_secure_zero(expanded, sizeof(expanded));
+  tinyblake_secure_zero(h, sizeof(h));
+  return 0;
+}
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_lthash16_init(tinyblake_lthash16 *state) {
+  if (!state)
+    return -1;
+  std::memset(state->sum, 0, sizeof(state->sum));
+  return 0;
+}
+
+int tinyblake_lthash16_add(tinyblake_lthash16 *state, const void *elem,
+                           size_t len) {
+  const void *elems[1] = {elem};
+  return tinyblake::update_many(state, elems, &len, 1, false);
+}
+
+int tinyblake_lthash16_remove(tinyblake_lthash16 *state, const void *elem,
+                              size_t len) {
+  const void *elems[1] = {elem};
+  return tinyblake::update_many(state, elems, &len, 1, true);
+}
+
+int tinyblake_lthash16_add_many(tinyblake_lthash16 *state,
+                                const void *const elems[], const size_t lens[],
+                                size_t n) {
+  return tinyblake::update_many(state, elems, lens, n, false);
+}
+
+int tinyblake_lthash16_remove_many(tinyblake_lthash16 *state,
+                                   const void *const elems[],
+                                   const size_t lens[], size_t n) {
+  return tinyblake::update_many(state, elems, lens, n, true);
+}
+
+int tinyblake_lthash16_combine(tinyblake_lthash16 *state,
+                               const tinyblake_lthash16 *other) {
+  if (!state || !other)
+    return -1;
+  tinyblake::get_kernels().add(state->sum, other->sum);
+  return 0;
+}
+
+int tinyblake_lthash16_subtract(tinyblake_lthash16 *state,
+                                const tinyblake_lthash16 *other) {
+  if (!state || !other)
+    return -1;
+  tinyblake::get_kernels().sub(state->sum, other->sum);
+  return 0;
+}
+
+int tinyblake_lthash16_digest(const tinyblake_lthash16 *state, void *out,
+                              size_t outlen) {
+  if (!state || !out || outlen == 0 || outlen > 64)
+    return -1;
+  tinyblake::detail::stats_internal internal;
+  return tinyblake_blake2b(out, outlen, state->sum, sizeof(state->sum),
+                           nullptr, 0);
+}
+
+int tinyblake_lthash16_eq(const tinyblake_lthash16 *a,
+                          const tinyblake_lthash16 *b) {
+  if (!a || !b)
+    return 0;
+  return tinyblake_constant_time_eq(a->sum, b->sum, sizeof(a->sum));
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::lthash {
+
+lthash16::lthash16() { tinyblake_lthash16_init(&state_); }
+
+void lthash16::add(const void *elem, size_t len) {
+  if (tinyblake_lthash16_add(&state_, elem, len) != 0)
+    throw std::invalid_argument("LtHash16::add: null element");
+}
+
+void lthash16::add(const std::vector<uint8_t> &elem) {
+  add(elem.data(), elem.size());
+}
+
+void lthash16::add(const std::string &elem) { add(elem.data(), elem.size()); }
+
+void lthash16::remove(const void *elem, size_t len) {
+  if (tinyblake_lthash16_remove(&state_, elem, len) != 0)
+    throw std::invalid_argument("LtHash16::remove: null element");
+}
+
+void lthash16::remove(const std::vector<uint8_t> &elem) {
+  remove(elem.data(), elem.size());
+}
+
+void lthash16::remove(const std::string &elem) {
+  remove(elem.data(), elem.size());
+}
+
+void lthash16::add_many(const void *const elems[], const size_t lens[],
+                        size_t n) {
+  if (tinyblake_lthash16_add_many(&state_, elems, lens, n) != 0)
+    throw std::invalid_argument("LtHash16::add_many: null element");
+}
+
+void lthash16::remove_many(const void *const elems[], const size_t lens[],
+                           size_t n) {
+  if (tinyblake_lthash16_remove_many(&state_, elems, lens, n) != 0)
+    throw std::invalid_argument("LtHash16::remove_many: null element");
+}
+
+lthash16 &lthash16::operator+=(const lthash16 &other) {
+  tinyblake_lthash16_combine(&state_, &other.state_);
+  return *this;
+}
+
+lthash16 &lthash16::operator-=(const lthash16 &other) {
+  tinyblake_lthash16_subtract(&state_, &other.state_);
+  return *this;
+}
+
+bool lthash16::operator==(const lthash16 &other) const {
+  return tinyblake_lthash16_eq(&state_, &other.state_) == 1;
+}
+
+bool lthash16::operator!=(const lthash16 &other) const {
+  return !(*this == other);
+}
+
+std::vector<uint8_t> lthash16::digest(size_t outlen) const {
+  std::vector<uint8_t> out(outlen);
+  if (tinyblake_lthash16_digest(&state_, out.data(), outlen) != 0)
+    throw std::invalid_argument("LtHash16::digest: outlen must be 1..64");
+  return out;
+}
+
+} /* namespace tinyblake::lthash */
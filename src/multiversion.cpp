@@ -0,0 +1,172 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "tinyblake/blake2b.h"
+#include "tinyblake/hmac.h"
+#include "tinyblake/pbkdf2.h"
+#include "cpu_features.h"
+
+/*
+ * Public entry points of a multiversioned build (see
+ * internal/multiversion.h). blake2b.cpp, hmac.cpp and pbkdf2.cpp are
+ * compiled once per x86-64 level with their C functions renamed to
+ * tinyblake_*_x86_64_vN; the definitions below pick one table of those
+ * copies on first use and forward every call through it, so the whole
+ * call runs at one level and nothing below the API boundary dispatches
+ * again except the compress kernel itself.
+ */
+
+/* return type, name, parameter list, argument list */
+#define TINYBLAKE_MV_API(X)                                                    \
+  X(int, tinyblake_blake2b_init,                                               \
+    (tinyblake_blake2b_state * state, size_t outlen), (state, outlen))         \
+  X(int, tinyblake_blake2b_init_key,                                           \
+    (tinyblake_blake2b_state * state, size_t outlen, const void *key,          \
+     size_t keylen),                                                           \
+    (state, outlen, key, keylen))                                              \
+  X(int, tinyblake_blake2b_init_param,                                         \
+    (tinyblake_blake2b_state * state, const uint8_t param[64]),                \
+    (state, param))                                                            \
+  X(int, tinyblake_blake2b_update,                                             \
+    (tinyblake_blake2b_state * state, const void *in, size_t inlen),           \
+    (state, in, inlen))                                                        \
+  X(int, tinyblake_blake2b_final,                                              \
+    (tinyblake_blake2b_state * state, void *out, size_t outlen),               \
+    (state, out, outlen))                                                      \
+  X(int, tinyblake_blake2b,                                                    \
+    (void *out, size_t outlen, const void *in, size_t inlen, const void *key,  \
+     size_t keylen),                                                           \
+    (out, outlen, in, inlen, key, keylen))                                     \
+  X(int, tinyblake_blake2b_init_v2,                                            \
+    (tinyblake_blake2b_state_v2 * state, size_t outlen), (state, outlen))      \
+  X(int, tinyblake_blake2b_init_key_v2,                                        \
+    (tinyblake_blake2b_state_v2 * state, size_t outlen, const void *key,       \
+     size_t keylen),                                                           \
+    (state, outlen, key, keylen))                                              \
+  X(int, tinyblake_blake2b_init_param_v2,                                      \
+    (tinyblake_blake2b_state_v2 * state, const uint8_t param[64]),             \
+    (state, param))                                                            \
+  X(int, tinyblake_blake2b_update_v2,                                          \
+    (tinyblake_blake2b_state_v2 * state, const void *in, size_t inlen),        \
+    (state, in, inlen))                                                        \
+  X(int, tinyblake_blake2b_final_v2,                                           \
+    (tinyblake_blake2b_state_v2 * state, void *out, size_t outlen),            \
+    (state, out, outlen))                                                      \
+  X(int, tinyblake_blake2b_ex,                                                 \
+    (const tinyblake_engine *engine, void *out, size_t outlen, const void *in, \
+     size_t inlen, const void *key, size_t keylen),                            \
+    (engine, out, outlen, in, inlen, key, keylen))                             \
+  X(int, tinyblake_blake2b_update_ex,                                          \
+    (const tinyblake_engine *engine, tinyblake_blake2b_state *state,           \
+     const void *in, size_t inlen),                                            \
+    (engine, state, in, inlen))                                                \
+  X(int, tinyblake_blake2b_final_ex,                                           \
+    (const tinyblake_engine *engine, tinyblake_blake2b_state *state,           \
+     void *out, size_t outlen),                                                \
+    (engine, state, out, outlen))                                              \
+  X(int, tinyblake_hmac_init,                                                  \
+    (tinyblake_hmac_state * state, const void *key, size_t keylen),            \
+    (state, key, keylen))                                                      \
+  X(int, tinyblake_hmac_update,                                                \
+    (tinyblake_hmac_state * state, const void *in, size_t inlen),              \
+    (state, in, inlen))                                                        \
+  X(int, tinyblake_hmac_final,                                                 \
+    (tinyblake_hmac_state * state, void *out, size_t outlen),                  \
+    (state, out, outlen))                                                      \
+  X(int, tinyblake_hmac,                                                       \
+    (void *out, size_t outlen, const void *key, size_t keylen, const void *in, \
+     size_t inlen),                                                            \
+    (out, outlen, key, keylen, in, inlen))                                     \
+  X(int, tinyblake_pbkdf2,                                                     \
+    (void *out, size_t outlen, const void *password, size_t passlen,           \
+     const void *salt, size_t saltlen, uint32_t rounds),                       \
+    (out, outlen, password, passlen, salt, saltlen, rounds))
+
+/* ─── Per-level copies ─── */
+
+#define DECLARE_LEVEL_FN(ret, name, params, args)                              \
+  ret name##_x86_64_v1 params;                                                 \
+  ret name##_x86_64_v2 params;                                                 \
+  ret name##_x86_64_v3 params;                                                 \
+  ret name##_x86_64_v4 params;
+
+extern "C" {
+TINYBLAKE_MV_API(DECLARE_LEVEL_FN)
+}
+
+#undef DECLARE_LEVEL_FN
+
+namespace tinyblake {
+namespace {
+
+struct api_table {
+#define TABLE_FIELD(ret, name, params, args) ret(*name) params;
+  TINYBLAKE_MV_API(TABLE_FIELD)
+#undef TABLE_FIELD
+};
+
+#define TABLE_ENTRY_V1(ret, name, params, args) name##_x86_64_v1,
+#define TABLE_ENTRY_V2(ret, name, params, args) name##_x86_64_v2,
+#define TABLE_ENTRY_V3(ret, name, params, args) name##_x86_64_v3,
+#define TABLE_ENTRY_V4(ret, name, params, args) name##_x86_64_v4,
+
+/* Indexed by x86_level - 1 */
+const api_table TABLES[4] = {
+    {TINYBLAKE_MV_API(TABLE_ENTRY_V1)},
+    {TINYBLAKE_MV_API(TABLE_ENTRY_V2)},
+    {TINYBLAKE_MV_API(TABLE_ENTRY_V3)},
+    {TINYBLAKE_MV_API(TABLE_ENTRY_V4)},
+};
+
+#undef TABLE_ENTRY_V1
+#undef TABLE_ENTRY_V2
+#undef TABLE_ENTRY_V3
+#undef TABLE_ENTRY_V4
+
+const api_table &resolve_api() {
+  const unsigned level = cpu::detect().x86_level;
+  return TABLES[level >= 1 && level <= 4 ? level - 1 : 0];
+}
+
+const api_table &api() {
+  static const api_table &cached = resolve_api();
+  return cached;
+}
+
+} /* namespace */
+} /* namespace tinyblake */
+
+/* ─── Public entry points ─── */
+
+extern "C" {
+
+#define FORWARD(ret, name, params, args)                                       \
+  ret name params { return tinyblake::api().name args; }
+TINYBLAKE_MV_API(FORWARD)
+#undef FORWARD
+
+} /* extern "C" */
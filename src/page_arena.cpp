@@ -0,0 +1,103 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "internal/page_arena.h"
+#include "tinyblake/common.h"
+
+#include <new>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
+
+namespace tinyblake {
+namespace detail {
+
+#if defined(__linux__)
+static const size_t HUGE_PAGE_BYTES = size_t{2} << 20;
+#endif
+
+page_arena::page_arena(size_t bytes) : size_(bytes) {
+  if (bytes == 0)
+    return;
+
+#if defined(_WIN32)
+  void *p = VirtualAlloc(nullptr, bytes, MEM_COMMIT | MEM_RESERVE,
+                         PAGE_READWRITE);
+  if (p) {
+    data_ = static_cast<uint8_t *>(p);
+    mapped_ = bytes;
+  }
+#elif defined(__unix__) || defined(__APPLE__)
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  if (bytes >= HUGE_PAGE_BYTES && bytes <= SIZE_MAX - HUGE_PAGE_BYTES) {
+    const size_t rounded =
+        (bytes + HUGE_PAGE_BYTES - 1) & ~(HUGE_PAGE_BYTES - 1);
+    void *p = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED) {
+      data_ = static_cast<uint8_t *>(p);
+      mapped_ = rounded;
+      huge_ = true;
+      return;
+    }
+  }
+#endif
+  void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p != MAP_FAILED) {
+    data_ = static_cast<uint8_t *>(p);
+    mapped_ = bytes;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (bytes >= HUGE_PAGE_BYTES)
+      madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+  }
+#else
+  data_ = new (std::nothrow) uint8_t[bytes]();
+#endif
+}
+
+page_arena::~page_arena() {
+  if (!data_)
+    return;
+  tinyblake_secure_zero(data_, size_);
+
+#if defined(_WIN32)
+  VirtualFree(data_, 0, MEM_RELEASE);
+#elif defined(__unix__) || defined(__APPLE__)
+  munmap(data_, mapped_);
+#else
+  delete[] data_;
+#endif
+}
+
+} /* namespace detail */
+} /* namespace tinyblake */
@@ -26,8 +26,11 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include "internal/multiversion.h"
+
 #include "tinyblake/pbkdf2.h"
 #include "tinyblake/hmac.h"
+#include "internal/stats.h"
 
 #include <climits>
 #include <cstring>
@@ -43,6 +46,8 @@
  * Uj = PRF(P, U_{j-1})
  */
 
+#if TINYBLAKE_MV_EMIT_C_API
+
 static const size_t HLEN = 64; /* HMAC-BLAKE2b-512 output */
 
 static void store_be32(uint8_t dst[4], uint32_t v) {
@@ -55,6 +60,7 @@ static void store_be32(uint8_t dst[4], uint32_t v) {
 extern "C" int tinyblake_pbkdf2(void *out, size_t outlen, const void *password,
                                 size_t passlen, const void *salt,
                                 size_t saltlen, uint32_t rounds) {
+  tinyblake::detail::stats_timer timer(TINYBLAKE_STATS_PBKDF2);
   if (!out || outlen == 0)
     return -1;
   if (rounds == 0)
@@ -135,6 +141,10 @@ extern "C" int tinyblake_pbkdf2(void *out, size_t outlen, const void *password,
   return 0;
 }
 
+#endif /* TINYBLAKE_MV_EMIT_C_API */
+
+#if TINYBLAKE_MV_EMIT_SHARED
+
 /* ─── C++ wrapper ─── */
 
 namespace tinyblake::pbkdf2 {
@@ -156,4 +166,6 @@ std::vector<uint8_t> derive(const std::string &password,
                 rounds, outlen);
 }
 
-} /* namespace tinyblake::pbkdf2 */
\ No newline at end of file
+} /* namespace tinyblake::pbkdf2 */
+
+#endif /* TINYBLAKE_MV_EMIT_SHARED */
\ No newline at end of file
@@ -0,0 +1,328 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/pow.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "internal/thread_pool.h"
+#include "tinyblake/blake2b.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * Nonce search. The header's full blocks are compressed once into a
+ * midstate; every candidate then costs one (or, when the nonce straddles a
+ * block boundary, two) compressions. Pool threads claim fixed-size nonce
+ * chunks in increasing order and evaluate one nonce per SIMD lane, so the
+ * first hit found is refined to the smallest qualifying nonce: every chunk
+ * below a hit has already been claimed and runs to completion.
+ */
+
+namespace tinyblake {
+
+static const uint64_t POW_CHUNK = 4096; /* nonces claimed per step */
+
+namespace {
+
+struct pow_job {
+  uint64_t mid[8];   /* chaining value after the header's full blocks */
+  uint8_t tail[128]; /* header bytes after the midstate */
+  size_t tail_len;
+  uint64_t t_base; /* header bytes absorbed into the midstate */
+  size_t outlen;
+  const uint8_t *target;
+};
+
+void pow_setup(pow_job &job, const uint8_t *header, size_t headerlen,
+               size_t outlen, const uint8_t *target) {
+  uint8_t param[64] = {};
+  param[0] = static_cast<uint8_t>(outlen); /* digest_length */
+  param[2] = 1;                            /* fanout */
+  param[3] = 1;                            /* depth */
+  detail::blake2b_param_to_h(job.mid, param);
+
+  const blake2b_compress_fn compress = detail::blake2b_get_compress();
+  const size_t full = headerlen / 128;
+  for (size_t i = 0; i < full; ++i) {
+    compress(job.mid, header + i * 128, static_cast<uint64_t>(i + 1) * 128, 0,
+             false);
+  }
+
+  job.t_base = static_cast<uint64_t>(full) * 128;
+  job.tail_len = headerlen - full * 128;
+  if (job.tail_len > 0)
+    std::memcpy(job.tail, header + full * 128, job.tail_len);
+  job.outlen = outlen;
+  job.target = target;
+}
+
+bool pow_meets(const uint64_t h[8], const pow_job &job, uint8_t digest[64]) {
+  for (int w = 0; w < 8; ++w) {
+    detail::store_le64(digest + w * 8, h[w]);
+  }
+  return std::memcmp(digest, job.target, job.outlen) <= 0;
+}
+
+void pow_atomic_min(std::atomic<uint64_t> &target, uint64_t value) {
+  uint64_t cur = target.load(std::memory_order_relaxed);
+  while (value < cur &&
+         !target.compare_exchange_weak(cur, value, std::memory_order_relaxed))
+    ;
+}
+
+/* Per-thread search state: one message buffer and chaining value per lane.
+ * The kernel is resolved by the caller: pool workers do not inherit the
+ * calling thread's engine. */
+class pow_worker {
+public:
+  pow_worker(const pow_job &job, const detail::blake2b_lanes_kernel &kernel)
+      : job_(job), kernel_(kernel) {
+    const size_t total = job.tail_len + 8;
+    two_blocks_ = total > 128;
+    std::memset(msg_, 0, sizeof(msg_));
+    for (size_t l = 0; l < kernel_.lanes; ++l) {
+      if (job.tail_len > 0)
+        std::memcpy(msg_[l], job.tail, job.tail_len);
+      state_[l] = h_[l];
+      block0_[l] = msg_[l];
+      block1_[l] = msg_[l] + 128;
+      t0_mid_[l] = job.t_base + 128;
+      t0_end_[l] = job.t_base + total;
+      t1_[l] = 0;
+      f0_zero_[l] = 0;
+      f0_last_[l] = ~uint64_t{0};
+    }
+  }
+
+  size_t lanes() const { return kernel_.lanes; }
+
+  /* Evaluate nonces [first, first + count); index of the first hit, or
+   * count when none qualifies. */
+  size_t eval(uint64_t first, size_t count) {
+    for (size_t l = 0; l < kernel_.lanes; ++l) {
+      std::memcpy(h_[l], job_.mid, sizeof(job_.mid));
+      detail::store_le64(msg_[l] + job_.tail_len, first + (l < count ? l : 0));
+    }
+
+    if (two_blocks_) {
+      kernel_.fn(state_, block0_, t0_mid_, t1_, f0_zero_);
+      kernel_.fn(state_, block1_, t0_end_, t1_, f0_last_);
+    } else {
+      kernel_.fn(state_, block0_, t0_end_, t1_, f0_last_);
+    }
+
+    uint8_t digest[64];
+    for (size_t l = 0; l < count; ++l) {
+      if (pow_meets(h_[l], job_, digest))
+        return l;
+    }
+    return count;
+  }
+
+private:
+  const pow_job &job_;
+  const detail::blake2b_lanes_kernel &kernel_;
+  bool two_blocks_;
+  alignas(64) uint8_t msg_[detail::BLAKE2B_MAX_LANES][256];
+  uint64_t h_[detail::BLAKE2B_MAX_LANES][8];
+  uint64_t *state_[detail::BLAKE2B_MAX_LANES];
+  const uint8_t *block0_[detail::BLAKE2B_MAX_LANES];
+  const uint8_t *block1_[detail::BLAKE2B_MAX_LANES];
+  uint64_t t0_mid_[detail::BLAKE2B_MAX_LANES];
+  uint64_t t0_end_[detail::BLAKE2B_MAX_LANES];
+  uint64_t t1_[detail::BLAKE2B_MAX_LANES];
+  uint64_t f0_zero_[detail::BLAKE2B_MAX_LANES];
+  uint64_t f0_last_[detail::BLAKE2B_MAX_LANES];
+};
+
+} /* namespace */
+
+static int pow_hash(uint8_t *digest, size_t outlen, const void *header,
+                    size_t headerlen, uint64_t nonce) {
+  uint8_t nonce_le[8];
+  detail::store_le64(nonce_le, nonce);
+
+  tinyblake_blake2b_state S;
+  if (tinyblake_blake2b_init(&S, outlen) != 0 ||
+      tinyblake_blake2b_update(&S, header, headerlen) != 0 ||
+      tinyblake_blake2b_update(&S, nonce_le, 8) != 0 ||
+      tinyblake_blake2b_final(&S, digest, outlen) != 0) {
+    tinyblake_secure_zero(&S, sizeof(S));
+    return -1;
+  }
+  return 0;
+}
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_pow_target_bits(uint8_t *target, size_t outlen, unsigned bits) {
+  if (!target || outlen == 0 || outlen > 64 || bits > outlen * 8)
+    return -1;
+
+  std::memset(target, 0xFF, outlen);
+  const size_t zero_bytes = bits / 8;
+  std::memset(target, 0, zero_bytes);
+  if (bits % 8 != 0)
+    target[zero_bytes] = static_cast<uint8_t>(0xFF >> (bits % 8));
+  return 0;
+}
+
+int tinyblake_pow_search(const void *header, size_t headerlen, size_t outlen,
+                         const uint8_t *target, uint64_t start_nonce,
+                         uint64_t max_tries, size_t threads,
+                         uint64_t *nonce_out, void *digest_out) {
+  if (!nonce_out || !target || outlen == 0 || outlen > 64)
+    return -1;
+  if (!header && headerlen > 0)
+    return -1;
+  if (max_tries == 0)
+    return 1;
+
+  const uint64_t end = (max_tries > UINT64_MAX - start_nonce)
+                           ? UINT64_MAX
+                           : start_nonce + max_tries;
+
+  tinyblake::pow_job job;
+  tinyblake::pow_setup(job, static_cast<const uint8_t *>(header), headerlen,
+                       outlen, target);
+
+  const tinyblake::detail::blake2b_lanes_kernel &kernel =
+      tinyblake::detail::blake2b_get_lanes();
+  std::atomic<uint64_t> next{start_nonce};
+  std::atomic<uint64_t> found{UINT64_MAX};
+
+  auto task = [&](size_t) {
+    tinyblake::pow_worker worker(job, kernel);
+    const size_t lanes = worker.lanes();
+
+    for (;;) {
+      /* Claim the next chunk; chunks go out in increasing order. */
+      uint64_t lo = next.load(std::memory_order_relaxed);
+      uint64_t hi;
+      do {
+        if (lo >= end || lo >= found.load(std::memory_order_relaxed))
+          return;
+        hi = (end - lo < tinyblake::POW_CHUNK) ? end
+                                               : lo + tinyblake::POW_CHUNK;
+      } while (!next.compare_exchange_weak(lo, hi, std::memory_order_relaxed));
+
+      for (uint64_t n = lo; n < hi; n += lanes) {
+        const size_t count =
+            (hi - n < lanes) ? static_cast<size_t>(hi - n) : lanes;
+        const size_t hit = worker.eval(n, count);
+        if (hit < count) {
+          tinyblake::pow_atomic_min(found, n + hit);
+          break;
+        }
+      }
+    }
+  };
+
+  tinyblake::detail::thread_pool &pool =
+      tinyblake::detail::thread_pool::shared();
+  size_t nthreads = pool.size();
+  if (threads != 0 && threads < nthreads)
+    nthreads = threads;
+  /* A single worker runs inline; wrapping the capture-heavy lambda in a
+   * std::function for the pool would cost a heap allocation. */
+  if (nthreads <= 1)
+    task(0);
+  else
+    pool.parallel_for(nthreads, task, nthreads);
+
+  const uint64_t nonce = found.load();
+  if (nonce == UINT64_MAX)
+    return 1;
+
+  *nonce_out = nonce;
+  if (digest_out &&
+      tinyblake::pow_hash(static_cast<uint8_t *>(digest_out), outlen, header,
+                          headerlen, nonce) != 0)
+    return -1;
+  return 0;
+}
+
+int tinyblake_pow_verify(const void *header, size_t headerlen, uint64_t nonce,
+                         size_t outlen, const uint8_t *target) {
+  if (!target || outlen == 0 || outlen > 64)
+    return -1;
+  if (!header && headerlen > 0)
+    return -1;
+
+  uint8_t digest[64];
+  if (tinyblake::pow_hash(digest, outlen, header, headerlen, nonce) != 0)
+    return -1;
+  return std::memcmp(digest, target, outlen) <= 0 ? 1 : 0;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::pow {
+
+solution search(const void *header, size_t len, unsigned difficulty_bits,
+                uint64_t start, uint64_t max_tries, size_t outlen,
+                size_t threads) {
+  uint8_t target[64];
+  if (tinyblake_pow_target_bits(target, outlen, difficulty_bits) != 0)
+    throw std::invalid_argument(
+        "pow::search: outlen must be 1..64 and difficulty <= 8 * outlen");
+
+  solution sol{false, 0, {}};
+  std::vector<uint8_t> digest(outlen);
+  const int rc = tinyblake_pow_search(header, len, outlen, target, start,
+                                      max_tries, threads, &sol.nonce,
+                                      digest.data());
+  if (rc < 0)
+    throw std::runtime_error("pow::search failed");
+  if (rc == 0) {
+    sol.found = true;
+    sol.digest = std::move(digest);
+  }
+  return sol;
+}
+
+bool verify(const void *header, size_t len, uint64_t nonce,
+            unsigned difficulty_bits, size_t outlen) {
+  uint8_t target[64];
+  if (tinyblake_pow_target_bits(target, outlen, difficulty_bits) != 0)
+    throw std::invalid_argument(
+        "pow::verify: outlen must be 1..64 and difficulty <= 8 * outlen");
+
+  const int rc = tinyblake_pow_verify(header, len, nonce, outlen, target);
+  if (rc < 0)
+    throw std::runtime_error("pow::verify failed");
+  return rc == 1;
+}
+
+} /* namespace tinyblake::pow */
@@ -0,0 +1,399 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "internal/stats.h"
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#ifdef TINYBLAKE_STATS
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#endif
+
+/*
+ * Each thread records into its own heap block of atomic counters, created
+ * on the thread's first sample and registered in a global list. Only the
+ * owning thread writes its block (relaxed fetch_add, uncontended), so the
+ * recording path takes no lock. Snapshots lock the list and add every live
+ * block to the totals of exited threads; a thread folds its block into
+ * those totals when it exits.
+ */
+
+namespace {
+
+const char *const OP_NAMES[TINYBLAKE_STATS_OPS] = {
+    "blake2b",
+    "blake2b_hash_many",
+    "blake2s_hash_many",
+    "hmac",
+    "hmac_verify",
+    "pbkdf2",
+    "hmac_blake2s",
+    "hmac_multi",
+    "blake2b_keyed_multi",
+    "blake2b_keyed_multi_verify",
+    "blake2b_tuple_hash_many",
+};
+
+constexpr size_t BUCKETS = TINYBLAKE_STATS_BUCKETS;
+constexpr unsigned SUB_BITS = 5; /* 32 buckets per power of two */
+constexpr uint64_t SUB_COUNT = uint64_t{1} << SUB_BITS;
+
+bool valid_op(int op) { return op >= 0 && op < TINYBLAKE_STATS_OPS; }
+
+#ifdef TINYBLAKE_STATS
+constexpr uint64_t MAX_NS = (uint64_t{1} << 40) - 1; /* last bucket */
+
+/* Exact below 2 * SUB_COUNT, then SUB_COUNT linear buckets per octave */
+size_t bucket_index(uint64_t ns) {
+  if (ns > MAX_NS)
+    ns = MAX_NS;
+  if (ns < 2 * SUB_COUNT)
+    return static_cast<size_t>(ns);
+  unsigned msb = 0;
+  for (uint64_t v = ns; v >>= 1;)
+    ++msb;
+  const unsigned shift = msb - SUB_BITS;
+  return static_cast<size_t>((shift + 1) * SUB_COUNT + (ns >> shift) -
+                             SUB_COUNT);
+}
+#endif
+
+void bucket_bounds(size_t index, uint64_t &lo, uint64_t &hi) {
+  if (index < 2 * SUB_COUNT) {
+    lo = hi = index;
+    return;
+  }
+  const uint64_t shift = index / SUB_COUNT - 1;
+  const uint64_t mant = index % SUB_COUNT + SUB_COUNT;
+  lo = mant << shift;
+  hi = ((mant + 1) << shift) - 1;
+}
+
+} /* namespace */
+
+#ifdef TINYBLAKE_STATS
+
+namespace tinyblake {
+namespace detail {
+
+std::atomic<uint32_t> g_stats_rate{0};
+
+namespace {
+
+struct op_hist {
+  std::atomic<uint64_t> counts[BUCKETS];
+  std::atomic<uint64_t> sum;
+  std::atomic<uint64_t> min;
+  std::atomic<uint64_t> max;
+
+  op_hist() { clear(); }
+
+  void clear() {
+    for (auto &c : counts)
+      c.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    min.store(UINT64_MAX, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+  }
+
+  /* Owner-thread update: the min/max read-then-store is only safe because
+   * no other thread writes this block outside reset */
+  void record(uint64_t ns) {
+    counts[bucket_index(ns)].fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(ns, std::memory_order_relaxed);
+    if (ns < min.load(std::memory_order_relaxed))
+      min.store(ns, std::memory_order_relaxed);
+    if (ns > max.load(std::memory_order_relaxed))
+      max.store(ns, std::memory_order_relaxed);
+  }
+};
+
+struct thread_hist {
+  op_hist ops[TINYBLAKE_STATS_OPS];
+};
+
+/* Plain (non-atomic) accumulator for merging */
+struct merged {
+  uint64_t counts[BUCKETS] = {};
+  uint64_t sum = 0;
+  uint64_t min = UINT64_MAX;
+  uint64_t max = 0;
+
+  void add(const op_hist &h) {
+    for (size_t i = 0; i < BUCKETS; ++i)
+      counts[i] += h.counts[i].load(std::memory_order_relaxed);
+    sum += h.sum.load(std::memory_order_relaxed);
+    min = std::min(min, h.min.load(std::memory_order_relaxed));
+    max = std::max(max, h.max.load(std::memory_order_relaxed));
+  }
+};
+
+struct registry {
+  std::mutex mutex;
+  std::vector<thread_hist *> live;
+  merged retired[TINYBLAKE_STATS_OPS];
+};
+
+/* Leaked so that threads exiting during static destruction can still
+ * retire their histograms */
+registry &get_registry() {
+  static registry *reg = new registry;
+  return *reg;
+}
+
+struct thread_slot {
+  thread_hist *hist = nullptr;
+
+  ~thread_slot() {
+    if (!hist)
+      return;
+    registry &reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (int op = 0; op < TINYBLAKE_STATS_OPS; ++op)
+      reg.retired[op].add(hist->ops[op]);
+    reg.live.erase(std::find(reg.live.begin(), reg.live.end(), hist));
+    delete hist;
+  }
+};
+
+thread_local thread_slot t_slot;
+
+/* The calling thread's histograms, registered on first use; NULL if they
+ * cannot be allocated, in which case the sample is dropped */
+thread_hist *thread_histograms() noexcept {
+  if (t_slot.hist)
+    return t_slot.hist;
+  thread_hist *hist = new (std::nothrow) thread_hist;
+  if (!hist)
+    return nullptr;
+  registry &reg = get_registry();
+  try {
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.live.push_back(hist);
+  } catch (...) {
+    delete hist;
+    return nullptr;
+  }
+  t_slot.hist = hist;
+  return hist;
+}
+
+bool merge_op(int op, merged &out) {
+  if (!valid_op(op))
+    return false;
+  registry &reg = get_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  out = reg.retired[op];
+  for (const thread_hist *hist : reg.live)
+    out.add(hist->ops[op]);
+  return true;
+}
+
+} /* namespace */
+
+void stats_record(int op, uint64_t ns) noexcept {
+  if (!valid_op(op))
+    return;
+  thread_hist *hist = thread_histograms();
+  if (hist)
+    hist->ops[op].record(ns);
+}
+
+} /* namespace detail */
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_stats_enabled(void) { return 1; }
+
+int tinyblake_stats_set_sample_rate(uint32_t rate) {
+  tinyblake::detail::g_stats_rate.store(rate, std::memory_order_relaxed);
+  return 0;
+}
+
+uint32_t tinyblake_stats_sample_rate(void) {
+  return tinyblake::detail::g_stats_rate.load(std::memory_order_relaxed);
+}
+
+int tinyblake_stats_reset(void) {
+  auto &reg = tinyblake::detail::get_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto &r : reg.retired)
+    r = tinyblake::detail::merged();
+  for (auto *hist : reg.live) {
+    for (auto &h : hist->ops)
+      h.clear();
+  }
+  return 0;
+}
+
+int tinyblake_stats_snapshot(int op, tinyblake_stats_summary *out) {
+  if (!out)
+    return -1;
+  /* ~9 KiB; keep it off small thread stacks */
+  std::unique_ptr<tinyblake::detail::merged> m(
+      new (std::nothrow) tinyblake::detail::merged);
+  if (!m || !tinyblake::detail::merge_op(op, *m))
+    return -1;
+
+  std::memset(out, 0, sizeof(*out));
+  for (size_t i = 0; i < BUCKETS; ++i)
+    out->count += m->counts[i];
+  if (out->count == 0)
+    return 0;
+  out->min_ns = m->min;
+  out->max_ns = m->max;
+  out->mean_ns = m->sum / out->count;
+
+  /* Nearest rank: the smallest bucket whose cumulative count reaches
+   * ceil(q * count) */
+  const double quantiles[4] = {0.50, 0.90, 0.99, 0.999};
+  uint64_t *results[4] = {&out->p50_ns, &out->p90_ns, &out->p99_ns,
+                          &out->p999_ns};
+  size_t bucket = 0;
+  uint64_t seen = 0;
+  for (int q = 0; q < 4; ++q) {
+    const double want = quantiles[q] * static_cast<double>(out->count);
+    uint64_t rank = static_cast<uint64_t>(want);
+    if (static_cast<double>(rank) < want)
+      ++rank;
+    if (rank == 0)
+      rank = 1;
+    while (seen + m->counts[bucket] < rank)
+      seen += m->counts[bucket++];
+    uint64_t lo, hi;
+    bucket_bounds(bucket, lo, hi);
+    *results[q] = std::min(std::max(hi, out->min_ns), out->max_ns);
+  }
+  return 0;
+}
+
+int tinyblake_stats_histogram(int op,
+                              uint64_t counts[TINYBLAKE_STATS_BUCKETS]) {
+  if (!counts)
+    return -1;
+  std::unique_ptr<tinyblake::detail::merged> m(
+      new (std::nothrow) tinyblake::detail::merged);
+  if (!m || !tinyblake::detail::merge_op(op, *m))
+    return -1;
+  std::memcpy(counts, m->counts, sizeof(m->counts));
+  return 0;
+}
+
+} /* extern "C" */
+
+#else /* !TINYBLAKE_STATS */
+
+extern "C" {
+
+int tinyblake_stats_enabled(void) { return 0; }
+
+int tinyblake_stats_set_sample_rate(uint32_t) { return -1; }
+
+uint32_t tinyblake_stats_sample_rate(void) { return 0; }
+
+int tinyblake_stats_reset(void) { return -1; }
+
+int tinyblake_stats_snapshot(int, tinyblake_stats_summary *) { return -1; }
+
+int tinyblake_stats_histogram(int, uint64_t[TINYBLAKE_STATS_BUCKETS]) {
+  return -1;
+}
+
+} /* extern "C" */
+
+#endif /* TINYBLAKE_STATS */
+
+extern "C" {
+
+int tinyblake_stats_bucket_range(size_t index, uint64_t *lo_ns,
+                                 uint64_t *hi_ns) {
+  if (index >= BUCKETS || !lo_ns || !hi_ns)
+    return -1;
+  bucket_bounds(index, *lo_ns, *hi_ns);
+  return 0;
+}
+
+const char *tinyblake_stats_op_name(int op) {
+  return valid_op(op) ? OP_NAMES[op] : nullptr;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::stats {
+
+namespace {
+
+void require_enabled() {
+  if (!tinyblake_stats_enabled())
+    throw std::runtime_error("stats: library built without ENABLE_STATS");
+}
+
+void require_op(int op) {
+  if (!valid_op(op))
+    throw std::invalid_argument("stats: unknown operation");
+}
+
+} /* namespace */
+
+void set_sample_rate(uint32_t rate) {
+  require_enabled();
+  tinyblake_stats_set_sample_rate(rate);
+}
+
+void reset() {
+  require_enabled();
+  tinyblake_stats_reset();
+}
+
+summary snapshot(int op) {
+  require_op(op);
+  require_enabled();
+  summary s;
+  if (tinyblake_stats_snapshot(op, &s) != 0)
+    throw std::runtime_error("stats: snapshot failed");
+  return s;
+}
+
+std::vector<uint64_t> histogram(int op) {
+  require_op(op);
+  require_enabled();
+  std::vector<uint64_t> counts(BUCKETS);
+  if (tinyblake_stats_histogram(op, counts.data()) != 0)
+    throw std::runtime_error("stats: histogram failed");
+  return counts;
+}
+
+} /* namespace tinyblake::stats */
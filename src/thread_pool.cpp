@@ -0,0 +1,136 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "internal/thread_pool.h"
+
+namespace tinyblake {
+namespace detail {
+
+thread_pool::thread_pool(size_t threads) {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+      threads = 1;
+  }
+  workers_.reserve(threads - 1);
+  for (size_t i = 0; i + 1 < threads; ++i) {
+    workers_.emplace_back([this, i] { worker_loop(i); });
+  }
+}
+
+thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto &t : workers_) {
+    t.join();
+  }
+}
+
+/* Claim and run indices until the job is exhausted. */
+void thread_pool::run_tasks() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const std::function<void(size_t)> *fn = fn_;
+  while (next_ < count_) {
+    const size_t i = next_++;
+    lock.unlock();
+    (*fn)(i);
+    lock.lock();
+  }
+}
+
+void thread_pool::worker_loop(size_t id) {
+  size_t seen = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+      if (stop_)
+        return;
+      seen = generation_;
+      if (id >= active_limit_)
+        continue;
+      ++busy_;
+    }
+
+    run_tasks();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --busy_;
+    }
+    done_.notify_one();
+  }
+}
+
+void thread_pool::parallel_for(size_t count,
+                               const std::function<void(size_t)> &fn,
+                               size_t max_threads) {
+  if (count == 0)
+    return;
+
+  size_t helpers = workers_.size();
+  if (max_threads != 0 && max_threads - 1 < helpers)
+    helpers = max_threads - 1;
+  if (count - 1 < helpers)
+    helpers = count - 1;
+
+  if (helpers == 0) {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fn_ = &fn;
+    count_ = count;
+    next_ = 0;
+    active_limit_ = helpers;
+    ++generation_;
+  }
+  wake_.notify_all();
+
+  run_tasks();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [&] { return next_ >= count_ && busy_ == 0; });
+  fn_ = nullptr;
+}
+
+thread_pool &thread_pool::shared() {
+  static thread_pool pool(0);
+  return pool;
+}
+
+} /* namespace detail */
+} /* namespace tinyblake */
@@ -0,0 +1,215 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "tinyblake/wots.h"
+#include "internal/blake2b_dispatch.h"
+#include "internal/endian.h"
+#include "tinyblake/blake2b.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/*
+ * WOTS chain engine. A chain step hashes one 32-byte value, i.e. a single
+ * final block, and its tweak lives entirely in the parameter block, so each
+ * step is one compression from a chaining value built directly as
+ * IV ^ param. Chains are scheduled onto the lanes of the multi-lane kernel
+ * and a lane is refilled as soon as its chain is done, keeping every lane
+ * busy however uneven the step counts are.
+ */
+
+namespace tinyblake {
+
+namespace {
+
+struct wots_lane {
+  size_t chain; /* chain being advanced */
+  uint32_t pos; /* current position */
+  uint32_t left; /* steps still to take */
+  bool active;
+};
+
+} /* namespace */
+
+} /* namespace tinyblake */
+
+extern "C" {
+
+int tinyblake_wots_chains(uint8_t *out, const uint8_t *in,
+                          const uint8_t *addrs, const uint32_t *start,
+                          const uint32_t *steps, size_t nchains,
+                          const uint8_t *seed) {
+  if (nchains == 0)
+    return 0;
+  if (!out || !in || !addrs || !steps || !seed)
+    return -1;
+  for (size_t i = 0; i < nchains; ++i) {
+    const uint32_t s = start ? start[i] : 0;
+    if (steps[i] > UINT32_MAX - s)
+      return -1;
+  }
+
+  using tinyblake::detail::BLAKE2B_IV;
+  using tinyblake::detail::BLAKE2B_MAX_LANES;
+  using tinyblake::detail::load_le64;
+  using tinyblake::detail::store_le64;
+
+  const tinyblake::detail::blake2b_lanes_kernel &kernel =
+      tinyblake::detail::blake2b_get_lanes();
+  const size_t lanes = kernel.lanes;
+
+  /* digest_length 32, key_length 0, fanout 1, depth 1 */
+  const uint64_t h0 = BLAKE2B_IV[0] ^ 0x01010020ULL;
+  const uint64_t h6 = BLAKE2B_IV[6] ^ load_le64(seed);
+  const uint64_t h7 = BLAKE2B_IV[7] ^ load_le64(seed + 8);
+
+  uint64_t h[BLAKE2B_MAX_LANES][8];
+  uint8_t block[BLAKE2B_MAX_LANES][128];
+  uint64_t *state[BLAKE2B_MAX_LANES];
+  const uint8_t *blocks[BLAKE2B_MAX_LANES];
+  uint64_t t0[BLAKE2B_MAX_LANES], t1[BLAKE2B_MAX_LANES];
+  uint64_t f0[BLAKE2B_MAX_LANES];
+  tinyblake::wots_lane lane[BLAKE2B_MAX_LANES];
+
+  std::memset(h, 0, sizeof(h));
+  std::memset(block, 0, sizeof(block));
+  for (size_t l = 0; l < lanes; ++l) {
+    state[l] = h[l];
+    blocks[l] = block[l];
+    t0[l] = TINYBLAKE_WOTS_N;
+    t1[l] = 0;
+    f0[l] = ~uint64_t{0};
+    lane[l].chain = 0;
+    lane[l].active = false;
+  }
+
+  /* Load the next chain with steps left; zero-step chains copy through. */
+  size_t next = 0;
+  auto refill = [&](size_t l) {
+    while (next < nchains && steps[next] == 0) {
+      if (out != in)
+        std::memcpy(out + next * 32, in + next * 32, 32);
+      ++next;
+    }
+    if (next == nchains) {
+      lane[l].active = false;
+      return;
+    }
+    lane[l].chain = next;
+    lane[l].pos = start ? start[next] : 0;
+    lane[l].left = steps[next];
+    lane[l].active = true;
+    std::memcpy(block[l], in + next * 32, 32);
+    ++next;
+  };
+
+  size_t active = 0;
+  for (size_t l = 0; l < lanes; ++l) {
+    refill(l);
+    active += lane[l].active ? 1 : 0;
+  }
+
+  while (active > 0) {
+    for (size_t l = 0; l < lanes; ++l) {
+      const uint8_t *addr = addrs + lane[l].chain * 16;
+      const uint64_t salt1 =
+          (load_le64(addr + 8) & 0xFFFFFFFFULL) |
+          (static_cast<uint64_t>(lane[l].pos) << 32);
+      h[l][0] = h0;
+      h[l][1] = BLAKE2B_IV[1];
+      h[l][2] = BLAKE2B_IV[2];
+      h[l][3] = BLAKE2B_IV[3];
+      h[l][4] = BLAKE2B_IV[4] ^ load_le64(addr);
+      h[l][5] = BLAKE2B_IV[5] ^ salt1;
+      h[l][6] = h6;
+      h[l][7] = h7;
+    }
+
+    /* Idle lanes hash stale data; their results are never read. */
+    kernel.fn(state, blocks, t0, t1, f0);
+
+    for (size_t l = 0; l < lanes; ++l) {
+      if (!lane[l].active)
+        continue;
+      for (int w = 0; w < 4; ++w) {
+        store_le64(block[l] + w * 8, h[l][w]);
+      }
+      ++lane[l].pos;
+      if (--lane[l].left == 0) {
+        std::memcpy(out + lane[l].chain * 32, block[l], 32);
+        refill(l);
+        if (!lane[l].active)
+          --active;
+      }
+    }
+  }
+
+  tinyblake_secure_zero(h, sizeof(h));
+  tinyblake_secure_zero(block, sizeof(block));
+  return 0;
+}
+
+} /* extern "C" */
+
+/* ─── C++ wrapper ─── */
+
+namespace tinyblake::wots {
+
+std::vector<uint8_t> chains(const std::vector<uint8_t> &values,
+                            const std::vector<uint8_t> &addrs,
+                            const std::vector<uint32_t> &start,
+                            const std::vector<uint32_t> &steps,
+                            const uint8_t seed[SEED_BYTES]) {
+  const size_t n = steps.size();
+  if (values.size() != n * N || addrs.size() != n * ADDR_BYTES ||
+      (!start.empty() && start.size() != n))
+    throw std::invalid_argument(
+        "wots::chains: values, addrs, start and steps sizes disagree");
+  if (!seed)
+    throw std::invalid_argument("wots::chains: seed is null");
+
+  std::vector<uint8_t> out(values.size());
+  if (tinyblake_wots_chains(out.data(), values.data(), addrs.data(),
+                            start.empty() ? nullptr : start.data(),
+                            steps.data(), n, seed) != 0)
+    throw std::invalid_argument("wots::chains: chain position overflows");
+  return out;
+}
+
+std::vector<uint8_t> chain(const uint8_t value[N],
+                           const uint8_t addr[ADDR_BYTES], uint32_t start,
+                           uint32_t steps, const uint8_t seed[SEED_BYTES]) {
+  std::vector<uint8_t> out(N);
+  if (tinyblake_wots_chains(out.data(), value, addr, &start, &steps, 1,
+                            seed) != 0)
+    throw std::invalid_argument(
+        "wots::chain: null argument or chain position overflows");
+  return out;
+}
+
+} /* namespace tinyblake::wots */
@@ -0,0 +1,549 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * Allocation-counting harness.
+ *
+ * Replaces the global operator new / delete (and, on glibc, malloc and
+ * friends) with counting versions, calls every entry point after one
+ * warm-up call, and prints allocations and bytes per call. Entry points
+ * declared zero-allocation — the C API and the C++ hashers that write into
+ * caller buffers — fail the run if they allocate. The wrappers that return
+ * std::vector / std::string are measured, not checked.
+ *
+ * A separate executable, because the replacement operators are global.
+ * mmap-backed arenas (Balloon) are not seen by these hooks.
+ */
+
+#include <tinyblake.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+/* ─── Counting hooks ─── */
+
+namespace {
+
+std::atomic<bool> g_counting{false};
+std::atomic<uint64_t> g_allocs{0};
+std::atomic<uint64_t> g_bytes{0};
+
+void note(size_t n) {
+  if (g_counting.load(std::memory_order_relaxed)) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(n, std::memory_order_relaxed);
+  }
+}
+
+} /* namespace */
+
+#if defined(__GLIBC__)
+
+/* glibc's internal entry points, so the hooks below can forward without
+ * recursing into themselves */
+extern "C" {
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void *__libc_memalign(size_t, size_t);
+void __libc_free(void *);
+
+void *malloc(size_t n) noexcept {
+  note(n);
+  return __libc_malloc(n);
+}
+
+void *calloc(size_t count, size_t n) noexcept {
+  note(count * n);
+  return __libc_calloc(count, n);
+}
+
+void *realloc(void *p, size_t n) noexcept {
+  note(n);
+  return __libc_realloc(p, n);
+}
+
+void free(void *p) noexcept { __libc_free(p); }
+
+void *memalign(size_t align, size_t n) noexcept {
+  note(n);
+  return __libc_memalign(align, n);
+}
+
+void *aligned_alloc(size_t align, size_t n) noexcept {
+  note(n);
+  return __libc_memalign(align, n);
+}
+
+int posix_memalign(void **out, size_t align, size_t n) noexcept {
+  note(n);
+  void *p = __libc_memalign(align, n);
+  if (!p)
+    return ENOMEM;
+  *out = p;
+  return 0;
+}
+} /* extern "C" */
+
+namespace {
+void *raw_alloc(size_t n, size_t align) {
+  return align ? __libc_memalign(align, n ? n : 1) : __libc_malloc(n ? n : 1);
+}
+void raw_free(void *p) { __libc_free(p); }
+} /* namespace */
+
+#else
+
+namespace {
+void *raw_alloc(size_t n, size_t align) {
+  if (!align)
+    return std::malloc(n ? n : 1);
+  void *p = nullptr;
+  return posix_memalign(&p, align, n ? n : 1) == 0 ? p : nullptr;
+}
+void raw_free(void *p) { std::free(p); }
+} /* namespace */
+
+#endif /* __GLIBC__ */
+
+namespace {
+void *counted_new(size_t n, size_t align) {
+  note(n);
+  void *p = raw_alloc(n, align);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+} /* namespace */
+
+void *operator new(size_t n) { return counted_new(n, 0); }
+void *operator new[](size_t n) { return counted_new(n, 0); }
+void *operator new(size_t n, std::align_val_t a) {
+  return counted_new(n, static_cast<size_t>(a));
+}
+void *operator new[](size_t n, std::align_val_t a) {
+  return counted_new(n, static_cast<size_t>(a));
+}
+void *operator new(size_t n, const std::nothrow_t &) noexcept {
+  note(n);
+  return raw_alloc(n, 0);
+}
+void *operator new[](size_t n, const std::nothrow_t &) noexcept {
+  note(n);
+  return raw_alloc(n, 0);
+}
+void *operator new(size_t n, std::align_val_t a,
+                   const std::nothrow_t &) noexcept {
+  note(n);
+  return raw_alloc(n, static_cast<size_t>(a));
+}
+void *operator new[](size_t n, std::align_val_t a,
+                     const std::nothrow_t &) noexcept {
+  note(n);
+  return raw_alloc(n, static_cast<size_t>(a));
+}
+void operator delete(void *p) noexcept { raw_free(p); }
+void operator delete[](void *p) noexcept { raw_free(p); }
+void operator delete(void *p, size_t) noexcept { raw_free(p); }
+void operator delete[](void *p, size_t) noexcept { raw_free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { raw_free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { raw_free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept {
+  raw_free(p);
+}
+void operator delete[](void *p, size_t, std::align_val_t) noexcept {
+  raw_free(p);
+}
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  raw_free(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  raw_free(p);
+}
+void operator delete(void *p, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  raw_free(p);
+}
+void operator delete[](void *p, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  raw_free(p);
+}
+
+/* ─── Entry points ─── */
+
+namespace {
+
+/* Shared inputs and outputs, so the calls themselves allocate nothing */
+uint8_t g_msg[4096];
+uint8_t g_key[64];
+uint8_t g_out[8192];
+char g_text[16384];
+const void *g_many_in[8];
+size_t g_many_len[8];
+tinyblake_hmac_key_ctx g_hmac_ctx[4];
+tinyblake_blake2b_key_ctx g_b2_ctx[4];
+tinyblake_lthash16 g_lt, g_lt2;
+uint8_t g_target[64];
+uint8_t g_checkpoints[4 * 64];
+const std::vector<uint8_t> g_vec(g_msg, g_msg + 256);
+
+void setup() {
+  for (size_t i = 0; i < sizeof(g_msg); ++i)
+    g_msg[i] = static_cast<uint8_t>(i * 7 + 1);
+  for (size_t i = 0; i < sizeof(g_key); ++i)
+    g_key[i] = static_cast<uint8_t>(0xA0 + i);
+  for (size_t i = 0; i < 8; ++i) {
+    g_many_in[i] = g_msg + 64 * i;
+    g_many_len[i] = 128 + 64 * i;
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    tinyblake_hmac_key_ctx_init(&g_hmac_ctx[i], g_key + i, 32);
+    tinyblake_blake2b_key_ctx_init(&g_b2_ctx[i], 32, g_key + i, 32);
+  }
+  tinyblake_lthash16_init(&g_lt);
+  tinyblake_lthash16_init(&g_lt2);
+  tinyblake_pow_target_bits(g_target, 32, 4);
+  tinyblake_blake2b_iterate_checkpoints(g_out, 64, g_msg, 64, 400, 100,
+                                        g_checkpoints, sizeof(g_checkpoints));
+}
+
+struct api_case {
+  const char *name;
+  bool zero_alloc; /* declared: must not allocate */
+  void (*fn)();
+};
+
+const api_case CASES[] = {
+    /* ── C API: BLAKE2b ── */
+    {"tinyblake_blake2b", true,
+     [] { tinyblake_blake2b(g_out, 64, g_msg, 1000, nullptr, 0); }},
+    {"tinyblake_blake2b (keyed)", true,
+     [] { tinyblake_blake2b(g_out, 32, g_msg, 1000, g_key, 32); }},
+    {"tinyblake_blake2b_init/update/final", true,
+     [] {
+       tinyblake_blake2b_state S;
+       tinyblake_blake2b_init(&S, 64);
+       tinyblake_blake2b_update(&S, g_msg, 3000);
+       tinyblake_blake2b_final(&S, g_out, 64);
+     }},
+    {"tinyblake_blake2b_init_param", true,
+     [] {
+       uint8_t param[64] = {64, 0, 1, 1};
+       tinyblake_blake2b_state S;
+       tinyblake_blake2b_init_param(&S, param);
+       tinyblake_blake2b_final(&S, g_out, 64);
+     }},
+    {"tinyblake_blake2b_*_v2", true,
+     [] {
+       tinyblake_blake2b_state_v2 S;
+       tinyblake_blake2b_init_key_v2(&S, 64, g_key, 64);
+       tinyblake_blake2b_update_v2(&S, g_msg, 3000);
+       tinyblake_blake2b_final_v2(&S, g_out, 64);
+     }},
+    {"tinyblake_blake2b_ex", true,
+     [] {
+       tinyblake_blake2b_ex(tinyblake_engine_get("portable"), g_out, 64,
+                            g_msg, 500, nullptr, 0);
+     }},
+    {"tinyblake_blake2b_hash_many", true,
+     [] {
+       tinyblake_blake2b_hash_many(g_out, 64, g_many_in, g_many_len, 8,
+                                   nullptr, 0);
+     }},
+    {"tinyblake_blake2b_state_array_alloc", false,
+     [] {
+       tinyblake_blake2b_state_array_free(
+           tinyblake_blake2b_state_array_alloc(4), 4);
+     }},
+    {"tinyblake_blake2b_tuple_*", true,
+     [] {
+       tinyblake_blake2b_state S;
+       tinyblake_blake2b_tuple_init(&S, 32, "p", 1);
+       tinyblake_blake2b_tuple_add(&S, TINYBLAKE_TUPLE_BYTES, g_msg, 40);
+       tinyblake_blake2b_tuple_add_u64(&S, 7);
+       tinyblake_blake2b_final(&S, g_out, 32);
+     }},
+    {"tinyblake_blake2b_tuple_hash_many", true,
+     [] {
+       tinyblake_blake2b_tuple_field f[16];
+       for (size_t i = 0; i < 16; ++i)
+         f[i] = {g_msg + i, 24, TINYBLAKE_TUPLE_BYTES};
+       tinyblake_blake2b_tuple_hash_many(g_out, 32, f, 2, 8, nullptr, 0);
+     }},
+    {"tinyblake_blake2b_tuple_hash_many (17 fields)", true,
+     [] {
+       tinyblake_blake2b_tuple_field f[34];
+       for (size_t i = 0; i < 34; ++i)
+         f[i] = {g_msg + i, 24, TINYBLAKE_TUPLE_BYTES};
+       tinyblake_blake2b_tuple_hash_many(g_out, 32, f, 17, 2, nullptr, 0);
+     }},
+    {"tinyblake_blake2b_keyed_multi_verify", true,
+     [] {
+       tinyblake_blake2b_keyed_multi(g_msg, 300, g_b2_ctx, 4, g_out);
+       tinyblake_blake2b_keyed_multi_verify(g_msg, 300, g_b2_ctx, 4, g_out,
+                                            32, nullptr);
+     }},
+    /* ── C API: HMAC / PBKDF2 ── */
+    {"tinyblake_hmac", true,
+     [] { tinyblake_hmac(g_out, 64, g_key, 32, g_msg, 1000); }},
+    {"tinyblake_hmac_init/update/final", true,
+     [] {
+       tinyblake_hmac_state S;
+       tinyblake_hmac_init(&S, g_msg, 200); /* long key, hashed */
+       tinyblake_hmac_update(&S, g_msg, 1000);
+       tinyblake_hmac_final(&S, g_out, 64);
+     }},
+    {"tinyblake_hmac_multi_verify", true,
+     [] {
+       tinyblake_hmac_multi(g_msg, 300, g_hmac_ctx, 4, g_out);
+       tinyblake_hmac_multi_verify(g_msg, 300, g_hmac_ctx, 4, g_out, 64,
+                                   nullptr);
+     }},
+    {"tinyblake_pbkdf2", true,
+     [] { tinyblake_pbkdf2(g_out, 96, g_key, 16, g_msg, 16, 20); }},
+    {"tinyblake_hmac_blake2s", true,
+     [] {
+       tinyblake_hmac_blake2s(g_out, 32, g_key, 32, g_msg, 1000);
+       tinyblake_hmac_blake2s_state S;
+       tinyblake_hmac_blake2s_init(&S, g_key, 32);
+       tinyblake_hmac_blake2s_update(&S, g_msg, 100);
+       tinyblake_hmac_blake2s_final(&S, g_out, 32);
+     }},
+    /* ── C API: BLAKE2s / BLAKE2Xb / BLAKE3 ── */
+    {"tinyblake_blake2s", true,
+     [] {
+       tinyblake_blake2s(g_out, 32, g_msg, 1000, g_key, 16);
+       tinyblake_blake2s_state S;
+       tinyblake_blake2s_init(&S, 32);
+       tinyblake_blake2s_update(&S, g_msg, 1000);
+       tinyblake_blake2s_final(&S, g_out, 32);
+     }},
+    {"tinyblake_blake2s_hash_many", true,
+     [] {
+       tinyblake_blake2s_hash_many(g_out, 32, g_many_in, g_many_len, 8,
+                                   nullptr, 0);
+     }},
+    {"tinyblake_blake2xb", true,
+     [] { tinyblake_blake2xb(g_out, 2048, g_msg, 100, nullptr, 0); }},
+    {"tinyblake_blake3", true,
+     [] {
+       tinyblake_blake3(g_out, 32, g_msg, 4096, nullptr);
+       tinyblake_blake3(g_out, 100, g_msg, 100, g_key);
+     }},
+    {"tinyblake_blake3_init/update/final", true,
+     [] {
+       tinyblake_blake3_state S;
+       tinyblake_blake3_init_derive_key(&S, "ctx", 3);
+       tinyblake_blake3_update(&S, g_msg, 4096);
+       tinyblake_blake3_final_seek(&S, 64, g_out, 64);
+     }},
+    {"tinyblake_blake3_update_parallel", false,
+     [] {
+       tinyblake_blake3_state S;
+       tinyblake_blake3_init(&S);
+       tinyblake_blake3_update_parallel(&S, g_msg, 4096, 2);
+       tinyblake_blake3_final(&S, g_out, 32);
+     }},
+    /* ── C API: chains, WOTS+, PoW, LtHash, Balloon ── */
+    {"tinyblake_blake2b_iterate", true,
+     [] { tinyblake_blake2b_iterate(g_out, 32, g_msg, 32, 100); }},
+    {"tinyblake_blake2b_iterate_checkpoints", true,
+     [] {
+       tinyblake_blake2b_iterate_checkpoints(g_out, 64, g_msg, 64, 100, 25,
+                                             g_out + 64, 4 * 64);
+     }},
+    {"tinyblake_blake2b_chain_verify", false,
+     [] {
+       tinyblake_blake2b_chain_verify(g_msg, 64, g_checkpoints, 4, 64, 100,
+                                      2, nullptr);
+     }},
+    {"tinyblake_wots_chains", true,
+     [] {
+       uint32_t start[2] = {0, 3}, steps[2] = {15, 5};
+       tinyblake_wots_chains(g_out, g_msg, g_msg + 64, start, steps, 2,
+                             g_key);
+     }},
+    {"tinyblake_pow_search (1 thread)", true,
+     [] {
+       uint64_t nonce;
+       tinyblake_pow_search(g_msg, 80, 32, g_target, 0, 1000, 1, &nonce,
+                            g_out);
+       tinyblake_pow_verify(g_msg, 80, nonce, 32, g_target);
+     }},
+    {"tinyblake_lthash16_*", true,
+     [] {
+       tinyblake_lthash16_add(&g_lt, g_msg, 64);
+       tinyblake_lthash16_add_many(&g_lt, g_many_in, g_many_len, 8);
+       tinyblake_lthash16_remove_many(&g_lt, g_many_in, g_many_len, 8);
+       tinyblake_lthash16_combine(&g_lt2, &g_lt);
+       tinyblake_lthash16_digest(&g_lt, g_out, 32);
+     }},
+    {"tinyblake_balloon", true,
+     [] { tinyblake_balloon(g_out, g_key, 16, g_msg, 16, 64, 1); }},
+    /* ── C API: encoding ── */
+    {"tinyblake_hex_encode/decode", true,
+     [] {
+       size_t n;
+       tinyblake_hex_encode(g_text, sizeof(g_text), g_msg, 1024, 0);
+       tinyblake_hex_decode(g_out, sizeof(g_out), &n, g_text, 2048,
+                            TINYBLAKE_ENCODE_CONSTANT_TIME);
+     }},
+    {"tinyblake_base64url_encode/decode", true,
+     [] {
+       size_t n;
+       tinyblake_base64url_encode(g_text, sizeof(g_text), g_msg, 1023, 0);
+       tinyblake_base64url_decode(g_out, sizeof(g_out), &n, g_text,
+                                  tinyblake_base64url_encoded_len(1023), 0);
+     }},
+    {"tinyblake_hex_encode_many", true,
+     [] {
+       tinyblake_hex_encode_many(g_text, sizeof(g_text), g_msg, 32, 16, 0);
+     }},
+    {"tinyblake_constant_time_eq", true,
+     [] { tinyblake_constant_time_eq(g_msg, g_msg + 1, 64); }},
+    /* ── C++ hashers into caller buffers ── */
+    {"blake2b::hasher final_(out)", true,
+     [] {
+       tinyblake::blake2b::hasher h(g_key, 32, 64);
+       h.update(g_msg, 1000);
+       h.final_(g_out, 64);
+       h.reset();
+     }},
+    {"blake2b::tuple_hasher final_(out)", true,
+     [] {
+       tinyblake::blake2b::tuple_hasher h(32);
+       h.add_field(g_msg, 40);
+       h.add_u64(9);
+       h.final_(g_out, 32);
+     }},
+    {"blake2s::hasher final_(out)", true,
+     [] {
+       tinyblake::blake2s::hasher h(32);
+       h.update(g_msg, 1000);
+       h.final_(g_out, 32);
+     }},
+    {"blake2xb::hasher final_(out)", true,
+     [] {
+       tinyblake::blake2xb::hasher h(256);
+       h.update(g_msg, 100);
+       h.final_(g_out, 256);
+     }},
+    {"blake3::hasher final_(out)", true,
+     [] {
+       tinyblake::blake3::hasher h(g_key);
+       h.update(g_msg, 4096);
+       h.final_(g_out, 32);
+     }},
+    {"hmac::hasher final_(out)", true,
+     [] {
+       tinyblake::hmac::hasher h(g_key, 32);
+       h.update(g_msg, 1000);
+       h.final_(g_out, 64);
+     }},
+    {"hmac_blake2s::hasher final_(out)", true,
+     [] {
+       tinyblake::hmac_blake2s::hasher h(g_key, 32);
+       h.update(g_msg, 1000);
+       h.final_(g_out, 32);
+     }},
+    {"lthash::lthash16 add", true,
+     [] {
+       tinyblake::lthash::lthash16 h;
+       h.add(g_msg, 64);
+       h.remove(g_msg, 64);
+     }},
+    /* ── C++ wrappers returning containers (measured only) ── */
+    {"blake2b::hash", false,
+     [] { (void)tinyblake::blake2b::hash(g_msg, 1000, 64); }},
+    {"blake2b::hash(vector)", false,
+     [] { (void)tinyblake::blake2b::hash(g_vec, 64); }},
+    {"blake2b::keyed_hash", false,
+     [] {
+       (void)tinyblake::blake2b::keyed_hash(g_key, 32, g_msg, 1000, 32);
+     }},
+    {"blake2b::hasher final_()", false,
+     [] {
+       tinyblake::blake2b::hasher h;
+       h.update(g_msg, 100);
+       (void)h.final_();
+     }},
+    {"blake2s::hash", false,
+     [] { (void)tinyblake::blake2s::hash(g_msg, 1000, 32); }},
+    {"blake3::hash", false,
+     [] { (void)tinyblake::blake3::hash(g_msg, 1000, 32); }},
+    {"blake2xb::hash", false,
+     [] { (void)tinyblake::blake2xb::hash(g_msg, 100, 256); }},
+    {"hmac::mac", false,
+     [] { (void)tinyblake::hmac::mac(g_key, 32, g_msg, 1000); }},
+    {"pbkdf2::derive", false,
+     [] { (void)tinyblake::pbkdf2::derive(g_key, 16, g_msg, 16, 20, 64); }},
+    {"chain::iterate", false,
+     [] { (void)tinyblake::chain::iterate(g_msg, 32, 100, 32); }},
+    {"hex::encode", false,
+     [] { (void)tinyblake::hex::encode(g_msg, 64); }},
+    {"base64url::encode", false,
+     [] { (void)tinyblake::base64url::encode(g_msg, 64); }},
+};
+
+constexpr size_t ITERS = 8;
+
+} /* namespace */
+
+int main() {
+  setup();
+
+  std::printf("%-46s %10s %12s  %s\n", "entry point", "allocs/call",
+              "bytes/call", "declared");
+  int failures = 0;
+  for (const api_case &c : CASES) {
+    c.fn(); /* warm-up: dispatch, engines, the shared thread pool */
+
+    g_allocs.store(0);
+    g_bytes.store(0);
+    g_counting.store(true);
+    for (size_t i = 0; i < ITERS; ++i)
+      c.fn();
+    g_counting.store(false);
+
+    const double allocs = static_cast<double>(g_allocs.load()) / ITERS;
+    const double bytes = static_cast<double>(g_bytes.load()) / ITERS;
+    const bool bad = c.zero_alloc && g_allocs.load() != 0;
+    failures += bad;
+    std::printf("%-46s %10.2f %12.1f  %s\n", c.name, allocs, bytes,
+                bad ? "zero  FAILED" : c.zero_alloc ? "zero" : "-");
+  }
+
+  std::printf("\n%d zero-allocation entry point(s) allocated\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/internal/page_arena.h"
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/balloon.h>
+
+/* Vectors from a direct Python transcription of the algorithm in
+ * balloon.h over hashlib.blake2b */
+
+TEST(balloon_reference_vectors) {
+  auto got = tinyblake::balloon::hash("password", 8, "salt", 4, 16, 1);
+  auto expected = test::hex_to_bytes(
+      "04cb575064a89f9ebc12c41a1857fb2c6d182fea7c7e065ae60f92ae69bf4d19"
+      "cc8a676d74f6ab1aca2098b832c9b9a2215d101fe0905d959257d9ec87a3214a");
+  ASSERT_EQ(got, expected);
+
+  got = tinyblake::balloon::hash(nullptr, 0, nullptr, 0, 1, 1);
+  expected = test::hex_to_bytes(
+      "cfd481f335a940b5149384b29883a58faa39d72b2e3a07270f606c82c175338c"
+      "70ea5520daa01aed4a6f1a9794c5aef22d30014da93a54f1ad944f29946e1c7e");
+  ASSERT_EQ(got, expected);
+
+  /* Spans several index-hash batches, with a partial last batch */
+  got = tinyblake::balloon::hash("password", 8, "salt", 4, 200, 2);
+  expected = test::hex_to_bytes(
+      "440480e1adccced66cecbcb8c3d4994beebe6dd590f7075aa1c98f6660408247"
+      "ab4921336a10c941d9bd5983ef8cfc55b60242258c6017ca919426b1065c1a9d");
+  ASSERT_EQ(got, expected);
+
+  got = tinyblake::balloon::hash("hunter42", 8, "examplesalt", 11, 1024, 3);
+  expected = test::hex_to_bytes(
+      "28298836a8af499d372e8dcaf8f7ab6ef3d2df4d6d204674fee773b8581762d5"
+      "aaf3b4fb8689cdadf389172b738c8f8df351ffd43f7f80327562a16913fe7fa3");
+  ASSERT_EQ(got, expected);
+}
+
+TEST(balloon_m_reference_vector) {
+  auto expected = test::hex_to_bytes(
+      "10c3596ba05de99ef595d06aac4a4bc3d23eaa1d5f0205928a677341508ab44d"
+      "bf3ef9c73041b172230fc347467f11b58e63e73c3fff2bd7a757f9770f99b101");
+  /* Same result on one thread and on the whole pool */
+  ASSERT_EQ(tinyblake::balloon::hash_m("password", 8, "salt", 4, 64, 2, 4, 1),
+            expected);
+  ASSERT_EQ(tinyblake::balloon::hash_m("password", 8, "salt", 4, 64, 2, 4),
+            expected);
+}
+
+TEST(balloon_inputs_matter) {
+  auto base = tinyblake::balloon::hash("pw", 2, "salt", 4, 32, 1);
+  ASSERT_TRUE(tinyblake::balloon::hash("pX", 2, "salt", 4, 32, 1) != base);
+  ASSERT_TRUE(tinyblake::balloon::hash("pw", 2, "salT", 4, 32, 1) != base);
+  ASSERT_TRUE(tinyblake::balloon::hash("pw", 2, "salt", 4, 33, 1) != base);
+  ASSERT_TRUE(tinyblake::balloon::hash("pw", 2, "salt", 4, 32, 2) != base);
+}
+
+TEST(balloon_invalid_args) {
+  uint8_t out[64];
+  ASSERT_EQ(tinyblake_balloon(nullptr, "p", 1, "s", 1, 8, 1), -1);
+  ASSERT_EQ(tinyblake_balloon(out, nullptr, 1, "s", 1, 8, 1), -1);
+  ASSERT_EQ(tinyblake_balloon(out, "p", 1, nullptr, 1, 8, 1), -1);
+  ASSERT_EQ(tinyblake_balloon(out, "p", 1, "s", 1, 0, 1), -1);
+  ASSERT_EQ(tinyblake_balloon(out, "p", 1, "s", 1, 8, 0), -1);
+  ASSERT_EQ(tinyblake_balloon(out, "p", 1, "s", 1, (uint64_t{1} << 32) + 1,
+                              1),
+            -1);
+  ASSERT_EQ(tinyblake_balloon(out, "p", 1, "s", 1, 8, UINT64_MAX), -1);
+  ASSERT_EQ(tinyblake_balloon_m(out, "p", 1, "s", 1, 8, 1, 0, 0), -1);
+
+  static const uint8_t long_salt[TINYBLAKE_BALLOON_M_MAXSALT + 1] = {};
+  ASSERT_EQ(tinyblake_balloon_m(out, "p", 1, long_salt,
+                                TINYBLAKE_BALLOON_M_MAXSALT, 8, 1, 2, 1),
+            0);
+  ASSERT_EQ(tinyblake_balloon_m(out, "p", 1, long_salt,
+                                TINYBLAKE_BALLOON_M_MAXSALT + 1, 8, 1, 2, 1),
+            -1);
+
+  bool threw = false;
+  try {
+    tinyblake::balloon::hash_m("p", 1, "s", 1, 8, 1, 0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
+
+TEST(page_arena_zeroed_and_writable) {
+  static const size_t sizes[] = {1, 4096, 3 << 20};
+  for (size_t n : sizes) {
+    tinyblake::detail::page_arena arena(n);
+    ASSERT_TRUE(arena.data() != nullptr);
+    ASSERT_EQ(arena.size(), n);
+    bool zero = true;
+    for (size_t i = 0; i < n; ++i)
+      zero = zero && arena.data()[i] == 0;
+    ASSERT_TRUE(zero);
+    std::memset(arena.data(), 0xAB, n);
+  }
+
+  tinyblake::detail::page_arena empty(0);
+  ASSERT_TRUE(empty.data() == nullptr);
+}
@@ -26,9 +26,16 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include "../src/backend/blake2b_compress.h"
+#include "../src/cpu_features.h"
 #include "test_harness.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <stdexcept>
+#include <thread>
 #include <tinyblake/blake2b.h>
+#include <vector>
 
 #include "vectors_rfc7693.inl"
 
@@ -349,4 +356,251 @@ TEST(blake2b_move_assign) {
     caught = true;
   }
   ASSERT_TRUE(caught);
+}
+
+/* ─── v2 (cache-line-aligned) state ─── */
+
+TEST(blake2b_state_v2_layout) {
+  ASSERT_EQ(alignof(tinyblake_blake2b_state_v2), size_t(64));
+  ASSERT_EQ(sizeof(tinyblake_blake2b_state_v2) % 64, size_t(0));
+  ASSERT_TRUE(offsetof(tinyblake_blake2b_state_v2, t) < 64);
+  ASSERT_TRUE(offsetof(tinyblake_blake2b_state_v2, buflen) < 64);
+  ASSERT_TRUE(offsetof(tinyblake_blake2b_state_v2, outlen) < 64);
+  ASSERT_EQ(offsetof(tinyblake_blake2b_state_v2, h) % 64, size_t(0));
+  ASSERT_EQ(offsetof(tinyblake_blake2b_state_v2, buf) % 64, size_t(0));
+}
+
+TEST(blake2b_state_v2_matches_v1) {
+  std::vector<uint8_t> msg(777);
+  for (size_t i = 0; i < msg.size(); ++i)
+    msg[i] = static_cast<uint8_t>(i * 7 + 3);
+  const uint8_t key[40] = {1, 2, 3, 4, 5};
+
+  for (size_t chunk : {size_t(1), size_t(63), size_t(128), size_t(129),
+                       size_t(777)}) {
+    for (int keyed = 0; keyed <= 1; ++keyed) {
+      tinyblake_blake2b_state s1;
+      tinyblake_blake2b_state_v2 s2;
+      if (keyed) {
+        ASSERT_EQ(tinyblake_blake2b_init_key(&s1, 48, key, sizeof(key)), 0);
+        ASSERT_EQ(tinyblake_blake2b_init_key_v2(&s2, 48, key, sizeof(key)), 0);
+      } else {
+        ASSERT_EQ(tinyblake_blake2b_init(&s1, 48), 0);
+        ASSERT_EQ(tinyblake_blake2b_init_v2(&s2, 48), 0);
+      }
+      for (size_t off = 0; off < msg.size(); off += chunk) {
+        const size_t n = std::min(chunk, msg.size() - off);
+        ASSERT_EQ(tinyblake_blake2b_update(&s1, msg.data() + off, n), 0);
+        ASSERT_EQ(tinyblake_blake2b_update_v2(&s2, msg.data() + off, n), 0);
+      }
+      uint8_t d1[48], d2[48];
+      ASSERT_EQ(tinyblake_blake2b_final(&s1, d1, sizeof(d1)), 0);
+      ASSERT_EQ(tinyblake_blake2b_final_v2(&s2, d2, sizeof(d2)), 0);
+      ASSERT_BYTES_EQ(d1, d2, sizeof(d1));
+    }
+  }
+
+  /* Key-only message and parameter-block init */
+  uint8_t d1[64], d2[64];
+  ASSERT_EQ(tinyblake_blake2b(d1, 64, nullptr, 0, key, sizeof(key)), 0);
+  tinyblake_blake2b_state_v2 s2;
+  ASSERT_EQ(tinyblake_blake2b_init_key_v2(&s2, 64, key, sizeof(key)), 0);
+  ASSERT_EQ(tinyblake_blake2b_final_v2(&s2, d2, 64), 0);
+  ASSERT_BYTES_EQ(d1, d2, 64);
+
+  uint8_t param[64] = {32, 0, 1, 1};
+  param[48] = 'p';
+  tinyblake_blake2b_state s1;
+  ASSERT_EQ(tinyblake_blake2b_init_param(&s1, param), 0);
+  ASSERT_EQ(tinyblake_blake2b_init_param_v2(&s2, param), 0);
+  ASSERT_EQ(tinyblake_blake2b_update(&s1, "abc", 3), 0);
+  ASSERT_EQ(tinyblake_blake2b_update_v2(&s2, "abc", 3), 0);
+  ASSERT_EQ(tinyblake_blake2b_final(&s1, d1, 32), 0);
+  ASSERT_EQ(tinyblake_blake2b_final_v2(&s2, d2, 32), 0);
+  ASSERT_BYTES_EQ(d1, d2, 32);
+}
+
+TEST(blake2b_state_v2_error_paths) {
+  tinyblake_blake2b_state_v2 s;
+  uint8_t out[64];
+  ASSERT_EQ(tinyblake_blake2b_init_v2(nullptr, 64), -1);
+  ASSERT_EQ(tinyblake_blake2b_init_v2(&s, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_init_v2(&s, 65), -1);
+  ASSERT_EQ(tinyblake_blake2b_init_key_v2(&s, 64, nullptr, 4), -1);
+  ASSERT_EQ(tinyblake_blake2b_update_v2(nullptr, "x", 1), -1);
+  ASSERT_EQ(tinyblake_blake2b_final_v2(nullptr, out, 64), -1);
+
+  ASSERT_EQ(tinyblake_blake2b_init_v2(&s, 64), 0);
+  ASSERT_EQ(tinyblake_blake2b_final_v2(&s, out, 32), -1);
+  ASSERT_EQ(tinyblake_blake2b_final_v2(&s, out, 64), 0);
+  /* final wipes the state, so it cannot be reused without re-init */
+  ASSERT_EQ(tinyblake_blake2b_update_v2(&s, "x", 1), -1);
+  ASSERT_EQ(tinyblake_blake2b_final_v2(&s, out, 64), -1);
+}
+
+TEST(blake2b_aligned_compress_kernels) {
+  const auto &feat = tinyblake::cpu::detect();
+  std::vector<tinyblake::blake2b_compress_fn> kernels;
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (feat.avx2)
+    kernels.push_back(tinyblake::blake2b_compress_avx2_aligned);
+  if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2)
+    kernels.push_back(tinyblake::blake2b_compress_avx512_aligned);
+#else
+  (void)feat;
+#endif
+
+  uint8_t block[128];
+  for (size_t i = 0; i < sizeof(block); ++i)
+    block[i] = static_cast<uint8_t>(i * 11 + 1);
+
+  for (auto fn : kernels) {
+    for (int last = 0; last <= 1; ++last) {
+      alignas(64) uint64_t want[8], got[8];
+      for (int i = 0; i < 8; ++i)
+        want[i] = got[i] = 0x0F1E2D3C4B5A6978ULL * static_cast<uint64_t>(i + 3);
+      tinyblake::blake2b_compress_portable(want, block, 256, 1, last != 0);
+      fn(got, block, 256, 1, last != 0);
+      ASSERT_BYTES_EQ(reinterpret_cast<const uint8_t *>(got),
+                      reinterpret_cast<const uint8_t *>(want), sizeof(want));
+    }
+  }
+}
+
+TEST(blake2b_state_array_per_thread) {
+  ASSERT_TRUE(tinyblake_blake2b_state_array_alloc(0) == nullptr);
+  tinyblake_blake2b_state_array_free(nullptr, 4);
+
+  constexpr size_t N = 4;
+  tinyblake::blake2b::state_array states(N);
+  ASSERT_EQ(states.size(), N);
+  for (size_t i = 0; i < N; ++i) {
+    const auto addr = reinterpret_cast<uintptr_t>(&states[i]);
+    ASSERT_EQ(addr % 64, uintptr_t(0));
+    ASSERT_EQ(states[i].version, uint8_t(0));
+  }
+
+  /* Each thread hashes its own message in its own state */
+  std::vector<std::thread> threads;
+  uint8_t digests[N][32];
+  for (size_t i = 0; i < N; ++i) {
+    threads.emplace_back([&states, &digests, i] {
+      uint8_t msg[300];
+      std::memset(msg, static_cast<int>(i), sizeof(msg));
+      tinyblake_blake2b_init_v2(&states[i], 32);
+      for (int rep = 0; rep < 10; ++rep)
+        tinyblake_blake2b_update_v2(&states[i], msg, sizeof(msg));
+      tinyblake_blake2b_final_v2(&states[i], digests[i], 32);
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+
+  for (size_t i = 0; i < N; ++i) {
+    std::vector<uint8_t> msg(3000, static_cast<uint8_t>(i));
+    auto want = tinyblake::blake2b::hash(msg, 32);
+    ASSERT_BYTES_EQ(digests[i], want.data(), 32);
+  }
+
+  bool caught = false;
+  try {
+    tinyblake::blake2b::state_array empty(0);
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  ASSERT_TRUE(caught);
+
+  tinyblake::blake2b::state_array moved(std::move(states));
+  ASSERT_EQ(moved.size(), N);
+  ASSERT_EQ(states.size(), size_t(0));
+}
+
+TEST(blake2b_size_class_dispatch) {
+  static const char *const NAMES[] = {"portable", "x64",       "avx2", "avx512",
+                                      "neon",     "neon_sha3", "rvv"};
+  const int classes[] = {TINYBLAKE_BLAKE2B_SIZE_SINGLE,
+                         TINYBLAKE_BLAKE2B_SIZE_SMALL,
+                         TINYBLAKE_BLAKE2B_SIZE_BULK};
+
+  /* Reference digests under the default assignment */
+  std::vector<uint8_t> msg(2000);
+  for (size_t i = 0; i < msg.size(); ++i)
+    msg[i] = static_cast<uint8_t>(i * 7 + 3);
+  const size_t lens[] = {0, 1, 64, 128, 129, 300, 512, 513, 2000};
+  uint8_t want[9][64];
+  for (size_t i = 0; i < 9; ++i)
+    tinyblake_blake2b(want[i], 64, msg.data(), lens[i], nullptr, 0);
+
+  ASSERT_EQ(tinyblake_blake2b_set_kernel(3, "portable"), -1);
+  ASSERT_EQ(tinyblake_blake2b_set_kernel(-1, "portable"), -1);
+  ASSERT_EQ(tinyblake_blake2b_set_kernel(0, "sse9"), -1);
+  ASSERT_EQ(tinyblake_blake2b_set_kernel(0, nullptr), -1);
+  ASSERT_TRUE(tinyblake_blake2b_get_kernel(3) == nullptr);
+  ASSERT_EQ(tinyblake_blake2b_set_thresholds(512, 128), -1);
+
+  size_t single_max = 0, small_max = 0;
+  tinyblake_blake2b_get_thresholds(&single_max, &small_max);
+  ASSERT_TRUE(single_max <= small_max);
+
+  /* Every supported kernel in every class gives the same digests, through
+   * the one-shot and through uneven streaming updates */
+  for (int cls : classes) {
+    for (const char *name : NAMES) {
+      if (tinyblake_blake2b_set_kernel(cls, name) != 0)
+        continue;
+      ASSERT_EQ(std::strcmp(tinyblake_blake2b_get_kernel(cls), name), 0);
+      for (size_t i = 0; i < 9; ++i) {
+        uint8_t got[64];
+        tinyblake_blake2b(got, 64, msg.data(), lens[i], nullptr, 0);
+        ASSERT_BYTES_EQ(got, want[i], 64);
+
+        tinyblake_blake2b_state S;
+        tinyblake_blake2b_init(&S, 64);
+        size_t off = 0, step = 1;
+        while (off < lens[i]) {
+          const size_t n = std::min(step, lens[i] - off);
+          tinyblake_blake2b_update(&S, msg.data() + off, n);
+          off += n;
+          step = step * 3 + 1;
+        }
+        tinyblake_blake2b_final(&S, got, 64);
+        ASSERT_BYTES_EQ(got, want[i], 64);
+      }
+    }
+    ASSERT_EQ(tinyblake_blake2b_set_kernel(cls, "auto"), 0);
+  }
+
+  /* Thresholds move calls between classes without changing results */
+  ASSERT_EQ(tinyblake_blake2b_set_kernel(TINYBLAKE_BLAKE2B_SIZE_SMALL,
+                                         "portable"),
+            0);
+  ASSERT_EQ(tinyblake_blake2b_set_thresholds(0, 4096), 0);
+  size_t a = 1, b = 1;
+  tinyblake_blake2b_get_thresholds(&a, &b);
+  ASSERT_EQ(a, size_t(0));
+  ASSERT_EQ(b, size_t(4096));
+  for (size_t i = 0; i < 9; ++i) {
+    uint8_t got[64];
+    tinyblake_blake2b(got, 64, msg.data(), lens[i], nullptr, 0);
+    ASSERT_BYTES_EQ(got, want[i], 64);
+  }
+  auto keyed = tinyblake::blake2b::keyed_hash(msg.data(), 32, msg.data(),
+                                              300, 64);
+  ASSERT_EQ(tinyblake_blake2b_set_thresholds(single_max, small_max), 0);
+  ASSERT_EQ(tinyblake_blake2b_set_kernel(TINYBLAKE_BLAKE2B_SIZE_SMALL, "auto"),
+            0);
+  auto keyed_default = tinyblake::blake2b::keyed_hash(msg.data(), 32,
+                                                      msg.data(), 300, 64);
+  ASSERT_TRUE(keyed == keyed_default);
+
+  /* Autotune assigns a supported kernel to every class */
+  ASSERT_EQ(tinyblake_blake2b_autotune(), 0);
+  for (int cls : classes) {
+    ASSERT_TRUE(tinyblake_blake2b_get_kernel(cls) != nullptr);
+    uint8_t got[64];
+    tinyblake_blake2b(got, 64, msg.data(), 2000, nullptr, 0);
+    ASSERT_BYTES_EQ(got, want[8], 64);
+    ASSERT_EQ(tinyblake_blake2b_set_kernel(cls, "auto"), 0);
+  }
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "../src/backend/blake2b_compress.h"
+#include "../src/cpu_features.h"
+#include "test_harness.h"
+#include <cstring>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/blake2b_inline.h>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    (defined(__GNUC__) || defined(__clang__)) &&                               \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+#define TEST_INLINE_X86_KERNELS 1
+#endif
+
+using inline_fn = int (*)(void *, size_t, const void *, size_t, const void *,
+                          size_t);
+using inline_compress_fn = void (*)(uint64_t *, const uint8_t *, uint64_t,
+                                    uint64_t, int);
+
+#if defined(TEST_INLINE_X86_KERNELS)
+/* Defined in test_blake2b_inline_avx2.cpp / _avx512vl.cpp */
+const char *blake2b_inline_backend_avx2();
+int blake2b_inline_avx2(void *, size_t, const void *, size_t, const void *,
+                        size_t);
+void blake2b_compress_inline_avx2(uint64_t *, const uint8_t *, uint64_t,
+                                  uint64_t, int);
+const char *blake2b_inline_backend_avx512vl();
+int blake2b_inline_avx512vl(void *, size_t, const void *, size_t, const void *,
+                            size_t);
+void blake2b_compress_inline_avx512vl(uint64_t *, const uint8_t *, uint64_t,
+                                      uint64_t, int);
+#endif
+
+/* Every length across the first few block boundaries, keyed and unkeyed,
+ * plus every digest size on one message */
+static void check_against_library(inline_fn fn) {
+  const auto msg = test::make_input(300, 31, 7);
+  const auto key = test::make_input(64, 17, 7);
+  uint8_t want[64], got[64];
+
+  for (size_t keylen : {size_t(0), size_t(1), size_t(32), size_t(64)}) {
+    for (size_t len = 0; len <= msg.size(); ++len) {
+      ASSERT_EQ(tinyblake_blake2b(want, 64, msg.data(), len,
+                                  keylen ? key.data() : nullptr, keylen),
+                0);
+      ASSERT_EQ(fn(got, 64, msg.data(), len, keylen ? key.data() : nullptr,
+                   keylen),
+                0);
+      ASSERT_BYTES_EQ(got, want, 64);
+    }
+  }
+
+  for (size_t outlen = 1; outlen <= 64; ++outlen) {
+    ASSERT_EQ(tinyblake_blake2b(want, outlen, msg.data(), 100, key.data(), 16),
+              0);
+    std::memset(got, 0xAA, sizeof(got));
+    ASSERT_EQ(fn(got, outlen, msg.data(), 100, key.data(), 16), 0);
+    ASSERT_BYTES_EQ(got, want, outlen);
+    /* Nothing written past outlen */
+    for (size_t i = outlen; i < 64; ++i)
+      ASSERT_EQ(got[i], 0xAA);
+  }
+}
+
+static void check_compress(inline_compress_fn fn) {
+  const auto block = test::make_input(128, 5, 7);
+  for (int last = 0; last <= 1; ++last) {
+    for (uint64_t t0 : {uint64_t(1), uint64_t(128), ~uint64_t(0)}) {
+      uint64_t want[8], got[8];
+      for (int i = 0; i < 8; ++i)
+        want[i] = got[i] = 0x0123456789ABCDEFULL * static_cast<uint64_t>(i + 1);
+      tinyblake::blake2b_compress_portable(want, block.data(), t0, 3,
+                                           last != 0);
+      fn(got, block.data(), t0, 3, last);
+      ASSERT_BYTES_EQ(reinterpret_cast<const uint8_t *>(got),
+                      reinterpret_cast<const uint8_t *>(want), sizeof(want));
+    }
+  }
+}
+
+TEST(blake2b_inline_matches_library) {
+  check_against_library(tinyblake_blake2b_inline);
+}
+
+TEST(blake2b_inline_compress_matches_portable) {
+  check_compress(tinyblake_blake2b_compress_inline);
+}
+
+TEST(blake2b_inline_rfc7693_abc) {
+  const auto want = test::hex_to_bytes(
+      "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d1"
+      "7d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923");
+  uint8_t got[64];
+  ASSERT_EQ(tinyblake_blake2b_inline(got, 64, "abc", 3, nullptr, 0), 0);
+  ASSERT_BYTES_EQ(got, want.data(), 64);
+}
+
+TEST(blake2b_inline_rejects_bad_args) {
+  uint8_t out[64];
+  const uint8_t key[65] = {0};
+  ASSERT_EQ(tinyblake_blake2b_inline(nullptr, 64, "x", 1, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_inline(out, 0, "x", 1, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_inline(out, 65, "x", 1, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_inline(out, 64, "x", 1, key, 65), -1);
+  ASSERT_EQ(tinyblake_blake2b_inline(out, 64, "x", 1, nullptr, 4), -1);
+  ASSERT_EQ(tinyblake_blake2b_inline(out, 64, nullptr, 1, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_inline(out, 64, nullptr, 0, nullptr, 0), 0);
+}
+
+TEST(blake2b_inline_backend_name) {
+  const char *name = tinyblake_blake2b_inline_backend();
+  ASSERT_TRUE(name != nullptr && name[0] != '\0');
+#if defined(TINYBLAKE_FORCE_PORTABLE)
+  ASSERT_TRUE(std::strcmp(name, "portable") == 0);
+#endif
+}
+
+#if defined(TEST_INLINE_X86_KERNELS)
+TEST(blake2b_inline_avx2_kernel) {
+  if (!tinyblake::cpu::detect().avx2)
+    return;
+  ASSERT_TRUE(std::strcmp(blake2b_inline_backend_avx2(), "avx2") == 0);
+  check_against_library(blake2b_inline_avx2);
+  check_compress(blake2b_compress_inline_avx2);
+}
+
+TEST(blake2b_inline_avx512vl_kernel) {
+  const auto &f = tinyblake::cpu::detect();
+  if (!f.avx2 || !f.avx512f || !f.avx512vl)
+    return;
+  ASSERT_TRUE(std::strcmp(blake2b_inline_backend_avx512vl(),
+                          "avx2+avx512vl") == 0);
+  check_against_library(blake2b_inline_avx512vl);
+  check_compress(blake2b_compress_inline_avx512vl);
+}
+#endif
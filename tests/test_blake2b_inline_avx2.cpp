@@ -0,0 +1,48 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/*
+ * Built with -mavx2 (see tests/CMakeLists.txt) so the inline header picks
+ * its AVX2 kernel; test_blake2b_inline.cpp calls these only when the CPU
+ * has the extension. Kept free of other headers so no AVX2-compiled copy
+ * of a shared inline function can leak into the rest of the binary.
+ */
+#include <tinyblake/blake2b_inline.h>
+
+const char *blake2b_inline_backend_avx2() {
+  return tinyblake_blake2b_inline_backend();
+}
+
+int blake2b_inline_avx2(void *out, size_t outlen, const void *in, size_t inlen,
+                      const void *key, size_t keylen) {
+  return tinyblake_blake2b_inline(out, outlen, in, inlen, key, keylen);
+}
+
+void blake2b_compress_inline_avx2(uint64_t h[8], const uint8_t block[128],
+                                uint64_t t0, uint64_t t1, int last) {
+  tinyblake_blake2b_compress_inline(h, block, t0, t1, last);
+}
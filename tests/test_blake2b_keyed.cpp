@@ -31,19 +31,12 @@
 
 #include "vectors_blake2b_keyed.inl"
 
-/* Build input for keyed KAT: input(i) = 00 01 02 ... (i-1) */
-static std::vector<uint8_t> make_input(size_t len) {
-  std::vector<uint8_t> v(len);
-  for (size_t i = 0; i < len; ++i) {
-    v[i] = static_cast<uint8_t>(i & 0xFF);
-  }
-  return v;
-}
+/* Keyed KATs hash input(i) = 00 01 02 ... (i-1) */
 
 TEST(blake2b_keyed_kat_0) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[0].expected_hex);
-  auto input = make_input(keyed_kat_vectors[0].input_len);
+  auto input = test::make_input(keyed_kat_vectors[0].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -55,7 +48,7 @@ TEST(blake2b_keyed_kat_0) {
 TEST(blake2b_keyed_kat_1) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[1].expected_hex);
-  auto input = make_input(keyed_kat_vectors[1].input_len);
+  auto input = test::make_input(keyed_kat_vectors[1].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -67,7 +60,7 @@ TEST(blake2b_keyed_kat_1) {
 TEST(blake2b_keyed_kat_2) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[2].expected_hex);
-  auto input = make_input(keyed_kat_vectors[2].input_len);
+  auto input = test::make_input(keyed_kat_vectors[2].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -79,7 +72,7 @@ TEST(blake2b_keyed_kat_2) {
 TEST(blake2b_keyed_kat_3) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[3].expected_hex);
-  auto input = make_input(keyed_kat_vectors[3].input_len);
+  auto input = test::make_input(keyed_kat_vectors[3].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -91,7 +84,7 @@ TEST(blake2b_keyed_kat_3) {
 TEST(blake2b_keyed_kat_63) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[4].expected_hex);
-  auto input = make_input(keyed_kat_vectors[4].input_len);
+  auto input = test::make_input(keyed_kat_vectors[4].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -103,7 +96,7 @@ TEST(blake2b_keyed_kat_63) {
 TEST(blake2b_keyed_kat_64) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[5].expected_hex);
-  auto input = make_input(keyed_kat_vectors[5].input_len);
+  auto input = test::make_input(keyed_kat_vectors[5].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -115,7 +108,7 @@ TEST(blake2b_keyed_kat_64) {
 TEST(blake2b_keyed_kat_128) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[6].expected_hex);
-  auto input = make_input(keyed_kat_vectors[6].input_len);
+  auto input = test::make_input(keyed_kat_vectors[6].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -127,7 +120,7 @@ TEST(blake2b_keyed_kat_128) {
 TEST(blake2b_keyed_kat_255) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[7].expected_hex);
-  auto input = make_input(keyed_kat_vectors[7].input_len);
+  auto input = test::make_input(keyed_kat_vectors[7].input_len);
 
   uint8_t out[64];
   int rc = tinyblake_blake2b(out, 64, input.data(), input.size(), key.data(),
@@ -148,7 +141,7 @@ TEST(blake2b_keyed_cpp_api) {
 TEST(blake2b_keyed_incremental) {
   auto key = test::hex_to_bytes(keyed_kat_key_hex);
   auto expected = test::hex_to_bytes(keyed_kat_vectors[6].expected_hex);
-  auto input = make_input(128);
+  auto input = test::make_input(128);
 
   /* Feed incrementally */
   tinyblake::blake2b::hasher h(key.data(), key.size(), 64);
@@ -0,0 +1,240 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/backend/blake2s_compress.h"
+#include "../src/cpu_features.h"
+#include "../src/internal/blake2s_dispatch.h"
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake2s.h>
+
+#include "vectors_blake2s_keyed.inl"
+
+TEST(blake2s_rfc7693_abc) {
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_blake2s(out, 32, "abc", 3, nullptr, 0), 0);
+  auto expected = test::hex_to_bytes(
+      "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982");
+  ASSERT_BYTES_EQ(out, expected.data(), 32);
+}
+
+TEST(blake2s_empty) {
+  auto got = tinyblake::blake2s::hash("", 0);
+  auto expected = test::hex_to_bytes(
+      "69217a3079908094e11121d042354a7c1f55b6482ca1a51e1b250dfd1ed0eef9");
+  ASSERT_EQ(got, expected);
+}
+
+TEST(blake2s_keyed_kat) {
+  auto key = test::hex_to_bytes(keyed_kat_key_s_hex);
+  for (const auto &v : keyed_kat_vectors_s) {
+    auto expected = test::hex_to_bytes(v.expected_hex);
+    auto input = test::make_input(v.input_len);
+
+    uint8_t out[32];
+    ASSERT_EQ(tinyblake_blake2s(out, 32, input.data(), input.size(),
+                                key.data(), key.size()),
+              0);
+    ASSERT_BYTES_EQ(out, expected.data(), 32);
+
+    tinyblake::blake2s::hasher h(key.data(), key.size());
+    h.update(input);
+    ASSERT_EQ(h.final_(), expected);
+  }
+}
+
+TEST(blake2s_param_block_salt_personal) {
+  /* hashlib.blake2s(b"tinyblake", digest_size=20, salt=b"saltsalt",
+   *                 person=b"personal") */
+  uint8_t param[32] = {};
+  param[0] = 20;
+  param[2] = 1;
+  param[3] = 1;
+  std::memcpy(param + 16, "saltsalt", 8);
+  std::memcpy(param + 24, "personal", 8);
+
+  tinyblake_blake2s_state S;
+  ASSERT_EQ(tinyblake_blake2s_init_param(&S, param), 0);
+  ASSERT_EQ(tinyblake_blake2s_update(&S, "tinyblake", 9), 0);
+  uint8_t out[20];
+  ASSERT_EQ(tinyblake_blake2s_final(&S, out, 20), 0);
+  auto expected =
+      test::hex_to_bytes("a1e547e6eccba5a085dd1c54d33e465cdb1b31d9");
+  ASSERT_BYTES_EQ(out, expected.data(), 20);
+}
+
+TEST(blake2s_incremental_matches_oneshot) {
+  auto input = test::make_input(300);
+  static const size_t chunks[] = {1, 3, 63, 64, 65, 128};
+  for (size_t len = 0; len <= input.size(); len += 7) {
+    uint8_t expected[32];
+    tinyblake_blake2s(expected, 32, input.data(), len, nullptr, 0);
+    for (size_t chunk : chunks) {
+      tinyblake::blake2s::hasher h;
+      for (size_t off = 0; off < len; off += chunk)
+        h.update(input.data() + off, (len - off) < chunk ? len - off : chunk);
+      auto got = h.final_();
+      ASSERT_BYTES_EQ(got.data(), expected, 32);
+    }
+  }
+}
+
+TEST(blake2s_cpp_reset_and_move) {
+  const uint8_t key[16] = {1, 2, 3};
+  tinyblake::blake2s::hasher h(key, sizeof(key), 24);
+  h.update("data", 4);
+  auto first = h.final_();
+  ASSERT_EQ(first.size(), size_t{24});
+  ASSERT_EQ(first, tinyblake::blake2s::keyed_hash(key, sizeof(key), "data", 4,
+                                                  24));
+
+  h.reset();
+  h.update(std::string("data"));
+  tinyblake::blake2s::hasher moved(std::move(h));
+  ASSERT_EQ(moved.final_(), first);
+}
+
+TEST(blake2s_error_cases) {
+  tinyblake_blake2s_state S;
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_blake2s_init(&S, 0), -1);
+  ASSERT_EQ(tinyblake_blake2s_init(&S, 33), -1);
+  ASSERT_EQ(tinyblake_blake2s_init(nullptr, 32), -1);
+  ASSERT_EQ(tinyblake_blake2s_init_key(&S, 32, "k", 0), -1);
+  ASSERT_EQ(tinyblake_blake2s_init_key(&S, 32, out, 33), -1);
+  ASSERT_EQ(tinyblake_blake2s(out, 32, nullptr, 1, nullptr, 0), -1);
+
+  ASSERT_EQ(tinyblake_blake2s_init(&S, 32), 0);
+  ASSERT_EQ(tinyblake_blake2s_final(&S, out, 16), -1);
+
+  bool threw = false;
+  try {
+    tinyblake::blake2s::hasher h(64);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
+
+TEST(blake2s_hash_many_matches_single) {
+  static const size_t counts[] = {1, 2, 7, 8, 9, 17};
+  const uint8_t key[32] = {9, 8, 7, 6, 5, 4, 3, 2, 1};
+  for (size_t n : counts) {
+    std::vector<std::vector<uint8_t>> msgs(n);
+    std::vector<const void *> ptrs(n);
+    std::vector<size_t> lens(n);
+    for (size_t i = 0; i < n; ++i) {
+      msgs[i] = test::make_input((i * 37 + n * 11) % 200);
+      ptrs[i] = msgs[i].data();
+      lens[i] = msgs[i].size();
+    }
+
+    for (size_t keylen : {size_t{0}, size_t{5}, size_t{32}}) {
+      for (size_t outlen : {size_t{32}, size_t{16}}) {
+        std::vector<uint8_t> out(n * outlen);
+        ASSERT_EQ(tinyblake_blake2s_hash_many(out.data(), outlen, ptrs.data(),
+                                              lens.data(), n, key, keylen),
+                  0);
+        for (size_t i = 0; i < n; ++i) {
+          uint8_t expected[32];
+          tinyblake_blake2s(expected, outlen, msgs[i].data(), msgs[i].size(),
+                            key, keylen);
+          ASSERT_BYTES_EQ(&out[i * outlen], expected, outlen);
+        }
+      }
+    }
+
+    auto flat = tinyblake::blake2s::hash_many(msgs);
+    ASSERT_EQ(flat.size(), n * 32);
+    ASSERT_BYTES_EQ(flat.data() + (n - 1) * 32,
+                    tinyblake::blake2s::hash(msgs[n - 1]).data(), 32);
+  }
+
+  ASSERT_EQ(tinyblake_blake2s_hash_many(nullptr, 32, nullptr, nullptr, 0,
+                                        nullptr, 0),
+            0);
+  const void *bad[1] = {nullptr};
+  const size_t badlen[1] = {4};
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_blake2s_hash_many(out, 32, bad, badlen, 1, nullptr, 0),
+            -1);
+}
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+static void fill_blocks(uint8_t (*blocks)[64], uint32_t (*state)[8],
+                        size_t lanes) {
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t i = 0; i < 64; ++i)
+      blocks[l][i] = static_cast<uint8_t>(l * 31 + i * 7);
+    for (size_t i = 0; i < 8; ++i)
+      state[l][i] = static_cast<uint32_t>(0x01234567u * (l + 1) + i);
+  }
+}
+#endif
+
+TEST(blake2s_backends_match_portable) {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = tinyblake::cpu::detect();
+  uint8_t blocks[8][64];
+  uint32_t ref[8][8], got[8][8];
+  fill_blocks(blocks, ref, 8);
+  std::memcpy(got, ref, sizeof(ref));
+
+  if (feat.sse41) {
+    for (int last = 0; last < 2; ++last) {
+      uint32_t a[8], b[8];
+      std::memcpy(a, ref[0], 32);
+      std::memcpy(b, ref[0], 32);
+      tinyblake::blake2s_compress_portable(a, blocks[0], 64, 1, last != 0);
+      tinyblake::blake2s_compress_sse41(b, blocks[0], 64, 1, last != 0);
+      ASSERT_TRUE(std::memcmp(a, b, sizeof(a)) == 0);
+    }
+  }
+
+  if (feat.avx2) {
+    uint32_t *state[8];
+    const uint8_t *block[8];
+    uint32_t t0[8], t1[8], f0[8];
+    for (size_t l = 0; l < 8; ++l) {
+      state[l] = got[l];
+      block[l] = blocks[l];
+      t0[l] = static_cast<uint32_t>(64 * (l + 1));
+      t1[l] = static_cast<uint32_t>(l & 1);
+      f0[l] = (l % 3 == 0) ? 0xFFFFFFFFu : 0;
+      tinyblake::blake2s_compress_portable(ref[l], blocks[l], t0[l], t1[l],
+                                           f0[l] != 0);
+    }
+    tinyblake::blake2s_compress_8way_avx2(state, block, t0, t1, f0);
+    ASSERT_TRUE(std::memcmp(got, ref, sizeof(ref)) == 0);
+  }
+#endif
+  ASSERT_TRUE(tinyblake::detail::blake2s_get_lanes().lanes >= 1);
+}
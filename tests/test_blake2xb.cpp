@@ -0,0 +1,133 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <stdexcept>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/blake2xb.h>
+
+#include "vectors_blake2xb.inl"
+
+TEST(blake2xb_kat_vectors) {
+  auto key = test::hex_to_bytes(blake2xb_key_hex);
+  for (const auto &vec : blake2xb_vectors) {
+    auto input = test::make_input(vec.input_len);
+    auto expected = test::hex_to_bytes(vec.expected_hex);
+    ASSERT_EQ(expected.size(), vec.outlen);
+
+    std::vector<uint8_t> out(vec.outlen);
+    int rc = tinyblake_blake2xb(out.data(), out.size(), input.data(),
+                                input.size(), vec.keyed ? key.data() : nullptr,
+                                vec.keyed ? key.size() : 0);
+    ASSERT_EQ(rc, 0);
+    ASSERT_BYTES_EQ(out.data(), expected.data(), vec.outlen);
+  }
+}
+
+TEST(blake2xb_long_outputs) {
+  auto key = test::hex_to_bytes(blake2xb_key_hex);
+  for (const auto &vec : blake2xb_long_vectors) {
+    auto input = test::make_input(vec.input_len);
+    auto expected = test::hex_to_bytes(vec.output_blake2b256_hex);
+
+    std::vector<uint8_t> out(vec.outlen);
+    int rc = tinyblake_blake2xb(out.data(), out.size(), input.data(),
+                                input.size(), vec.keyed ? key.data() : nullptr,
+                                vec.keyed ? key.size() : 0);
+    ASSERT_EQ(rc, 0);
+
+    uint8_t digest[32];
+    tinyblake_blake2b(digest, 32, out.data(), out.size(), nullptr, 0);
+    ASSERT_BYTES_EQ(digest, expected.data(), 32);
+  }
+}
+
+TEST(blake2xb_incremental_matches_oneshot) {
+  auto input = test::make_input(1000);
+  auto expected = tinyblake::blake2xb::hash(input.data(), input.size(), 777);
+
+  for (size_t chunk : {1, 63, 128, 129, 500}) {
+    tinyblake::blake2xb::hasher h(777);
+    for (size_t off = 0; off < input.size(); off += chunk) {
+      size_t n = (input.size() - off) < chunk ? (input.size() - off) : chunk;
+      h.update(input.data() + off, n);
+    }
+    auto out = h.final_();
+    ASSERT_EQ(out.size(), 777u);
+    ASSERT_BYTES_EQ(out.data(), expected.data(), 777);
+  }
+}
+
+TEST(blake2xb_cpp_keyed) {
+  auto key = test::hex_to_bytes(blake2xb_key_hex);
+  const auto &vec = blake2xb_vectors[9]; /* keyed, 256-byte output */
+  auto input = test::make_input(vec.input_len);
+  auto expected = test::hex_to_bytes(vec.expected_hex);
+
+  auto out = tinyblake::blake2xb::keyed_hash(key.data(), key.size(),
+                                             input.data(), input.size(),
+                                             vec.outlen);
+  ASSERT_EQ(out.size(), vec.outlen);
+  ASSERT_BYTES_EQ(out.data(), expected.data(), vec.outlen);
+}
+
+TEST(blake2xb_error_cases) {
+  uint8_t out[64];
+  tinyblake_blake2xb_state S;
+
+  ASSERT_EQ(tinyblake_blake2xb_init(nullptr, 64), -1);
+  ASSERT_EQ(tinyblake_blake2xb_init(&S, 0), -1);
+  ASSERT_EQ(tinyblake_blake2xb_init_key(&S, 64, nullptr, 32), -1);
+  ASSERT_EQ(tinyblake_blake2xb_init_key(&S, 64, out, 65), -1);
+  ASSERT_EQ(tinyblake_blake2xb(out, 64, nullptr, 5, nullptr, 0), -1);
+
+  /* Output buffer shorter than the declared length is rejected */
+  ASSERT_EQ(tinyblake_blake2xb_init(&S, 64), 0);
+  ASSERT_EQ(tinyblake_blake2xb_final(&S, out, 32), -1);
+  ASSERT_EQ(tinyblake_blake2xb_final(&S, out, 64), 0);
+
+  /* State is wiped after final */
+  ASSERT_EQ(tinyblake_blake2xb_final(&S, out, 64), -1);
+
+  bool threw = false;
+  try {
+    tinyblake::blake2xb::hasher h(0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
+
+TEST(blake2xb_differs_from_blake2b) {
+  /* xof_length is part of the root parameter block, so even a 64-byte
+   * BLAKE2Xb output differs from BLAKE2b-512. */
+  uint8_t a[64], b[64];
+  tinyblake_blake2xb(a, 64, "abc", 3, nullptr, 0);
+  tinyblake_blake2b(b, 64, "abc", 3, nullptr, 0);
+  ASSERT_TRUE(std::memcmp(a, b, 64) != 0);
+}
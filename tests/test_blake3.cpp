@@ -0,0 +1,263 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/backend/blake3_impl.h"
+#include "../src/cpu_features.h"
+#include "../src/internal/blake3_dispatch.h"
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake3.h>
+
+#include "vectors_blake3.inl"
+
+static const uint8_t *vector_key() {
+  return reinterpret_cast<const uint8_t *>(blake3_vector_key);
+}
+
+TEST(blake3_known_answers) {
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_blake3(out, 32, "abc", 3, nullptr), 0);
+  auto expected = test::hex_to_bytes(
+      "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85");
+  ASSERT_BYTES_EQ(out, expected.data(), 32);
+
+  auto empty = tinyblake::blake3::hash("", 0);
+  ASSERT_EQ(empty, test::hex_to_bytes("af1349b9f5f9a1a6a0404dea36dcc949"
+                                      "9bcb25c9adc112b7cc9a93cae41f3262"));
+}
+
+TEST(blake3_vectors_oneshot) {
+  const size_t ctxlen = std::strlen(blake3_vector_context);
+  for (const auto &v : blake3_vectors) {
+    auto input = test::make_input(v.input_len, 1, 0, 251);
+    auto hash = test::hex_to_bytes(v.hash_hex);
+    auto keyed = test::hex_to_bytes(v.keyed_hex);
+    auto derived = test::hex_to_bytes(v.derive_hex);
+
+    std::vector<uint8_t> out(hash.size());
+    ASSERT_EQ(tinyblake_blake3(out.data(), out.size(), input.data(),
+                               input.size(), nullptr),
+              0);
+    ASSERT_EQ(out, hash);
+
+    ASSERT_EQ(tinyblake_blake3(out.data(), 32, input.data(), input.size(),
+                               vector_key()),
+              0);
+    ASSERT_BYTES_EQ(out.data(), keyed.data(), 32);
+
+    ASSERT_EQ(tinyblake_blake3_derive_key(out.data(), out.size(),
+                                          blake3_vector_context, ctxlen,
+                                          input.data(), input.size()),
+              0);
+    ASSERT_EQ(out, derived);
+  }
+}
+
+TEST(blake3_vectors_incremental) {
+  static const size_t chunks[] = {1, 63, 64, 1000, 1024, 4097};
+  for (const auto &v : blake3_vectors) {
+    if (v.input_len > 102400)
+      continue;
+    auto input = test::make_input(v.input_len, 1, 0, 251);
+    auto keyed = test::hex_to_bytes(v.keyed_hex);
+
+    for (size_t chunk : chunks) {
+      tinyblake_blake3_state S;
+      ASSERT_EQ(tinyblake_blake3_init_keyed(&S, vector_key()), 0);
+      for (size_t off = 0; off < input.size(); off += chunk) {
+        const size_t n =
+            (input.size() - off) < chunk ? input.size() - off : chunk;
+        ASSERT_EQ(tinyblake_blake3_update(&S, input.data() + off, n), 0);
+      }
+      std::vector<uint8_t> out(keyed.size());
+      ASSERT_EQ(tinyblake_blake3_final(&S, out.data(), out.size()), 0);
+      ASSERT_EQ(out, keyed);
+    }
+  }
+}
+
+TEST(blake3_parallel_matches_serial) {
+  for (const auto &v : blake3_vectors) {
+    if (v.input_len < 8192)
+      continue;
+    auto input = test::make_input(v.input_len, 1, 0, 251);
+    auto hash = test::hex_to_bytes(v.hash_hex);
+
+    for (size_t threads : {size_t{0}, size_t{1}, size_t{3}, size_t{8}}) {
+      auto got = tinyblake::blake3::hash_parallel(input.data(), input.size(),
+                                                  hash.size(), threads);
+      ASSERT_EQ(got, hash);
+    }
+
+    /* A leading partial chunk leaves the counter unaligned */
+    tinyblake::blake3::hasher h;
+    h.update(input.data(), 1500);
+    h.update_parallel(input.data() + 1500, input.size() - 1500, 4);
+    ASSERT_EQ(h.final_(hash.size()), hash);
+  }
+}
+
+TEST(blake3_final_is_repeatable_and_seekable) {
+  auto input = test::make_input(5000, 1, 0, 251);
+  tinyblake::blake3::hasher h;
+  h.update(input.data(), 3000);
+  auto mid = h.final_();
+  ASSERT_EQ(mid, tinyblake::blake3::hash(input.data(), 3000));
+  ASSERT_EQ(h.final_(), mid);
+
+  h.update(input.data() + 3000, 2000);
+  auto full = h.final_(300);
+  ASSERT_EQ(full, tinyblake::blake3::hash(input.data(), input.size(), 300));
+
+  static const uint64_t seeks[] = {0, 1, 63, 64, 65, 130, 200};
+  for (uint64_t seek : seeks) {
+    uint8_t part[50];
+    const size_t n = (300 - seek) < 50 ? static_cast<size_t>(300 - seek) : 50;
+    h.final_seek(seek, part, n);
+    ASSERT_BYTES_EQ(part, full.data() + seek, n);
+  }
+}
+
+TEST(blake3_cpp_modes_reset_and_move) {
+  auto input = test::make_input(2049, 1, 0, 251);
+  const auto &v = blake3_vectors[8]; /* 2048 */
+  ASSERT_EQ(v.input_len, size_t{2048});
+
+  tinyblake::blake3::hasher keyed(vector_key());
+  keyed.update(input.data(), 100);
+  keyed.reset();
+  keyed.update(input.data(), 2048);
+  ASSERT_EQ(keyed.final_(131), test::hex_to_bytes(v.keyed_hex));
+
+  auto kdf = tinyblake::blake3::hasher::derive_key(blake3_vector_context);
+  kdf.update(input.data(), 7);
+  kdf.reset();
+  kdf.update(input.data(), 2048);
+  tinyblake::blake3::hasher moved(std::move(kdf));
+  ASSERT_EQ(moved.final_(131), test::hex_to_bytes(v.derive_hex));
+
+  ASSERT_EQ(tinyblake::blake3::derive_key(blake3_vector_context, input.data(),
+                                          2048, 131),
+            test::hex_to_bytes(v.derive_hex));
+  auto k = tinyblake::blake3::keyed_hash(vector_key(), input.data(), 2048);
+  ASSERT_BYTES_EQ(k.data(), test::hex_to_bytes(v.keyed_hex).data(), 32);
+}
+
+TEST(blake3_error_cases) {
+  tinyblake_blake3_state S;
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_blake3_init(nullptr), -1);
+  ASSERT_EQ(tinyblake_blake3_init_keyed(&S, nullptr), -1);
+  ASSERT_EQ(tinyblake_blake3_init_derive_key(&S, nullptr, 1), -1);
+  ASSERT_EQ(tinyblake_blake3_init(&S), 0);
+  ASSERT_EQ(tinyblake_blake3_update(&S, nullptr, 1), -1);
+  ASSERT_EQ(tinyblake_blake3_update(&S, nullptr, 0), 0);
+  ASSERT_EQ(tinyblake_blake3_final(&S, out, 0), -1);
+  ASSERT_EQ(tinyblake_blake3_final(&S, nullptr, 32), -1);
+  ASSERT_EQ(tinyblake_blake3(out, 32, nullptr, 5, nullptr), -1);
+
+  bool threw = false;
+  try {
+    tinyblake::blake3::hasher h;
+    h.final_(0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+
+  threw = false;
+  try {
+    tinyblake::blake3::hasher h(static_cast<const uint8_t *>(nullptr));
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
+
+/* Every hash_many backend against the portable one, for chunk and parent
+ * inputs, group remainders, and a counter crossing 2^32. */
+static void check_hash_many(tinyblake::blake3_hash_many_fn fn) {
+  using namespace tinyblake;
+  auto input = test::make_input(40 * BLAKE3_CHUNK_LEN, 1, 0, 251);
+  const uint32_t key[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  const uint8_t *ptrs[40];
+  for (size_t i = 0; i < 40; ++i)
+    ptrs[i] = input.data() + i * BLAKE3_CHUNK_LEN;
+
+  for (size_t n = 0; n <= 40; n += (n < 18 ? 1 : 11)) {
+    for (size_t blocks : {size_t{1}, size_t{16}}) {
+      std::vector<uint8_t> ref(n * 32 + 1), got(n * 32 + 1);
+      const uint64_t counter = 0xFFFFFFFDull;
+      blake3_hash_many_portable(ptrs, n, blocks, key, counter, blocks > 1,
+                                BLAKE3_KEYED_HASH, BLAKE3_CHUNK_START,
+                                BLAKE3_CHUNK_END, ref.data());
+      fn(ptrs, n, blocks, key, counter, blocks > 1, BLAKE3_KEYED_HASH,
+         BLAKE3_CHUNK_START, BLAKE3_CHUNK_END, got.data());
+      ASSERT_EQ(got, ref);
+    }
+  }
+}
+
+TEST(blake3_backends_match_portable) {
+  using namespace tinyblake;
+  const detail::blake3_kernels &k = detail::blake3_get_kernels();
+  ASSERT_TRUE(k.degree >= 1 && k.degree <= detail::BLAKE3_MAX_SIMD_DEGREE);
+  check_hash_many(k.hash_many);
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = cpu::detect();
+  if (feat.sse41) {
+    check_hash_many(blake3_hash_many_sse41);
+
+    auto block = test::make_input(64, 1, 0, 251);
+    const uint32_t cv[8] = {9, 8, 7, 6, 5, 4, 3, 2};
+    for (uint8_t len : {uint8_t{0}, uint8_t{17}, uint8_t{64}}) {
+      uint8_t a[64], b[64];
+      blake3_compress_xof_portable(cv, block.data(), len, 0x123456789ull,
+                                   BLAKE3_ROOT | BLAKE3_CHUNK_END, a);
+      blake3_compress_xof_sse41(cv, block.data(), len, 0x123456789ull,
+                                BLAKE3_ROOT | BLAKE3_CHUNK_END, b);
+      ASSERT_BYTES_EQ(a, b, 64);
+
+      uint32_t x[8], y[8];
+      std::memcpy(x, cv, 32);
+      std::memcpy(y, cv, 32);
+      blake3_compress_in_place_portable(x, block.data(), len, 7,
+                                        BLAKE3_PARENT);
+      blake3_compress_in_place_sse41(y, block.data(), len, 7, BLAKE3_PARENT);
+      ASSERT_TRUE(std::memcmp(x, y, 32) == 0);
+    }
+  }
+  if (feat.avx2)
+    check_hash_many(blake3_hash_many_avx2);
+  if (feat.avx512f && feat.avx512vl)
+    check_hash_many(blake3_hash_many_avx512);
+#endif
+}
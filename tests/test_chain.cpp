@@ -0,0 +1,295 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/backend/blake2b_compress.h"
+#include "../src/cpu_features.h"
+#include "../src/internal/blake2b_dispatch.h"
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/chain.h>
+
+/* Reference chain through the streaming API */
+static std::vector<uint8_t> manual_chain(const void *in, size_t inlen,
+                                         uint64_t n, size_t outlen) {
+  std::vector<uint8_t> d(outlen);
+  tinyblake_blake2b(d.data(), outlen, in, inlen, nullptr, 0);
+  for (uint64_t i = 1; i < n; ++i) {
+    std::vector<uint8_t> next(outlen);
+    tinyblake_blake2b(next.data(), outlen, d.data(), d.size(), nullptr, 0);
+    d = next;
+  }
+  return d;
+}
+
+TEST(chain_reference_vectors) {
+  auto got = tinyblake::chain::iterate("tinyblake", 9, 1000, 32);
+  auto expected = test::hex_to_bytes(
+      "27df1fcb4287167c01660343fae452552a12df39de6f05959d96dfe1410959c3");
+  ASSERT_BYTES_EQ(got.data(), expected.data(), 32);
+
+  got = tinyblake::chain::iterate(nullptr, 0, 100000);
+  expected = test::hex_to_bytes(
+      "3210bff7615a255d8981a219f922418a62e8ef8a0310f2ad87863e203af2db79"
+      "74dd4089ec6b2aa4250e6a7df9f121851a30e5c0ca4d2ca445ad1fb917290176");
+  ASSERT_BYTES_EQ(got.data(), expected.data(), 64);
+}
+
+TEST(chain_matches_streaming_api) {
+  static const size_t outlens[] = {1, 7, 8, 9, 20, 32, 48, 63, 64};
+  static const uint64_t steps[] = {1, 2, 3, 17};
+  std::vector<uint8_t> input(300);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>(i);
+
+  for (size_t outlen : outlens) {
+    for (uint64_t n : steps) {
+      auto expected = manual_chain(input.data(), input.size(), n, outlen);
+      auto got = tinyblake::chain::iterate(input.data(), input.size(), n,
+                                           outlen);
+      ASSERT_EQ(got, expected);
+    }
+  }
+}
+
+/* Every iterate kernel the CPU supports, not just the dispatched one. */
+static bool check_iterate_kernel(tinyblake::blake2b_iterate_fn fn,
+                                 size_t outlen) {
+  uint64_t ref[8], got[8];
+  for (int i = 0; i < 8; ++i)
+    ref[i] = got[i] = 0xA5A5A5A5A5A5A5A5ULL * static_cast<uint64_t>(i + 1);
+  tinyblake::blake2b_iterate_portable(ref, outlen, 25);
+  fn(got, outlen, 25);
+  for (int i = 0; i < 8; ++i) {
+    if (ref[i] != got[i])
+      return false;
+  }
+  return true;
+}
+
+TEST(chain_backends_match_portable) {
+  const auto &feat = tinyblake::cpu::detect();
+  for (size_t outlen = 1; outlen <= 64; ++outlen) {
+    ASSERT_TRUE(check_iterate_kernel(tinyblake::detail::blake2b_get_iterate(),
+                                     outlen));
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+    ASSERT_TRUE(check_iterate_kernel(tinyblake::blake2b_iterate_x64, outlen));
+    if (feat.avx2) {
+      ASSERT_TRUE(
+          check_iterate_kernel(tinyblake::blake2b_iterate_avx2, outlen));
+    }
+    if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2) {
+      ASSERT_TRUE(
+          check_iterate_kernel(tinyblake::blake2b_iterate_avx512, outlen));
+    }
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+    if (feat.neon) {
+      ASSERT_TRUE(
+          check_iterate_kernel(tinyblake::blake2b_iterate_neon, outlen));
+    }
+    if (feat.neon && feat.sha3) {
+      ASSERT_TRUE(
+          check_iterate_kernel(tinyblake::blake2b_iterate_neon_sha3, outlen));
+    }
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+    if (feat.rvv) {
+      ASSERT_TRUE(check_iterate_kernel(tinyblake::blake2b_iterate_rvv, outlen));
+    }
+#endif
+    (void)feat;
+  }
+
+  /* Bytes past outlen come back zero */
+  uint64_t d[8] = {~0ULL, ~0ULL, ~0ULL, ~0ULL, ~0ULL, ~0ULL, ~0ULL, ~0ULL};
+  tinyblake::blake2b_iterate_portable(d, 12, 0);
+  ASSERT_EQ(d[0], ~0ULL);
+  ASSERT_EQ(d[1], 0xFFFFFFFFULL);
+  ASSERT_EQ(d[2], 0ULL);
+}
+
+/* Multi-lane iterate kernels against the single-lane portable kernel */
+static bool check_iterate_lanes(tinyblake::blake2b_iterate_lanes_fn fn,
+                                size_t lanes, size_t outlen) {
+  uint64_t ref[8][8], got[8][8];
+  uint64_t *ptrs[8];
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t w = 0; w < 8; ++w)
+      ref[l][w] = got[l][w] = 0x9E3779B97F4A7C15ULL * (l * 8 + w + 1);
+    tinyblake::blake2b_iterate_portable(ref[l], outlen, 9);
+    ptrs[l] = got[l];
+  }
+  fn(ptrs, outlen, 9);
+  return std::memcmp(ref, got, lanes * sizeof(ref[0])) == 0;
+}
+
+TEST(chain_lane_kernels_match_portable) {
+  const auto &kernel = tinyblake::detail::blake2b_get_lanes();
+  const auto &feat = tinyblake::cpu::detect();
+  for (size_t outlen : {1, 8, 13, 32, 64}) {
+    ASSERT_TRUE(check_iterate_lanes(kernel.iterate, kernel.lanes, outlen));
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+    if (feat.avx2) {
+      ASSERT_TRUE(check_iterate_lanes(tinyblake::blake2b_iterate_4way_avx2, 4,
+                                      outlen));
+    }
+    if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2) {
+      ASSERT_TRUE(check_iterate_lanes(tinyblake::blake2b_iterate_8way_avx512,
+                                      8, outlen));
+    }
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+    if (feat.neon) {
+      ASSERT_TRUE(check_iterate_lanes(tinyblake::blake2b_iterate_2way_neon, 2,
+                                      outlen));
+    }
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+    if (feat.rvv) {
+      ASSERT_TRUE(check_iterate_lanes(tinyblake::blake2b_iterate_lanes_rvv,
+                                      tinyblake::blake2b_rvv_lanes(), outlen));
+    }
+#endif
+    (void)feat;
+  }
+}
+
+TEST(chain_verify) {
+  const uint64_t interval = 13;
+  auto cps = tinyblake::chain::checkpoints("seed", 4, 37 * interval, interval,
+                                           32);
+  ASSERT_EQ(cps.size(), size_t(37));
+
+  for (size_t threads : {0, 1, 3}) {
+    auto res = tinyblake::chain::verify("seed", 4, cps, interval, threads);
+    ASSERT_TRUE(res.valid);
+  }
+
+  /* wrong seed fails the first segment only */
+  auto res = tinyblake::chain::verify("seeD", 4, cps, interval);
+  ASSERT_TRUE(!res.valid);
+  ASSERT_EQ(res.first_bad, size_t(0));
+
+  /* a tampered checkpoint breaks its own segment and the next one */
+  auto bad = cps;
+  bad[21][5] ^= 0x01;
+  bad[30][0] ^= 0x80;
+  res = tinyblake::chain::verify("seed", 4, bad, interval);
+  ASSERT_TRUE(!res.valid);
+  ASSERT_EQ(res.first_bad, size_t(21));
+
+  /* wrong step count */
+  res = tinyblake::chain::verify("seed", 4, cps, interval + 1);
+  ASSERT_TRUE(!res.valid);
+  ASSERT_EQ(res.first_bad, size_t(0));
+
+  /* interval 1: every digest is a checkpoint */
+  auto every = tinyblake::chain::checkpoints("x", 1, 20, 1, 64);
+  ASSERT_TRUE(tinyblake::chain::verify("x", 1, every, 1).valid);
+}
+
+TEST(chain_verify_errors) {
+  uint8_t cp[32] = {};
+  size_t first_bad = 0;
+  ASSERT_EQ(tinyblake_blake2b_chain_verify("s", 1, cp, 1, 32, 1, 0, nullptr),
+            -1);
+  ASSERT_EQ(
+      tinyblake_blake2b_chain_verify("s", 1, cp, 1, 32, 0, 0, &first_bad), -1);
+  ASSERT_EQ(
+      tinyblake_blake2b_chain_verify("s", 1, cp, 1, 65, 1, 0, &first_bad), -1);
+  ASSERT_EQ(tinyblake_blake2b_chain_verify("s", 1, nullptr, 1, 32, 1, 0,
+                                           &first_bad),
+            -1);
+  ASSERT_EQ(
+      tinyblake_blake2b_chain_verify("s", 1, cp, 0, 32, 1, 0, &first_bad), 0);
+  ASSERT_EQ(
+      tinyblake_blake2b_chain_verify("s", 1, cp, 1, 32, 1, 0, &first_bad), 1);
+  ASSERT_EQ(first_bad, size_t(0));
+
+  bool threw = false;
+  try {
+    std::vector<std::vector<uint8_t>> mixed = {std::vector<uint8_t>(32),
+                                               std::vector<uint8_t>(16)};
+    tinyblake::chain::verify("s", 1, mixed, 1);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
+
+TEST(chain_checkpoints) {
+  const uint64_t n = 50;
+  const uint64_t interval = 7;
+  auto cps = tinyblake::chain::checkpoints("seed", 4, n, interval, 32);
+  ASSERT_EQ(cps.size(), size_t(7));
+  for (size_t c = 0; c < cps.size(); ++c) {
+    auto expected = manual_chain("seed", 4, (c + 1) * interval, 32);
+    ASSERT_EQ(cps[c], expected);
+  }
+
+  uint8_t out[32];
+  uint8_t buf[7 * 32];
+  ASSERT_EQ(tinyblake_blake2b_iterate_checkpoints(out, 32, "seed", 4, n,
+                                                  interval, buf, sizeof(buf)),
+            0);
+  auto final_expected = manual_chain("seed", 4, n, 32);
+  ASSERT_BYTES_EQ(out, final_expected.data(), 32);
+
+  /* interval larger than n: no checkpoints, final digest still produced */
+  ASSERT_EQ(tinyblake_blake2b_iterate_checkpoints(out, 32, "seed", 4, n, 100,
+                                                  nullptr, 0),
+            0);
+  ASSERT_BYTES_EQ(out, final_expected.data(), 32);
+}
+
+TEST(chain_errors) {
+  uint8_t out[64];
+  uint8_t buf[64];
+  ASSERT_EQ(tinyblake_blake2b_iterate(nullptr, 32, "x", 1, 1), -1);
+  ASSERT_EQ(tinyblake_blake2b_iterate(out, 0, "x", 1, 1), -1);
+  ASSERT_EQ(tinyblake_blake2b_iterate(out, 65, "x", 1, 1), -1);
+  ASSERT_EQ(tinyblake_blake2b_iterate(out, 32, "x", 1, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_iterate(out, 32, nullptr, 1, 1), -1);
+  ASSERT_EQ(
+      tinyblake_blake2b_iterate_checkpoints(out, 32, "x", 1, 4, 0, buf, 64),
+      -1);
+  /* buffer too small for 4 checkpoints */
+  ASSERT_EQ(
+      tinyblake_blake2b_iterate_checkpoints(out, 32, "x", 1, 4, 1, buf, 64),
+      -1);
+
+  bool threw = false;
+  try {
+    tinyblake::chain::iterate("x", 1, 0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
@@ -0,0 +1,369 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <algorithm>
+#include <blake2.h>
+#include <cstddef>
+#include <cstring>
+#include <sodium/crypto_generichash.h>
+#include <tinyblake/blake2b.h>
+#include <vector>
+
+static uint8_t KEY[64];
+
+static const uint8_t *kat_key() {
+  for (size_t i = 0; i < sizeof(KEY); ++i)
+    KEY[i] = static_cast<uint8_t>(i);
+  return KEY;
+}
+
+/* BLAKE2bp of the KAT message (bytes 0, 1, 2, ...): keyed with the 64-byte
+ * KAT key, unkeyed, and 32-byte output under the first 16 key bytes.
+ * Length 0 keyed is the first entry of the reference blake2bp-kat.txt;
+ * the rest come from an independent Python model of the tree. */
+struct blake2bp_vector {
+  size_t len;
+  const char *keyed;
+  const char *unkeyed;
+  const char *short_key_32;
+};
+
+static const blake2bp_vector BLAKE2BP_VECTORS[] = {
+    {0,
+     "9d9461073e4eb640a255357b839f394b838c6ff57c9b686a3f76107c1066728f"
+     "3c9956bd785cbc3bf79dc2ab578c5a0c063b9d9c405848de1dbe821cd05c940a",
+     "b5ef811a8038f70b628fa8b294daae7492b1ebe343a80eaabbf1f6ae664dd67b"
+     "9d90b0120791eab81dc96985f28849f6a305186a85501b405114bfa678df9380",
+     "f284c0ffaf88d2cd5968f11af4254106e0c56e2aea759f7cd09780ad5b6393c2"},
+    {1,
+     "ff8e90a37b94623932c59f7559f26035029c376732cb14d41602001cbb73adb7"
+     "9293a2dbda5f60703025144d158e2735529596251c73c0345ca6fccb1fb1e97e",
+     "a139280e72757b723e6473d5be59f36e9d50fc5cd7d4585cbc09804895a36c52"
+     "1242fb2789f85cb9e35491f31d4a6952f9d8e097aef94fa1ca0b12525721f03d",
+     "4c1a8abc3dd175c9f0513568c3e300deb10108716b0ead100a67c9661b442c2c"},
+    {128,
+     "9280f4d1157032ab315c100d636283fbf4fba2fbad0f8bc020721d76bc1c8973"
+     "ced28871cc907dab60e59756987b0e0f867fa2fe9d9041f2c9618074e44fe5e9",
+     "05ad0f271faf7e361320518452813ff9fb9976ac378050b6eefb05f7867b577b"
+     "8f14475794cff61b2bc062d346a7c65c6e0067c60a374af7940f10aa449d5fb9",
+     "e0bb3b0803f17761266750142b18394c38f4ed0304a07a34b3762516a991cd70"},
+    {129,
+     "5530c2d59f144872e987e4e258a7d8c38ce844e2cc2eed940ffc683b498815e5"
+     "3adb1faaf568946122805ac3b8e2fed435fed6162e76f564e586ba464424e885",
+     "b545880294afa153f8b9f49c73d952b5d1228f1a1ab5ebcb05ff79e560c030f7"
+     "500fe256a40b6a0e6cb3d42acd4b98595c5b51eaec5ad69cd40f1fc16d2d5f50",
+     "b7ac52affb41dc486947adcb1d32cd0a90706fbf5036cc4e99f0a5b03955fc10"},
+    {511,
+     "eb7b7bb4d5217025705e949d98db93ee62e64f6fb9e6f45108a5f7ebe2908161"
+     "294b0e8c904afa9d57c506e9da3b02806fd5767ae55498eb3bb8cd7f091b572d",
+     "fa14897433dd69321b1933a1fe101fdd463dc15fffe3f572c0b489bb607edff8"
+     "b6dd04a23871be993d64af5aaa9b76af482a2363a36c1e6daaef21d3e3ac29c6",
+     "efc9202e6c38ffe2d509fc96af166b4c4a9030a73261f723c2b073355e5247b3"},
+    {512,
+     "14ba32c1c80bb32c8282aa53f341f45daabda12bda41f7ad8ec75baa743a41ad"
+     "f2376ad3de32fb576d3efdcadf3f59d25b40b915681cc90dee3a9b2cb02061ea",
+     "5b3a0e990c4e8c6e5463e763a6686551a129a81ab48c49cd8dc10519dfe2d02d"
+     "2a451cbba6511775b6a9cb26db88363cdd067ffb7183efe19826678b2fc9f349",
+     "fad30ef696f9422a52b2edfe16c19315c8d73b9ded7a16d02e93c2e6e4ff36ef"},
+    {513,
+     "2d9af8503c1b107aece8ecc73f2c2a6ecfe3def943ab277bb3323643b8bbd336"
+     "31e34d0f095a4afb0193b2d44bcd11383d60ad020472b19f28f3edf3dbcbdcda",
+     "cd79fbbded91823272abb7a97a5530608f0583bd5405c7765156c4d8754ddf43"
+     "5d6d71b84f83c6381078935e378d4bf0f752b309d1398af578e103e443b8ac55",
+     "72b129442392ac882a9751f7399b1ced91b734e5667ecd920541bd730d93a4eb"},
+    {1024,
+     "868a4be429bfe126796f528004b99bb79b3cb149771e8d9f0d962e39d58db1c2"
+     "8d42dcf23eaed7361fe1ae8bc182a7e036352bf571976d2bfd63e92d920bb49a",
+     "98b6de75c42e1e5cdd6623aca47a1a359e9aef84f10d6bf125093331d9f5c63f"
+     "c7a2908b66f51bf068dd213b90f72fb13da8d7d37cc7b020188df451ffd32684",
+     "0a8d634ff9b882461423b7bef996d87180f542066c7e5aa4610f090d6f14d2d4"},
+    {1500,
+     "cbec29e00757448c5d6e66aca74e3053d45a5cbd2dc8f7138e63f34566237dc5"
+     "aef8d92675e4bcd536e5d5eaf50a955d3bc08451ba2788dda09d82b125ed97fb",
+     "4d5e9a80bc7f73ae9efbf73771ffe79b23eafb1a697b54233900df226fa57df7"
+     "3231aeccdfc3d7cac076bc9c246ea984ca9934603fbb9b2942de16bc973889b1",
+     "a7a1bfd7078606568559fd13844e7532e3b007cd1fb7d7591bc97427d3fc957d"},
+};
+
+/* ─── libb2 ─── */
+
+TEST(compat_blake2_layout) {
+  ASSERT_EQ(sizeof(blake2b_param), 64u);
+  ASSERT_EQ(offsetof(blake2b_param, node_offset), 8u);
+  ASSERT_EQ(offsetof(blake2b_param, node_depth), 16u);
+  ASSERT_EQ(offsetof(blake2b_param, salt), 32u);
+  ASSERT_EQ(offsetof(blake2b_param, personal), 48u);
+  ASSERT_EQ(sizeof(blake2b_state), 384u);
+  ASSERT_EQ(alignof(blake2b_state), 64u);
+  ASSERT_EQ(offsetof(blake2b_state, buflen), 352u);
+}
+
+TEST(compat_blake2b_matches_tinyblake) {
+  const uint8_t *key = kat_key();
+  const size_t lens[] = {0, 1, 127, 128, 129, 255, 256, 257, 1000};
+  for (size_t len : lens) {
+    auto msg = test::make_input(len);
+    for (size_t keylen : {size_t{0}, size_t{1}, size_t{64}}) {
+      uint8_t expected[64], out[64];
+      tinyblake_blake2b(expected, 64, msg.data(), len, key, keylen);
+      ASSERT_EQ(blake2b(out, msg.data(), key, 64, len, keylen), 0);
+      ASSERT_BYTES_EQ(out, expected, 64);
+
+      /* Streaming in uneven pieces */
+      blake2b_state S;
+      if (keylen > 0)
+        ASSERT_EQ(blake2b_init_key(&S, 64, key, keylen), 0);
+      else
+        ASSERT_EQ(blake2b_init(&S, 64), 0);
+      size_t off = 0, step = 1;
+      while (off < len) {
+        size_t n = std::min(step, len - off);
+        ASSERT_EQ(blake2b_update(&S, msg.data() + off, n), 0);
+        off += n;
+        step = step * 3 + 1;
+      }
+      ASSERT_EQ(blake2b_final(&S, out, 64), 0);
+      ASSERT_BYTES_EQ(out, expected, 64);
+    }
+  }
+}
+
+TEST(compat_blake2b_param_and_errors) {
+  blake2b_param P;
+  std::memset(&P, 0, sizeof(P));
+  P.digest_length = 32;
+  P.fanout = 1;
+  P.depth = 1;
+  std::memset(P.salt, 0x5a, sizeof(P.salt));
+  std::memset(P.personal, 0xa5, sizeof(P.personal));
+
+  tinyblake_blake2b_state T;
+  tinyblake_blake2b_init_param(&T, reinterpret_cast<const uint8_t *>(&P));
+  tinyblake_blake2b_update(&T, "abc", 3);
+  uint8_t expected[32];
+  tinyblake_blake2b_final(&T, expected, 32);
+
+  blake2b_state S;
+  ASSERT_EQ(blake2b_init_param(&S, &P), 0);
+  ASSERT_EQ(S.outlen, 32);
+  blake2b_update(&S, reinterpret_cast<const uint8_t *>("abc"), 3);
+  uint8_t out[64];
+  ASSERT_EQ(blake2b_final(&S, out, 16), -1); /* buffer too small */
+  ASSERT_EQ(blake2b_final(&S, out, 32), 0);
+  ASSERT_BYTES_EQ(out, expected, 32);
+  ASSERT_EQ(blake2b_final(&S, out, 32), -1); /* already finalized */
+
+  ASSERT_EQ(blake2b_init(&S, 0), -1);
+  ASSERT_EQ(blake2b_init(&S, 65), -1);
+  ASSERT_EQ(blake2b_init_key(&S, 64, nullptr, 16), -1);
+  ASSERT_EQ(blake2b_init_key(&S, 64, KEY, 65), -1);
+  ASSERT_EQ(blake2b(nullptr, "x", nullptr, 64, 1, 0), -1);
+  ASSERT_EQ(blake2b(out, nullptr, nullptr, 64, 1, 0), -1);
+  ASSERT_EQ(blake2b(out, "x", nullptr, 64, 1, 8), -1);
+}
+
+TEST(compat_blake2b_last_node) {
+  blake2b_param P;
+  std::memset(&P, 0, sizeof(P));
+  P.digest_length = 64;
+  P.fanout = 4;
+  P.depth = 2;
+  P.node_depth = 1;
+  P.inner_length = 64;
+
+  auto msg = test::make_input(200);
+  blake2b_state S;
+  blake2b_init_param(&S, &P);
+  S.last_node = 1;
+  blake2b_update(&S, msg.data(), 200);
+  uint8_t out[64];
+  ASSERT_EQ(blake2b_final(&S, out, 64), 0);
+  ASSERT_TRUE(S.f[1] != 0);
+
+  auto expected = test::hex_to_bytes(
+      "225955764a4fe675296113efe7c55b10a23dc41c9fa052bef2e82d7158d9982b"
+      "e852dde7c190f51aedb1c6be7ca2d3c5db655c4fce88fd87eb626d9fcfc2fb2a");
+  ASSERT_BYTES_EQ(out, expected.data(), 64);
+}
+
+TEST(compat_blake2bp_vectors) {
+  const uint8_t *key = kat_key();
+  for (const auto &v : BLAKE2BP_VECTORS) {
+    auto msg = test::make_input(v.len);
+    auto keyed = test::hex_to_bytes(v.keyed);
+    auto unkeyed = test::hex_to_bytes(v.unkeyed);
+    auto short_key = test::hex_to_bytes(v.short_key_32);
+
+    uint8_t out[64];
+    ASSERT_EQ(blake2bp(out, msg.data(), key, 64, v.len, 64), 0);
+    ASSERT_BYTES_EQ(out, keyed.data(), 64);
+    ASSERT_EQ(blake2bp(out, msg.data(), nullptr, 64, v.len, 0), 0);
+    ASSERT_BYTES_EQ(out, unkeyed.data(), 64);
+    ASSERT_EQ(blake2bp(out, msg.data(), key, 32, v.len, 16), 0);
+    ASSERT_BYTES_EQ(out, short_key.data(), 32);
+  }
+}
+
+TEST(compat_blake2bp_streaming) {
+  const uint8_t *key = kat_key();
+  /* Whole stripes go through the multi-lane kernel; the portable engine
+   * has none and takes the single-block path */
+  for (const char *engine : {"auto", "portable"}) {
+    tinyblake_engine_set_thread_default(tinyblake_engine_get(engine));
+    for (const auto &v : BLAKE2BP_VECTORS) {
+      auto msg = test::make_input(v.len);
+      auto keyed = test::hex_to_bytes(v.keyed);
+
+      /* Piece sizes that straddle the 512-byte stripe in every way */
+      for (size_t step :
+           {size_t{1}, size_t{100}, size_t{511}, size_t{513}, v.len}) {
+        blake2bp_state S;
+        ASSERT_EQ(blake2bp_init_key(&S, 64, key, 64), 0);
+        for (size_t off = 0; off < v.len; off += step) {
+          size_t n = std::min(step, v.len - off);
+          ASSERT_EQ(blake2bp_update(&S, msg.data() + off, n), 0);
+        }
+        uint8_t out[64];
+        ASSERT_EQ(blake2bp_final(&S, out, 64), 0);
+        ASSERT_BYTES_EQ(out, keyed.data(), 64);
+      }
+    }
+  }
+  tinyblake_engine_set_thread_default(nullptr);
+
+  blake2bp_state S;
+  ASSERT_EQ(blake2bp_init(&S, 0), -1);
+  ASSERT_EQ(blake2bp_init_key(&S, 64, nullptr, 0), -1);
+  ASSERT_EQ(blake2bp_init_key(&S, 64, key, 65), -1);
+}
+
+/* ─── libsodium ─── */
+
+TEST(compat_generichash_constants) {
+  ASSERT_EQ(crypto_generichash_bytes(), 32u);
+  ASSERT_EQ(crypto_generichash_bytes_min(), 16u);
+  ASSERT_EQ(crypto_generichash_bytes_max(), 64u);
+  ASSERT_EQ(crypto_generichash_keybytes(), 32u);
+  ASSERT_EQ(crypto_generichash_keybytes_min(), 16u);
+  ASSERT_EQ(crypto_generichash_keybytes_max(), 64u);
+  ASSERT_EQ(crypto_generichash_statebytes(), 384u);
+  ASSERT_EQ(alignof(crypto_generichash_state), 64u);
+  ASSERT_EQ(crypto_generichash_blake2b_saltbytes(), 16u);
+  ASSERT_EQ(crypto_generichash_blake2b_personalbytes(), 16u);
+  ASSERT_TRUE(std::strcmp(crypto_generichash_primitive(), "blake2b") == 0);
+}
+
+TEST(compat_generichash_matches_tinyblake) {
+  const uint8_t *key = kat_key();
+  const size_t lens[] = {0, 3, 128, 129, 1000};
+  for (size_t len : lens) {
+    auto msg = test::make_input(len);
+    for (size_t keylen : {size_t{0}, size_t{1}, size_t{32}, size_t{64}}) {
+      uint8_t expected[32], out[32];
+      tinyblake_blake2b(expected, 32, msg.data(), len, key, keylen);
+      ASSERT_EQ(crypto_generichash(out, 32, msg.data(), len, key, keylen), 0);
+      ASSERT_BYTES_EQ(out, expected, 32);
+
+      crypto_generichash_state st;
+      ASSERT_EQ(crypto_generichash_init(&st, key, keylen, 32), 0);
+      ASSERT_EQ(crypto_generichash_update(&st, msg.data(), len / 2), 0);
+      ASSERT_EQ(crypto_generichash_update(&st, msg.data() + len / 2,
+                                          len - len / 2),
+                0);
+      ASSERT_EQ(crypto_generichash_final(&st, out, 32), 0);
+      ASSERT_BYTES_EQ(out, expected, 32);
+      ASSERT_EQ(crypto_generichash_final(&st, out, 32), -1);
+    }
+  }
+}
+
+TEST(compat_generichash_sodium_semantics) {
+  auto msg = test::make_input(1);
+  uint8_t out[64], full[64], half[32];
+
+  /* final() emits the length it is asked for, not the one init() got */
+  crypto_generichash_state st;
+  crypto_generichash_init(&st, nullptr, 0, 32);
+  crypto_generichash_update(&st, msg.data(), 1);
+  ASSERT_EQ(crypto_generichash_final(&st, out, 64), 0);
+  crypto_generichash(half, 32, msg.data(), 1, nullptr, 0);
+  ASSERT_BYTES_EQ(out, half, 1);
+
+  crypto_generichash_init(&st, nullptr, 0, 64);
+  crypto_generichash_update(&st, msg.data(), 1);
+  ASSERT_EQ(crypto_generichash_final(&st, out, 16), 0);
+  crypto_generichash(full, 64, msg.data(), 1, nullptr, 0);
+  ASSERT_BYTES_EQ(out, full, 16);
+
+  /* init() treats a NULL key as unkeyed; the one-shot rejects it */
+  crypto_generichash_init(&st, nullptr, 5, 64);
+  crypto_generichash_update(&st, msg.data(), 1);
+  crypto_generichash_final(&st, out, 64);
+  ASSERT_BYTES_EQ(out, full, 64);
+  ASSERT_EQ(crypto_generichash(out, 32, msg.data(), 1, nullptr, 5), -1);
+
+  ASSERT_EQ(crypto_generichash(out, 0, msg.data(), 1, nullptr, 0), -1);
+  ASSERT_EQ(crypto_generichash(out, 65, msg.data(), 1, nullptr, 0), -1);
+  ASSERT_EQ(crypto_generichash(out, 32, msg.data(), 1, KEY, 65), -1);
+  ASSERT_EQ(crypto_generichash_init(&st, KEY, 65, 32), -1);
+  ASSERT_EQ(crypto_generichash_init(&st, nullptr, 0, 0), -1);
+}
+
+TEST(compat_generichash_salt_personal) {
+  /* Expected digests from Python's hashlib.blake2b(salt=, person=) */
+  auto msg = test::make_input(300);
+  const uint8_t *key = reinterpret_cast<const uint8_t *>("0123456789abcdef");
+  const uint8_t *salt = reinterpret_cast<const uint8_t *>("saltsaltsaltsalt");
+  const uint8_t *pers = reinterpret_cast<const uint8_t *>("personal-string!");
+
+  auto expected = test::hex_to_bytes(
+      "3f80b230d635a79e05e5f642ce8ca3b64aa051ceecbc3dc51e1f5124a9b2b16d");
+  uint8_t out[64];
+  ASSERT_EQ(crypto_generichash_blake2b_salt_personal(
+                out, 32, msg.data(), msg.size(), key, 16, salt, pers),
+            0);
+  ASSERT_BYTES_EQ(out, expected.data(), 32);
+
+  crypto_generichash_blake2b_state st;
+  ASSERT_EQ(crypto_generichash_blake2b_init_salt_personal(&st, key, 16, 32,
+                                                          salt, pers),
+            0);
+  crypto_generichash_blake2b_update(&st, msg.data(), msg.size());
+  crypto_generichash_blake2b_final(&st, out, 32);
+  ASSERT_BYTES_EQ(out, expected.data(), 32);
+
+  /* NULL salt means zeros */
+  auto expected_pers = test::hex_to_bytes(
+      "115684bc79220a3776225c90308017c7647315a27149b3f5ea5e0bb164519756"
+      "0e3e53dafde7833229c7b9432b5f55370a2a2c3a07c88d45209d8f6ffbb37cb0");
+  ASSERT_EQ(crypto_generichash_blake2b_salt_personal(
+                out, 64, msg.data(), msg.size(), nullptr, 0, nullptr, pers),
+            0);
+  ASSERT_BYTES_EQ(out, expected_pers.data(), 64);
+}
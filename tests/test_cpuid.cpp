@@ -47,12 +47,42 @@ TEST(cpuid_feature_consistency) {
     ASSERT_TRUE(f.avx2);
   }
 
+  /* Every AVX2 processor also implements SSE4.1 */
+  if (f.avx2) {
+    ASSERT_TRUE(f.sse41);
+  }
+
+  /* ... and SSE4.1 implies SSSE3 */
+  if (f.sse41) {
+    ASSERT_TRUE(f.ssse3);
+  }
+
+  /* The x86-64 levels are cumulative over the flags tracked here */
+  if (f.x86_level >= 3) {
+    ASSERT_TRUE(f.avx2 && f.sse41);
+  }
+  if (f.x86_level >= 4) {
+    ASSERT_TRUE(f.avx512f && f.avx512vl);
+  }
+#if defined(__x86_64__) || defined(_M_X64)
+  ASSERT_TRUE(f.x86_level >= 1 && f.x86_level <= 4);
+#else
+  ASSERT_EQ(f.x86_level, 0u);
+#endif
+
   /* On x86, NEON should be false */
 #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) ||             \
     defined(_M_IX86)
   ASSERT_TRUE(!f.neon);
+  ASSERT_TRUE(!f.sha3);
+  ASSERT_TRUE(!f.rvv);
 #endif
 
+  /* The SHA3 extension is an AArch64 addition to Advanced SIMD */
+  if (f.sha3) {
+    ASSERT_TRUE(f.neon);
+  }
+
   /* On AArch64, NEON should be true */
 #if defined(__aarch64__) || defined(_M_ARM64)
   ASSERT_TRUE(f.neon);
@@ -0,0 +1,317 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/backend/encoding_impl.h"
+#include "../src/cpu_features.h"
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tinyblake/blake2s.h>
+#include <tinyblake/encoding.h>
+#include <vector>
+
+static const int MODES[] = {0, TINYBLAKE_ENCODE_CONSTANT_TIME};
+
+TEST(encoding_rfc4648_vectors) {
+  static const char *const plain[] = {"", "f", "fo", "foo", "foob", "fooba",
+                                      "foobar"};
+  static const char *const b64[] = {"",     "Zg",      "Zm8",     "Zm9v",
+                                    "Zm9vYg", "Zm9vYmE", "Zm9vYmFy"};
+  static const char *const hex[] = {"",         "66",         "666f",
+                                    "666f6f",   "666f6f62",   "666f6f6261",
+                                    "666f6f626172"};
+  for (int mode : MODES) {
+    for (size_t i = 0; i < 7; ++i) {
+      char out[32];
+      const size_t n = std::strlen(plain[i]);
+      ASSERT_EQ(tinyblake_base64url_encode(out, sizeof(out), plain[i], n, mode),
+                0);
+      ASSERT_EQ(std::string(out), std::string(b64[i]));
+      ASSERT_EQ(tinyblake_hex_encode(out, sizeof(out), plain[i], n, mode), 0);
+      ASSERT_EQ(std::string(out), std::string(hex[i]));
+      ASSERT_EQ(tinyblake_base64url_encoded_len(n), std::strlen(b64[i]));
+
+      uint8_t back[16];
+      size_t m = 0;
+      ASSERT_EQ(tinyblake_base64url_decode(back, sizeof(back), &m, b64[i],
+                                           std::strlen(b64[i]), mode),
+                0);
+      ASSERT_EQ(m, n);
+      ASSERT_TRUE(std::memcmp(back, plain[i], n) == 0);
+    }
+  }
+
+  /* URL alphabet: 0xFB 0xFF -> "-_8" */
+  const uint8_t url[] = {0xFB, 0xFF};
+  ASSERT_EQ(tinyblake::base64url::encode(url, 2), std::string("-_8"));
+}
+
+TEST(encoding_roundtrip_all_lengths) {
+  const auto data = test::make_input(600, 151, 7);
+  for (int mode : MODES) {
+    const bool ct = mode != 0;
+    for (size_t len = 0; len <= 600; len += (len < 200 ? 1 : 37)) {
+      const std::string h = tinyblake::hex::encode(data.data(), len, ct);
+      std::string want_hex(2 * len, '\0');
+      tinyblake::hex_encode_scalar(&want_hex[0], data.data(), len, false);
+      ASSERT_EQ(h, want_hex);
+      auto back = tinyblake::hex::decode(h, ct);
+      ASSERT_EQ(back.size(), len);
+      ASSERT_TRUE(len == 0 || std::memcmp(back.data(), data.data(), len) == 0);
+
+      const std::string b = tinyblake::base64url::encode(data.data(), len, ct);
+      ASSERT_EQ(b.size(), tinyblake_base64url_encoded_len(len));
+      std::string want_b64(b.size(), '\0');
+      tinyblake::base64url_encode_scalar(&want_b64[0], data.data(), len,
+                                         false);
+      ASSERT_EQ(b, want_b64);
+      back = tinyblake::base64url::decode(b, ct);
+      ASSERT_EQ(back.size(), len);
+      ASSERT_TRUE(len == 0 || std::memcmp(back.data(), data.data(), len) == 0);
+    }
+  }
+
+  /* Uppercase hex decodes too */
+  auto upper = tinyblake::hex::decode("DEADbeef");
+  const uint8_t want[] = {0xDE, 0xAD, 0xBE, 0xEF};
+  ASSERT_BYTES_EQ(upper.data(), want, 4);
+}
+
+TEST(encoding_scalar_modes_agree) {
+  /* Every byte value through both scalar codecs */
+  std::vector<uint8_t> all(256);
+  for (size_t i = 0; i < 256; ++i)
+    all[i] = static_cast<uint8_t>(i);
+  std::string fast(512, '\0'), ct(512, '\0');
+  tinyblake::hex_encode_scalar(&fast[0], all.data(), 256, false);
+  tinyblake::hex_encode_scalar(&ct[0], all.data(), 256, true);
+  ASSERT_EQ(fast, ct);
+  std::string bfast(344, '\0'), bct(344, '\0');
+  tinyblake::base64url_encode_scalar(&bfast[0], all.data(), 256, false);
+  tinyblake::base64url_encode_scalar(&bct[0], all.data(), 256, true);
+  ASSERT_EQ(bfast, bct);
+
+  /* Every character through both scalar decoders */
+  for (int c = 0; c < 256; ++c) {
+    const char hex_in[2] = {static_cast<char>(c), '0'};
+    uint8_t out_fast = 0, out_ct = 0, err_fast = 0, err_ct = 0;
+    tinyblake::hex_decode_scalar(&out_fast, hex_in, 2, &err_fast, false);
+    tinyblake::hex_decode_scalar(&out_ct, hex_in, 2, &err_ct, true);
+    ASSERT_EQ(err_fast, err_ct);
+    if (!err_fast)
+      ASSERT_EQ(out_fast, out_ct);
+
+    const char b64_in[4] = {static_cast<char>(c), 'A', 'A', 'A'};
+    uint8_t b_fast[3] = {}, b_ct[3] = {};
+    err_fast = err_ct = 0;
+    tinyblake::base64url_decode_scalar(b_fast, b64_in, 4, &err_fast, false);
+    tinyblake::base64url_decode_scalar(b_ct, b64_in, 4, &err_ct, true);
+    ASSERT_EQ(err_fast, err_ct);
+    if (!err_fast)
+      ASSERT_BYTES_EQ(b_fast, b_ct, 3);
+  }
+}
+
+TEST(encoding_rejects_malformed) {
+  const auto data = test::make_input(200, 151, 7);
+  for (int mode : MODES) {
+    const bool ct = mode != 0;
+    const std::string h = tinyblake::hex::encode(data.data(), 200);
+    const std::string b = tinyblake::base64url::encode(data.data(), 200);
+
+    /* A bad character anywhere, in the SIMD body or the scalar tail */
+    for (size_t pos = 0; pos < h.size(); pos += 7) {
+      for (char bad : {'g', 'G', ' ', '\0', static_cast<char>(0xB0)}) {
+        std::string t = h;
+        t[pos] = bad;
+        bool caught = false;
+        try {
+          tinyblake::hex::decode(t, ct);
+        } catch (const std::invalid_argument &) {
+          caught = true;
+        }
+        ASSERT_TRUE(caught);
+      }
+    }
+    for (size_t pos = 0; pos < b.size(); pos += 5) {
+      for (char bad : {'+', '/', '=', '.', static_cast<char>(0xC1)}) {
+        std::string t = b;
+        t[pos] = bad;
+        uint8_t out[200];
+        size_t n = 0;
+        ASSERT_EQ(tinyblake_base64url_decode(out, sizeof(out), &n, t.data(),
+                                             t.size(), mode),
+                  -1);
+        /* Output is wiped on failure */
+        ASSERT_EQ(out[0], uint8_t(0));
+      }
+    }
+
+    uint8_t out[8];
+    size_t n = 0;
+    ASSERT_EQ(tinyblake_hex_decode(out, 8, &n, "abc", 3, mode), -1);
+    ASSERT_EQ(tinyblake_hex_decode(out, 1, &n, "abcd", 4, mode), -1);
+    ASSERT_EQ(tinyblake_base64url_decode(out, 8, &n, "Zm9vY", 5, mode), -1);
+    ASSERT_EQ(tinyblake_base64url_decode(out, 8, &n, "Zg==", 4, mode), -1);
+    /* Non-canonical trailing bits */
+    ASSERT_EQ(tinyblake_base64url_decode(out, 8, &n, "Zh", 2, mode), -1);
+    ASSERT_EQ(tinyblake_base64url_decode(out, 8, &n, "Zm9", 3, mode), -1);
+    ASSERT_EQ(tinyblake_base64url_decode(out, 8, &n, "Zm8", 3, mode), 0);
+  }
+
+  char small[5];
+  ASSERT_EQ(tinyblake_hex_encode(small, 4, "ab", 2, 0), -1);
+  ASSERT_EQ(tinyblake_hex_encode(small, 5, "ab", 2, 0), 0);
+  ASSERT_EQ(tinyblake_hex_encode(small, 5, "ab", 2, 2), -1);
+  ASSERT_EQ(tinyblake_base64url_encode(small, 4, "abc", 3, 0), -1);
+  ASSERT_EQ(tinyblake_hex_encode(nullptr, 5, "ab", 2, 0), -1);
+}
+
+TEST(encoding_many_matches_single) {
+  /* A BLAKE2s hash_many column of 32-byte digests */
+  std::vector<std::vector<uint8_t>> msgs;
+  for (size_t i = 0; i < 9; ++i)
+    msgs.push_back(test::make_input(i * 10, 151, 7));
+  const std::vector<uint8_t> digests = tinyblake::blake2s::hash_many(msgs, 32);
+
+  for (int mode : MODES) {
+    const bool ct = mode != 0;
+    auto hexes = tinyblake::hex::encode_many(digests.data(), 32, 9, ct);
+    auto b64s = tinyblake::base64url::encode_many(digests.data(), 32, 9, ct);
+    ASSERT_EQ(hexes.size(), size_t(9));
+    ASSERT_EQ(b64s.size(), size_t(9));
+    for (size_t i = 0; i < 9; ++i) {
+      ASSERT_EQ(hexes[i], tinyblake::hex::encode(digests.data() + i * 32, 32));
+      ASSERT_EQ(b64s[i],
+                tinyblake::base64url::encode(digests.data() + i * 32, 32));
+    }
+
+    std::vector<char> buf(9 * 65);
+    ASSERT_EQ(tinyblake_hex_encode_many(buf.data(), buf.size() - 1,
+                                        digests.data(), 32, 9, mode),
+              -1);
+    ASSERT_EQ(tinyblake_hex_encode_many(buf.data(), buf.size(),
+                                        digests.data(), 32, 9, mode),
+              0);
+    ASSERT_EQ(std::string(buf.data() + 65), hexes[1]);
+  }
+}
+
+TEST(encoding_simd_kernels_match_scalar) {
+  struct kernels {
+    const char *name;
+    bool supported;
+    tinyblake::hex_encode_fn hex_encode;
+    tinyblake::hex_decode_fn hex_decode;
+    tinyblake::base64url_encode_fn b64_encode;
+    tinyblake::base64url_decode_fn b64_decode;
+  };
+  std::vector<kernels> list;
+  const auto &feat = tinyblake::cpu::detect();
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  list.push_back({"ssse3", feat.ssse3, tinyblake::hex_encode_ssse3,
+                  tinyblake::hex_decode_ssse3,
+                  tinyblake::base64url_encode_ssse3,
+                  tinyblake::base64url_decode_ssse3});
+  list.push_back({"avx2", feat.avx2, tinyblake::hex_encode_avx2,
+                  tinyblake::hex_decode_avx2, tinyblake::base64url_encode_avx2,
+                  tinyblake::base64url_decode_avx2});
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  list.push_back({"neon", feat.neon, tinyblake::hex_encode_neon,
+                  tinyblake::hex_decode_neon, tinyblake::base64url_encode_neon,
+                  tinyblake::base64url_decode_neon});
+#else
+  (void)feat;
+#endif
+
+  const auto data = test::make_input(500, 151, 7);
+  for (const auto &k : list) {
+    if (!k.supported)
+      continue;
+    for (size_t len = 0; len <= 500; len += 3) {
+      /* Hex: the kernel's prefix must equal the scalar encoding */
+      std::string want(2 * len, '\0'), got(2 * len, '\0');
+      tinyblake::hex_encode_scalar(&want[0], data.data(), len, false);
+      const size_t done = k.hex_encode(&got[0], data.data(), len);
+      ASSERT_TRUE(done <= len);
+      ASSERT_TRUE(got.compare(0, 2 * done, want, 0, 2 * done) == 0);
+
+      std::vector<uint8_t> dec(len + 1, 0);
+      uint8_t err = 0;
+      const size_t used = k.hex_decode(dec.data(), want.data(), 2 * len, &err);
+      ASSERT_EQ(err, uint8_t(0));
+      ASSERT_TRUE(used <= 2 * len && used % 2 == 0);
+      ASSERT_TRUE(std::memcmp(dec.data(), data.data(), used / 2) == 0);
+
+      /* Base64url: whole groups only, prefix equal to scalar */
+      const size_t blen = tinyblake_base64url_encoded_len(len);
+      std::string bwant(blen, '\0'), bgot(blen + 64, '\0');
+      tinyblake::base64url_encode_scalar(&bwant[0], data.data(), len, false);
+      const size_t bdone = k.b64_encode(&bgot[0], data.data(), len);
+      ASSERT_EQ(bdone % 3, size_t(0));
+      ASSERT_TRUE(bgot.compare(0, bdone / 3 * 4, bwant, 0, bdone / 3 * 4) ==
+                  0);
+
+      err = 0;
+      const size_t bused =
+          k.b64_decode(dec.data(), bwant.data(), bwant.size(), &err);
+      ASSERT_EQ(err, uint8_t(0));
+      ASSERT_EQ(bused % 4, size_t(0));
+      ASSERT_TRUE(std::memcmp(dec.data(), data.data(), bused / 4 * 3) == 0);
+
+      /* Long inputs actually go through the kernel */
+      if (len >= 64)
+        ASSERT_TRUE(done > 0 && used > 0 && bdone > 0 && bused > 0);
+    }
+
+    /* Every character value inside a kernel block */
+    for (int c = 0; c < 256; ++c) {
+      std::string h(64, 'a');
+      h[17] = static_cast<char>(c);
+      uint8_t out[64];
+      uint8_t err = 0;
+      const size_t used = k.hex_decode(out, h.data(), h.size(), &err);
+      const bool valid = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+                         (c >= 'A' && c <= 'F');
+      if (used > 17)
+        ASSERT_EQ(err != 0, !valid);
+
+      std::string b(64, 'A');
+      b[17] = static_cast<char>(c);
+      err = 0;
+      const size_t bused = k.b64_decode(out, b.data(), b.size(), &err);
+      const bool bvalid = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+                          (c >= 'A' && c <= 'Z') || c == '-' || c == '_';
+      if (bused > 17)
+        ASSERT_EQ(err != 0, !bvalid);
+    }
+  }
+}
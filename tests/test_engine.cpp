@@ -0,0 +1,249 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/internal/blake2b_dispatch.h"
+#include "test_harness.h"
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <tinyblake/balloon.h>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/chain.h>
+#include <tinyblake/hmac.h>
+#include <tinyblake/pow.h>
+#include <vector>
+
+static const char *const BACKENDS[] = {"portable", "x64",  "avx2",
+                                       "avx512",   "neon", "neon_sha3",
+                                       "rvv"};
+
+TEST(engine_lookup) {
+  ASSERT_TRUE(tinyblake_engine_get(nullptr) == nullptr);
+  ASSERT_TRUE(tinyblake_engine_get("sse9") == nullptr);
+  ASSERT_TRUE(tinyblake_engine_name(nullptr) == nullptr);
+
+  const tinyblake_engine *portable = tinyblake_engine_get("portable");
+  ASSERT_TRUE(portable != nullptr);
+  ASSERT_EQ(std::strcmp(tinyblake_engine_name(portable), "portable"), 0);
+  ASSERT_TRUE(tinyblake_engine_get("portable") == portable);
+
+  /* "auto" is one of the named engines */
+  const tinyblake_engine *best = tinyblake_engine_get("auto");
+  ASSERT_TRUE(best != nullptr);
+  ASSERT_TRUE(tinyblake_engine_get(tinyblake_engine_name(best)) == best);
+
+  bool caught = false;
+  try {
+    tinyblake::blake2b::engine bad("sse9");
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  ASSERT_TRUE(caught);
+}
+
+TEST(engine_explicit_matches_default) {
+  const size_t lens[] = {0, 1, 127, 128, 129, 512, 513, 3000};
+  const auto msg = test::make_input(3000, 13, 5);
+  const uint8_t key[32] = {1, 2, 3};
+
+  for (const char *name : BACKENDS) {
+    const tinyblake_engine *e = tinyblake_engine_get(name);
+    if (!e)
+      continue;
+    for (size_t len : lens) {
+      uint8_t want[64], got[64];
+      tinyblake_blake2b(want, 64, msg.data(), len, key, sizeof(key));
+      ASSERT_EQ(tinyblake_blake2b_ex(e, got, 64, msg.data(), len, key,
+                                     sizeof(key)),
+                0);
+      ASSERT_BYTES_EQ(got, want, 64);
+
+      tinyblake_blake2b_state S;
+      tinyblake_blake2b_init(&S, 64);
+      size_t off = 0;
+      while (off < len) {
+        const size_t n = (len - off) < 200 ? (len - off) : 200;
+        ASSERT_EQ(tinyblake_blake2b_update_ex(e, &S, msg.data() + off, n), 0);
+        off += n;
+      }
+      ASSERT_EQ(tinyblake_blake2b_final_ex(e, &S, got, 64), 0);
+      tinyblake_blake2b(want, 64, msg.data(), len, nullptr, 0);
+      ASSERT_BYTES_EQ(got, want, 64);
+
+      const tinyblake::blake2b::engine cxx(name);
+      auto one_shot = tinyblake::blake2b::hash(cxx, msg.data(), len);
+      ASSERT_BYTES_EQ(one_shot.data(), want, 64);
+
+      tinyblake::blake2b::hasher h;
+      h.set_engine(cxx);
+      h.update(msg.data(), len);
+      auto streamed = h.final_();
+      ASSERT_BYTES_EQ(streamed.data(), want, 64);
+    }
+  }
+}
+
+TEST(engine_thread_default_routes_kernels) {
+  const tinyblake_engine *portable = tinyblake_engine_get("portable");
+  ASSERT_TRUE(tinyblake_engine_thread_default() == nullptr);
+
+  const auto msg = test::make_input(1000, 13, 5);
+  uint8_t want_hash[64], want_mac[64], want_iter[32];
+  tinyblake_blake2b(want_hash, 64, msg.data(), msg.size(), nullptr, 0);
+  tinyblake_hmac(want_mac, 64, "key", 3, msg.data(), msg.size());
+  tinyblake_blake2b_iterate(want_iter, 32, msg.data(), msg.size(), 100);
+
+  {
+    tinyblake::blake2b::engine e("portable");
+    tinyblake::blake2b::engine::thread_scope scope(e);
+    ASSERT_TRUE(tinyblake_engine_thread_default() == portable);
+    ASSERT_TRUE(tinyblake::detail::blake2b_get_compress() ==
+                tinyblake::blake2b_compress_portable);
+    ASSERT_TRUE(tinyblake::detail::blake2b_select_compress(1 << 20) ==
+                tinyblake::blake2b_compress_portable);
+    ASSERT_EQ(tinyblake::detail::blake2b_get_lanes().lanes, size_t(1));
+
+    uint8_t got[64];
+    tinyblake_blake2b(got, 64, msg.data(), msg.size(), nullptr, 0);
+    ASSERT_BYTES_EQ(got, want_hash, 64);
+    tinyblake_hmac(got, 64, "key", 3, msg.data(), msg.size());
+    ASSERT_BYTES_EQ(got, want_mac, 64);
+    tinyblake_blake2b_iterate(got, 32, msg.data(), msg.size(), 100);
+    ASSERT_BYTES_EQ(got, want_iter, 32);
+
+    /* Other threads keep the process-wide dispatch */
+    const tinyblake_engine *seen = portable;
+    std::thread([&seen] { seen = tinyblake_engine_thread_default(); }).join();
+    ASSERT_TRUE(seen == nullptr);
+  }
+  ASSERT_TRUE(tinyblake_engine_thread_default() == nullptr);
+
+  /* Two threads on different engines side by side */
+  const tinyblake_engine *best = tinyblake_engine_get("auto");
+  uint8_t out[2][64];
+  const tinyblake_engine *engines[2] = {portable, best};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 2; ++i) {
+    threads.emplace_back([&, i] {
+      tinyblake_engine_set_thread_default(engines[i]);
+      for (int rep = 0; rep < 50; ++rep)
+        tinyblake_blake2b(out[i], 64, msg.data(), msg.size(), nullptr, 0);
+      tinyblake_engine_set_thread_default(nullptr);
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+  ASSERT_BYTES_EQ(out[0], want_hash, 64);
+  ASSERT_BYTES_EQ(out[1], want_hash, 64);
+}
+
+/* An engine of portable kernels that counts every call, two lanes wide so
+ * the multi-lane paths run too */
+static std::atomic<uint64_t> g_counted_calls{0};
+
+static void counting_compress(uint64_t state[8], const uint8_t block[128],
+                              uint64_t t0, uint64_t t1, bool last) {
+  g_counted_calls.fetch_add(1, std::memory_order_relaxed);
+  tinyblake::blake2b_compress_portable(state, block, t0, t1, last);
+}
+
+static void counting_iterate(uint64_t digest[8], size_t outlen, uint64_t n) {
+  g_counted_calls.fetch_add(1, std::memory_order_relaxed);
+  tinyblake::blake2b_iterate_portable(digest, outlen, n);
+}
+
+static void counting_lanes(uint64_t *const state[],
+                           const uint8_t *const block[], const uint64_t t0[],
+                           const uint64_t t1[], const uint64_t f0[]) {
+  g_counted_calls.fetch_add(1, std::memory_order_relaxed);
+  for (size_t l = 0; l < 2; ++l)
+    tinyblake::blake2b_compress_portable(state[l], block[l], t0[l], t1[l],
+                                         f0[l] != 0);
+}
+
+static void counting_iterate_lanes(uint64_t *const digest[], size_t outlen,
+                                   uint64_t n) {
+  g_counted_calls.fetch_add(1, std::memory_order_relaxed);
+  for (size_t l = 0; l < 2; ++l)
+    tinyblake::blake2b_iterate_portable(digest[l], outlen, n);
+}
+
+static const tinyblake_engine COUNTING_ENGINE = {
+    "counting",
+    counting_compress,
+    counting_compress,
+    counting_iterate,
+    {counting_lanes, counting_iterate_lanes, 2, nullptr}};
+
+TEST(engine_thread_default_reaches_pool_workers) {
+  /* Proof-of-work search and Balloon-M hand their work to the shared pool.
+   * With the engine set on this thread, a run spread over every worker must
+   * make exactly the kernel calls of a run kept on this thread alone, and
+   * produce the default dispatch's results. */
+  const auto header = test::make_input(80, 13, 5);
+  const uint8_t never[32] = {}; /* no digest is <= all zeros */
+  uint8_t easy[32];
+  ASSERT_EQ(tinyblake_pow_target_bits(easy, 32, 6), 0);
+  uint64_t want_nonce = 0;
+  uint8_t want_pow[32], want_balloon[64];
+  ASSERT_EQ(tinyblake_pow_search(header.data(), header.size(), 32, easy, 0,
+                                 1 << 20, 0, &want_nonce, want_pow),
+            0);
+  ASSERT_EQ(tinyblake_balloon_m(want_balloon, "pw", 2, "salt", 4, 256, 2, 4,
+                                0),
+            0);
+
+  tinyblake_engine_set_thread_default(&COUNTING_ENGINE);
+  uint64_t calls[2];
+  for (int i = 0; i < 2; ++i) {
+    const size_t threads = i == 0 ? 1 : 0;
+    uint64_t nonce = 0;
+    g_counted_calls.store(0);
+    ASSERT_EQ(tinyblake_pow_search(header.data(), header.size(), 32, never, 0,
+                                   40000, threads, &nonce, nullptr),
+              1);
+    uint8_t out[64];
+    ASSERT_EQ(tinyblake_balloon_m(out, "pw", 2, "salt", 4, 256, 2, 4, threads),
+              0);
+    ASSERT_BYTES_EQ(out, want_balloon, 64);
+    calls[i] = g_counted_calls.load();
+  }
+
+  uint64_t nonce = 0;
+  uint8_t got_pow[32];
+  ASSERT_EQ(tinyblake_pow_search(header.data(), header.size(), 32, easy, 0,
+                                 1 << 20, 0, &nonce, got_pow),
+            0);
+  tinyblake_engine_set_thread_default(nullptr);
+
+  ASSERT_TRUE(calls[0] > 0);
+  ASSERT_EQ(calls[1], calls[0]);
+  ASSERT_EQ(nonce, want_nonce);
+  ASSERT_BYTES_EQ(got_pow, want_pow, 32);
+}
@@ -93,6 +93,15 @@ inline std::vector<uint8_t> hex_to_bytes(const char *hex) {
   return out;
 }
 
+/* Deterministic test input: byte i is (i * mul + add) % mod */
+inline std::vector<uint8_t> make_input(size_t len, size_t mul = 1,
+                                       size_t add = 0, size_t mod = 256) {
+  std::vector<uint8_t> out(len);
+  for (size_t i = 0; i < len; ++i)
+    out[i] = static_cast<uint8_t>((i * mul + add) % mod);
+  return out;
+}
+
 /* Bytes to hex string */
 inline std::string bytes_to_hex(const uint8_t *data, size_t len) {
   static const char hx[] = "0123456789abcdef";
@@ -0,0 +1,90 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/hmac_blake2s.h>
+
+/* Expected values from Python's hmac module over hashlib.blake2s */
+
+TEST(hmac_blake2s_basic) {
+  const char *msg = "The quick brown fox jumps over the lazy dog";
+  auto got = tinyblake::hmac_blake2s::mac("key", 3, msg, std::strlen(msg));
+  auto expected = test::hex_to_bytes(
+      "f93215bb90d4af4c3061cd932fb169fb8bb8a91d0b4022baea1271e1323cd9a0");
+  ASSERT_EQ(got, expected);
+}
+
+TEST(hmac_blake2s_long_key) {
+  uint8_t key[100];
+  for (int i = 0; i < 100; ++i)
+    key[i] = static_cast<uint8_t>(i);
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_hmac_blake2s(out, 32, key, sizeof(key), "msg", 3), 0);
+  auto expected = test::hex_to_bytes(
+      "d262c404e86fa6bc5be7b1aabcdc6737627e135c5b98de4a3b85ebc08ac01d54");
+  ASSERT_BYTES_EQ(out, expected.data(), 32);
+}
+
+TEST(hmac_blake2s_incremental_and_reset) {
+  std::vector<uint8_t> data(300);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<uint8_t>(i * 3);
+  auto expected = tinyblake::hmac_blake2s::mac("secret", 6, data.data(),
+                                               data.size());
+
+  tinyblake::hmac_blake2s::hasher h("secret", 6);
+  for (size_t off = 0; off < data.size(); off += 61)
+    h.update(data.data() + off,
+             (data.size() - off) < 61 ? data.size() - off : 61);
+  ASSERT_EQ(h.final_(), expected);
+
+  h.reset();
+  h.update(data);
+  tinyblake::hmac_blake2s::hasher moved(std::move(h));
+  ASSERT_EQ(moved.final_(), expected);
+}
+
+TEST(hmac_blake2s_error_paths) {
+  tinyblake_hmac_blake2s_state S;
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_hmac_blake2s_init(nullptr, "k", 1), -1);
+  ASSERT_EQ(tinyblake_hmac_blake2s_init(&S, nullptr, 1), -1);
+  ASSERT_EQ(tinyblake_hmac_blake2s_init(&S, "k", 0), -1);
+  ASSERT_EQ(tinyblake_hmac_blake2s_init(&S, "k", 1), 0);
+  ASSERT_EQ(tinyblake_hmac_blake2s_final(&S, out, 31), -1);
+
+  bool threw = false;
+  try {
+    tinyblake::hmac_blake2s::hasher h(nullptr, 0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
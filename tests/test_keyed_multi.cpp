@@ -0,0 +1,218 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/hmac.h>
+#include <tinyblake/keyed_multi.h>
+#include <vector>
+
+/* Key i of a batch: its own fill so no two keys in a batch are equal */
+static std::vector<uint8_t> make_key(size_t i, size_t len) {
+  return test::make_input(len, 5, i * 31 + 1);
+}
+
+/* Key counts straddle every lane width (1, 2, 4, 8 and a partial group) */
+static const size_t KEY_COUNTS[] = {1, 2, 3, 4, 5, 8, 9, 17};
+static const size_t MSG_LENS[] = {0, 1, 64, 127, 128, 129, 255, 256, 1000};
+
+TEST(keyed_multi_matches_keyed_blake2b) {
+  for (size_t nkeys : KEY_COUNTS) {
+    std::vector<tinyblake_blake2b_key_ctx> ctxs(nkeys);
+    std::vector<std::vector<uint8_t>> keys;
+    for (size_t i = 0; i < nkeys; ++i) {
+      keys.push_back(make_key(i, 1 + (i * 7) % 64));
+      ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctxs[i], 32, keys[i].data(),
+                                               keys[i].size()),
+                0);
+    }
+    for (size_t len : MSG_LENS) {
+      const auto msg = test::make_input(len, 13, 7);
+      std::vector<uint8_t> outs(nkeys * 32);
+      ASSERT_EQ(tinyblake_blake2b_keyed_multi(msg.data(), len, ctxs.data(),
+                                              nkeys, outs.data()),
+                0);
+      for (size_t i = 0; i < nkeys; ++i) {
+        uint8_t want[32];
+        tinyblake_blake2b(want, 32, msg.data(), len, keys[i].data(),
+                          keys[i].size());
+        ASSERT_BYTES_EQ(outs.data() + i * 32, want, 32);
+      }
+    }
+  }
+}
+
+TEST(keyed_multi_mixed_outlen) {
+  const auto msg = test::make_input(300, 13, 7);
+  const auto k0 = make_key(0, 16), k1 = make_key(1, 64);
+  tinyblake_blake2b_key_ctx ctxs[2];
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctxs[0], 20, k0.data(), 16), 0);
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctxs[1], 64, k1.data(), 64), 0);
+  uint8_t outs[84], want0[20], want1[64];
+  ASSERT_EQ(tinyblake_blake2b_keyed_multi(msg.data(), msg.size(), ctxs, 2,
+                                          outs),
+            0);
+  tinyblake_blake2b(want0, 20, msg.data(), msg.size(), k0.data(), 16);
+  tinyblake_blake2b(want1, 64, msg.data(), msg.size(), k1.data(), 64);
+  ASSERT_BYTES_EQ(outs, want0, 20);
+  ASSERT_BYTES_EQ(outs + 20, want1, 64);
+}
+
+TEST(hmac_multi_matches_hmac) {
+  for (size_t nkeys : KEY_COUNTS) {
+    std::vector<tinyblake_hmac_key_ctx> ctxs(nkeys);
+    std::vector<std::vector<uint8_t>> keys;
+    for (size_t i = 0; i < nkeys; ++i) {
+      /* Includes keys longer than the block size (hashed down) */
+      keys.push_back(make_key(i, 1 + (i * 41) % 200));
+      ASSERT_EQ(tinyblake_hmac_key_ctx_init(&ctxs[i], keys[i].data(),
+                                            keys[i].size()),
+                0);
+    }
+    for (size_t len : MSG_LENS) {
+      const auto msg = test::make_input(len, 13, 7);
+      std::vector<uint8_t> outs(nkeys * 64);
+      ASSERT_EQ(tinyblake_hmac_multi(msg.data(), len, ctxs.data(), nkeys,
+                                     outs.data()),
+                0);
+      for (size_t i = 0; i < nkeys; ++i) {
+        uint8_t want[64];
+        tinyblake_hmac(want, 64, keys[i].data(), keys[i].size(), msg.data(),
+                       len);
+        ASSERT_BYTES_EQ(outs.data() + i * 64, want, 64);
+      }
+    }
+  }
+}
+
+TEST(keyed_multi_verify_finds_key) {
+  const size_t nkeys = 4;
+  tinyblake_blake2b_key_ctx ctxs[nkeys];
+  tinyblake_hmac_key_ctx hctxs[nkeys];
+  std::vector<std::vector<uint8_t>> keys;
+  for (size_t i = 0; i < nkeys; ++i) {
+    keys.push_back(make_key(i, 32));
+    tinyblake_blake2b_key_ctx_init(&ctxs[i], 32, keys[i].data(), 32);
+    tinyblake_hmac_key_ctx_init(&hctxs[i], keys[i].data(), 32);
+  }
+  const auto msg = test::make_input(500, 13, 7);
+
+  for (size_t signer = 0; signer < nkeys; ++signer) {
+    uint8_t tag[32], mac[64];
+    tinyblake_blake2b(tag, 32, msg.data(), msg.size(), keys[signer].data(),
+                      32);
+    tinyblake_hmac(mac, 64, keys[signer].data(), 32, msg.data(), msg.size());
+
+    size_t matched = 99;
+    ASSERT_EQ(tinyblake_blake2b_keyed_multi_verify(msg.data(), msg.size(),
+                                                   ctxs, nkeys, tag, 32,
+                                                   &matched),
+              0);
+    ASSERT_EQ(matched, signer);
+
+    /* Truncated HMAC tag */
+    matched = 99;
+    ASSERT_EQ(tinyblake_hmac_multi_verify(msg.data(), msg.size(), hctxs,
+                                          nkeys, mac, 16, &matched),
+              0);
+    ASSERT_EQ(matched, signer);
+
+    tag[5] ^= 1;
+    mac[5] ^= 1;
+    ASSERT_EQ(tinyblake_blake2b_keyed_multi_verify(
+                  msg.data(), msg.size(), ctxs, nkeys, tag, 32, nullptr),
+              -1);
+    ASSERT_EQ(tinyblake_hmac_multi_verify(msg.data(), msg.size(), hctxs,
+                                          nkeys, mac, 64, nullptr),
+              -1);
+  }
+}
+
+TEST(keyed_multi_error_paths) {
+  const auto key = make_key(0, 16);
+  tinyblake_blake2b_key_ctx ctx;
+  tinyblake_hmac_key_ctx hctx;
+  uint8_t out[64], tag[32] = {};
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(nullptr, 32, key.data(), 16), -1);
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctx, 0, key.data(), 16), -1);
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctx, 32, nullptr, 16), -1);
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctx, 32, key.data(), 65), -1);
+  ASSERT_EQ(tinyblake_hmac_key_ctx_init(&hctx, key.data(), 0), -1);
+
+  ASSERT_EQ(tinyblake_blake2b_key_ctx_init(&ctx, 32, key.data(), 16), 0);
+  ASSERT_EQ(tinyblake_hmac_key_ctx_init(&hctx, key.data(), 16), 0);
+  ASSERT_EQ(tinyblake_blake2b_keyed_multi("x", 1, &ctx, 0, out), -1);
+  ASSERT_EQ(tinyblake_blake2b_keyed_multi(nullptr, 1, &ctx, 1, out), -1);
+  ASSERT_EQ(tinyblake_blake2b_keyed_multi("x", 1, &ctx, 1, nullptr), -1);
+  ASSERT_EQ(tinyblake_hmac_multi("x", 1, nullptr, 1, out), -1);
+  /* taglen must match the context's digest length */
+  ASSERT_EQ(tinyblake_blake2b_keyed_multi_verify("x", 1, &ctx, 1, tag, 16,
+                                                 nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_hmac_multi_verify("x", 1, &hctx, 1, tag, 0, nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_hmac_multi_verify("x", 1, &hctx, 1, tag, 65, nullptr),
+            -1);
+}
+
+TEST(keyed_multi_cpp_api) {
+  const auto msg = test::make_input(200, 13, 7);
+  std::vector<tinyblake::blake2b::key_ctx> keys;
+  std::vector<tinyblake::hmac::key_ctx> hkeys;
+  for (size_t i = 0; i < 3; ++i) {
+    const auto k = make_key(i, 24);
+    keys.push_back(tinyblake::blake2b::make_key_ctx(k.data(), k.size(), 32));
+    hkeys.push_back(tinyblake::hmac::make_key_ctx(k.data(), k.size()));
+  }
+
+  const auto digests =
+      tinyblake::blake2b::keyed_multi(msg.data(), msg.size(), keys);
+  ASSERT_EQ(digests.size(), size_t(96));
+  auto hit = tinyblake::blake2b::keyed_multi_verify(
+      msg.data(), msg.size(), keys, digests.data() + 64, 32);
+  ASSERT_TRUE(hit.has_value() && *hit == 2);
+
+  const auto macs = tinyblake::hmac::mac_multi(msg.data(), msg.size(), hkeys);
+  ASSERT_EQ(macs.size(), size_t(192));
+  const auto k1 = make_key(1, 24);
+  const auto want = tinyblake::hmac::mac(k1.data(), k1.size(), msg.data(),
+                                         msg.size());
+  ASSERT_BYTES_EQ(macs.data() + 64, want.data(), 64);
+  hit = tinyblake::hmac::verify_multi(msg.data(), msg.size(), hkeys,
+                                      want.data(), 64);
+  ASSERT_TRUE(hit.has_value() && *hit == 1);
+
+  bool caught = false;
+  try {
+    tinyblake::blake2b::make_key_ctx(nullptr, 0);
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  ASSERT_TRUE(caught);
+}
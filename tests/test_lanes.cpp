@@ -0,0 +1,253 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/cpu_features.h"
+#include "../src/internal/blake2b_dispatch.h"
+#include "test_harness.h"
+#include <tinyblake/blake2b.h>
+
+#include <cstring>
+
+/*
+ * Multi-lane driver vs. the single-message API, across lengths that land on
+ * and around block boundaries, with and without a prefix (key) block.
+ */
+
+static void serialize(const uint64_t h[8], uint8_t out[64]) {
+  for (int w = 0; w < 8; ++w) {
+    for (int b = 0; b < 8; ++b) {
+      out[w * 8 + b] = static_cast<uint8_t>(h[w] >> (8 * b));
+    }
+  }
+}
+
+TEST(lanes_match_single_unkeyed) {
+  static const size_t lens[] = {0,   1,   64,  127, 128, 129, 255, 256,
+                                257, 300, 511, 512, 513, 1000, 3, 128};
+  constexpr size_t n = sizeof(lens) / sizeof(lens[0]);
+
+  std::vector<std::vector<uint8_t>> msgs(n);
+  std::vector<const uint8_t *> in(n);
+  for (size_t i = 0; i < n; ++i) {
+    msgs[i].resize(lens[i]);
+    for (size_t j = 0; j < lens[i]; ++j)
+      msgs[i][j] = static_cast<uint8_t>(i * 31 + j);
+    in[i] = msgs[i].data();
+  }
+
+  uint8_t param[64] = {};
+  param[0] = 64;
+  param[2] = 1;
+  param[3] = 1;
+  uint64_t h[n][8];
+  for (size_t i = 0; i < n; ++i)
+    tinyblake::detail::blake2b_param_to_h(h[i], param);
+
+  tinyblake::detail::blake2b_lanes_hash(h, nullptr, in.data(), lens, n);
+
+  for (size_t i = 0; i < n; ++i) {
+    uint8_t got[64], expected[64];
+    serialize(h[i], got);
+    tinyblake_blake2b(expected, 64, msgs[i].data(), lens[i], nullptr, 0);
+    ASSERT_BYTES_EQ(got, expected, 64);
+  }
+}
+
+TEST(lanes_match_single_keyed_prefix) {
+  static const size_t lens[] = {0, 1, 128, 129, 200, 256, 17, 999, 5};
+  constexpr size_t n = sizeof(lens) / sizeof(lens[0]);
+  uint8_t key[32];
+  for (size_t i = 0; i < 32; ++i)
+    key[i] = static_cast<uint8_t>(0xA0 + i);
+
+  uint8_t prefix[128] = {};
+  std::memcpy(prefix, key, 32);
+
+  std::vector<std::vector<uint8_t>> msgs(n);
+  std::vector<const uint8_t *> in(n);
+  for (size_t i = 0; i < n; ++i) {
+    msgs[i].assign(lens[i], static_cast<uint8_t>(i));
+    in[i] = msgs[i].data();
+  }
+
+  uint8_t param[64] = {};
+  param[0] = 48;
+  param[1] = 32;
+  param[2] = 1;
+  param[3] = 1;
+  uint64_t h[n][8];
+  for (size_t i = 0; i < n; ++i)
+    tinyblake::detail::blake2b_param_to_h(h[i], param);
+
+  tinyblake::detail::blake2b_lanes_hash(h, prefix, in.data(), lens, n);
+
+  for (size_t i = 0; i < n; ++i) {
+    uint8_t got[64], expected[48];
+    serialize(h[i], got);
+    tinyblake_blake2b(expected, 48, msgs[i].data(), lens[i], key, 32);
+    ASSERT_BYTES_EQ(got, expected, 48);
+  }
+}
+
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) ||         \
+     defined(_M_ARM64) || defined(__ARM_NEON) || defined(__riscv)) &&          \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+/* Exercise every multi-lane backend the CPU supports, not just the one the
+ * dispatcher picks, against the portable single-block kernel. */
+static bool check_lanes_kernel(tinyblake::blake2b_compress_lanes_fn fn,
+                               size_t lanes) {
+  uint64_t ref[8][8], got[8][8];
+  uint8_t blocks[8][128];
+  uint64_t t0[8], t1[8], f0[8];
+  uint64_t *state[8];
+  const uint8_t *block[8];
+
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t w = 0; w < 8; ++w)
+      ref[l][w] = got[l][w] = 0x0123456789ABCDEFULL * (l + 1) + w;
+    for (size_t b = 0; b < 128; ++b)
+      blocks[l][b] = static_cast<uint8_t>(l * 7 + b);
+    t0[l] = 128 * (l + 1);
+    t1[l] = l;
+    f0[l] = (l & 1) ? ~uint64_t{0} : 0;
+    state[l] = got[l];
+    block[l] = blocks[l];
+    tinyblake::blake2b_compress_portable(ref[l], blocks[l], t0[l], t1[l],
+                                         f0[l] != 0);
+  }
+
+  fn(state, block, t0, t1, f0);
+  return std::memcmp(ref, got, lanes * sizeof(ref[0])) == 0;
+}
+#endif
+
+TEST(lanes_backends_match_portable) {
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  const auto &feat = tinyblake::cpu::detect();
+  if (feat.avx2) {
+    ASSERT_TRUE(check_lanes_kernel(tinyblake::blake2b_compress_4way_avx2, 4));
+  }
+  if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2) {
+    ASSERT_TRUE(
+        check_lanes_kernel(tinyblake::blake2b_compress_8way_avx512, 8));
+  }
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)) &&    \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (tinyblake::cpu::detect().neon) {
+    ASSERT_TRUE(check_lanes_kernel(tinyblake::blake2b_compress_2way_neon, 2));
+  }
+#elif defined(__riscv) && !defined(TINYBLAKE_FORCE_PORTABLE)
+  if (tinyblake::cpu::detect().rvv) {
+    ASSERT_TRUE(check_lanes_kernel(tinyblake::blake2b_compress_lanes_rvv,
+                                   tinyblake::blake2b_rvv_lanes()));
+  }
+#endif
+  ASSERT_TRUE(tinyblake::detail::blake2b_get_lanes().lanes >= 1);
+}
+
+#if (defined(__x86_64__) || defined(_M_X64)) &&                                \
+    !defined(TINYBLAKE_FORCE_PORTABLE)
+/* Shared-message kernels: every lane absorbs the same block */
+static bool check_bcast_kernel(tinyblake::blake2b_compress_bcast_fn fn,
+                               size_t lanes, bool last) {
+  uint64_t ref[8][8], got[8][8];
+  uint8_t block[128];
+  uint64_t *state[8];
+  for (size_t b = 0; b < 128; ++b)
+    block[b] = static_cast<uint8_t>(b * 3 + 1);
+  for (size_t l = 0; l < lanes; ++l) {
+    for (size_t w = 0; w < 8; ++w)
+      ref[l][w] = got[l][w] = 0x0F0E0D0C0B0A0908ULL * (l + 3) + w;
+    state[l] = got[l];
+    tinyblake::blake2b_compress_portable(ref[l], block, 384, 2, last);
+  }
+  fn(state, block, 384, 2, last);
+  return std::memcmp(ref, got, lanes * sizeof(ref[0])) == 0;
+}
+
+TEST(lanes_bcast_backends_match_portable) {
+  const auto &feat = tinyblake::cpu::detect();
+  for (int last = 0; last <= 1; ++last) {
+    if (feat.avx2) {
+      ASSERT_TRUE(check_bcast_kernel(
+          tinyblake::blake2b_compress_4way_bcast_avx2, 4, last != 0));
+    }
+    if (feat.avx512f && feat.avx512vl && feat.avx512vbmi2) {
+      ASSERT_TRUE(check_bcast_kernel(
+          tinyblake::blake2b_compress_8way_bcast_avx512, 8, last != 0));
+    }
+  }
+}
+#endif
+
+TEST(lanes_public_hash_many) {
+  /* Every batch size up to two full 8-lane groups plus a straggler, with
+   * lengths that mix empty, sub-block and multi-block messages */
+  const uint8_t key[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+  for (size_t n = 1; n <= 17; ++n) {
+    std::vector<std::vector<uint8_t>> msgs(n);
+    std::vector<const void *> ptrs(n);
+    std::vector<size_t> lens(n);
+    for (size_t i = 0; i < n; ++i) {
+      msgs[i].resize((i * 97 + n * 13) % 600);
+      for (size_t b = 0; b < msgs[i].size(); ++b)
+        msgs[i][b] = static_cast<uint8_t>(b * 7 + i);
+      ptrs[i] = msgs[i].data();
+      lens[i] = msgs[i].size();
+    }
+
+    for (size_t keylen : {size_t{0}, sizeof(key)}) {
+      const size_t outlen = keylen ? 40 : 64;
+      std::vector<uint8_t> out(n * outlen);
+      ASSERT_EQ(tinyblake_blake2b_hash_many(out.data(), outlen, ptrs.data(),
+                                            lens.data(), n, key, keylen),
+                0);
+      for (size_t i = 0; i < n; ++i) {
+        uint8_t expected[64];
+        tinyblake_blake2b(expected, outlen, msgs[i].data(), msgs[i].size(),
+                          key, keylen);
+        ASSERT_BYTES_EQ(out.data() + i * outlen, expected, outlen);
+      }
+    }
+
+    auto cpp = tinyblake::blake2b::hash_many(msgs, 32);
+    for (size_t i = 0; i < n; ++i) {
+      auto expected = tinyblake::blake2b::hash(msgs[i], 32);
+      ASSERT_BYTES_EQ(cpp.data() + i * 32, expected.data(), 32);
+    }
+  }
+
+  uint8_t out[64];
+  const void *null_msg[] = {nullptr};
+  const size_t one[] = {1};
+  ASSERT_EQ(tinyblake_blake2b_hash_many(out, 64, null_msg, one, 1, nullptr, 0),
+            -1);
+  ASSERT_EQ(tinyblake_blake2b_hash_many(out, 65, null_msg, one, 0, nullptr, 0),
+            0);
+}
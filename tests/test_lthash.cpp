@@ -0,0 +1,160 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <stdexcept>
+#include <tinyblake/lthash.h>
+
+/* Reference checksum for {"", "a", "abc", 00 01 .. (300 bytes)}, from an
+ * independent implementation: BLAKE2b-256 of the 2048-byte checksum and the
+ * first 16 checksum bytes. */
+static const char *lthash_ref_digest_hex =
+    "d622f0f332b777422c09476baabdca5b575a919a5d848c373e09347533e7c226";
+static const char *lthash_ref_prefix_hex = "31a06ed66f327fe258d3d5800d0f17d8";
+
+TEST(lthash_reference_vector) {
+  auto big = test::make_input(300);
+  tinyblake::lthash::lthash16 h;
+  h.add("", 0);
+  h.add("a", 1);
+  h.add("abc", 3);
+  h.add(big);
+
+  auto digest = h.digest(32);
+  auto expected = test::hex_to_bytes(lthash_ref_digest_hex);
+  ASSERT_BYTES_EQ(digest.data(), expected.data(), 32);
+
+  auto prefix = test::hex_to_bytes(lthash_ref_prefix_hex);
+  ASSERT_BYTES_EQ(h.data(), prefix.data(), 16);
+}
+
+TEST(lthash_order_independent) {
+  tinyblake::lthash::lthash16 a, b;
+  a.add(std::string("row-1"));
+  a.add(std::string("row-2"));
+  a.add(std::string("row-3"));
+  b.add(std::string("row-3"));
+  b.add(std::string("row-1"));
+  b.add(std::string("row-2"));
+  ASSERT_TRUE(a == b);
+}
+
+TEST(lthash_remove_cancels_add) {
+  tinyblake::lthash::lthash16 empty, h;
+  h.add(std::string("alpha"));
+  h.add(std::string("beta"));
+  ASSERT_TRUE(h != empty);
+  h.remove(std::string("alpha"));
+  h.remove(std::string("beta"));
+  ASSERT_TRUE(h == empty);
+}
+
+TEST(lthash_update_row) {
+  /* Replacing a row = remove old version + add new version */
+  tinyblake::lthash::lthash16 table, expected;
+  table.add(std::string("id=1,v=a"));
+  table.add(std::string("id=2,v=b"));
+  table.remove(std::string("id=2,v=b"));
+  table.add(std::string("id=2,v=c"));
+
+  expected.add(std::string("id=1,v=a"));
+  expected.add(std::string("id=2,v=c"));
+  ASSERT_TRUE(table == expected);
+}
+
+TEST(lthash_add_many_matches_sequential) {
+  /* Mixed lengths exercise idle lanes in the batched root hashing */
+  std::vector<std::vector<uint8_t>> elems;
+  for (size_t i = 0; i < 37; ++i) {
+    elems.push_back(test::make_input((i * 53) % 400));
+    if (!elems.back().empty())
+      elems.back()[0] = static_cast<uint8_t>(i);
+  }
+  std::vector<const void *> ptrs;
+  std::vector<size_t> lens;
+  for (const auto &e : elems) {
+    ptrs.push_back(e.data());
+    lens.push_back(e.size());
+  }
+
+  tinyblake::lthash::lthash16 seq, batch;
+  for (const auto &e : elems)
+    seq.add(e);
+  batch.add_many(ptrs.data(), lens.data(), ptrs.size());
+  ASSERT_TRUE(seq == batch);
+
+  batch.remove_many(ptrs.data(), lens.data(), ptrs.size());
+  ASSERT_TRUE(batch == tinyblake::lthash::lthash16());
+}
+
+TEST(lthash_combine_subtract) {
+  tinyblake::lthash::lthash16 a, b, both;
+  a.add(std::string("x"));
+  b.add(std::string("y"));
+  both.add(std::string("x"));
+  both.add(std::string("y"));
+
+  tinyblake::lthash::lthash16 u;
+  u += a;
+  u += b;
+  ASSERT_TRUE(u == both);
+  u -= a;
+  ASSERT_TRUE(u == b);
+}
+
+TEST(lthash_multiset_semantics) {
+  /* Duplicates count: {x, x} != {x} */
+  tinyblake::lthash::lthash16 once, twice;
+  once.add(std::string("x"));
+  twice.add(std::string("x"));
+  twice.add(std::string("x"));
+  ASSERT_TRUE(once != twice);
+}
+
+TEST(lthash_error_cases) {
+  tinyblake_lthash16 h;
+  uint8_t out[64];
+  ASSERT_EQ(tinyblake_lthash16_init(nullptr), -1);
+  ASSERT_EQ(tinyblake_lthash16_init(&h), 0);
+  ASSERT_EQ(tinyblake_lthash16_add(nullptr, "a", 1), -1);
+  ASSERT_EQ(tinyblake_lthash16_add(&h, nullptr, 1), -1);
+  ASSERT_EQ(tinyblake_lthash16_add(&h, nullptr, 0), 0);
+  ASSERT_EQ(tinyblake_lthash16_add_many(&h, nullptr, nullptr, 1), -1);
+  ASSERT_EQ(tinyblake_lthash16_digest(&h, out, 0), -1);
+  ASSERT_EQ(tinyblake_lthash16_digest(&h, out, 65), -1);
+  ASSERT_EQ(tinyblake_lthash16_combine(&h, nullptr), -1);
+
+  bool threw = false;
+  try {
+    tinyblake::lthash::lthash16 c;
+    c.digest(0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "../src/cpu_features.h"
+#include "test_harness.h"
+#include <cstring>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/hmac.h>
+#include <tinyblake/pbkdf2.h>
+#include <vector>
+
+#if defined(TINYBLAKE_MULTIVERSION)
+
+/* Every build: the dispatched one-shot, streaming and PBKDF2 entry points
+ * must agree with each other on the level picked for this CPU */
+TEST(multiversion_public_entry_points_agree) {
+  std::vector<uint8_t> msg(1031);
+  for (size_t i = 0; i < msg.size(); ++i)
+    msg[i] = static_cast<uint8_t>(i * 13 + 5);
+  const uint8_t key[40] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  for (size_t len : {0, 1, 127, 128, 129, 1031}) {
+    uint8_t want[64], got[64];
+    ASSERT_EQ(tinyblake_blake2b(want, 64, msg.data(), len, key, 40), 0);
+    tinyblake_blake2b_state S;
+    ASSERT_EQ(tinyblake_blake2b_init_key(&S, 64, key, 40), 0);
+    ASSERT_EQ(tinyblake_blake2b_update(&S, msg.data(), len / 2), 0);
+    ASSERT_EQ(
+        tinyblake_blake2b_update(&S, msg.data() + len / 2, len - len / 2), 0);
+    ASSERT_EQ(tinyblake_blake2b_final(&S, got, 64), 0);
+    ASSERT_BYTES_EQ(got, want, 64);
+
+    ASSERT_EQ(tinyblake_hmac(want, 64, key, 40, msg.data(), len), 0);
+    tinyblake_hmac_state H;
+    ASSERT_EQ(tinyblake_hmac_init(&H, key, 40), 0);
+    ASSERT_EQ(tinyblake_hmac_update(&H, msg.data(), len), 0);
+    ASSERT_EQ(tinyblake_hmac_final(&H, got, 64), 0);
+    ASSERT_BYTES_EQ(got, want, 64);
+  }
+
+  /* One iteration, one block: T1 = HMAC(P, S || INT(1)) */
+  uint8_t want[64], got[64];
+  const uint8_t salt_block[8] = {'s', 'a', 'l', 't', 0, 0, 0, 1};
+  ASSERT_EQ(tinyblake_hmac(want, 64, "password", 8, salt_block, 8), 0);
+  ASSERT_EQ(tinyblake_pbkdf2(got, 64, "password", 8, "salt", 4, 1), 0);
+  ASSERT_BYTES_EQ(got, want, 64);
+}
+
+/* The per-level copies are internal and not exported from a shared
+ * library, so only static builds can call them directly */
+#if !defined(TINYBLAKE_SHARED)
+
+/* Declared here to cross-check every level the CPU supports */
+#define DECLARE_LEVEL(N)                                                       \
+  int tinyblake_blake2b_x86_64_v##N(void *, size_t, const void *, size_t,      \
+                                    const void *, size_t);                     \
+  int tinyblake_hmac_x86_64_v##N(void *, size_t, const void *, size_t,         \
+                                 const void *, size_t);                        \
+  int tinyblake_pbkdf2_x86_64_v##N(void *, size_t, const void *, size_t,       \
+                                   const void *, size_t, uint32_t);
+
+extern "C" {
+DECLARE_LEVEL(1)
+DECLARE_LEVEL(2)
+DECLARE_LEVEL(3)
+DECLARE_LEVEL(4)
+}
+
+#undef DECLARE_LEVEL
+
+struct level_fns {
+  int (*blake2b)(void *, size_t, const void *, size_t, const void *, size_t);
+  int (*hmac)(void *, size_t, const void *, size_t, const void *, size_t);
+  int (*pbkdf2)(void *, size_t, const void *, size_t, const void *, size_t,
+                uint32_t);
+};
+
+static const level_fns LEVELS[4] = {
+    {tinyblake_blake2b_x86_64_v1, tinyblake_hmac_x86_64_v1,
+     tinyblake_pbkdf2_x86_64_v1},
+    {tinyblake_blake2b_x86_64_v2, tinyblake_hmac_x86_64_v2,
+     tinyblake_pbkdf2_x86_64_v2},
+    {tinyblake_blake2b_x86_64_v3, tinyblake_hmac_x86_64_v3,
+     tinyblake_pbkdf2_x86_64_v3},
+    {tinyblake_blake2b_x86_64_v4, tinyblake_hmac_x86_64_v4,
+     tinyblake_pbkdf2_x86_64_v4},
+};
+
+TEST(multiversion_levels_match_public_api) {
+  const unsigned level = tinyblake::cpu::detect().x86_level;
+  ASSERT_TRUE(level >= 1 && level <= 4);
+
+  std::vector<uint8_t> msg(1031);
+  for (size_t i = 0; i < msg.size(); ++i)
+    msg[i] = static_cast<uint8_t>(i * 13 + 5);
+  const uint8_t key[40] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  /* Only levels this CPU can execute */
+  for (unsigned l = 1; l <= level; ++l) {
+    const level_fns &fns = LEVELS[l - 1];
+    for (size_t len : {0, 1, 127, 128, 129, 1031}) {
+      uint8_t want[64], got[64];
+      ASSERT_EQ(tinyblake_blake2b(want, 64, msg.data(), len, nullptr, 0), 0);
+      ASSERT_EQ(fns.blake2b(got, 64, msg.data(), len, nullptr, 0), 0);
+      ASSERT_BYTES_EQ(got, want, 64);
+
+      ASSERT_EQ(tinyblake_blake2b(want, 32, msg.data(), len, key, 40), 0);
+      ASSERT_EQ(fns.blake2b(got, 32, msg.data(), len, key, 40), 0);
+      ASSERT_BYTES_EQ(got, want, 32);
+
+      ASSERT_EQ(tinyblake_hmac(want, 64, key, 40, msg.data(), len), 0);
+      ASSERT_EQ(fns.hmac(got, 64, key, 40, msg.data(), len), 0);
+      ASSERT_BYTES_EQ(got, want, 64);
+    }
+
+    uint8_t want[100], got[100];
+    ASSERT_EQ(tinyblake_pbkdf2(want, 100, "password", 8, "salt", 4, 3), 0);
+    ASSERT_EQ(fns.pbkdf2(got, 100, "password", 8, "salt", 4, 3), 0);
+    ASSERT_BYTES_EQ(got, want, 100);
+
+    /* Argument checks are part of the copied glue too */
+    ASSERT_EQ(fns.blake2b(got, 0, msg.data(), 1, nullptr, 0), -1);
+    ASSERT_EQ(fns.pbkdf2(got, 16, "p", 1, "s", 1, 0), -1);
+  }
+}
+
+#endif /* !TINYBLAKE_SHARED */
+
+#endif /* TINYBLAKE_MULTIVERSION */
@@ -164,4 +164,39 @@ TEST(params_keyed_reset) {
   /* Fresh keyed hash of msg2 */
   auto d2 = tinyblake::blake2b::keyed_hash(key, 4, "msg2", 4, 64);
   ASSERT_BYTES_EQ(d1.data(), d2.data(), 64);
-}
\ No newline at end of file
+}
+
+TEST(params_last_node) {
+  /* Root of a fanout-4 depth-2 tree, finalized as the last node (sets f1);
+   * expected digest from Python's hashlib.blake2b(last_node=True) */
+  uint8_t param[64] = {};
+  param[0] = 64;  /* digest_length */
+  param[2] = 4;   /* fanout */
+  param[3] = 2;   /* depth */
+  param[16] = 1;  /* node_depth */
+  param[17] = 64; /* inner_length */
+
+  uint8_t msg[200];
+  for (size_t i = 0; i < sizeof(msg); ++i)
+    msg[i] = static_cast<uint8_t>(i);
+
+  tinyblake_blake2b_state S;
+  ASSERT_EQ(tinyblake_blake2b_init_param(&S, param), 0);
+  ASSERT_EQ(S.last_node, 0);
+  S.last_node = 1;
+  tinyblake_blake2b_update(&S, msg, sizeof(msg));
+  uint8_t out[64];
+  ASSERT_EQ(tinyblake_blake2b_final(&S, out, 64), 0);
+
+  auto expected = test::hex_to_bytes(
+      "225955764a4fe675296113efe7c55b10a23dc41c9fa052bef2e82d7158d9982b"
+      "e852dde7c190f51aedb1c6be7ca2d3c5db655c4fce88fd87eb626d9fcfc2fb2a");
+  ASSERT_BYTES_EQ(out, expected.data(), 64);
+
+  /* Without the flag the same node hashes differently */
+  tinyblake_blake2b_init_param(&S, param);
+  tinyblake_blake2b_update(&S, msg, sizeof(msg));
+  uint8_t plain[64];
+  tinyblake_blake2b_final(&S, plain, 64);
+  ASSERT_TRUE(std::memcmp(out, plain, 64) != 0);
+}
@@ -0,0 +1,198 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/pow.h>
+
+/* Reference search: hash header || LE64(nonce) through the one-shot API */
+static std::vector<uint8_t> manual_digest(const std::vector<uint8_t> &header,
+                                          uint64_t nonce, size_t outlen) {
+  std::vector<uint8_t> msg(header);
+  for (int i = 0; i < 8; ++i)
+    msg.push_back(static_cast<uint8_t>(nonce >> (8 * i)));
+  std::vector<uint8_t> d(outlen);
+  tinyblake_blake2b(d.data(), outlen, msg.data(), msg.size(), nullptr, 0);
+  return d;
+}
+
+static uint64_t manual_search(const std::vector<uint8_t> &header,
+                              const uint8_t *target, size_t outlen,
+                              uint64_t start) {
+  for (uint64_t n = start;; ++n) {
+    auto d = manual_digest(header, n, outlen);
+    if (std::memcmp(d.data(), target, outlen) <= 0)
+      return n;
+  }
+}
+
+TEST(pow_target_bits) {
+  uint8_t t[4];
+  ASSERT_EQ(tinyblake_pow_target_bits(t, 4, 0), 0);
+  const uint8_t all[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+  ASSERT_BYTES_EQ(t, all, 4);
+
+  ASSERT_EQ(tinyblake_pow_target_bits(t, 4, 12), 0);
+  const uint8_t twelve[4] = {0x00, 0x0F, 0xFF, 0xFF};
+  ASSERT_BYTES_EQ(t, twelve, 4);
+
+  ASSERT_EQ(tinyblake_pow_target_bits(t, 4, 32), 0);
+  const uint8_t zero[4] = {0, 0, 0, 0};
+  ASSERT_BYTES_EQ(t, zero, 4);
+
+  ASSERT_EQ(tinyblake_pow_target_bits(t, 4, 33), -1);
+  ASSERT_EQ(tinyblake_pow_target_bits(t, 0, 0), -1);
+  ASSERT_EQ(tinyblake_pow_target_bits(t, 65, 0), -1);
+}
+
+/* Every split of header || nonce across the final block boundary */
+TEST(pow_matches_sequential_scan) {
+  static const size_t lens[] = {0, 1, 50, 119, 120, 121, 127, 128, 129, 200,
+                                255, 256, 300};
+  static const size_t outlens[] = {64, 32, 20};
+  for (size_t len : lens) {
+    for (size_t outlen : outlens) {
+      auto header = test::make_input(len, 7, 3);
+      uint8_t target[64];
+      tinyblake_pow_target_bits(target, outlen, 9);
+
+      const uint64_t expected = manual_search(header, target, outlen, 5);
+      uint64_t nonce = 0;
+      uint8_t digest[64];
+      ASSERT_EQ(tinyblake_pow_search(header.data(), len, outlen, target, 5,
+                                     UINT64_MAX, 0, &nonce, digest),
+                0);
+      ASSERT_EQ(nonce, expected);
+      auto d = manual_digest(header, expected, outlen);
+      ASSERT_BYTES_EQ(digest, d.data(), outlen);
+      ASSERT_EQ(tinyblake_pow_verify(header.data(), len, nonce, outlen,
+                                     target),
+                1);
+    }
+  }
+}
+
+TEST(pow_smallest_nonce_any_thread_count) {
+  auto header = test::make_input(80, 7, 3);
+  auto one = tinyblake::pow::search(header.data(), header.size(), 14, 0,
+                                    UINT64_MAX, 64, 1);
+  auto all = tinyblake::pow::search(header.data(), header.size(), 14);
+  ASSERT_TRUE(one.found);
+  ASSERT_TRUE(all.found);
+  ASSERT_EQ(one.nonce, all.nonce);
+  ASSERT_EQ(one.digest, all.digest);
+  ASSERT_EQ(one.digest.size(), size_t{64});
+  ASSERT_EQ(one.digest[0], 0);
+  ASSERT_EQ(one.digest[1] & 0xFC, 0);
+
+  uint8_t target[64];
+  tinyblake_pow_target_bits(target, 64, 14);
+  ASSERT_EQ(one.nonce, manual_search(header, target, 64, 0));
+
+  ASSERT_TRUE(tinyblake::pow::verify(header.data(), header.size(), one.nonce,
+                                     14));
+  if (one.nonce > 0) {
+    /* Resuming past the solution finds a later one */
+    auto next = tinyblake::pow::search(header.data(), header.size(), 14,
+                                       one.nonce + 1);
+    ASSERT_TRUE(next.found);
+    ASSERT_TRUE(next.nonce > one.nonce);
+  }
+}
+
+TEST(pow_exhausted_range) {
+  auto header = test::make_input(40, 7, 3);
+  uint8_t target[64];
+  tinyblake_pow_target_bits(target, 64, 12);
+  const uint64_t first = manual_search(header, target, 64, 0);
+
+  /* The range stops one short of the first solution */
+  uint64_t nonce = 0;
+  ASSERT_EQ(tinyblake_pow_search(header.data(), header.size(), 64, target, 0,
+                                 first, 0, &nonce, nullptr),
+            1);
+  ASSERT_EQ(tinyblake_pow_search(header.data(), header.size(), 64, target, 0,
+                                 first + 1, 0, &nonce, nullptr),
+            0);
+  ASSERT_EQ(nonce, first);
+
+  auto sol = tinyblake::pow::search(header.data(), header.size(), 64, 0, 1000);
+  ASSERT_TRUE(!sol.found);
+  ASSERT_TRUE(sol.digest.empty());
+
+  /* Range clamped at the top of the nonce space; difficulty 0 always hits */
+  tinyblake_pow_target_bits(target, 64, 0);
+  ASSERT_EQ(tinyblake_pow_search(header.data(), header.size(), 64, target,
+                                 UINT64_MAX - 10, UINT64_MAX, 0, &nonce,
+                                 nullptr),
+            0);
+  ASSERT_EQ(nonce, UINT64_MAX - 10);
+}
+
+TEST(pow_invalid_args) {
+  uint8_t target[64] = {};
+  uint64_t nonce = 0;
+  ASSERT_EQ(tinyblake_pow_search("h", 1, 64, target, 0, 1, 0, nullptr,
+                                 nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_pow_search("h", 1, 64, nullptr, 0, 1, 0, &nonce,
+                                 nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_pow_search(nullptr, 1, 64, target, 0, 1, 0, &nonce,
+                                 nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_pow_search("h", 1, 0, target, 0, 1, 0, &nonce,
+                                 nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_pow_search("h", 1, 65, target, 0, 1, 0, &nonce,
+                                 nullptr),
+            -1);
+  ASSERT_EQ(tinyblake_pow_search("h", 1, 64, target, 0, 0, 0, &nonce,
+                                 nullptr),
+            1);
+  ASSERT_EQ(tinyblake_pow_verify(nullptr, 1, 0, 64, target), -1);
+  ASSERT_EQ(tinyblake_pow_verify("h", 1, 0, 64, nullptr), -1);
+
+  bool threw = false;
+  try {
+    tinyblake::pow::search("h", 1, 513);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+
+  threw = false;
+  try {
+    tinyblake::pow::verify("h", 1, 0, 8, 0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
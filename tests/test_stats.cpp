@@ -0,0 +1,279 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <tinyblake/blake2b.h>
+#include <tinyblake/blake2b_tuple.h>
+#include <tinyblake/blake2s.h>
+#include <tinyblake/hmac.h>
+#include <tinyblake/hmac_blake2s.h>
+#include <tinyblake/keyed_multi.h>
+#include <tinyblake/lthash.h>
+#include <tinyblake/pbkdf2.h>
+#include <tinyblake/stats.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Latency histograms. The bucket layout and names are checked in every
+ * build; recording is checked only when the library has ENABLE_STATS, and
+ * the disabled API's error returns otherwise.
+ */
+
+static uint64_t sampled(int op) {
+  tinyblake_stats_summary s;
+  if (tinyblake_stats_snapshot(op, &s) != 0)
+    return UINT64_MAX;
+  return s.count;
+}
+
+TEST(stats_bucket_layout) {
+  uint64_t lo, hi, prev_hi = 0;
+  ASSERT_EQ(tinyblake_stats_bucket_range(0, &lo, &hi), 0);
+  ASSERT_EQ(lo, 0u);
+  ASSERT_EQ(hi, 0u);
+  for (size_t i = 1; i < TINYBLAKE_STATS_BUCKETS; ++i) {
+    ASSERT_EQ(tinyblake_stats_bucket_range(i, &lo, &hi), 0);
+    ASSERT_EQ(lo, prev_hi + 1);
+    ASSERT_TRUE(hi >= lo);
+    /* at most 1/32 relative width past the exact range */
+    ASSERT_TRUE(hi - lo <= lo / 32);
+    prev_hi = hi;
+  }
+  ASSERT_EQ(prev_hi, (uint64_t{1} << 40) - 1);
+
+  ASSERT_EQ(tinyblake_stats_bucket_range(64, &lo, &hi), 0);
+  ASSERT_EQ(lo, 64u);
+  ASSERT_EQ(hi, 65u);
+  ASSERT_EQ(tinyblake_stats_bucket_range(TINYBLAKE_STATS_BUCKETS, &lo, &hi),
+            -1);
+  ASSERT_EQ(tinyblake_stats_bucket_range(0, nullptr, &hi), -1);
+}
+
+TEST(stats_op_names) {
+  ASSERT_TRUE(std::string(tinyblake_stats_op_name(TINYBLAKE_STATS_BLAKE2B)) ==
+              "blake2b");
+  ASSERT_TRUE(std::string(tinyblake_stats_op_name(TINYBLAKE_STATS_PBKDF2)) ==
+              "pbkdf2");
+  for (int op = 0; op < TINYBLAKE_STATS_OPS; ++op)
+    ASSERT_TRUE(tinyblake_stats_op_name(op) != nullptr);
+  ASSERT_TRUE(tinyblake_stats_op_name(-1) == nullptr);
+  ASSERT_TRUE(tinyblake_stats_op_name(TINYBLAKE_STATS_OPS) == nullptr);
+}
+
+TEST(stats_disabled_build) {
+  if (tinyblake::stats::enabled())
+    return;
+  tinyblake_stats_summary s;
+  uint64_t counts[TINYBLAKE_STATS_BUCKETS];
+  ASSERT_EQ(tinyblake_stats_set_sample_rate(1), -1);
+  ASSERT_EQ(tinyblake_stats_sample_rate(), 0u);
+  ASSERT_EQ(tinyblake_stats_reset(), -1);
+  ASSERT_EQ(tinyblake_stats_snapshot(TINYBLAKE_STATS_BLAKE2B, &s), -1);
+  ASSERT_EQ(tinyblake_stats_histogram(TINYBLAKE_STATS_BLAKE2B, counts), -1);
+
+  bool caught = false;
+  try {
+    tinyblake::stats::snapshot(TINYBLAKE_STATS_BLAKE2B);
+  } catch (const std::runtime_error &) {
+    caught = true;
+  }
+  ASSERT_TRUE(caught);
+}
+
+TEST(stats_records_sampled_calls) {
+  if (!tinyblake::stats::enabled())
+    return;
+  uint8_t msg[256] = {1, 2, 3};
+  uint8_t out[64];
+
+  ASSERT_EQ(tinyblake_stats_set_sample_rate(1), 0);
+  ASSERT_EQ(tinyblake_stats_sample_rate(), 1u);
+  ASSERT_EQ(tinyblake_stats_reset(), 0);
+  for (int i = 0; i < 100; ++i)
+    tinyblake_blake2b(out, 64, msg, sizeof(msg), nullptr, 0);
+
+  tinyblake_stats_summary s = tinyblake::stats::snapshot(
+      TINYBLAKE_STATS_BLAKE2B);
+  ASSERT_EQ(s.count, 100u);
+  ASSERT_TRUE(s.min_ns <= s.p50_ns);
+  ASSERT_TRUE(s.p50_ns <= s.p90_ns);
+  ASSERT_TRUE(s.p90_ns <= s.p99_ns);
+  ASSERT_TRUE(s.p99_ns <= s.p999_ns);
+  ASSERT_TRUE(s.p999_ns <= s.max_ns);
+  ASSERT_TRUE(s.mean_ns >= s.min_ns && s.mean_ns <= s.max_ns);
+  ASSERT_EQ(s.p999_ns, s.max_ns);
+
+  std::vector<uint64_t> counts =
+      tinyblake::stats::histogram(TINYBLAKE_STATS_BLAKE2B);
+  uint64_t total = 0;
+  for (uint64_t c : counts)
+    total += c;
+  ASSERT_EQ(total, 100u);
+
+  /* 1 in 4 */
+  tinyblake::stats::set_sample_rate(4);
+  tinyblake::stats::reset();
+  for (int i = 0; i < 100; ++i)
+    tinyblake_blake2b(out, 32, msg, 64, nullptr, 0);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 25u);
+
+  /* Off */
+  tinyblake::stats::set_sample_rate(0);
+  tinyblake::stats::reset();
+  for (int i = 0; i < 100; ++i)
+    tinyblake_blake2b(out, 32, msg, 64, nullptr, 0);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 0u);
+}
+
+TEST(stats_instrumented_entry_points) {
+  if (!tinyblake::stats::enabled())
+    return;
+  uint8_t msg[64] = {9};
+  uint8_t key[200] = {7};
+  uint8_t out[8 * 64];
+
+  tinyblake::stats::set_sample_rate(1);
+  tinyblake::stats::reset();
+
+  /* A >128-byte HMAC key is hashed with tinyblake_blake2b() internally;
+   * only the outer call is recorded */
+  tinyblake_hmac(out, 64, key, sizeof(key), msg, sizeof(msg));
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_HMAC), 1u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 0u);
+
+  tinyblake_pbkdf2(out, 64, key, 16, msg, 16, 10);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_PBKDF2), 1u);
+
+  const void *in[3] = {msg, msg, msg};
+  const size_t inlen[3] = {1, 2, 64};
+  tinyblake_blake2b_hash_many(out, 64, in, inlen, 3, nullptr, 0);
+  tinyblake_blake2s_hash_many(out, 32, in, inlen, 3, nullptr, 0);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B_HASH_MANY), 1u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2S_HASH_MANY), 1u);
+
+  tinyblake_hmac_key_ctx ctx;
+  tinyblake_hmac_key_ctx_init(&ctx, key, 32);
+  uint8_t tag[64];
+  tinyblake_hmac(tag, 64, key, 32, msg, sizeof(msg));
+  size_t matched = 99;
+  ASSERT_EQ(tinyblake_hmac_multi_verify(msg, sizeof(msg), &ctx, 1, tag, 64,
+                                        &matched),
+            0);
+  ASSERT_EQ(matched, 0u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_HMAC_VERIFY), 1u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_HMAC), 2u);
+
+  tinyblake_hmac_multi(msg, sizeof(msg), &ctx, 1, out);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_HMAC_MULTI), 1u);
+
+  tinyblake_hmac_blake2s(out, 32, key, 32, msg, sizeof(msg));
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_HMAC_BLAKE2S), 1u);
+
+  tinyblake_blake2b_key_ctx bctx;
+  tinyblake_blake2b_key_ctx_init(&bctx, 32, key, 32);
+  tinyblake_blake2b_keyed_multi(msg, sizeof(msg), &bctx, 1, out);
+  tinyblake_blake2b_keyed_multi_verify(msg, sizeof(msg), &bctx, 1, out, 32,
+                                       nullptr);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_KEYED_MULTI), 1u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_KEYED_MULTI_VERIFY), 1u);
+
+  const tinyblake_blake2b_tuple_field fields[2] = {
+      {msg, 8, TINYBLAKE_TUPLE_BYTES}, {msg, 8, TINYBLAKE_TUPLE_U64}};
+  tinyblake_blake2b_tuple_hash_many(out, 32, fields, 1, 2, nullptr, 0);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_TUPLE_HASH_MANY), 1u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 0u);
+
+  tinyblake::stats::set_sample_rate(0);
+}
+
+TEST(stats_internal_calls_do_not_tick) {
+  if (!tinyblake::stats::enabled())
+    return;
+  uint8_t msg[64] = {9};
+  uint8_t key[200] = {7};
+  uint8_t out[64];
+
+  /* With one call in three sampled, an HMAC whose long key goes through
+   * tinyblake_blake2b() must advance the period once and never record
+   * the inner call, sampled outer call or not */
+  tinyblake::stats::set_sample_rate(3);
+  tinyblake::stats::reset();
+  for (int i = 0; i < 30; ++i)
+    tinyblake_hmac(out, 64, key, sizeof(key), msg, sizeof(msg));
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_HMAC), 10u);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 0u);
+
+  /* Uninstrumented entry points hash through tinyblake_blake2b() too */
+  static tinyblake_lthash16 lt;
+  tinyblake_lthash16_init(&lt);
+  for (int i = 0; i < 30; ++i)
+    tinyblake_lthash16_digest(&lt, out, 32);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 0u);
+
+  tinyblake::stats::set_sample_rate(0);
+}
+
+TEST(stats_merges_threads) {
+  if (!tinyblake::stats::enabled())
+    return;
+  tinyblake::stats::set_sample_rate(1);
+  tinyblake::stats::reset();
+
+  /* Two threads exit before the snapshot, the calling thread stays live */
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 2; ++t) {
+    threads.emplace_back([] {
+      uint8_t out[32];
+      for (int i = 0; i < 50; ++i)
+        tinyblake_blake2b(out, 32, "abc", 3, nullptr, 0);
+    });
+  }
+  for (std::thread &t : threads)
+    t.join();
+  uint8_t out[32];
+  for (int i = 0; i < 20; ++i)
+    tinyblake_blake2b(out, 32, "abc", 3, nullptr, 0);
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 120u);
+
+  /* Reset clears exited threads' totals too */
+  tinyblake::stats::reset();
+  ASSERT_EQ(sampled(TINYBLAKE_STATS_BLAKE2B), 0u);
+  tinyblake::stats::set_sample_rate(0);
+
+  bool caught = false;
+  try {
+    tinyblake::stats::snapshot(TINYBLAKE_STATS_OPS);
+  } catch (const std::invalid_argument &) {
+    caught = true;
+  }
+  ASSERT_TRUE(caught);
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "../src/internal/thread_pool.h"
+#include "test_harness.h"
+
+#include <atomic>
+#include <vector>
+
+TEST(thread_pool_runs_every_index_once) {
+  tinyblake::detail::thread_pool pool(4);
+  ASSERT_EQ(pool.size(), size_t(4));
+
+  for (size_t count : {1, 2, 7, 100, 1000}) {
+    std::vector<std::atomic<int>> hits(count);
+    for (auto &h : hits)
+      h.store(0);
+    pool.parallel_for(count, [&](size_t i) { hits[i].fetch_add(1); });
+    for (size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(hits[i].load(), 1);
+    }
+  }
+}
+
+TEST(thread_pool_thread_cap) {
+  tinyblake::detail::thread_pool pool(4);
+  std::atomic<size_t> sum{0};
+  pool.parallel_for(
+      64, [&](size_t i) { sum.fetch_add(i); }, 2);
+  ASSERT_EQ(sum.load(), size_t(64 * 63 / 2));
+
+  /* a cap of one runs inline on the caller */
+  sum.store(0);
+  pool.parallel_for(
+      10, [&](size_t i) { sum.fetch_add(i); }, 1);
+  ASSERT_EQ(sum.load(), size_t(45));
+
+  pool.parallel_for(0, [&](size_t) { sum.store(1000); });
+  ASSERT_EQ(sum.load(), size_t(45));
+}
+
+TEST(thread_pool_shared) {
+  auto &pool = tinyblake::detail::thread_pool::shared();
+  ASSERT_TRUE(pool.size() >= 1);
+  ASSERT_TRUE(&pool == &tinyblake::detail::thread_pool::shared());
+}
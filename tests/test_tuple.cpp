@@ -0,0 +1,250 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/blake2b_tuple.h>
+
+static const uint8_t PERSONAL[16] = {'e', 'x', 'a', 'm', 'p', 'l', 'e', '.',
+                                     't', 'u', 'p', 'l', 'e', '.', 'v', '1'};
+
+TEST(tuple_reference_vector) {
+  /* ("hello", 42, "world", -1) framed as tag || LE64 len || data */
+  tinyblake::blake2b::tuple_hasher h(32, PERSONAL, sizeof(PERSONAL));
+  h.add_field("hello", 5);
+  h.add_u64(42);
+  h.add_string("world");
+  h.add_i64(-1);
+  auto digest = h.final_();
+
+  auto expected = test::hex_to_bytes(
+      "c6b9761396706c05542815be6412e1014021d31069ab43fc322091941c0ba09d");
+  ASSERT_EQ(digest.size(), size_t(32));
+  ASSERT_BYTES_EQ(digest.data(), expected.data(), 32);
+}
+
+TEST(tuple_matches_manual_framing) {
+  uint8_t param[64] = {};
+  param[0] = 64;
+  param[2] = 1;
+  param[3] = 1;
+  std::memcpy(param + 48, PERSONAL, 16);
+
+  std::vector<uint8_t> framed;
+  auto frame = [&](uint8_t tag, const std::vector<uint8_t> &d) {
+    framed.push_back(tag);
+    for (int i = 0; i < 8; ++i)
+      framed.push_back(static_cast<uint8_t>(uint64_t(d.size()) >> (8 * i)));
+    framed.insert(framed.end(), d.begin(), d.end());
+  };
+  std::vector<uint8_t> big(300, 0xAB);
+  frame(TINYBLAKE_TUPLE_BYTES, big);
+  frame(TINYBLAKE_TUPLE_BYTES, {});
+  frame(TINYBLAKE_TUPLE_STRING, {'x'});
+
+  tinyblake::blake2b::hasher ref(param);
+  ref.update(framed);
+  auto expected = ref.final_();
+
+  tinyblake::blake2b::tuple_hasher h(64, PERSONAL, sizeof(PERSONAL));
+  h.add_field(big);
+  h.add_field(nullptr, 0);
+  h.add_string("x");
+  ASSERT_EQ(h.final_(), expected);
+}
+
+TEST(tuple_field_boundaries_are_unambiguous) {
+  tinyblake::blake2b::tuple_hasher a;
+  a.add_field("ab", 2);
+  a.add_field("c", 1);
+
+  tinyblake::blake2b::tuple_hasher b;
+  b.add_field("a", 1);
+  b.add_field("bc", 2);
+
+  tinyblake::blake2b::tuple_hasher c;
+  c.add_field("abc", 3);
+
+  auto da = a.final_();
+  auto db = b.final_();
+  auto dc = c.final_();
+  ASSERT_TRUE(da != db);
+  ASSERT_TRUE(da != dc);
+  ASSERT_TRUE(db != dc);
+}
+
+TEST(tuple_types_and_personal_separate) {
+  uint8_t le42[8] = {42, 0, 0, 0, 0, 0, 0, 0};
+
+  tinyblake::blake2b::tuple_hasher u;
+  u.add_u64(42);
+  tinyblake::blake2b::tuple_hasher i;
+  i.add_i64(42);
+  tinyblake::blake2b::tuple_hasher raw;
+  raw.add_field(le42, 8);
+  tinyblake::blake2b::tuple_hasher p(64, PERSONAL, sizeof(PERSONAL));
+  p.add_u64(42);
+
+  auto du = u.final_();
+  auto di = i.final_();
+  auto dr = raw.final_();
+  auto dp = p.final_();
+  ASSERT_TRUE(du != di);
+  ASSERT_TRUE(du != dr);
+  ASSERT_TRUE(du != dp);
+}
+
+TEST(tuple_reset) {
+  tinyblake::blake2b::tuple_hasher h(32);
+  h.add_u64(7);
+  auto first = h.final_();
+  h.reset();
+  h.add_u64(7);
+  ASSERT_EQ(h.final_(), first);
+}
+
+TEST(tuple_hash_many_matches_single) {
+  /* Three fields per record with lengths chosen to straddle block edges. */
+  const size_t nrecords = 19;
+  const size_t nfields = 3;
+  std::vector<std::vector<uint8_t>> blobs(nrecords);
+  std::vector<uint8_t> ids(nrecords * 8);
+  std::vector<tinyblake::blake2b::tuple_field> fields(nrecords * nfields);
+  static const char *names[] = {"", "a", "record-name"};
+
+  for (size_t r = 0; r < nrecords; ++r) {
+    blobs[r].resize(r * 37);
+    for (size_t k = 0; k < blobs[r].size(); ++k)
+      blobs[r][k] = static_cast<uint8_t>(r + k);
+    for (int b = 0; b < 8; ++b)
+      ids[r * 8 + b] = static_cast<uint8_t>(uint64_t(r * 1000003) >> (8 * b));
+
+    fields[r * nfields + 0] = {&ids[r * 8], 8, TINYBLAKE_TUPLE_U64};
+    fields[r * nfields + 1] = {blobs[r].data(), blobs[r].size(),
+                               TINYBLAKE_TUPLE_BYTES};
+    fields[r * nfields + 2] = {names[r % 3], std::strlen(names[r % 3]),
+                               TINYBLAKE_TUPLE_STRING};
+  }
+
+  auto batch = tinyblake::blake2b::hash_tuples(
+      fields.data(), nfields, nrecords, 48, PERSONAL, sizeof(PERSONAL));
+  ASSERT_EQ(batch.size(), nrecords * 48);
+
+  for (size_t r = 0; r < nrecords; ++r) {
+    tinyblake::blake2b::tuple_hasher h(48, PERSONAL, sizeof(PERSONAL));
+    h.add_u64(r * 1000003);
+    h.add_field(blobs[r]);
+    h.add_string(names[r % 3]);
+    auto single = h.final_();
+    ASSERT_BYTES_EQ(batch.data() + r * 48, single.data(), 48);
+  }
+}
+
+TEST(tuple_hash_many_wide_records) {
+  /* Records wider than one 16-field chunk are absorbed chunk by chunk.
+   * Record 0 uses 119-byte fields so every chunk ends exactly on a block
+   * boundary; the rest cover uneven carries. */
+  const size_t nrecords = 11;
+  const size_t nfields = 37;
+  auto field_len = [](size_t r, size_t f) -> size_t {
+    return r == 0 ? 119 : (r * 37 + f * 11) % 200;
+  };
+  std::vector<uint8_t> data(nfields + 200);
+  for (size_t k = 0; k < data.size(); ++k)
+    data[k] = static_cast<uint8_t>(k * 3);
+  std::vector<tinyblake::blake2b::tuple_field> fields(nrecords * nfields);
+  for (size_t r = 0; r < nrecords; ++r)
+    for (size_t f = 0; f < nfields; ++f)
+      fields[r * nfields + f] = {data.data() + f, field_len(r, f),
+                                 TINYBLAKE_TUPLE_BYTES};
+
+  auto batch =
+      tinyblake::blake2b::hash_tuples(fields.data(), nfields, nrecords, 32);
+  ASSERT_EQ(batch.size(), nrecords * 32);
+
+  for (size_t r = 0; r < nrecords; ++r) {
+    tinyblake::blake2b::tuple_hasher h(32);
+    for (size_t f = 0; f < nfields; ++f)
+      h.add_field(data.data() + f, field_len(r, f));
+    auto single = h.final_();
+    ASSERT_BYTES_EQ(batch.data() + r * 32, single.data(), 32);
+  }
+}
+
+TEST(tuple_hash_many_no_fields) {
+  uint8_t out[2 * 32];
+  ASSERT_EQ(tinyblake_blake2b_tuple_hash_many(out, 32, nullptr, 0, 2, nullptr,
+                                              0),
+            0);
+
+  tinyblake::blake2b::tuple_hasher h(32);
+  auto empty = h.final_();
+  ASSERT_BYTES_EQ(out, empty.data(), 32);
+  ASSERT_BYTES_EQ(out + 32, empty.data(), 32);
+}
+
+TEST(tuple_errors) {
+  tinyblake_blake2b_state S;
+  ASSERT_EQ(tinyblake_blake2b_tuple_init(nullptr, 32, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_init(&S, 0, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_init(&S, 65, nullptr, 0), -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_init(&S, 32, PERSONAL, 17), -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_init(&S, 32, nullptr, 4), -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_init(&S, 32, PERSONAL, 16), 0);
+
+  ASSERT_EQ(tinyblake_blake2b_tuple_add(&S, TINYBLAKE_TUPLE_BYTES, nullptr, 1),
+            -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_add(&S, TINYBLAKE_TUPLE_U64, "abc", 3), -1);
+
+  tinyblake::blake2b::tuple_field bad = {"abc", 3, TINYBLAKE_TUPLE_I64};
+  uint8_t out[32];
+  ASSERT_EQ(tinyblake_blake2b_tuple_hash_many(out, 32, &bad, 1, 1, nullptr, 0),
+            -1);
+  ASSERT_EQ(tinyblake_blake2b_tuple_hash_many(out, 32, &bad, 2,
+                                              SIZE_MAX / 2 + 1, nullptr, 0),
+            -1);
+
+  bool threw = false;
+  try {
+    tinyblake::blake2b::tuple_hasher h(0);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+
+  threw = false;
+  try {
+    tinyblake::blake2b::tuple_hasher h(32, PERSONAL, 17);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "test_harness.h"
+#include <cstring>
+#include <stdexcept>
+#include <tinyblake/blake2b.h>
+#include <tinyblake/wots.h>
+
+static const uint8_t SEED[16] = {0, 1, 2,  3,  4,  5,  6,  7,
+                                 8, 9, 10, 11, 12, 13, 14, 15};
+
+/* Reference chain: one parameter-block hash per step */
+static std::vector<uint8_t> manual_chain(const uint8_t *x, const uint8_t *addr,
+                                         uint32_t start, uint32_t steps) {
+  std::vector<uint8_t> v(x, x + 32);
+  for (uint32_t j = start; j < start + steps; ++j) {
+    uint8_t param[64] = {};
+    param[0] = 32;
+    param[2] = 1;
+    param[3] = 1;
+    std::memcpy(param + 32, addr, 12);
+    for (int b = 0; b < 4; ++b)
+      param[44 + b] = static_cast<uint8_t>(j >> (8 * b));
+    std::memcpy(param + 48, SEED, 16);
+
+    tinyblake_blake2b_state S;
+    tinyblake_blake2b_init_param(&S, param);
+    tinyblake_blake2b_update(&S, v.data(), 32);
+    tinyblake_blake2b_final(&S, v.data(), 32);
+  }
+  return v;
+}
+
+TEST(wots_reference_vector) {
+  /* hashlib.blake2b(x, digest_size=32, salt=addr[:12] + LE32(j),
+   *                 person=seed) for j = 3..17 */
+  uint8_t x[32], addr[16];
+  std::memset(x, 0x5A, 32);
+  for (int i = 0; i < 16; ++i)
+    addr[i] = static_cast<uint8_t>(100 + i);
+
+  auto got = tinyblake::wots::chain(x, addr, 3, 15, SEED);
+  auto expected = test::hex_to_bytes(
+      "8b0bbdf5f14a5dff1513dd831a0b37f65dbe4b52a5b9ed3f11945add4b63aa1a");
+  ASSERT_EQ(got, expected);
+
+  /* Address bytes 12..15 carry the step index and are ignored */
+  addr[12] ^= 0xFF;
+  addr[15] ^= 0x01;
+  ASSERT_EQ(tinyblake::wots::chain(x, addr, 3, 15, SEED), expected);
+}
+
+/* Uneven step counts exercise lane refill, including zero-step chains */
+TEST(wots_matches_reference_chains) {
+  static const size_t counts[] = {1, 3, 4, 5, 8, 9, 17, 67};
+  for (size_t n : counts) {
+    std::vector<uint8_t> values(n * 32), addrs(n * 16);
+    std::vector<uint32_t> start(n), steps(n);
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<uint8_t>(i * 13 + n);
+    for (size_t i = 0; i < addrs.size(); ++i)
+      addrs[i] = static_cast<uint8_t>(i * 5 + 1);
+    for (size_t i = 0; i < n; ++i) {
+      start[i] = static_cast<uint32_t>((i * 7) % 5);
+      steps[i] = static_cast<uint32_t>((i * 11 + n) % 16);
+    }
+
+    auto got = tinyblake::wots::chains(values, addrs, start, steps, SEED);
+    ASSERT_EQ(got.size(), n * 32);
+    for (size_t i = 0; i < n; ++i) {
+      auto expected = manual_chain(&values[i * 32], &addrs[i * 16], start[i],
+                                   steps[i]);
+      ASSERT_BYTES_EQ(&got[i * 32], expected.data(), 32);
+    }
+
+    /* In place through the C API */
+    ASSERT_EQ(tinyblake_wots_chains(values.data(), values.data(), addrs.data(),
+                                    start.data(), steps.data(), n, SEED),
+              0);
+    ASSERT_EQ(values, got);
+  }
+}
+
+/* Signing stops at position d; verification continues to the end */
+TEST(wots_sign_then_verify_reaches_public_key) {
+  const size_t n = 67;
+  const uint32_t w1 = 15;
+  std::vector<uint8_t> sk(n * 32), addrs(n * 16);
+  for (size_t i = 0; i < sk.size(); ++i)
+    sk[i] = static_cast<uint8_t>(i ^ 0x3C);
+  for (size_t i = 0; i < n; ++i)
+    addrs[i * 16] = static_cast<uint8_t>(i);
+
+  std::vector<uint32_t> full(n, w1), digits(n), rest(n);
+  for (size_t i = 0; i < n; ++i) {
+    digits[i] = static_cast<uint32_t>((i * 7) % 16);
+    rest[i] = w1 - digits[i];
+  }
+
+  auto pk = tinyblake::wots::chains(sk, addrs, {}, full, SEED);
+  auto sig = tinyblake::wots::chains(sk, addrs, {}, digits, SEED);
+  auto recovered = tinyblake::wots::chains(sig, addrs, digits, rest, SEED);
+  ASSERT_EQ(recovered, pk);
+
+  /* A different seed yields a different public key */
+  uint8_t other[16];
+  std::memcpy(other, SEED, 16);
+  other[0] ^= 1;
+  ASSERT_TRUE(tinyblake::wots::chains(sk, addrs, {}, full, other) != pk);
+}
+
+TEST(wots_invalid_args) {
+  uint8_t v[32] = {}, a[16] = {};
+  uint32_t start = 10, steps = UINT32_MAX;
+  ASSERT_EQ(tinyblake_wots_chains(v, v, a, &start, &steps, 1, SEED), -1);
+  steps = 1;
+  ASSERT_EQ(tinyblake_wots_chains(nullptr, v, a, &start, &steps, 1, SEED),
+            -1);
+  ASSERT_EQ(tinyblake_wots_chains(v, v, a, &start, &steps, 1, nullptr), -1);
+  ASSERT_EQ(tinyblake_wots_chains(v, v, a, nullptr, nullptr, 1, SEED), -1);
+  ASSERT_EQ(tinyblake_wots_chains(nullptr, nullptr, nullptr, nullptr, nullptr,
+                                  0, nullptr),
+            0);
+
+  bool threw = false;
+  try {
+    tinyblake::wots::chains(std::vector<uint8_t>(64), std::vector<uint8_t>(32),
+                            {}, {1}, SEED);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
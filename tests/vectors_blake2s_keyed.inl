@@ -0,0 +1,93 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * BLAKE2s keyed hash test vectors in the layout of the official
+ * blake2s reference implementation (blake2s-kat.txt).
+ *
+ * Key = 00 01 02 ... 1f (32 bytes)
+ * Input(i) = 00 01 02 ... (i-1)  for i = 0..255
+ * Output = BLAKE2s-256(key, input(i))
+ *
+ * We include a subset: entries 0, 1, 2, 3, 63, 64, 65, 128, 255.
+ */
+
+struct KeyedKatVectorS {
+    size_t input_len;
+    const char* expected_hex;
+};
+
+static const char* const keyed_kat_key_s_hex =
+    "000102030405060708090a0b0c0d0e0f"
+    "101112131415161718191a1b1c1d1e1f";
+
+static const KeyedKatVectorS keyed_kat_vectors_s[] = {
+    /* input_len=0 */
+    {
+        0,
+        "48a8997da407876b3d79c0d92325ad3b89cbb754d86ab71aee047ad345fd2c49"
+    },
+    /* input_len=1 */
+    {
+        1,
+        "40d15fee7c328830166ac3f918650f807e7e01e177258cdc0a39b11f598066f1"
+    },
+    /* input_len=2 */
+    {
+        2,
+        "6bb71300644cd3991b26ccd4d274acd1adeab8b1d7914546c1198bbe9fc9d803"
+    },
+    /* input_len=3 */
+    {
+        3,
+        "1d220dbe2ee134661fdf6d9e74b41704710556f2f6e5a091b227697445dbea6b"
+    },
+    /* input_len=63 */
+    {
+        63,
+        "c65382513f07460da39833cb666c5ed82e61b9e998f4b0c4287cee56c3cc9bcd"
+    },
+    /* input_len=64 */
+    {
+        64,
+        "8975b0577fd35566d750b362b0897a26c399136df07bababbde6203ff2954ed4"
+    },
+    /* input_len=65 */
+    {
+        65,
+        "21fe0ceb0052be7fb0f004187cacd7de67fa6eb0938d927677f2398c132317a8"
+    },
+    /* input_len=128 */
+    {
+        128,
+        "0c311f38c35a4fb90d651c289d486856cd1413df9b0677f53ece2cd9e477c60a"
+    },
+    /* input_len=255 */
+    {
+        255,
+        "3fb735061abc519dfe979e54c1ee5bfad0a9d858b3315bad34bde999efd724dd"
+    },
+};
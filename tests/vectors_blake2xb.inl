@@ -0,0 +1,119 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * BLAKE2Xb test vectors, generated with an independent reference
+ * implementation of the BLAKE2X specification.
+ *
+ * Key = 00 01 02 ... 3f (64 bytes) when keyed
+ * Input(i) = 00 01 02 ... (i-1)
+ *
+ * Long outputs are checked via BLAKE2b-256 of the full output.
+ */
+
+struct Blake2xbVector {
+    size_t input_len;
+    bool keyed;
+    size_t outlen;
+    const char* expected_hex;
+};
+
+struct Blake2xbLongVector {
+    size_t input_len;
+    bool keyed;
+    size_t outlen;
+    const char* output_blake2b256_hex;
+};
+
+static const char* blake2xb_key_hex =
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f";
+
+static const Blake2xbVector blake2xb_vectors[] = {
+    {0, false, 1,
+     "34"},
+    {3, false, 32,
+     "7eeddf8f8b394caee03b5a843b795ad4e9c817cb17f24f07f9b26b99ef054213"},
+    {3, false, 64,
+     "9103633bd300fcc44c8bf3255c5af88a62e25aadbf5b2797e2bd9a049872ce0e"
+     "d6c7c21b5169c2b1784cf8506e7991a0a18476b75450b1883a4c1e19e5fc46d9"},
+    {3, false, 65,
+     "9a860b829e5851e79b6105a8fe9a9548b134c2990b80cb51356013d4bf04d328"
+     "3a48831a490b8177df4e442a8718cafc5cfb44649ec34032def405226235e7f3"
+     "f5"},
+    {255, false, 128,
+     "1b04c32f21baa4357d161e142e93952512256fe7ea6780886290991e70f84fd6"
+     "335a83558b4c4926767bfa5ef9e32f1c89c0be34325cfef843c78c62edf8e0d4"
+     "17d776a0526ebc3805b5702e81440d3ca714ecfdd9f92215ba3d661d5ca490f5"
+     "f111371050c3c027dd860409615febf9eed2b89cd512bc58fa32bbf3161a6f25"},
+    {256, true, 1,
+     "64"},
+    {256, true, 63,
+     "e101f43179d8e8546e5ce6a96d7556b7e6b9d4a7d00e7aade5579d085d527ce3"
+     "4a9329551ebcaf6ba946949bbe38e30a62ae344c1950b4bde55306b3bac432"},
+    {256, true, 64,
+     "4324561d76c370ef35ac36a4adf8f3773a50d86504bd284f71f7ce9e2bc4c1f1"
+     "d34a7fb2d67561d101955d448b67577eb30dfee96a95c7f921ef53e20be8bc44"},
+    {256, true, 100,
+     "cb859b35dc70e264efaad2a809fea1e71cd4a3f924be3b5a13f8687a1166b538"
+     "c40b2ad51d5c3e47b0de482497382673140f547068ff0b3b0fb7501209e1bf36"
+     "082509ae85f60bb98fd02ac50d883a1a8daa704952d83c1f6da60c9624bc7c99"
+     "912930bf"},
+    {256, true, 256,
+     "1e9b2c454e9de3a2d723d850331037dbf54133dbe27488ff757dd255833a27d8"
+     "eb8a128ad12d0978b6884e25737086a704fb289aaaccf930d5b582ab4df1f55f"
+     "0c429b6875edec3fe45464fa74164be056a55e243c4222c586bec5b18f39036a"
+     "a903d98180f24f83d09a454dfa1e03a60e6a3ba4613e99c35f874d790174ee48"
+     "a557f4f021ade4d1b278d7997ef094569b37b3db0505951e9ee8400adaea275c"
+     "6db51b325ee730c69df97745b556ae41cd98741e28aa3a49544541eeb3da1b1e"
+     "8fa4e8e9100d66dd0c7f5e2c271b1ecc077de79c462b9fe4c273543ecd82a5be"
+     "a63c5acc01eca5fb780c7d7c8c9fe208ae8bd50cad1769693d92c6c8649d20d8"},
+    {128, true, 129,
+     "374c72a85c7028d61f7dec659d800f8d4b1af4c79437ad9a2bb1adc762ed4ff1"
+     "bfeebc7c4ca08286d4d13b64d524fcba085ce84e127c698f949abeea4dd8c678"
+     "f5dfa21241dd4a2fc6f7f225c132b6d5d208a4c983140ebd8d73d8c9e3c8d941"
+     "088c7ffeda8fcba6e0dcb004c4ca791e3b68670c833c7962e4d59e108ce3473d"
+     "2a"},
+    {129, false, 200,
+     "8f0d00f9a2b3d33c24d7715ded8c5787c4d0eec6ac43eb062c7176f4f9357216"
+     "7cb7f7a5011b81f6165000e7fbc7376eeb5606a55a38c1036f646d08c5345793"
+     "75e7db897de05a621c8bba12206e1601692f727212df2da67d2ee97207489599"
+     "c73b5fbc16b2d091d66d2329eb91388923a8177e763198aa2b1906eea75472b6"
+     "c5e8690cb0b00a32aff51fc13f20343ecf0bb5b596e2cfc2748d98d74efabe4a"
+     "d46ef4dcad677fd5ecc42ea5840dcf48cd3dfed3cc27b03a43a5d97daf64bb51"
+     "303481d346ace49c"},
+};
+
+static const Blake2xbLongVector blake2xb_long_vectors[] = {
+    {256, true, 2048,
+     "f46205aad36e2eee4692da7e30e775b68a0288bf8150703e1b9ecc7f640dbf06"},
+    {1000, false, 1025,
+     "7c75df4c7440e1ba9be28763d60dc8947c3480523520f78d10ba18f1ace2a9f1"},
+    {4096, true, 4097,
+     "6dd6638eefc1c3e6afc500558841d20785b37962c71ce664fa2f97cb2f7db613"},
+    {0, false, 8192,
+     "f2cfe0f27a5779f16db67a0e7879f11a969bbcf08665a00332553207412ab62b"},
+};
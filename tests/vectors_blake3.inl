@@ -0,0 +1,543 @@
+// Copyright (c) 2025-2026, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * BLAKE3 test vectors in the layout of the official test_vectors.json,
+ * generated with the reference implementation.
+ *
+ * Input(n) = bytes(i % 251 for i in range(n))
+ * Output   = 131 bytes of extended output each for hash, keyed_hash
+ *            (key below) and derive_key (context below)
+ */
+
+struct Blake3Vector {
+    size_t input_len;
+    const char* hash_hex;
+    const char* keyed_hex;
+    const char* derive_hex;
+};
+
+static const char* const blake3_vector_key =
+    "tinyblake blake3 test vector key";
+static const char* const blake3_vector_context =
+    "BLAKE3 2019-12-27 16:29:52 test vectors context";
+
+static const Blake3Vector blake3_vectors[] = {
+    /* input_len=0 */
+    {
+        0,
+        "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"
+        "e00f03e7b69af26b7faaf09fcd333050338ddfe085b8cc869ca98b206c08243a"
+        "26f5487789e8f660afe6c99ef9e0c52b92e7393024a80459cf91f476f9ffdbda"
+        "7001c22e159b402631f277ca96f2defdf1078282314e763699a31c5363165421"
+        "cce14d",
+        "0f8ed46e8da5e43b04b99a6f90dd6c20b16802efa784205d51d0a9afe99491ac"
+        "570363fca7c6566e71487091549a1db24b299fc0622dc42aff53de1eb6ce307d"
+        "6007a36724948d6b2c828d709448439ef09d699af0f28dcc7c7eb5a53f0883f0"
+        "df9d243a57f531659aa6a6b12d215d5bf65e307e832445737f8fb363762f7037"
+        "d0bc2a",
+        "2cc39783c223154fea8dfb7c1b1660f2ac2dcbd1c1de8277b0b0dd39b7e50d7d"
+        "905630c8be290dfcf3e6842f13bddd573c098c3f17361f1f206b8cad9d088aa4"
+        "a3f746752c6b0ce6a83b0da81d59649257cdf8eb3e9f7d4998e41021fac119de"
+        "efb896224ac99f860011f73609e6e0e4540f93b273e56547dfd3aa1a035ba668"
+        "9d89a0"
+    },
+    /* input_len=1 */
+    {
+        1,
+        "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213"
+        "c3a6cb8bf623e20cdb535f8d1a5ffb86342d9c0b64aca3bce1d31f60adfa137b"
+        "358ad4d79f97b47c3d5e79f179df87a3b9776ef8325f8329886ba42f07fb138b"
+        "b502f4081cbcec3195c5871e6c23e2cc97d3c69a613eba131e5f1351f3f1da78"
+        "6545e5",
+        "86682ac5d3001e5de4465803790b9499dda76002a860b22279342586dccb1645"
+        "cd490778a83b3044412009a96b11b57941b461f334d1aebb71ed8708f0943b96"
+        "fbb9fb739a587d0a7355d1e22f441aa9ebbdec9a43f75870a5539ca1afbf4616"
+        "baaff8eb0c89bf8e84f65eea9d8fa6f8dcf1ff6784ae05e36fcbcc4b6e87715b"
+        "14d292",
+        "b3e2e340a117a499c6cf2398a19ee0d29cca2bb7404c73063382693bf66cb06c"
+        "5827b91bf889b6b97c5477f535361caefca0b5d8c4746441c576171119331589"
+        "50670f9aa8a05d791daae10ac683cbef8faf897c84e6114a59d2173c3f417023"
+        "a35d6983f2c7dfa57e7fc559ad751dbfb9ffab39c2ef8c4aafebc9ae973a64f0"
+        "c76551"
+    },
+    /* input_len=63 */
+    {
+        63,
+        "e9bc37a594daad83be9470df7f7b3798297c3d834ce80ba85d6e207627b7db7b"
+        "1197012b1e7d9af4d7cb7bdd1f3bb49a90a9b5dec3ea2bbc6eaebce77f4e470c"
+        "bf4687093b5352f04e4a4570fba233164e6acc36900e35d185886a827f7ea9bd"
+        "c1e5c3ce88b095a200e62c10c043b3e9bc6cb9b6ac4dfa51794b02ace9f98779"
+        "040755",
+        "5b4ca921486b21acec58b420b21aad8917343e05372f96eb166cb13939c3d4b1"
+        "f49244ce8c7d8cdb54748423e8d63113aaafeb7e672c8dcf0deb3d3e5d89789b"
+        "829efbae92e26a8d4db8a53fe27f8cfbe1dab288d1758c558e8197e4f7292484"
+        "f67eeacc1d8cec2aa85366acc47df1df8fbe51cc6624f89da5dc7c7207935bed"
+        "40c44b",
+        "b6451e30b953c206e34644c6803724e9d2725e0893039cfc49584f991f451af3"
+        "b89e8ff572d3da4f4022199b9563b9d70ebb616efff0763e9abec71b550f1371"
+        "e233319c4c4e74da936ba8e5bbb29a598e007a0bbfa929c99738ca2cc098d591"
+        "34d11ff300c39f82e2fce9f7f0fa266459503f64ab9913befc65fddc474f6dc1"
+        "c67669"
+    },
+    /* input_len=64 */
+    {
+        64,
+        "4eed7141ea4a5cd4b788606bd23f46e212af9cacebacdc7d1f4c6dc7f2511b98"
+        "fc9cc56cb831ffe33ea8e7e1d1df09b26efd2767670066aa82d023b1dfe8ab1b"
+        "2b7fbb5b97592d46ffe3e05a6a9b592e2949c74160e4674301bc3f97e04903f8"
+        "c6cf95b863174c33228924cdef7ae47559b10b294acd660666c4538833582b43"
+        "f82d74",
+        "b69d4dc3de62020f5dfe94cab3ac3cdf3a53b4beb27bdd6765c476456d90214f"
+        "2897fe329d897ac5d9e77e6136ec35abaa3cddb455dcc88a85f32a9ccf7b03c0"
+        "0b944b4320a27281241a12fb9c07185dd4d8933a70bc0aad03638930a95b2e40"
+        "e8e6dce436c6b048a2d887d285ce65a51b42f0b7a264bec77e2c52b33a08f9c2"
+        "6c0cef",
+        "a5c4a7053fa86b64746d4bb688d06ad1f02a18fce9afd3e818fefaa7126bf73e"
+        "9b9493a9befebe0bf0c9509fb3105cfa0e262cde141aa8e3f2c2f77890bb64a4"
+        "cca96922a21ead111f6338ad5244f2c15c44cb595443ac2ac294231e31be4a43"
+        "07d0a91e874d36fc9852aeb1265c09b6e0cda7c37ef686fbbcab97e8ff66718b"
+        "e048bb"
+    },
+    /* input_len=65 */
+    {
+        65,
+        "de1e5fa0be70df6d2be8fffd0e99ceaa8eb6e8c93a63f2d8d1c30ecb6b263dee"
+        "0e16e0a4749d6811dd1d6d1265c29729b1b75a9ac346cf93f0e1d7296dfcfd43"
+        "13b3a227faaaaf7757cc95b4e87a49be3b8a270a12020233509b1c3632b3485e"
+        "ef309d0abc4a4a696c9decc6e90454b53b000f456a3f10079072baaf7a981653"
+        "221f2c",
+        "3e13c0afc6c4e38ffe006d1561c5591a8af63109afc6880f36345377e66f89bd"
+        "1e83ba439e125ef398262ecb48136691fe7fc5ead471b79519e6484c1a3c8303"
+        "b3785adc1f574297b0ebccefb70bff303bc7fe8363e93aac15449cd86900fb86"
+        "a3ef530ff4318e0d46396b583083dd6b24c8bb51249c03373d7402faa527b848"
+        "ec3b5e",
+        "51fd05c3c1cfbc8ed67d139ad76f5cf8236cd2acd26627a30c104dfd9d3ff8a8"
+        "2b02e8bd36d8498a75ad8c8e9b15eb386970283d6dd42c8ae7911cc592887fdb"
+        "e26a0a5f0bf821cd92986c60b2502c9be3f98a9c133a7e8045ea867e0828c725"
+        "2e739321f7c2d65daee4468eb4429efae469a42763f1f94977435d10dccae3e3"
+        "dce88d"
+    },
+    /* input_len=1023 */
+    {
+        1023,
+        "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11"
+        "a182d27a591b05592b15607500e1e8dd56bc6c7fc063715b7a1d737df5bad333"
+        "9c56778957d870eb9717b57ea3d9fb68d1b55127bba6a906a4a24bbd5acb2d12"
+        "3a37b28f9e9a81bbaae360d58f85e5fc9d75f7c370a0cc09b6522d9c8d822f2f"
+        "28f485",
+        "80cabb1a136e1741a33061e697b68681624862dfe92429b4dd3004874e9f11e4"
+        "c1c7c29fbce56d45aa8a57ffb0742508834e976952c168c6cde9c4f1608b56b2"
+        "b4981a45a205464bd84daca3649b8f54a38edba8c5da486885bf1868beb80923"
+        "235690e05774678c3035a6c4276a41ef5aff4f5641b1d2a8d4f2af3ace8cae52"
+        "8c5538",
+        "74a16c1c3d44368a86e1ca6df64be6a2f64cce8f09220787450722d85725dea5"
+        "9c413264404661e9e4d955409dfe4ad3aa487871bcd454ed12abfe2c2b1eb775"
+        "7588cf6cb18d2eccad49e018c0d0fec323bec82bf1644c6325717d13ea712e68"
+        "40d3e6e730d35553f59eff5377a9c350bcc1556694b924b858f329c44ee64b88"
+        "4ef00d"
+    },
+    /* input_len=1024 */
+    {
+        1024,
+        "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7"
+        "1cf8107265ecdaf8505b95d8fcec83a98a6a96ea5109d2c179c47a387ffbb404"
+        "756f6eeae7883b446b70ebb144527c2075ab8ab204c0086bb22b7c93d465efc5"
+        "7f8d917f0b385c6df265e77003b85102967486ed57db5c5ca170ba441427ed9a"
+        "fa684e",
+        "fa0d9f207f353326f0b429d0048a61cc94e6f8501081f3d4fc9f65ae890343b9"
+        "4e28c163d35e7ddfe3fe2784417699591cde361d30ea9cdcebc1003e8e8bb38e"
+        "57f39a65581bfb651adf060f8408f821f7567e1de1bc96ca61b756612c76be8a"
+        "01b70e266e855d5ae22f9e4775c4916ceaa75665928af9517f9b3f289b342654"
+        "6ade5f",
+        "7356cd7720d5b66b6d0697eb3177d9f8d73a4a5c5e968896eb6a689684302706"
+        "6c23b601d3ddfb391e90d5c8eccdef4ae2a264bce9e612ba15e2bc9d654af148"
+        "1b2e75dbabe615974f1070bba84d56853265a34330b4766f8e75edd1f4a16504"
+        "76c10802f22b64bd3919d246ba20a17558bc51c199efdec67e80a227251808d8"
+        "ce5bad"
+    },
+    /* input_len=1025 */
+    {
+        1025,
+        "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444"
+        "f4c4a22b4b399155358a994e52bf255de60035742ec71bd08ac275a1b51cc6bf"
+        "e332b0ef84b409108cda080e6269ed4b3e2c3f7d722aa4cdc98d16deb554e562"
+        "7be8f955c98e1d5f9565a9194cad0c4285f93700062d9595adb992ae68ff1280"
+        "0ab67a",
+        "9e223c665c42f25be591ca71c8da5e8ae5733e4d100e155408f8639015b8ffc1"
+        "539309e7247dfd4f12f8997a318816077257975f067b1d2ca80fa968e0110ca4"
+        "1aba0ea8e713d52d1a9dcbfc60c505284cfeac1164cacd754ac9dc787fa1365c"
+        "b72e8ae20f7d688ff74b4a8b5266ab027b31fb2dae9b40905a9ad7e82f59e079"
+        "5f3b49",
+        "effaa245f065fbf82ac186839a249707c3bddf6d3fdda22d1b95a3c970379bcb"
+        "5d31013a167509e9066273ab6e2123bc835b408b067d88f96addb550d96b6852"
+        "dad38e320b9d940f86db74d398c770f462118b35d2724efa13da97194491d96d"
+        "d37c3c09cbef665953f2ee85ec83d88b88d11547a6f911c8217cca46defa2751"
+        "e7f3ad"
+    },
+    /* input_len=2048 */
+    {
+        2048,
+        "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a"
+        "9a60bf80001410ec9eea6698cd537939fad4749edd484cb541aced55cd9bf547"
+        "64d063f23f6f1e32e12958ba5cfeb1bf618ad094266d4fc3c968c2088f677454"
+        "c288c67ba0dba337b9d91c7e1ba586dc9a5bc2d5e90c14f53a8863ac75655461"
+        "cea8f9",
+        "083a7b12847789ca3d741fa6a49907ac28cc0f3a9a805edc1a2b06a68d44df6d"
+        "8b2b274c4614dc79e16a4ceb45940942d1772c7c10578889c4992974a72d93ab"
+        "ad9c54cb96bef46f3f2f97bf5e55070592e6b017de71d2281979dff3dd0df77f"
+        "ebf2b0a838af224a320dfc431d89973fe6ab366912dc590f322b372a8e7b0a57"
+        "7c0a63",
+        "7b2945cb4fef70885cc5d78a87bf6f6207dd901ff239201351ffac04e1088a23"
+        "e2c11a1ebffcea4d80447867b61badb1383d842d4e79645d48dd82ccba290769"
+        "caa7af8eaa1bd78a2a5e6e94fbdab78d9c7b74e894879f6a515257ccf6f95056"
+        "f4e25390f24f6b35ffbb74b766202569b1d797f2d4bd9d17524c720107f985f4"
+        "ddc583"
+    },
+    /* input_len=2049 */
+    {
+        2049,
+        "5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030"
+        "96de31d71d74103403822a2e0bc1eb193e7aecc9643a76b7bbc0c9f9c52e8783"
+        "aae98764ca468962b5c2ec92f0c74eb5448d519713e09413719431c802f948dd"
+        "5d90425a4ecdadece9eb178d80f26efccae630734dff63340285adec2aed3b51"
+        "073ad3",
+        "5be48b362401671c816bc80be09458c6416ee938350f3836c89a14dc93784e12"
+        "70a0cd7ca662142fb1d579b71fc68e2a26c40e1199a9789cb1783afe0413f1a1"
+        "e7b683d9ada1fab913685b09d2ab132faf304a87a35e69863678602a60a130ad"
+        "20ae43ce7e5fa1b678d98c74155f5cfad81b51deb82038b6ea3786f982a93ef5"
+        "500955",
+        "2ea477c5515cc3dd606512ee72bb3e0e758cfae7232826f35fb98ca1bcbdf273"
+        "16d8e9e79081a80b046b60f6a263616f33ca464bd78d79fa18200d06c7fc9bff"
+        "d808cc4755277a7d5e09da0f29ed150f6537ea9bed946227ff184cc66a72a5f8"
+        "c1e4bd8b04e81cf40fe6dc4427ad5678311a61f4ffc39d195589bdbc670f63ae"
+        "70f4b6"
+    },
+    /* input_len=3072 */
+    {
+        3072,
+        "b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2"
+        "9a3f6b0b978d6608335c09dc94ccf682f9951cdfc501bfe47b9c9189a6fc7b40"
+        "4d120258506341a6d802857322fbd20d3e5dae05b95c88793fa83db1cb08e7d8"
+        "008d1599b6209d78336e24839724c191b2a52a80448306e0daa84a3fdb566661"
+        "a37e11",
+        "c81e67dc1612d80d8a0dffd102dd3cc3b5b3e02ae904111ea493b43c67295e40"
+        "7ef6b328732cf8c9e8de0fdfb77d9ddab0071a16dafcf3a1036b0c850d3a2f47"
+        "5d95b1338b91c4ba84083278f23ac63856a24a1ce772e6e67cf6599423552978"
+        "1f05b3efee765f1f47ba564e172c6bc70c59a636f4f23fe2a13c0dd5620e8b8b"
+        "df0176",
+        "050df97f8c2ead654d9bb3ab8c9178edcd902a32f8495949feadcc1e0480c46b"
+        "3604131bbd6e3ba573b6dd682fa0a63e5b165d39fc43a625d00207607a2bfeb6"
+        "5ff1d29292152e26b298868e3b87be95d6458f6f2ce6118437b632415abe6ad5"
+        "22874bcd79e4030a5e7bad2efa90a7a7c67e93f0a18fb28369d0a9329ab5c241"
+        "34ccb0"
+    },
+    /* input_len=3073 */
+    {
+        3073,
+        "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3"
+        "9a27ae3b79d68d89da9bf25bc27139ae65a324918a5f9b7828181e52cf373c84"
+        "f35b639b7fccbb985b6f2fa56aea0c18f531203497b8bbd3a07ceb5926f1cab7"
+        "4d14bd66486d9a91eba99059a98bd1cd25876b2af5a76c3e9eed554ed72ea952"
+        "b603bf",
+        "d0758c1612105f1a880581c1eeb54798bc82e231857b323fc4035a10b050b8c6"
+        "8106f208d8bc14f739a4724ff993bfd29100a084c9f915aa38262e109d5bdad1"
+        "da860410cb452931d9b254b92455ecd4cab9b9f2bd1dd2df3d679468355e2f36"
+        "b62a8a0db08cc21d2481c46ec0be03bbcc5e491ff7e493f8c5bcc41f10b26e43"
+        "496179",
+        "72613c9ec9ff7e40f8f5c173784c532ad852e827dba2bf85b2ab4b76f7079081"
+        "576288e552647a9d86481c2cae75c2dd4e7c5195fb9ada1ef50e9c5098c249d7"
+        "43929191441301c69e1f48505a4305ec1778450ee48b8e69dc23a25960fe3307"
+        "0ea549119599760a8a2d28aeca06b8c5e9ba58bc19e11fe57b6ee98aa44b2a8e"
+        "6b14a5"
+    },
+    /* input_len=4096 */
+    {
+        4096,
+        "015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969"
+        "0289e9409ddb1b99768eafe1623da896faf7e1114bebeadc1be30829b6f8af70"
+        "7d85c298f4f0ff4d9438aef948335612ae921e76d411c3a9111df62d27eaf871"
+        "959ae0062b5492a0feb98ef3ed4af277f5395172dbe5c311918ea0074ce00364"
+        "54f620",
+        "f1e6068f3becab172d9b5552429a93ae93457f2b47647bdb38187f5dd2ddc8cb"
+        "b8556d61aad7f28c994e5331a3a39517ee0aad8c0847f6147d9caba783f420b5"
+        "4ac95bb061c61715be7251fc35712533067d60fc8dc0a5bd19338d1da236007a"
+        "9de82e9d94cc6cdeb5868cbe018bbadb17de9494fcc377d7bf03c1ac89a98608"
+        "052464",
+        "1e0d7f3db8c414c97c6307cbda6cd27ac3b030949da8e23be1a1a924ad2f25b9"
+        "d78038f7b198596c6cc4a9ccf93223c08722d684f240ff6569075ed81591fd93"
+        "f9fff1110b3a75bc67e426012e5588959cc5a4c192173a03c00731cf84544f65"
+        "a2fb9378989f72e9694a6a394a8a30997c2e67f95a504e631cd2c5f552460247"
+        "61b245"
+    },
+    /* input_len=4097 */
+    {
+        4097,
+        "9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995"
+        "05f91b0b5600a11251652eacfa9497b31cd3c409ce2e45cfe6c0a016967316c4"
+        "26bd26f619eab5d70af9a418b845c608840390f361630bd497b1ab4401931635"
+        "7c61dbe091ce72fc16dc340ac3d6e009e050b3adac4b5b2c92e722cffdc46501"
+        "531956",
+        "9b5c746fcb08f07b45c9467cdf81b51fca60de8c1796e05966d3fbdee5b8dc6a"
+        "8c0c40ee8e6e1df6d26cf57a25737fe6deeb185b34b0cec6c6321bbcda1ea365"
+        "d7054bef24e85537fd9812513ddb35caea4c43c77d43345f1f6a8df44470dd5b"
+        "342f82b21309c1a2bd6cfcf8d1c30d51818cb306d3c83b44d9895d6ffad4dabf"
+        "d8ab1d",
+        "aca51029626b55fda7117b42a7c211f8c6e9ba4fe5b7a8ca922f34299500ead8"
+        "a897f66a400fed9198fd61dd2d58d382458e64e100128075fc54b860934e8de2"
+        "e84170734b06e1d212a117100820dbc48292d148afa50567b8b84b1ec336ae10"
+        "d40c8c975a624996e12de31abbe135d9d159375739c333798a80c64ae895e51e"
+        "22f3ad"
+    },
+    /* input_len=5120 */
+    {
+        5120,
+        "9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833"
+        "acc61c8fdc114a2010ce8038c853e121e1544985133fccdd0a2d507e8e615e61"
+        "1e9a0ba4f47915f49e53d721816a9198e8b30f12d20ec3689989175f1bf7a300"
+        "eee0d9321fad8da232ece6efb8e9fd81b42ad161f6b9550a069e66b11b40487a"
+        "5f5059",
+        "8a767e469f16a3fa71e98476718037d1aa4ce5cae9fd07756e6b7eac845b8bb9"
+        "e54caeb80efcac8cd12311705816d3893a3e35b99c166d938707d1a039875791"
+        "93c039a168c7556f2a35b8366f715a6cb131e50846b2ee94c7dd670c4ac33e35"
+        "cf30db3a2ed0a2ac1d3638501e2eb980317feb0366836590ae52ae9ecad579fd"
+        "f38b91",
+        "7a7acac8a02adcf3038d74cdd1d34527de8a0fcc0ee3399d1262397ce5817f60"
+        "55d0cefd84d9d57fe792d65a278fd20384ac6c30fdb340092f1a74a92ace99c4"
+        "82b28f0fc0ef3b923e56ade20c6dba47e49227166251337d80a037e987ad3a7f"
+        "728b5ab6dfafd6e2ab1bd583a95d9c895ba9c2422c24ea0f62961f0dca45cad4"
+        "7bfa0d"
+    },
+    /* input_len=5121 */
+    {
+        5121,
+        "628bd2cb2004694adaab7bbd778a25df25c47b9d4155a55f8fbd79f2fe154cff"
+        "96adaab0613a6146cdaabe498c3a94e529d3fc1da2bd08edf54ed64d40dcd677"
+        "7647eac51d8277d70219a9694334a68bc8f0f23e20b0ff70ada6f844542dfa32"
+        "cd4204ca1846ef76d811cdb296f65e260227f477aa7aa008bac878f72257484f"
+        "2b6c95",
+        "738b9d30163969cf02bc334b607bd7c05caa0281c20afe93a7c235fded3d93c2"
+        "376f84dd32eebbeccc0998b3f6c28f55a8e0a80d87f57dc49d889a3c50deb3d7"
+        "8623c4f403687c416e034c8591d81dddf67985afcf621d222503ad82cf2637e1"
+        "082a09b1c36b6fa7f5ce7f3a2332e84d4354dd776a91b2b073c1ce35be032b57"
+        "8d8ebd",
+        "b07f01e518e702f7ccb44a267e9e112d403a7b3f4883a47ffbed4b48339b3c34"
+        "1a0add0ac032ab5aaea1e4e5b004707ec5681ae0fcbe3796974c0b1cf31a1947"
+        "40c14519273eedaabec832e8a784b6e7cfc2c5952677e6c3f2c3914454082d7e"
+        "b1ce1766ac7d75a4d3001fc89544dd46b5147382240d689bbbaefc359fb6ae30"
+        "263165"
+    },
+    /* input_len=6144 */
+    {
+        6144,
+        "3e2e5b74e048f3add6d21faab3f83aa44d3b2278afb83b80b3c35164ebeca205"
+        "4d742022da6fdda444ebc384b04a54c3ac5839b49da7d39f6d8a9db03deab32a"
+        "ade156c1c0311e9b3435cde0ddba0dce7b26a376cad121294b689193508dd631"
+        "51603c6ddb866ad16c2ee41585d1633a2cea093bea714f4c5d6b903522045b20"
+        "395c83",
+        "ddc3e43039852f473b6ed7538843c397f6b68297a64d1d9f6e5c1e3560e8ae00"
+        "fa3abdf978a0e1c74e78e564d894ffab1799b261c265102898beaee642596fc6"
+        "4b6efbbf1b13f79c607fe34c17913fd8e6c5ac429a7d8b337641b0788663d29a"
+        "875d6c057c46e70a9fb9532b89c8d4204bd4c5e613401673bf9be1c0f5a2b1d4"
+        "84b1e3",
+        "2a95beae63ddce523762355cf4b9c1d8f131465780a391286a5d01abb5683a15"
+        "97099e3c6488aab6c48f3c15dbe1942d21dbcdc12115d19a8b8465fb54e90533"
+        "23a9178e4275647f1a9927f6439e52b7031a0b465c861a3fc531527f7758b2b8"
+        "88cf2f20582e9e2c593709c0a44f9c6e0f8b963994882ea4168827823eef1f64"
+        "169fef"
+    },
+    /* input_len=6145 */
+    {
+        6145,
+        "f1323a8631446cc50536a9f705ee5cb619424d46887f3c376c695b70e0f0507f"
+        "18a2cfdd73c6e39dd75ce7c1c6e3ef238fd54465f053b25d21044ccb2093beb0"
+        "15015532b108313b5829c3621ce324b8e14229091b7c93f32db2e4e63126a377"
+        "d2a63a3597997d4f1cba59309cb4af240ba70cebff9a23d5e3ff0cdae2cfd54e"
+        "070022",
+        "c0ae585a258e2b0fa57e345241c623892bc3acc9e6f063a766b987a5b91a1281"
+        "92edeb0d26a95c18d1593d44c562ce1c999fc3d8be26dfae9d6750719c4e7991"
+        "f7e10ea1ed3197e1ed066b3d84fcb1a55dd6f25ff1c9c41b05b7422b334ae9a3"
+        "f66800d5579e71871d0e0b115a70f0bfdaa8f4b36ccaa1a4603bb1bfac55adac"
+        "cb5798",
+        "379bcc61d0051dd489f686c13de00d5b14c505245103dc040d9e4dd1facab8e5"
+        "114493d029bdbd295aaa744a59e31f35c7f52dba9c3642f773dd0b4262a9980a"
+        "2aef811697e1305d37ba9d8b6d850ef07fe41108993180cf779aeece363704c7"
+        "6483458603bbeeb693cffbbe5588d1f3535dcad888893e53d977424bb7072015"
+        "69a8d2"
+    },
+    /* input_len=7168 */
+    {
+        7168,
+        "61da957ec2499a95d6b8023e2b0e604ec7f6b50e80a9678b89d2628e99ada77a"
+        "5707c321c83361793b9af62a40f43b523df1c8633cecb4cd14d00bdc79c78fca"
+        "5165b863893f6d38b02ff7236c5a9a8ad2dba87d24c547cab046c29fc5bc1ed1"
+        "42e1de4763613bb162a5a538e6ef05ed05199d751f9eb58d332791b8d73fb74e"
+        "4fce95",
+        "ae0396d68130729e543b7bc345d37e8c36c4e5a570f71cf9fe8c4b2b2b23abd6"
+        "7d6cf035d2f58e9aa8d770ba06a9c48962b4822e8a4c53b087c86d74f191870d"
+        "7cc31b20d27509aa5c9c567e05a2b962eed8343cbbdbd9ae4e3c34213e33c321"
+        "efa0a493a734ca81b28dece19405dee858e7adf526fb95455bb79f462bbbf89c"
+        "64ef15",
+        "11c37a112765370c94a51415d0d651190c288566e295d505defdad895dae2237"
+        "30d5a5175a38841693020669c7638f40b9bc1f9f39cf98bda7a5b54ae24218a8"
+        "00a2116b34665aa95d846d97ea988bfcb53dd9c055d588fa21ba78996776ea6c"
+        "40bc428b53c62b5f3ccf200f647a5aae8067f0ea1976391fcc72af1945100e2a"
+        "6dcb88"
+    },
+    /* input_len=7169 */
+    {
+        7169,
+        "a003fc7a51754a9b3c7fae0367ab3d782dccf28855a03d435f8cfe74605e7817"
+        "98a8b20534be1ca9eb2ae2df3fae2ea60e48c6fb0b850b1385b5de0fe460dbe9"
+        "d9f9b0d8db4435da75c601156df9d047f4ede008732eb17adc05d96180f8a735"
+        "48522840779e6062d643b79478a6e8dbce68927f36ebf676ffa7d72d5f68f050"
+        "b119c8",
+        "2d81676af021129830cf3d6264781a139cbf0c141de0a4fc7db1e65b3be2720b"
+        "d214df2398b013ac0c41c6c77e738962aeb7597c89196c7d13d320ab441a4b4f"
+        "a7bb50112e08eae22c26783a4a0bdeb6270248c765ff1c62a195cde1fcd6c1e2"
+        "a6280b22e6fe7719721ed343fe754217f864cf8e2e8dc050317790630341c623"
+        "af1d67",
+        "554b0a5efea9ef183f2f9b931b7497995d9eb26f5c5c6dad2b97d62fc5ac31d9"
+        "9b20652c016d88ba2a611bbd761668d5eda3e568e940faae24b0d9991c3bd25a"
+        "65f770b89fdcadabcb3d1a9c1cb63e69721cacf1ae69fefdcef1e3ef41bc5312"
+        "ccc17222199e47a26552c6adc460cf47a72319cb5039369d0060eaea59d6c651"
+        "30f1dd"
+    },
+    /* input_len=8192 */
+    {
+        8192,
+        "aae792484c8efe4f19e2ca7d371d8c467ffb10748d8a5a1ae579948f718a2a63"
+        "5fe51a27db045a567c1ad51be5aa34c01c6651c4d9b5b5ac5d0fd58cf18dd61a"
+        "47778566b797a8c67df7b1d60b97b19288d2d877bb2df417ace009dcb0241ca1"
+        "257d62712b6a4043b4ff33f690d849da91ea3bf711ed583cb7b7a7da2839ba71"
+        "309bbf",
+        "22de17e05fe30e64cd78b8134b23c36c2af3195beb09f778c7f639275bde5221"
+        "9b4489d22c4d23850a880a3b63210d62615ca4f1f7936a415d54bfe18931b219"
+        "388db81a641f8fc82d13b0205302f56c39fcab8a80d8a58e2f8cb98557e6b6bc"
+        "9d3a61bf7c32c5bc7c2e1744ecbbd2a7628c84425399408f42ea1e187dd26fbd"
+        "51f65e",
+        "ad01d7ae4ad059b0d33baa3c01319dcf8088094d0359e5fd45d6aeaa8b2d0c3d"
+        "4c9e58958553513b67f84f8eac653aeeb02ae1d5672dcecf91cd9985a0e67f45"
+        "01910ecba25555395427ccc7241d70dc21c190e2aadee875e5aae6bf1912837e"
+        "53411dabf7a56cbf8e4fb780432b0d7fe6cec45024a0788cf5874616407757e9"
+        "e6bef7"
+    },
+    /* input_len=8193 */
+    {
+        8193,
+        "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b"
+        "b2282aa69be089359ea1154b9a9286c4a56af4de975a9aa4a5c497654914d279"
+        "bea60bb6d2cf7225a2fa0ff5ef56bbe4b149f3ed15860f78b4e2ad04e158e375"
+        "c1e0c0b551cd7dfc82f1b155c11b6b3ed51ec9edb30d133653bb5709d1dbd55f"
+        "4e1ff6",
+        "101e8566cfcde1b0051fea4da14fa7842443b549c00fa7540f51b96bddba903e"
+        "65a674880d59ab9c954567ca9b77d26810db8c77eb0451e46967812a41ed06df"
+        "c32ea65942d3d047b0bfeb569849d4398cade42d52b37db1603683329fa5f9e4"
+        "91e41f6491377783fab65b3bd6f6d5b939b92bf166cd36e46fb45dc9527f2714"
+        "9a6a55",
+        "af1e0346e389b17c23200270a64aa4e1ead98c61695d917de7d5b00491c9b0f1"
+        "2f20a01d6d622edf3de026a4db4e4526225debb93c1237934d71c7340bb59161"
+        "58cbdafe9ac3225476b6ab57a12357db3abbad7a26c6e66290e44034fb08a20a"
+        "8d0ec264f309994d2810c49cfba6989d7abb095897459f5425adb48aba07c5fb"
+        "3c83c0"
+    },
+    /* input_len=16384 */
+    {
+        16384,
+        "f875d6646de28985646f34ee13be9a576fd515f76b5b0a26bb324735041ddde4"
+        "9d764c270176e53e97bdffa58d549073f2c660be0e81293767ed4e4929f9ad34"
+        "bbb39a529334c57c4a381ffd2a6d4bfdbf1482651b172aa883cc13408fa67758"
+        "a3e47503f93f87720a3177325f7823251b85275f64636a8f1d599c2e49722f42"
+        "e93893",
+        "98c0a4584429ee8fcfea3d31ea435d0c39fd8d62a2aa5b67db8da53ea300e827"
+        "e5c5269daeee7d37cbc97e540a8811dbbd1431ad4f1ebd2a4a76ae8d704ecf4d"
+        "6b3abd4682f77ba97fec23906199875e6b9c52ab932c4d890f1aec40784e03fc"
+        "4888b4e91824e77a5d78504b33c1f57f9ba66268656a8a1f14ce706aba7587c6"
+        "5bafb0",
+        "160e18b5878cd0df1c3af85eb25a0db5344d43a6fbd7a8ef4ed98d0714c3f7e1"
+        "60dc0b1f09caa35f2f417b9ef309dfe5ebd67f4c9507995a531374d099cf8ae3"
+        "17542e885ec6f589378864d3ea98716b3bbb65ef4ab5e0ab5bb298a501f19a41"
+        "ec19af84a5e6b428ecd813b1a47ed91c9657c3fba11c406bc316768b58f6802c"
+        "9e9b57"
+    },
+    /* input_len=31744 */
+    {
+        31744,
+        "62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47"
+        "860cc51f2b0c28a7b77304bd55fe73af663c02d3f52ea053ba43431ca5bab7bf"
+        "ea2f5e9d7121770d88f70ae9649ea713087d1914f7f312147e247f87eb2d4ffe"
+        "f0ac978bf7b6579d57d533355aa20b8b77b13fd09748728a5cc327a8ec470f40"
+        "13226f",
+        "d998b28778b5f5035192dd97358bd655a7eb4faa45ee0ef2dc37d0ec5c2010aa"
+        "d4131051e562b668151d5b5f624b47e4a25b43a0c51d6e9ff23ac1fe032bdd75"
+        "28544c3de466ff891a0e4ec572f4060acddd26eaa22cb25c7bb1811cd9a4f2fb"
+        "08d5195e23151c4190598845b71373ef5122724ca5fc5a2d6015da5773608f40"
+        "143c24",
+        "39772aef80e0ebe60596361e45b061e8f417429d529171b6764468c22928e28e"
+        "9759adeb797a3fbf771b1bcea30150a020e317982bf0d6e7d14dd9f064bc1102"
+        "5c25f31e81bd78a921db0174f03dd481d30e93fd8e90f8b2fee209f849f2d2a5"
+        "2f31719a490fb0ba7aea1e09814ee912eba111a9fde9d5c274185f7bae8ba85d"
+        "300a2b"
+    },
+    /* input_len=102400 */
+    {
+        102400,
+        "bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085"
+        "e01c59dab908c04c3342b816941a26d69c2605ebee5ec5291cc55e15b76146e6"
+        "745f0601156c3596cb75065a9c57f35585a52e1ac70f69131c23d611ce11ee4a"
+        "b1ec2c009012d236648e77be9295dd0426f29b764d65de58eb7d01dd42248204"
+        "f45f8e",
+        "fd21b16880796868b13d389d1efbca0ee8fe5613230859deb51b8a332168d7cc"
+        "a8227ea82021bdc584fc176f91d2036cf23c32c70a6ca17e0a597cca55007064"
+        "4ca81dc61295b3a0bb7df966ca27140af7d0292399b734099a074326cd0ca6ea"
+        "ee56bb7a04b5138273b1cb4b2e9e9a0d6cb26b06721049aa4549830e1422e128"
+        "754381",
+        "4652cff7a3f385a6103b5c260fc1593e13c778dbe608efb092fe7ee69df6e9c6"
+        "d83a3e041bc3a48df2879f4a0a3ed40e7c961c73eff740f3117a0504c2dff478"
+        "6d44fb17f1549eb0ba585e40ec29bf7732f0b7e286ff8acddc4cb1e23b87ff5d"
+        "824a986458dcc6a04ac83969b80637562953df51ed1a7e90a7926924d2763778"
+        "be8560"
+    },
+    /* input_len=1048577 */
+    {
+        1048577,
+        "2f053cd7472cf0cd2f9adaf45c1180255b91b9a865404a63671a0ee5f792ed33"
+        "a131af9e51c941f9ffab2d9d36016ccb7a2b60195263874a1a66df85b4994d87"
+        "2bd46ac2941533a5dae91fa66dab1343d82e05117746d56acc37e5fba2ef58cd"
+        "060bd857011dd7b099798a8582a59e4c172e9e93113c38afa88ba87afd63ea88"
+        "d5f692",
+        "ae8ba43246b34800a457821f9a2204726981674700faef04f88b83717e5161f2"
+        "4404cf8864e870d08d0429d71e1935f4d199b154ea31652315b7f7d4ad296c54"
+        "b8cd9ef35a2dc90c771e1f81fc7ba725297b228ff578f1ab7bf8f582a87573a8"
+        "f3b3817155b0adcc4aa67269c65d3a06af405c068aebe5925f71384b18fba17a"
+        "684e06",
+        "e00afb385303a8c7372a0f98b54d76771aaf9770ed42115e20f77d9cb7fc778f"
+        "3c0b5f317ad6112daf2a93a6a99800f9df552e2a372e54a76597bc2a8dd804ac"
+        "f78340a3c52f6a0e9f0a62a4ab3dbd135071acd14f5cac3b5dd6c805c3717b1a"
+        "47f00aea24e93283426ee3ef42b1a2f285d78572da12997a81f7680c7302e309"
+        "57ed14"
+    },
+};